@@ -123,6 +123,20 @@ uros_err_t send_msg__std_msgs__String(
   UrosTcpRosStatus *tcpstp,
   struct msg__std_msgs__String *objp
 );
+uint8_t *serialize_msg__std_msgs__String(
+  uint8_t *bufp,
+  struct msg__std_msgs__String *objp
+);
+void serializev_msg__std_msgs__String(
+  UrosTcpRosGather *gp,
+  struct msg__std_msgs__String *objp
+);
+uros_err_t deserialize_msg__std_msgs__String(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__std_msgs__String *objp
+);
 
 /*===========================================================================*/
 /* SERVICE PROTOTYPES                                                        */
@@ -82,8 +82,8 @@ uros_err_t pub_tpc__benchmark__output(UrosTcpRosStatus *tcpstp) {
     urosMutexUnlock(&benchmark.lock);
 
     /* Send the message.*/
-    UROS_MSG_SEND_LENGTH(msgp, msg__std_msgs__String);
-    UROS_MSG_SEND_BODY(msgp, msg__std_msgs__String);
+    UROS_MSG_FRAME_LENGTH(msgp, msg__std_msgs__String);
+    UROS_MSG_SEND_FRAME(msgp, msg__std_msgs__String);
 
     urosMutexLock(&benchmark.lock);
     ++benchmark.outCount.numMsgs;
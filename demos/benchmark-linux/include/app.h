@@ -72,6 +72,16 @@ typedef struct cpucnt_t {
   unsigned long misc;           /**< @brief Remaining counters, aggregated.*/
 } cpucnt_t;
 
+/**
+ * @brief   Shared payload header.
+ * @details Precedes the characters of the payload string, which is referenced
+ *          by the published messages until their last reader releases them.
+ */
+typedef struct payload_t {
+  uros_cnt_t    refcnt;         /**< @brief References, protected by the
+                                 *          benchmark lock.*/
+} payload_t;
+
 /**
  * @brief   Benchmark status.
  */
@@ -87,6 +97,8 @@ typedef struct benchmark_t {
                                  *          <tt>/benchmark/input</tt>.*/
   uros_bool_t   hasOutSub;      /**< @brief Creates the subscriber of
                                  *          <tt>/benchmark/output</tt>.*/
+  uros_bool_t   memPoolOnly;    /**< @brief Runs the memory pool
+                                 *          microbenchmark only.*/
 
   /* Meters.*/
   cpucnt_t      curCpu;         /**< @brief Current CPU usages.*/
@@ -94,11 +106,39 @@ typedef struct benchmark_t {
   streamcnt_t   inCount;        /**< @brief Incoming stream counters.*/
   streamcnt_t   outCount;       /**< @brief Outgoing stream counters.*/
   UrosThreadId  printerId;      /**< @brief Stats printer thread.*/
+  UrosThreadId  publisherId;    /**< @brief Output publisher thread.*/
 } benchmark_t;
 
 /** @brief Stack size of the printer thread.*/
 #define PRINTER_STKLEN      (PTHREAD_STACK_MIN << 1)
 
+/** @brief Stack size of the output publisher thread.*/
+#define PUBLISHER_STKLEN    (PTHREAD_STACK_MIN << 1)
+
+/** @brief Size of the XMLRPC heap.*/
+#define XMLRPC_HEAPLEN      (4ul << 20)
+
+/** @brief Size of the TCPROS heap.*/
+#define TCPROS_HEAPLEN      (32ul << 20)
+
+/** @brief Size of the message heap.*/
+#define MSG_HEAPLEN         (16ul << 20)
+
+/** @brief Memory pool microbenchmark threads, doubled from 1 up to this.*/
+#define MEMPOOL_MAXTHREADS  8
+
+/** @brief Memory pool microbenchmark alloc/free pairs per thread.*/
+#define MEMPOOL_ITERATIONS  400000
+
+/** @brief Memory pool microbenchmark preloaded blocks.*/
+#define MEMPOOL_NUMBLOCKS   256
+
+/** @brief Memory pool microbenchmark block size.*/
+#define MEMPOOL_BLOCKSIZE   64
+
+/** @brief Stack size of the memory pool microbenchmark threads.*/
+#define MEMPOOL_STKLEN      PTHREAD_STACK_MIN
+
 /** @brief Skips incoming data in handlers.*/
 #define HANDLERS_INPUT_SKIP 1
 
@@ -121,8 +161,12 @@ extern "C" {
 #endif
 
 uros_err_t app_printer_thread(void* argp);
+uros_err_t app_publisher_thread(void *argp);
+char *app_payload_new(size_t length);
+void app_payload_release(UrosString *payloadp);
 void app_printusage(void);
 uros_bool_t app_parseargs(int argc, char *argv[]);
+void app_mempool_benchmark(void);
 void app_initialize(void);
 void app_wait_exit(void);
 
@@ -52,9 +52,7 @@ extern "C" {
 /* PUBLISHED TOPIC PROTOTYPES                                                */
 /*===========================================================================*/
 
-/*~~~ PUBLISHED TOPIC: /benchmark/output ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-
-uros_err_t pub_tpc__benchmark__output(UrosTcpRosStatus *tcpstp);
+/* The /benchmark/output messages are published by app_publisher_thread().*/
 
 /*===========================================================================*/
 /* SUBSCRIBED TOPIC PROTOTYPES                                               */
@@ -62,11 +60,14 @@ uros_err_t pub_tpc__benchmark__output(UrosTcpRosStatus *tcpstp);
 
 /*~~~ SUBSCRIBED TOPIC: /benchmark/input ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-uros_err_t sub_tpc__benchmark__input(UrosTcpRosStatus *tcpstp);
+uros_err_t sub_frm__benchmark__input(UrosTcpRosStatus *tcpstp,
+                                     const uint8_t *framep, size_t framelen);
 
 /*~~~ SUBSCRIBED TOPIC: /benchmark/output ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 uros_err_t sub_tpc__benchmark__output(UrosTcpRosStatus *tcpstp);
+uros_err_t sub_msg__benchmark__output(UrosTcpRosStatus *tcpstp,
+                                      const void *msgp);
 
 /*===========================================================================*/
 /* PUBLISHED SERVICE PROTOTYPES                                              */
@@ -78,6 +78,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /** @brief Node thread stack size.*/
 #define UROS_NODE_THREAD_STKSIZE            (PTHREAD_STACK_MIN << 1)
 
+/** @brief Master calls batched into a single multicall, @p 0 to disable.*/
+#define UROS_NODE_MULTICALL_LENGTH          8
+
+/** @brief Cached service providers, @p 0 to disable.*/
+#define UROS_NODE_SRVCACHE_LENGTH           8
+
+/** @brief Cached service provider lifetime, in milliseconds.*/
+#define UROS_NODE_SRVCACHE_TTL              5000
+
 /** @} */
 /** @} */
 
@@ -205,6 +214,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /** @brief TCPROS Client thread stack size.*/
 #define UROS_TCPROS_CLIENT_STKSIZE          (PTHREAD_STACK_MIN << 1)
 
+/** @brief Publisher connections waiting for a TCPROS Client thread.*/
+#define UROS_TCPROS_CLIENT_PENDING          32
+
 /** @} */
 
 /*~~~ SERVER CONFIGURATION ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -221,6 +233,48 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /** @brief TCPROS server thread stack size.*/
 #define UROS_TCPROS_SERVER_STKSIZE          (PTHREAD_STACK_MIN << 1)
 
+/** @brief Persistent service links served at once, below the pool size.*/
+#define UROS_TCPROS_MAXPERSISTENT           2
+
+/** @} */
+
+/*~~~ REACTOR CONFIGURATION ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/** @name TCPROS reactor configuration */
+/** @{ */
+
+/** @brief Multiplexes @p reactor and fan-out topic links onto reactor threads.*/
+#define UROS_TCPROS_USE_REACTOR             1
+
+/** @brief TCPROS reactor thread count.*/
+#define UROS_TCPROS_REACTOR_THREADS         2
+
+/** @brief TCPROS reactor thread priority.*/
+#define UROS_TCPROS_REACTOR_PRIO            60
+
+/** @brief TCPROS reactor thread stack size.*/
+#define UROS_TCPROS_REACTOR_STKSIZE         (PTHREAD_STACK_MIN << 1)
+
+/** @} */
+
+/*~~~ FAN-OUT CONFIGURATION ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/** @name TCPROS fan-out configuration */
+/** @{ */
+
+/** @brief Frames held by the fan-out ring of a topic, as a power of two.*/
+#define UROS_TCPROS_FANOUT_LENGTH           8
+
+/** @} */
+
+/*~~~ MESSAGE ARENA CONFIGURATION ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/** @name TCPROS message arena configuration */
+/** @{ */
+
+/** @brief Alignment of the message arena allocations, as a power of two.*/
+#define UROS_TCPROS_ARENA_ALIGN             8
+
 /** @} */
 
 /*~~~ MISC OPTIONS `~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -231,6 +285,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /** @brief Reads the message definition, instead of skipping it.*/
 #define UROS_TCPROS_USE_MSGDEF              0
 
+/** @brief Maximum length of a received message, in bytes.*/
+#define UROS_TCPROS_MAXMSGLEN               0x100000UL
+
+/** @brief Minimum length of a payload sent without being copied, in bytes.*/
+#define UROS_TCPROS_GATHER_MINLEN           256
+
+/** @brief Maximum number of chunks of a gathered frame.*/
+#define UROS_TCPROS_GATHER_LENGTH           8
+
 /** @} */
 
 /** @name TCPROS timeouts configuration */
@@ -245,6 +308,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /** @} */
 /** @} */
 
+/*===========================================================================*/
+/* UDPROS CONFIGURATION                                                      */
+/*===========================================================================*/
+
+/** @addtogroup udpros_config */
+/** @{ */
+
+/** @brief Maximum UDPROS datagram size, including the datagram header.*/
+#define UROS_UDPROS_DGRAMSIZE               (UROS_MTU_SIZE - 28)
+
+/** @} */
+
 /*===========================================================================*/
 /* INTERNAL MODULES CONFIGURATION                                            */
 /*===========================================================================*/
@@ -252,26 +327,40 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /** @addtogroup rpc_config */
 /** @{ */
 
-/*~~~ XMLRPC PARSER OPTIONS ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+/*~~~ XMLRPC CALL OPTIONS ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-/** @name XMLRPC parser configuration */
+/** @name XMLRPC call configuration */
 /** @{ */
 
-/** @brief Default length of the reading buffer.*/
-#define UROS_RPCPARSER_RDBUFLEN             256
+/** @brief Kept-alive XMLRPC client connections, @p 0 to disable.*/
+#define UROS_RPCCALL_KEEPALIVE_SLOTS        4
 
-/** @brief Reads the status message, instead of skipping it.*/
-#define UROS_RPCPARSER_USE_STATMSG          0
+/** @brief Asynchronous XMLRPC call threads, @p 0 to call synchronously.*/
+#define UROS_RPCCALL_ASYNC_THREADS          2
+
+/** @brief Asynchronous XMLRPC call thread priority.*/
+#define UROS_RPCCALL_ASYNC_PRIO             UROS_XMLRPC_SLAVE_PRIO
+
+/** @brief Asynchronous XMLRPC call thread stack size.*/
+#define UROS_RPCCALL_ASYNC_STKSIZE          UROS_XMLRPC_SLAVE_STKSIZE
+
+/** @brief Preallocated XMLRPC call contexts and buffers.*/
+#define UROS_RPCCALL_POOLSIZE               (1 + UROS_XMLRPC_SLAVE_POOLSIZE + \
+                                             UROS_RPCCALL_ASYNC_THREADS + \
+                                             UROS_RPCCALL_KEEPALIVE_SLOTS)
 
 /** @} */
 
-/*~~~ XMLRPC STREAMER OPTIONS ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+/*~~~ XMLRPC PARSER OPTIONS ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-/** @name XMLRPC streamer configuration */
+/** @name XMLRPC parser configuration */
 /** @{ */
 
-/** @brief Fixed Content-Length, when the message spans more packets.*/
-#define UROS_RPCSTREAMER_FIXLEN             4000
+/** @brief Default length of the reading buffer.*/
+#define UROS_RPCPARSER_RDBUFLEN             256
+
+/** @brief Reads the status message, instead of skipping it.*/
+#define UROS_RPCPARSER_USE_STATMSG          0
 
 /** @} */
 /** @} */
@@ -305,6 +394,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /** @brief Uses the built-in memory pool.*/
 #define UROS_USE_BUILTIN_MEMPOOL            1
 
+/** @brief Free lists of each built-in memory pool, to reduce contention.*/
+#define UROS_MEMPOOL_STRIPES                8
+
+/** @brief Buckets of the string intern table.*/
+#define UROS_STRINTERN_BUCKETS              64
+
+/** @brief Heap of the XMLRPC subsystem, default if @p NULL.*/
+#define UROS_XMLRPC_HEAP                    (&xmlrpcHeap)
+
+/** @brief Heap of the TCPROS frame buffers, default if @p NULL.*/
+#define UROS_TCPROS_HEAP                    (&tcprosHeap)
+
+/** @brief Heap of the received message contents, default if @p NULL.*/
+#define UROS_MSG_HEAP                       (&msgHeap)
+
 /** @brief Enables assertion evaluations.*/
 #define UROS_USE_ASSERT                     0
 
@@ -342,6 +446,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /** @brief Enables assertions for <tt>urosTcpRos.c</tt>.*/
 #define UROS_TCPROS_C_USE_ASSERT            1
 
+/** @brief Enables assertions for <tt>urosUdpRos.c</tt>.*/
+#define UROS_UDPROS_C_USE_ASSERT            1
+
 /** @brief Enables assertions for <tt>urosThreading.c</tt>.*/
 #define UROS_THREADING_C_USE_ASSERT         1
 
@@ -376,6 +483,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /** @brief Enables error messages for <tt>urosTcpRos.c</tt>.*/
 #define UROS_TCPROS_C_USE_ERROR_MSG         1
 
+/** @brief Enables error messages for <tt>urosUdpRos.c</tt>.*/
+#define UROS_UDPROS_C_USE_ERROR_MSG         1
+
 /** @brief Enables error messages for <tt>urosThreading.c</tt>.*/
 #define UROS_THREADING_C_USE_ERROR_MSG      1
 
@@ -415,8 +525,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /** @brief Error type, compatible with thread return type.*/
 typedef int             uros_err_t;
 
-/** @brief Heap type.*/
-typedef void            UrosMemHeap;
+/** @brief Heap type, platform-dependent.*/
+#include "lld/posix/uros_lld_heap.h"
+
+/** @brief Subsystem heaps, initialized by the application.*/
+extern UrosMemHeap xmlrpcHeap, tcprosHeap, msgHeap;
 
 /** @brief Memory pool type, platform-dependent.*/
 struct UrosMemPool;
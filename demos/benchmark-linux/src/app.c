@@ -34,6 +34,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "app.h"
 
+#include "urosMsgTypes.h"
+
 #include <stdio.h>
 #include <urosNode.h>
 #include <sys/time.h>
@@ -52,6 +54,21 @@ benchmark_t benchmark;
 /** @brief Printer thread stack.*/
 static UROS_STACK(printerstack, PRINTER_STKLEN);
 
+/** @brief Output publisher thread stack.*/
+static UROS_STACK(publisherstack, PUBLISHER_STKLEN);
+
+/** @brief XMLRPC subsystem heap.*/
+UrosMemHeap xmlrpcHeap;
+static double xmlrpcheapbuf[XMLRPC_HEAPLEN / sizeof(double)];
+
+/** @brief TCPROS frame buffers heap.*/
+UrosMemHeap tcprosHeap;
+static double tcprosheapbuf[TCPROS_HEAPLEN / sizeof(double)];
+
+/** @brief Received message contents heap.*/
+UrosMemHeap msgHeap;
+static double msgheapbuf[MSG_HEAPLEN / sizeof(double)];
+
 /*===========================================================================*/
 /* GLOBAL FUNCTIONS                                                          */
 /*===========================================================================*/
@@ -113,6 +130,20 @@ void app_print_cpu_usage(void) {
          (unsigned long)time.tv_sec, (unsigned long)time.tv_nsec);
 }
 
+void app_print_heap_state(const char *namep, UrosMemHeap *heapp) {
+
+  UrosMemHeapStats stats;
+
+  urosMemHeapStats(heapp, &stats);
+  printf("HEAP: %s used: %lu peak: %lu free: %lu frag: %lu fails: %lu\n",
+         namep,
+         (unsigned long)stats.used,
+         (unsigned long)stats.peak,
+         (unsigned long)stats.free,
+         (unsigned long)stats.fragmented,
+         (unsigned long)stats.numFails);
+}
+
 void app_print_thread_state(pthread_t threadId) {
 
   char namebuf[32];
@@ -140,30 +171,37 @@ void app_print_thread_state(pthread_t threadId) {
          namebuf);
 }
 
-uros_err_t app_printer_thread(void* argp) {
+uros_bool_t app_wait_running(void) {
 
   static UrosNodeStatus *const stp = &urosNode.status;
 
-  unsigned long oldTime, curTime, winTime, logentry = 0;
-  streamcnt_t inCount, outCount;
-  uros_cnt_t i;
-  int err; (void)err;
-  (void)argp;
-
   /* Wait until all of the threads exist.*/
   do {
     urosMutexLock(&stp->stateLock);
     if (stp->exitFlag) {
       urosMutexUnlock(&stp->stateLock);
-      return UROS_OK;
+      return UROS_FALSE;
     }
     if (stp->state == UROS_NODE_RUNNING) {
       urosMutexUnlock(&stp->stateLock);
-      break;
+      return UROS_TRUE;
     }
     urosMutexUnlock(&stp->stateLock);
     urosThreadSleepMsec(20);
   } while (UROS_TRUE);
+}
+
+uros_err_t app_printer_thread(void* argp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  unsigned long oldTime, curTime, winTime, logentry = 0;
+  streamcnt_t inCount, outCount;
+  uros_cnt_t i;
+  int err; (void)err;
+  (void)argp;
+
+  if (!app_wait_running()) { return UROS_OK; }
 
   oldTime = urosGetTimestampMsec() - 1;
   urosMutexLock(&stp->stateLock);
@@ -201,6 +239,11 @@ uros_err_t app_printer_thread(void* argp) {
     app_print_cpu_state();
     app_print_cpu_usage();
 
+    /* Subsystem heaps.*/
+    app_print_heap_state("xmlrpc", &xmlrpcHeap);
+    app_print_heap_state("tcpros", &tcprosHeap);
+    app_print_heap_state("msg", &msgHeap);
+
     /* Printer and Node thread.*/
     app_print_thread_state(pthread_self());
 
@@ -263,15 +306,105 @@ uros_err_t app_printer_thread(void* argp) {
   return UROS_OK;
 }
 
+char *app_payload_new(size_t length) {
+
+  payload_t *hdrp;
+
+  hdrp = (payload_t*)urosAlloc(NULL, sizeof(payload_t) + length);
+  if (hdrp == NULL) { return NULL; }
+  hdrp->refcnt = 1;
+  return (char*)(hdrp + 1);
+}
+
+void app_payload_release(UrosString *payloadp) {
+
+  payload_t *hdrp;
+
+  /* The benchmark lock must be held.*/
+  if (payloadp->datap != NULL) {
+    hdrp = (payload_t*)payloadp->datap - 1;
+    if (--hdrp->refcnt == 0) {
+      urosFree(hdrp);
+    }
+  }
+  urosStringObjectInit(payloadp);
+}
+
+void app_output_delete(void *msgp) {
+
+  /* Called when the last reader releases the message.*/
+  urosMutexLock(&benchmark.lock);
+  app_payload_release(&((struct msg__std_msgs__String *)msgp)->data);
+  urosMutexUnlock(&benchmark.lock);
+  urosFree(msgp);
+}
+
+uros_err_t app_publisher_thread(void *argp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+  static const UrosString outputname = { 17, "/benchmark/output" };
+
+  struct msg__std_msgs__String *msgp;
+  uint32_t rate;
+  size_t length;
+  uros_err_t err;
+  (void)argp;
+
+  if (!app_wait_running()) { return UROS_OK; }
+
+  urosMutexLock(&stp->stateLock);
+  while (!stp->exitFlag) {
+    urosMutexUnlock(&stp->stateLock);
+
+    /* Share the payload with the new message, instead of copying it.*/
+    msgp = urosNew(NULL, struct msg__std_msgs__String);
+    urosAssert(msgp != NULL);
+    init_msg__std_msgs__String(msgp);
+    urosMutexLock(&benchmark.lock);
+    msgp->data = benchmark.payload;
+    if (msgp->data.datap != NULL) {
+      ++((payload_t*)msgp->data.datap - 1)->refcnt;
+    }
+    rate = benchmark.rate;
+    urosMutexUnlock(&benchmark.lock);
+    length = 2 * sizeof(uint32_t) + msgp->data.length;
+
+    /* Local subscribers get the object, the others a single frame.*/
+    err = urosNodePublishShared(
+      &outputname, msgp,
+      (uros_msglen_f)length_msg__std_msgs__String,
+      (uros_msgser_f)serialize_msg__std_msgs__String,
+      app_output_delete
+    );
+    if (err == UROS_OK) {
+      urosMutexLock(&benchmark.lock);
+      ++benchmark.outCount.numMsgs;
+      benchmark.outCount.numBytes += length;
+      ++benchmark.outCount.deltaMsgs;
+      benchmark.outCount.deltaBytes += length;
+      urosMutexUnlock(&benchmark.lock);
+    }
+
+    /* No delay, to achieve the maximum throughput (beware: it may hang up).*/
+    if (rate > 0) {
+      urosThreadSleepUsec(1000000ul / rate);
+    }
+    urosMutexLock(&stp->stateLock);
+  }
+  urosMutexUnlock(&stp->stateLock);
+  return UROS_OK;
+}
+
 void app_printusage(void) {
 
   puts("Usage:");
-  puts("  benchmark <[o][p][s]>");
+  puts("  benchmark <[o][p][s]|m>");
   puts("");
   puts("Options:");
   puts("  o   Creates the /benchmark/output subscriber (default off)");
   puts("  p   Creates the /benchmark/output publisher (default on)");
   puts("  s   Creates the /benchmark/input subscriber (default on)");
+  puts("  m   Runs the memory pool microbenchmark only, then exits");
   puts("");
 }
 
@@ -291,6 +424,7 @@ uros_bool_t app_parseargs(int argc, char *argv[]) {
       case 'p': benchmark.hasOutPub = UROS_TRUE; break;
       case 's': benchmark.hasInSub = UROS_TRUE; break;
       case 'o': benchmark.hasOutSub = UROS_TRUE; break;
+      case 'm': benchmark.memPoolOnly = UROS_TRUE; break;
       default:
         printf("Invalid option: %c\n\n", argv[1][i]);
         return UROS_FALSE;
@@ -304,6 +438,61 @@ uros_bool_t app_parseargs(int argc, char *argv[]) {
   return UROS_TRUE;
 }
 
+uros_err_t app_mempool_thread(void *argp) {
+
+  UrosMemPool *poolp = (UrosMemPool *)argp;
+  void *blockp[2];
+  unsigned long i;
+
+  for (i = 0; i < MEMPOOL_ITERATIONS; ++i) {
+    blockp[0] = urosMemPoolAlloc(poolp);
+    blockp[1] = urosMemPoolAlloc(poolp);
+    urosAssert(blockp[0] != NULL && blockp[1] != NULL);
+    urosMemPoolFree(poolp, blockp[1]);
+    urosMemPoolFree(poolp, blockp[0]);
+  }
+  return UROS_OK;
+}
+
+void app_mempool_benchmark(void) {
+
+  static struct {
+    void    *reservedp;
+    uint8_t payload[MEMPOOL_BLOCKSIZE];
+  } blocks[MEMPOOL_NUMBLOCKS];
+
+  UrosMemPool pool;
+  UrosThreadId threadIds[MEMPOOL_MAXTHREADS];
+  unsigned long startTime, winTime;
+  unsigned numThreads, i;
+  uros_err_t err;
+  (void)err;
+
+  urosMemPoolObjectInit(&pool, MEMPOOL_BLOCKSIZE, NULL);
+  urosMemPoolLoadArray(&pool, blocks, MEMPOOL_NUMBLOCKS);
+
+  /* Each operation is an allocation or a deallocation.*/
+  for (numThreads = 1; numThreads <= MEMPOOL_MAXTHREADS; numThreads <<= 1) {
+    startTime = urosGetTimestampMsec();
+    for (i = 0; i < numThreads; ++i) {
+      err = urosThreadCreateFromHeap(&threadIds[i], "mempool", 50,
+                                     app_mempool_thread, &pool,
+                                     MEMPOOL_STKLEN);
+      urosAssert(err == UROS_OK);
+    }
+    for (i = 0; i < numThreads; ++i) {
+      urosThreadJoin(threadIds[i]);
+    }
+    winTime = urosGetTimestampMsec() - startTime;
+    if (winTime == 0) { winTime = 1; }
+    printf("MEMPOOL: stripes: %u threads: %u %lu op/s free: %lu\n",
+           (unsigned)UROS_MEMPOOL_STRIPES, numThreads,
+           (unsigned long)((4000 * (uint64_t)MEMPOOL_ITERATIONS * numThreads)
+                           / winTime),
+           (unsigned long)urosMemPoolNumFree(&pool));
+  }
+}
+
 void app_initialize(void) {
 
   uros_err_t err;
@@ -317,6 +506,10 @@ void app_initialize(void) {
   memset(&benchmark.curCpu, 0, sizeof(cpucnt_t));
   memset(&benchmark.oldCpu, 0, sizeof(cpucnt_t));
 
+  urosMemHeapObjectInit(&xmlrpcHeap, xmlrpcheapbuf, sizeof(xmlrpcheapbuf));
+  urosMemHeapObjectInit(&tcprosHeap, tcprosheapbuf, sizeof(tcprosheapbuf));
+  urosMemHeapObjectInit(&msgHeap, msgheapbuf, sizeof(msgheapbuf));
+
   urosInit();
   urosNodeCreateThread();
 
@@ -324,10 +517,20 @@ void app_initialize(void) {
                                app_printer_thread, NULL, printerstack,
                                PRINTER_STKLEN);
   urosAssert(err == UROS_OK);
+
+  if (benchmark.hasOutPub) {
+    err = urosThreadCreateStatic(&benchmark.publisherId, "publisher", 50,
+                                 app_publisher_thread, NULL, publisherstack,
+                                 PUBLISHER_STKLEN);
+    urosAssert(err == UROS_OK);
+  }
 }
 
 void app_wait_exit(void) {
 
+  if (benchmark.hasOutPub) {
+    urosThreadJoin(benchmark.publisherId);
+  }
   urosThreadJoin(benchmark.printerId);
   urosThreadJoin(urosNode.status.nodeThreadId);
 }
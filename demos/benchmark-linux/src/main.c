@@ -46,6 +46,10 @@ int main (int argc, char *argv[]) {
     app_printusage();
     return 1;
   }
+  if (benchmark.memPoolOnly) {
+    app_mempool_benchmark();
+    return 0;
+  }
 
   app_initialize();
   app_wait_exit();
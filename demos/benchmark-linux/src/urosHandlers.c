@@ -53,59 +53,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /** @addtogroup tcpros_pubtopic_funcs */
 /** @{ */
 
-/*~~~ PUBLISHED TOPIC: /benchmark/output ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-
-/** @name Topic <tt>/benchmark/output</tt> publisher */
-/** @{ */
-
-/**
- * @brief   TCPROS <tt>/benchmark/output</tt> published topic handler.
- *
- * @param[in,out] tcpstp
- *          Pointer to a working @p UrosTcpRosStatus object.
- * @return
- *          Error code.
- */
-uros_err_t pub_tpc__benchmark__output(UrosTcpRosStatus *tcpstp) {
-
-  uint32_t rate;
-
-  /* Message allocation and initialization.*/
-  UROS_TPC_INIT_H(msg__std_msgs__String);
-
-  /* Published messages loop.*/
-  while (!urosTcpRosStatusCheckExit(tcpstp)) {
-    /* Assign the string chunk.*/
-    urosMutexLock(&benchmark.lock);
-    msgp->data = benchmark.payload;
-    rate = benchmark.rate;
-    urosMutexUnlock(&benchmark.lock);
-
-    /* Send the message.*/
-    UROS_MSG_SEND_LENGTH(msgp, msg__std_msgs__String);
-    UROS_MSG_SEND_BODY(msgp, msg__std_msgs__String);
-
-    urosMutexLock(&benchmark.lock);
-    ++benchmark.outCount.numMsgs;
-    benchmark.outCount.numBytes += 2 * sizeof(uint32_t) + msgp->data.length;
-    ++benchmark.outCount.deltaMsgs;
-    benchmark.outCount.deltaBytes += 2 * sizeof(uint32_t) + msgp->data.length;
-    urosMutexUnlock(&benchmark.lock);
-
-    /* No delay, to achieve the maximum throughput (beware: it may hang up).*/
-    if (rate > 0) {
-      urosThreadSleepUsec(1000000ul / rate);
-    }
-  }
-  tcpstp->err = UROS_OK;
-
-_finally:
-  /* Message deinitialization and deallocation.*/
-  UROS_TPC_UNINIT_H(msg__std_msgs__String);
-  return tcpstp->err;
-}
-
-/** @} */
+/* The /benchmark/output messages are published by app_publisher_thread().*/
 
 /** @} */
 
@@ -122,44 +70,47 @@ _finally:
 /** @{ */
 
 /**
- * @brief   TCPROS <tt>/benchmark/input</tt> subscribed topic handler.
+ * @brief   TCPROS <tt>/benchmark/input</tt> subscribed topic frame handler.
+ * @details Called by a reactor thread for each received message.
  *
  * @param[in,out] tcpstp
  *          Pointer to a working @p UrosTcpRosStatus object.
+ * @param[in] framep
+ *          Pointer to the message frame body.
+ * @param[in] framelen
+ *          Length of the message frame body, in bytes.
  * @return
  *          Error code.
  */
-uros_err_t sub_tpc__benchmark__input(UrosTcpRosStatus *tcpstp) {
+uros_err_t sub_frm__benchmark__input(UrosTcpRosStatus *tcpstp,
+                                     const uint8_t *framep, size_t framelen) {
 
-  /* Message allocation and initialization.*/
-  UROS_TPC_INIT_H(msg__std_msgs__String);
+  /* Message initialization.*/
+  UROS_FRM_INIT_S(msg__std_msgs__String);
 
-  /* Subscribed messages loop.*/
-  while (!urosTcpRosStatusCheckExit(tcpstp)) {
-    /* Receive the next message.*/
-    UROS_MSG_RECV_LENGTH();
 #if HANDLERS_INPUT_SKIP
-    msgp->data.length = msglen - sizeof(uint32_t);
-    if (urosTcpRosSkip(tcpstp, msglen) != UROS_OK) { goto _finally; }
+  (void)framep;
+  if (framelen < sizeof(uint32_t)) {
+    tcpstp->err = UROS_ERR_BADPARAM;
+    goto _finally;
+  }
+  msg.data.length = framelen - sizeof(uint32_t);
 #else
-    UROS_MSG_RECV_BODY(msgp, msg__std_msgs__String);
+  /* The contents of the previous message are recycled by the arena.*/
+  UROS_MSG_DECODE_FRAME(&msg, msg__std_msgs__String);
 #endif
 
-    urosMutexLock(&benchmark.lock);
-    ++benchmark.inCount.numMsgs;
-    benchmark.inCount.numBytes += 2 * sizeof(uint32_t) + msgp->data.length;
-    ++benchmark.inCount.deltaMsgs;
-    benchmark.inCount.deltaBytes += 2 * sizeof(uint32_t) + msgp->data.length;
-    urosMutexUnlock(&benchmark.lock);
-
-    /* Dispose the contents of the message.*/
-    clean_msg__std_msgs__String(msgp);
-  }
+  urosMutexLock(&benchmark.lock);
+  ++benchmark.inCount.numMsgs;
+  benchmark.inCount.numBytes += 2 * sizeof(uint32_t) + msg.data.length;
+  ++benchmark.inCount.deltaMsgs;
+  benchmark.inCount.deltaBytes += 2 * sizeof(uint32_t) + msg.data.length;
+  urosMutexUnlock(&benchmark.lock);
   tcpstp->err = UROS_OK;
 
 _finally:
-  /* Message deinitialization and deallocation.*/
-  UROS_TPC_UNINIT_H(msg__std_msgs__String);
+  /* Message deinitialization, its contents belong to the arena.*/
+  UROS_TPC_UNINIT_ARENA_S();
   return tcpstp->err;
 }
 
@@ -187,19 +138,37 @@ uros_err_t sub_tpc__benchmark__output(UrosTcpRosStatus *tcpstp) {
   while (!urosTcpRosStatusCheckExit(tcpstp)) {
     /* Receive the next message.*/
     UROS_MSG_RECV_LENGTH();
-    UROS_MSG_RECV_BODY(msgp, msg__std_msgs__String);
-
-    /* Dispose the contents of the message.*/
-    clean_msg__std_msgs__String(msgp);
+    UROS_MSG_RECV_BODY_ARENA(msgp, msg__std_msgs__String);
   }
   tcpstp->err = UROS_OK;
 
 _finally:
-  /* Message deinitialization and deallocation.*/
-  UROS_TPC_UNINIT_H(msg__std_msgs__String);
+  /* Message deallocation, its contents belong to the arena.*/
+  UROS_TPC_UNINIT_ARENA_H();
   return tcpstp->err;
 }
 
+/**
+ * @brief   <tt>/benchmark/output</tt> shared message handler.
+ * @details Gets the messages published by this very node, as objects.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to the TCPROS status of the intra-process link.
+ * @param[in] msgp
+ *          Pointer to the shared message object.
+ * @return
+ *          Error code.
+ */
+uros_err_t sub_msg__benchmark__output(UrosTcpRosStatus *tcpstp,
+                                      const void *msgp) {
+
+  (void)tcpstp;
+  (void)msgp;
+
+  /* The message is just consumed.*/
+  return UROS_OK;
+}
+
 /** @} */
 
 /** @} */
@@ -241,11 +210,15 @@ void urosHandlersPublishTopics(void) {
 
   /* /benchmark/output */
   if (benchmark.hasOutPub) {
+    uros_topicflags_t flags = uros_nulltopicflags;
+
+    /* Fed by app_publisher_thread(), at the pace of the slowest link.*/
+    flags.blocking = UROS_TRUE;
     urosNodePublishTopicSZ(
       "/benchmark/output",
       "std_msgs/String",
-      (uros_proc_f)pub_tpc__benchmark__output,
-      uros_nulltopicflags
+      NULL,
+      flags
     );
   }
 }
@@ -272,20 +245,21 @@ void urosHandlersSubscribeTopics(void) {
 
   /* /benchmark/input */
   if (benchmark.hasInSub) {
-    urosNodeSubscribeTopicSZ(
+    urosNodeSubscribeTopicFramesSZ(
       "/benchmark/input",
       "std_msgs/String",
-      (uros_proc_f)sub_tpc__benchmark__input,
+      sub_frm__benchmark__input,
       uros_nulltopicflags
     );
   }
 
   /* /benchmark/output */
   if (benchmark.hasOutSub) {
-    urosNodeSubscribeTopicSZ(
+    urosNodeSubscribeTopicSharedSZ(
       "/benchmark/output",
       "std_msgs/String",
       (uros_proc_f)sub_tpc__benchmark__output,
+      sub_msg__benchmark__output,
       uros_nulltopicflags
     );
   }
@@ -306,11 +280,8 @@ void urosHandlersUnsubscribeTopics(void) {
 
   /* /benchmark/output */
   if (benchmark.hasOutSub) {
-    urosNodeSubscribeTopicSZ(
-      "/benchmark/output",
-      "std_msgs/String",
-      (uros_proc_f)sub_tpc__benchmark__output,
-      uros_nulltopicflags
+    urosNodeUnsubscribeTopicSZ(
+      "/benchmark/output"
     );
   }
 }
@@ -180,6 +180,89 @@ uros_err_t send_msg__std_msgs__String(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>std_msgs/String</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__std_msgs__String()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__std_msgs__String</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__std_msgs__String(
+  uint8_t *bufp,
+  struct msg__std_msgs__String *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutString(bufp, &objp->data);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>std_msgs/String</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__std_msgs__String()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__std_msgs__String</code> object.
+ */
+void serializev_msg__std_msgs__String(
+  UrosTcpRosGather *gp,
+  struct msg__std_msgs__String *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  urosTcpRosGatherString(gp, &objp->data);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>std_msgs/String</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__std_msgs__String</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__std_msgs__String(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__std_msgs__String *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->data); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__std_msgs__String(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /** @} */
@@ -441,13 +441,13 @@ uros_err_t urosUserParamUpdate(const UrosString *keyp,
 
     urosAssert(paramp->class == UROS_RPCP_INT);
     urosMutexLock(&benchmark.lock);
-    urosStringClean(&benchmark.payload);
+    /* Messages still referencing the old payload keep it alive.*/
+    app_payload_release(&benchmark.payload);
     urosAssert(paramp->value.int32 >= 0);
     urosAssert(paramp->value.int32 < 100 * (1 << (20 - 3)));
     benchmark.payload.length = (uint32_t)paramp->value.int32;
     if (benchmark.payload.length > 0) {
-      benchmark.payload.datap = urosArrayNew(NULL, benchmark.payload.length,
-                                             char);
+      benchmark.payload.datap = app_payload_new(benchmark.payload.length);
       for (i = 0; i < benchmark.payload.length; ++i) {
         benchmark.payload.datap[i] = hex[i & 0x0F];
       }
@@ -252,16 +252,6 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /** @brief Reads the status message, instead of skipping it.*/
 #define UROS_RPCPARSER_USE_STATMSG          0
 
-/** @} */
-
-/*~~~ XMLRPC STREAMER OPTIONS ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-
-/** @name XMLRPC streamer configuration */
-/** @{ */
-
-/** @brief Fixed Content-Length, when the message spans more packets.*/
-#define UROS_RPCSTREAMER_FIXLEN             4000
-
 /** @} */
 /** @} */
 
@@ -89,8 +89,8 @@ uros_err_t pub_tpc__rosout(UrosTcpRosStatus *tcpstp) {
     msgp->header.frame_id.datap = "0";
 
     /* Send the message.*/
-    UROS_MSG_SEND_LENGTH(msgp, msg__rosgraph_msgs__Log);
-    UROS_MSG_SEND_BODY(msgp, msg__rosgraph_msgs__Log);
+    UROS_MSG_FRAME_LENGTH(msgp, msg__rosgraph_msgs__Log);
+    UROS_MSG_SEND_FRAME(msgp, msg__rosgraph_msgs__Log);
 
     /* Deallocate the message if not constant.*/
     if (!constant) {
@@ -136,8 +136,8 @@ uros_err_t pub_tpc__turtleX__color_sensor(UrosTcpRosStatus *tcpstp) {
     urosMutexUnlock(&backgroundColorLock);
 
     /* Send the message.*/
-    UROS_MSG_SEND_LENGTH(msgp, msg__turtlesim__Color);
-    UROS_MSG_SEND_BODY(msgp, msg__turtlesim__Color);
+    UROS_MSG_FRAME_LENGTH(msgp, msg__turtlesim__Color);
+    UROS_MSG_SEND_FRAME(msgp, msg__turtlesim__Color);
 
     /* Dispose the contents of the message.*/
     clean_msg__turtlesim__Color(msgp);
@@ -196,8 +196,8 @@ uros_err_t pub_tpc__turtleX__pose(UrosTcpRosStatus *tcpstp) {
     urosMutexUnlock(&turtlep->lock);
 
     /* Send the message.*/
-    UROS_MSG_SEND_LENGTH(msgp, msg__turtlesim__Pose);
-    UROS_MSG_SEND_BODY(msgp, msg__turtlesim__Pose);
+    UROS_MSG_FRAME_LENGTH(msgp, msg__turtlesim__Pose);
+    UROS_MSG_SEND_FRAME(msgp, msg__turtlesim__Pose);
 
     /* Dispose the contents of the message.*/
     clean_msg__turtlesim__Pose(msgp);
@@ -328,8 +328,8 @@ uros_err_t pub_srv__clear(UrosTcpRosStatus *tcpstp) {
 
     /* Send the response message.*/
     UROS_SRV_SEND_OKBYTE_ERRSTR();
-    UROS_MSG_SEND_LENGTH(outmsgp, out_srv__std_srvs__Empty);
-    UROS_MSG_SEND_BODY(outmsgp, out_srv__std_srvs__Empty);
+    UROS_MSG_FRAME_LENGTH(outmsgp, out_srv__std_srvs__Empty);
+    UROS_MSG_SEND_FRAME(outmsgp, out_srv__std_srvs__Empty);
 
     /* Dispose the contents of the response message.*/
     clean_out_srv__std_srvs__Empty(outmsgp);
@@ -389,8 +389,8 @@ uros_err_t pub_srv__kill(UrosTcpRosStatus *tcpstp) {
 
     /* Send the response message.*/
     UROS_SRV_SEND_OKBYTE_ERRSTR();
-    UROS_MSG_SEND_LENGTH(outmsgp, out_srv__turtlesim__Kill);
-    UROS_MSG_SEND_BODY(outmsgp, out_srv__turtlesim__Kill);
+    UROS_MSG_FRAME_LENGTH(outmsgp, out_srv__turtlesim__Kill);
+    UROS_MSG_SEND_FRAME(outmsgp, out_srv__turtlesim__Kill);
 
   tcpstp->err = UROS_OK;
 
@@ -453,8 +453,8 @@ uros_err_t pub_srv__spawn(UrosTcpRosStatus *tcpstp) {
 
     /* Send the response message.*/
     UROS_SRV_SEND_OKBYTE_ERRSTR();
-    UROS_MSG_SEND_LENGTH(outmsgp, out_srv__turtlesim__Spawn);
-    UROS_MSG_SEND_BODY(outmsgp, out_srv__turtlesim__Spawn);
+    UROS_MSG_FRAME_LENGTH(outmsgp, out_srv__turtlesim__Spawn);
+    UROS_MSG_SEND_FRAME(outmsgp, out_srv__turtlesim__Spawn);
 
     /* Dispose the contents of the response message.*/
     clean_out_srv__turtlesim__Spawn(outmsgp);
@@ -520,8 +520,8 @@ uros_err_t pub_srv__turtleX__set_pen(UrosTcpRosStatus *tcpstp) {
 
     /* Send the response message.*/
     UROS_SRV_SEND_OKBYTE_ERRSTR();
-    UROS_MSG_SEND_LENGTH(outmsgp, out_srv__turtlesim__SetPen);
-    UROS_MSG_SEND_BODY(outmsgp, out_srv__turtlesim__SetPen);
+    UROS_MSG_FRAME_LENGTH(outmsgp, out_srv__turtlesim__SetPen);
+    UROS_MSG_SEND_FRAME(outmsgp, out_srv__turtlesim__SetPen);
 
     /* Dispose the contents of the response message.*/
     clean_out_srv__turtlesim__SetPen(outmsgp);
@@ -603,8 +603,8 @@ uros_err_t pub_srv__turtleX__teleport_absolute(UrosTcpRosStatus *tcpstp) {
 
     /* Send the response message.*/
     UROS_SRV_SEND_OKBYTE_ERRSTR();
-    UROS_MSG_SEND_LENGTH(outmsgp, out_srv__turtlesim__TeleportAbsolute);
-    UROS_MSG_SEND_BODY(outmsgp, out_srv__turtlesim__TeleportAbsolute);
+    UROS_MSG_FRAME_LENGTH(outmsgp, out_srv__turtlesim__TeleportAbsolute);
+    UROS_MSG_SEND_FRAME(outmsgp, out_srv__turtlesim__TeleportAbsolute);
 
     /* Dispose the contents of the response message.*/
     clean_out_srv__turtlesim__TeleportAbsolute(outmsgp);
@@ -685,8 +685,8 @@ uros_err_t pub_srv__turtleX__teleport_relative(UrosTcpRosStatus *tcpstp) {
 
     /* Send the response message.*/
     UROS_SRV_SEND_OKBYTE_ERRSTR();
-    UROS_MSG_SEND_LENGTH(outmsgp, out_srv__turtlesim__TeleportRelative);
-    UROS_MSG_SEND_BODY(outmsgp, out_srv__turtlesim__TeleportRelative);
+    UROS_MSG_FRAME_LENGTH(outmsgp, out_srv__turtlesim__TeleportRelative);
+    UROS_MSG_SEND_FRAME(outmsgp, out_srv__turtlesim__TeleportRelative);
 
     /* Dispose the contents of the response message.*/
     clean_out_srv__turtlesim__TeleportRelative(outmsgp);
@@ -186,6 +186,95 @@ uros_err_t send_msg__std_msgs__Header(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>std_msgs/Header</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__std_msgs__Header()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__std_msgs__Header</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__std_msgs__Header(
+  uint8_t *bufp,
+  struct msg__std_msgs__Header *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutRaw(bufp, objp->seq);
+  bufp = urosTcpRosPutRaw(bufp, objp->stamp);
+  bufp = urosTcpRosPutString(bufp, &objp->frame_id);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>std_msgs/Header</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__std_msgs__Header()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__std_msgs__Header</code> object.
+ */
+void serializev_msg__std_msgs__Header(
+  UrosTcpRosGather *gp,
+  struct msg__std_msgs__Header *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->seq);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->stamp);
+  urosTcpRosGatherString(gp, &objp->frame_id);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>std_msgs/Header</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__std_msgs__Header</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__std_msgs__Header(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__std_msgs__Header *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->seq); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->stamp); _CHKOK
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->frame_id); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__std_msgs__Header(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ MESSAGE: rosgraph_msgs/Log ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -358,6 +447,134 @@ uros_err_t send_msg__rosgraph_msgs__Log(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>rosgraph_msgs/Log</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__rosgraph_msgs__Log()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__rosgraph_msgs__Log</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__rosgraph_msgs__Log(
+  uint8_t *bufp,
+  struct msg__rosgraph_msgs__Log *objp
+) {
+  uint32_t i;
+
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = serialize_msg__std_msgs__Header(bufp, &objp->header);
+  bufp = urosTcpRosPutRaw(bufp, objp->level);
+  bufp = urosTcpRosPutString(bufp, &objp->name);
+  bufp = urosTcpRosPutString(bufp, &objp->msg);
+  bufp = urosTcpRosPutString(bufp, &objp->file);
+  bufp = urosTcpRosPutString(bufp, &objp->function);
+  bufp = urosTcpRosPutRaw(bufp, objp->line);
+  bufp = urosTcpRosPutRaw(bufp, objp->topics.length);
+  for (i = 0; i < objp->topics.length; ++i) {
+    bufp = urosTcpRosPutString(bufp, &objp->topics.entriesp[i]);
+  }
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>rosgraph_msgs/Log</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__rosgraph_msgs__Log()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__rosgraph_msgs__Log</code> object.
+ */
+void serializev_msg__rosgraph_msgs__Log(
+  UrosTcpRosGather *gp,
+  struct msg__rosgraph_msgs__Log *objp
+) {
+  uint32_t i;
+
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  serializev_msg__std_msgs__Header(gp, &objp->header);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->level);
+  urosTcpRosGatherString(gp, &objp->name);
+  urosTcpRosGatherString(gp, &objp->msg);
+  urosTcpRosGatherString(gp, &objp->file);
+  urosTcpRosGatherString(gp, &objp->function);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->line);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->topics.length);
+  for (i = 0; i < objp->topics.length; ++i) {
+    urosTcpRosGatherString(gp, &objp->topics.entriesp[i]);
+  }
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>rosgraph_msgs/Log</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__rosgraph_msgs__Log</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__rosgraph_msgs__Log(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__rosgraph_msgs__Log *objp
+) {
+  uros_err_t err;
+  uint32_t i;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = deserialize_msg__std_msgs__Header(bufpp, buflenp, arenap, &objp->header); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->level); _CHKOK
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->name); _CHKOK
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->msg); _CHKOK
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->file); _CHKOK
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->function); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->line); _CHKOK
+  urosTcpRosArrayObjectInit((UrosTcpRosArray *)&objp->topics);
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->topics.length); _CHKOK
+  if (objp->topics.length > *buflenp / sizeof(uint32_t)) {
+    objp->topics.length = 0; err = UROS_ERR_PARSE; goto _error;
+  }
+  objp->topics.entriesp = urosTcpRosArenaArrayNew(arenap, objp->topics.length,
+                                                  UrosString);
+  if (objp->topics.entriesp == NULL) {
+    objp->topics.length = 0; err = UROS_ERR_NOMEM; goto _error;
+  }
+  memset(objp->topics.entriesp, 0, (size_t)objp->topics.length * sizeof(UrosString));
+  for (i = 0; i < objp->topics.length; ++i) {
+    err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->topics.entriesp[i]); _CHKOK
+  }
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__rosgraph_msgs__Log(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ MESSAGE: turtlesim/Pose ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -483,6 +700,101 @@ uros_err_t send_msg__turtlesim__Pose(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/Pose</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__turtlesim__Pose()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__turtlesim__Pose</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__turtlesim__Pose(
+  uint8_t *bufp,
+  struct msg__turtlesim__Pose *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutRaw(bufp, objp->x);
+  bufp = urosTcpRosPutRaw(bufp, objp->y);
+  bufp = urosTcpRosPutRaw(bufp, objp->theta);
+  bufp = urosTcpRosPutRaw(bufp, objp->linear_velocity);
+  bufp = urosTcpRosPutRaw(bufp, objp->angular_velocity);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/Pose</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__turtlesim__Pose()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__turtlesim__Pose</code> object.
+ */
+void serializev_msg__turtlesim__Pose(
+  UrosTcpRosGather *gp,
+  struct msg__turtlesim__Pose *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->x);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->y);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->theta);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->linear_velocity);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->angular_velocity);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>turtlesim/Pose</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__turtlesim__Pose</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__turtlesim__Pose(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__turtlesim__Pose *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->x); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->y); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->theta); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->linear_velocity); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->angular_velocity); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__turtlesim__Pose(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ MESSAGE: turtlesim/Color ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -602,6 +914,95 @@ uros_err_t send_msg__turtlesim__Color(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/Color</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__turtlesim__Color()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__turtlesim__Color</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__turtlesim__Color(
+  uint8_t *bufp,
+  struct msg__turtlesim__Color *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutRaw(bufp, objp->r);
+  bufp = urosTcpRosPutRaw(bufp, objp->g);
+  bufp = urosTcpRosPutRaw(bufp, objp->b);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/Color</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__turtlesim__Color()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__turtlesim__Color</code> object.
+ */
+void serializev_msg__turtlesim__Color(
+  UrosTcpRosGather *gp,
+  struct msg__turtlesim__Color *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->r);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->g);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->b);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>turtlesim/Color</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__turtlesim__Color</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__turtlesim__Color(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__turtlesim__Color *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->r); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->g); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->b); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__turtlesim__Color(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ MESSAGE: turtlesim/Velocity ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -718,6 +1119,92 @@ uros_err_t send_msg__turtlesim__Velocity(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/Velocity</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__turtlesim__Velocity()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__turtlesim__Velocity</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__turtlesim__Velocity(
+  uint8_t *bufp,
+  struct msg__turtlesim__Velocity *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutRaw(bufp, objp->linear);
+  bufp = urosTcpRosPutRaw(bufp, objp->angular);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/Velocity</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__turtlesim__Velocity()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__turtlesim__Velocity</code> object.
+ */
+void serializev_msg__turtlesim__Velocity(
+  UrosTcpRosGather *gp,
+  struct msg__turtlesim__Velocity *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->linear);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->angular);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>turtlesim/Velocity</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__turtlesim__Velocity</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__turtlesim__Velocity(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__turtlesim__Velocity *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->linear); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->angular); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__turtlesim__Velocity(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /** @} */
@@ -902,57 +1389,233 @@ uros_err_t send_out_srv__turtlesim__SetPen(
   return tcpstp->err = UROS_OK;
 }
 
-/** @} */
-
-/*~~~ SERVICE: turtlesim/Spawn ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-
-/** @name Service <tt>turtlesim/Spawn</tt> */
-/** @{ */
-
 /**
- * @brief   Content length of a TCPROS <tt>turtlesim/Spawn</tt> service request.
+ * @brief   Serializes a TCPROS <tt>turtlesim/SetPen</tt> service request.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
  *
- * @param[in,out] objp
- *          Pointer to an initialized <code>struct srv__turtlesim__Spawn</code> object.
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_in_srv__turtlesim__SetPen()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__SetPen</code> object.
  * @return
- *          Length of the TCPROS service request contents, in bytes.
+ *          Pointer to the first byte after the serialized contents.
  */
-size_t length_in_srv__turtlesim__Spawn(
-  struct in_srv__turtlesim__Spawn *objp
+uint8_t *serialize_in_srv__turtlesim__SetPen(
+  uint8_t *bufp,
+  struct in_srv__turtlesim__SetPen *objp
 ) {
-  size_t length = 0;
-
+  urosAssert(bufp != NULL);
   urosAssert(objp != NULL);
 
-  length += sizeof(float);
-  length += sizeof(float);
-  length += sizeof(float);
-  length += sizeof(uint32_t) + objp->name.length;
+  bufp = urosTcpRosPutRaw(bufp, objp->r);
+  bufp = urosTcpRosPutRaw(bufp, objp->g);
+  bufp = urosTcpRosPutRaw(bufp, objp->b);
+  bufp = urosTcpRosPutRaw(bufp, objp->width);
+  bufp = urosTcpRosPutRaw(bufp, objp->off);
 
-  return length;
+  return bufp;
 }
 
 /**
- * @brief   Initializes a TCPROS <tt>turtlesim/Spawn</tt> service request.
+ * @brief   Serializes a TCPROS <tt>turtlesim/SetPen</tt> service response.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
  *
- * @param[in,out] objp
- *          Pointer to an allocated <code>struct in_srv__turtlesim__Spawn</code> object.
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_out_srv__turtlesim__SetPen()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__SetPen</code> object.
  * @return
- *          Error code.
+ *          Pointer to the first byte after the serialized contents.
  */
-void init_in_srv__turtlesim__Spawn(
-  struct in_srv__turtlesim__Spawn *objp
+uint8_t *serialize_out_srv__turtlesim__SetPen(
+  uint8_t *bufp,
+  struct out_srv__turtlesim__SetPen *objp
 ) {
+  urosAssert(bufp != NULL);
   urosAssert(objp != NULL);
 
-  urosStringObjectInit(&objp->name);
+  /* Nothing to serialize.*/
+  (void)objp;
+  return bufp;
 }
 
 /**
- * @brief   Cleans a TCPROS <tt>turtlesim/Spawn</tt> service request.
+ * @brief   Serializes a TCPROS <tt>turtlesim/SetPen</tt> service request into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
  *
- * @param[in,out] objp
- *          Pointer to an initialized <code>struct in_srv__turtlesim__Spawn</code>object.
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_in_srv__turtlesim__SetPen()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__SetPen</code> object.
+ */
+void serializev_in_srv__turtlesim__SetPen(
+  UrosTcpRosGather *gp,
+  struct in_srv__turtlesim__SetPen *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->r);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->g);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->b);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->width);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->off);
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/SetPen</tt> service response into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_out_srv__turtlesim__SetPen()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__SetPen</code> object.
+ */
+void serializev_out_srv__turtlesim__SetPen(
+  UrosTcpRosGather *gp,
+  struct out_srv__turtlesim__SetPen *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to serialize.*/
+  (void)gp;
+  (void)objp;
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>turtlesim/SetPen</tt> service request.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__SetPen</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_in_srv__turtlesim__SetPen(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct in_srv__turtlesim__SetPen *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->r); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->g); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->b); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->width); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->off); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_in_srv__turtlesim__SetPen(objp); }
+  return err;
+#undef _CHKOK
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>turtlesim/SetPen</tt> service response.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__SetPen</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_out_srv__turtlesim__SetPen(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct out_srv__turtlesim__SetPen *objp
+) {
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to deserialize.*/
+  (void)bufpp;
+  (void)buflenp;
+  (void)arenap;
+  (void)objp;
+  return UROS_OK;
+}
+
+/** @} */
+
+/*~~~ SERVICE: turtlesim/Spawn ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/** @name Service <tt>turtlesim/Spawn</tt> */
+/** @{ */
+
+/**
+ * @brief   Content length of a TCPROS <tt>turtlesim/Spawn</tt> service request.
+ *
+ * @param[in,out] objp
+ *          Pointer to an initialized <code>struct srv__turtlesim__Spawn</code> object.
+ * @return
+ *          Length of the TCPROS service request contents, in bytes.
+ */
+size_t length_in_srv__turtlesim__Spawn(
+  struct in_srv__turtlesim__Spawn *objp
+) {
+  size_t length = 0;
+
+  urosAssert(objp != NULL);
+
+  length += sizeof(float);
+  length += sizeof(float);
+  length += sizeof(float);
+  length += sizeof(uint32_t) + objp->name.length;
+
+  return length;
+}
+
+/**
+ * @brief   Initializes a TCPROS <tt>turtlesim/Spawn</tt> service request.
+ *
+ * @param[in,out] objp
+ *          Pointer to an allocated <code>struct in_srv__turtlesim__Spawn</code> object.
+ * @return
+ *          Error code.
+ */
+void init_in_srv__turtlesim__Spawn(
+  struct in_srv__turtlesim__Spawn *objp
+) {
+  urosAssert(objp != NULL);
+
+  urosStringObjectInit(&objp->name);
+}
+
+/**
+ * @brief   Cleans a TCPROS <tt>turtlesim/Spawn</tt> service request.
+ *
+ * @param[in,out] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__Spawn</code>object.
  * @return
  *          Error code.
  */
@@ -1072,6 +1735,181 @@ uros_err_t send_out_srv__turtlesim__Spawn(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/Spawn</tt> service request.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_in_srv__turtlesim__Spawn()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__Spawn</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_in_srv__turtlesim__Spawn(
+  uint8_t *bufp,
+  struct in_srv__turtlesim__Spawn *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutRaw(bufp, objp->x);
+  bufp = urosTcpRosPutRaw(bufp, objp->y);
+  bufp = urosTcpRosPutRaw(bufp, objp->theta);
+  bufp = urosTcpRosPutString(bufp, &objp->name);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/Spawn</tt> service response.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_out_srv__turtlesim__Spawn()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__Spawn</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_out_srv__turtlesim__Spawn(
+  uint8_t *bufp,
+  struct out_srv__turtlesim__Spawn *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutString(bufp, &objp->name);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/Spawn</tt> service request into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_in_srv__turtlesim__Spawn()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__Spawn</code> object.
+ */
+void serializev_in_srv__turtlesim__Spawn(
+  UrosTcpRosGather *gp,
+  struct in_srv__turtlesim__Spawn *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->x);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->y);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->theta);
+  urosTcpRosGatherString(gp, &objp->name);
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/Spawn</tt> service response into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_out_srv__turtlesim__Spawn()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__Spawn</code> object.
+ */
+void serializev_out_srv__turtlesim__Spawn(
+  UrosTcpRosGather *gp,
+  struct out_srv__turtlesim__Spawn *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  urosTcpRosGatherString(gp, &objp->name);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>turtlesim/Spawn</tt> service request.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__Spawn</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_in_srv__turtlesim__Spawn(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct in_srv__turtlesim__Spawn *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->x); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->y); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->theta); _CHKOK
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->name); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_in_srv__turtlesim__Spawn(objp); }
+  return err;
+#undef _CHKOK
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>turtlesim/Spawn</tt> service response.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__Spawn</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_out_srv__turtlesim__Spawn(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct out_srv__turtlesim__Spawn *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->name); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_out_srv__turtlesim__Spawn(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ SERVICE: turtlesim/Kill ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -1237,6 +2075,170 @@ uros_err_t send_out_srv__turtlesim__Kill(
   return tcpstp->err = UROS_OK;
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/Kill</tt> service request.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_in_srv__turtlesim__Kill()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__Kill</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_in_srv__turtlesim__Kill(
+  uint8_t *bufp,
+  struct in_srv__turtlesim__Kill *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutString(bufp, &objp->name);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/Kill</tt> service response.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_out_srv__turtlesim__Kill()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__Kill</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_out_srv__turtlesim__Kill(
+  uint8_t *bufp,
+  struct out_srv__turtlesim__Kill *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to serialize.*/
+  (void)objp;
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/Kill</tt> service request into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_in_srv__turtlesim__Kill()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__Kill</code> object.
+ */
+void serializev_in_srv__turtlesim__Kill(
+  UrosTcpRosGather *gp,
+  struct in_srv__turtlesim__Kill *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  urosTcpRosGatherString(gp, &objp->name);
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/Kill</tt> service response into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_out_srv__turtlesim__Kill()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__Kill</code> object.
+ */
+void serializev_out_srv__turtlesim__Kill(
+  UrosTcpRosGather *gp,
+  struct out_srv__turtlesim__Kill *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to serialize.*/
+  (void)gp;
+  (void)objp;
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>turtlesim/Kill</tt> service request.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__Kill</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_in_srv__turtlesim__Kill(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct in_srv__turtlesim__Kill *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->name); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_in_srv__turtlesim__Kill(objp); }
+  return err;
+#undef _CHKOK
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>turtlesim/Kill</tt> service response.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__Kill</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_out_srv__turtlesim__Kill(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct out_srv__turtlesim__Kill *objp
+) {
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to deserialize.*/
+  (void)bufpp;
+  (void)buflenp;
+  (void)arenap;
+  (void)objp;
+  return UROS_OK;
+}
+
 /** @} */
 
 /*~~~ SERVICE: turtlesim/TeleportAbsolute ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -1408,6 +2410,176 @@ uros_err_t send_out_srv__turtlesim__TeleportAbsolute(
   return tcpstp->err = UROS_OK;
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/TeleportAbsolute</tt> service request.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_in_srv__turtlesim__TeleportAbsolute()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__TeleportAbsolute</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_in_srv__turtlesim__TeleportAbsolute(
+  uint8_t *bufp,
+  struct in_srv__turtlesim__TeleportAbsolute *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutRaw(bufp, objp->x);
+  bufp = urosTcpRosPutRaw(bufp, objp->y);
+  bufp = urosTcpRosPutRaw(bufp, objp->theta);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/TeleportAbsolute</tt> service response.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_out_srv__turtlesim__TeleportAbsolute()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__TeleportAbsolute</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_out_srv__turtlesim__TeleportAbsolute(
+  uint8_t *bufp,
+  struct out_srv__turtlesim__TeleportAbsolute *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to serialize.*/
+  (void)objp;
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/TeleportAbsolute</tt> service request into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_in_srv__turtlesim__TeleportAbsolute()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__TeleportAbsolute</code> object.
+ */
+void serializev_in_srv__turtlesim__TeleportAbsolute(
+  UrosTcpRosGather *gp,
+  struct in_srv__turtlesim__TeleportAbsolute *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->x);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->y);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->theta);
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/TeleportAbsolute</tt> service response into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_out_srv__turtlesim__TeleportAbsolute()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__TeleportAbsolute</code> object.
+ */
+void serializev_out_srv__turtlesim__TeleportAbsolute(
+  UrosTcpRosGather *gp,
+  struct out_srv__turtlesim__TeleportAbsolute *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to serialize.*/
+  (void)gp;
+  (void)objp;
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>turtlesim/TeleportAbsolute</tt> service request.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__TeleportAbsolute</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_in_srv__turtlesim__TeleportAbsolute(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct in_srv__turtlesim__TeleportAbsolute *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->x); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->y); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->theta); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_in_srv__turtlesim__TeleportAbsolute(objp); }
+  return err;
+#undef _CHKOK
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>turtlesim/TeleportAbsolute</tt> service response.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__TeleportAbsolute</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_out_srv__turtlesim__TeleportAbsolute(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct out_srv__turtlesim__TeleportAbsolute *objp
+) {
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to deserialize.*/
+  (void)bufpp;
+  (void)buflenp;
+  (void)arenap;
+  (void)objp;
+  return UROS_OK;
+}
+
 /** @} */
 
 /*~~~ SERVICE: std_srvs/Empty ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -1569,6 +2741,168 @@ uros_err_t send_out_srv__std_srvs__Empty(
   return tcpstp->err = UROS_OK;
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>std_srvs/Empty</tt> service request.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_in_srv__std_srvs__Empty()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct in_srv__std_srvs__Empty</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_in_srv__std_srvs__Empty(
+  uint8_t *bufp,
+  struct in_srv__std_srvs__Empty *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to serialize.*/
+  (void)objp;
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>std_srvs/Empty</tt> service response.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_out_srv__std_srvs__Empty()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct out_srv__std_srvs__Empty</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_out_srv__std_srvs__Empty(
+  uint8_t *bufp,
+  struct out_srv__std_srvs__Empty *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to serialize.*/
+  (void)objp;
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>std_srvs/Empty</tt> service request into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_in_srv__std_srvs__Empty()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct in_srv__std_srvs__Empty</code> object.
+ */
+void serializev_in_srv__std_srvs__Empty(
+  UrosTcpRosGather *gp,
+  struct in_srv__std_srvs__Empty *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to serialize.*/
+  (void)gp;
+  (void)objp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>std_srvs/Empty</tt> service response into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_out_srv__std_srvs__Empty()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct out_srv__std_srvs__Empty</code> object.
+ */
+void serializev_out_srv__std_srvs__Empty(
+  UrosTcpRosGather *gp,
+  struct out_srv__std_srvs__Empty *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to serialize.*/
+  (void)gp;
+  (void)objp;
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>std_srvs/Empty</tt> service request.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct in_srv__std_srvs__Empty</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_in_srv__std_srvs__Empty(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct in_srv__std_srvs__Empty *objp
+) {
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to deserialize.*/
+  (void)bufpp;
+  (void)buflenp;
+  (void)arenap;
+  (void)objp;
+  return UROS_OK;
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>std_srvs/Empty</tt> service response.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct out_srv__std_srvs__Empty</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_out_srv__std_srvs__Empty(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct out_srv__std_srvs__Empty *objp
+) {
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to deserialize.*/
+  (void)bufpp;
+  (void)buflenp;
+  (void)arenap;
+  (void)objp;
+  return UROS_OK;
+}
+
 /** @} */
 
 /*~~~ SERVICE: turtlesim/TeleportRelative ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -1738,6 +3072,173 @@ uros_err_t send_out_srv__turtlesim__TeleportRelative(
   return tcpstp->err = UROS_OK;
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/TeleportRelative</tt> service request.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_in_srv__turtlesim__TeleportRelative()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__TeleportRelative</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_in_srv__turtlesim__TeleportRelative(
+  uint8_t *bufp,
+  struct in_srv__turtlesim__TeleportRelative *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutRaw(bufp, objp->linear);
+  bufp = urosTcpRosPutRaw(bufp, objp->angular);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/TeleportRelative</tt> service response.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_out_srv__turtlesim__TeleportRelative()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__TeleportRelative</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_out_srv__turtlesim__TeleportRelative(
+  uint8_t *bufp,
+  struct out_srv__turtlesim__TeleportRelative *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to serialize.*/
+  (void)objp;
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/TeleportRelative</tt> service request into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_in_srv__turtlesim__TeleportRelative()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__TeleportRelative</code> object.
+ */
+void serializev_in_srv__turtlesim__TeleportRelative(
+  UrosTcpRosGather *gp,
+  struct in_srv__turtlesim__TeleportRelative *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->linear);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->angular);
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>turtlesim/TeleportRelative</tt> service response into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_out_srv__turtlesim__TeleportRelative()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__TeleportRelative</code> object.
+ */
+void serializev_out_srv__turtlesim__TeleportRelative(
+  UrosTcpRosGather *gp,
+  struct out_srv__turtlesim__TeleportRelative *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to serialize.*/
+  (void)gp;
+  (void)objp;
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>turtlesim/TeleportRelative</tt> service request.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct in_srv__turtlesim__TeleportRelative</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_in_srv__turtlesim__TeleportRelative(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct in_srv__turtlesim__TeleportRelative *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->linear); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->angular); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_in_srv__turtlesim__TeleportRelative(objp); }
+  return err;
+#undef _CHKOK
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>turtlesim/TeleportRelative</tt> service response.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct out_srv__turtlesim__TeleportRelative</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_out_srv__turtlesim__TeleportRelative(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct out_srv__turtlesim__TeleportRelative *objp
+) {
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to deserialize.*/
+  (void)bufpp;
+  (void)buflenp;
+  (void)arenap;
+  (void)objp;
+  return UROS_OK;
+}
+
 /** @} */
 
 /** @} */
@@ -300,6 +300,20 @@ uros_err_t send_msg__std_msgs__Header(
   UrosTcpRosStatus *tcpstp,
   struct msg__std_msgs__Header *objp
 );
+uint8_t *serialize_msg__std_msgs__Header(
+  uint8_t *bufp,
+  struct msg__std_msgs__Header *objp
+);
+void serializev_msg__std_msgs__Header(
+  UrosTcpRosGather *gp,
+  struct msg__std_msgs__Header *objp
+);
+uros_err_t deserialize_msg__std_msgs__Header(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__std_msgs__Header *objp
+);
 
 /*~~~ MESSAGE: rosgraph_msgs/Log ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -320,6 +334,20 @@ uros_err_t send_msg__rosgraph_msgs__Log(
   UrosTcpRosStatus *tcpstp,
   struct msg__rosgraph_msgs__Log *objp
 );
+uint8_t *serialize_msg__rosgraph_msgs__Log(
+  uint8_t *bufp,
+  struct msg__rosgraph_msgs__Log *objp
+);
+void serializev_msg__rosgraph_msgs__Log(
+  UrosTcpRosGather *gp,
+  struct msg__rosgraph_msgs__Log *objp
+);
+uros_err_t deserialize_msg__rosgraph_msgs__Log(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__rosgraph_msgs__Log *objp
+);
 
 /*~~~ MESSAGE: turtlesim/Pose ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -340,6 +368,20 @@ uros_err_t send_msg__turtlesim__Pose(
   UrosTcpRosStatus *tcpstp,
   struct msg__turtlesim__Pose *objp
 );
+uint8_t *serialize_msg__turtlesim__Pose(
+  uint8_t *bufp,
+  struct msg__turtlesim__Pose *objp
+);
+void serializev_msg__turtlesim__Pose(
+  UrosTcpRosGather *gp,
+  struct msg__turtlesim__Pose *objp
+);
+uros_err_t deserialize_msg__turtlesim__Pose(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__turtlesim__Pose *objp
+);
 
 /*~~~ MESSAGE: turtlesim/Color ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -360,6 +402,20 @@ uros_err_t send_msg__turtlesim__Color(
   UrosTcpRosStatus *tcpstp,
   struct msg__turtlesim__Color *objp
 );
+uint8_t *serialize_msg__turtlesim__Color(
+  uint8_t *bufp,
+  struct msg__turtlesim__Color *objp
+);
+void serializev_msg__turtlesim__Color(
+  UrosTcpRosGather *gp,
+  struct msg__turtlesim__Color *objp
+);
+uros_err_t deserialize_msg__turtlesim__Color(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__turtlesim__Color *objp
+);
 
 /*~~~ MESSAGE: turtlesim/Velocity ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -380,6 +436,20 @@ uros_err_t send_msg__turtlesim__Velocity(
   UrosTcpRosStatus *tcpstp,
   struct msg__turtlesim__Velocity *objp
 );
+uint8_t *serialize_msg__turtlesim__Velocity(
+  uint8_t *bufp,
+  struct msg__turtlesim__Velocity *objp
+);
+void serializev_msg__turtlesim__Velocity(
+  UrosTcpRosGather *gp,
+  struct msg__turtlesim__Velocity *objp
+);
+uros_err_t deserialize_msg__turtlesim__Velocity(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__turtlesim__Velocity *objp
+);
 
 /*===========================================================================*/
 /* SERVICE PROTOTYPES                                                        */
@@ -413,6 +483,34 @@ uros_err_t send_out_srv__turtlesim__SetPen(
   UrosTcpRosStatus *tcpstp,
   struct out_srv__turtlesim__SetPen *objp
 );
+uint8_t *serialize_in_srv__turtlesim__SetPen(
+  uint8_t *bufp,
+  struct in_srv__turtlesim__SetPen *objp
+);
+uint8_t *serialize_out_srv__turtlesim__SetPen(
+  uint8_t *bufp,
+  struct out_srv__turtlesim__SetPen *objp
+);
+void serializev_in_srv__turtlesim__SetPen(
+  UrosTcpRosGather *gp,
+  struct in_srv__turtlesim__SetPen *objp
+);
+void serializev_out_srv__turtlesim__SetPen(
+  UrosTcpRosGather *gp,
+  struct out_srv__turtlesim__SetPen *objp
+);
+uros_err_t deserialize_in_srv__turtlesim__SetPen(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct in_srv__turtlesim__SetPen *objp
+);
+uros_err_t deserialize_out_srv__turtlesim__SetPen(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct out_srv__turtlesim__SetPen *objp
+);
 
 /*~~~ SERVICE: turtlesim/Velocity ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -442,6 +540,34 @@ uros_err_t send_out_srv__turtlesim__Spawn(
   UrosTcpRosStatus *tcpstp,
   struct out_srv__turtlesim__Spawn *objp
 );
+uint8_t *serialize_in_srv__turtlesim__Spawn(
+  uint8_t *bufp,
+  struct in_srv__turtlesim__Spawn *objp
+);
+uint8_t *serialize_out_srv__turtlesim__Spawn(
+  uint8_t *bufp,
+  struct out_srv__turtlesim__Spawn *objp
+);
+void serializev_in_srv__turtlesim__Spawn(
+  UrosTcpRosGather *gp,
+  struct in_srv__turtlesim__Spawn *objp
+);
+void serializev_out_srv__turtlesim__Spawn(
+  UrosTcpRosGather *gp,
+  struct out_srv__turtlesim__Spawn *objp
+);
+uros_err_t deserialize_in_srv__turtlesim__Spawn(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct in_srv__turtlesim__Spawn *objp
+);
+uros_err_t deserialize_out_srv__turtlesim__Spawn(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct out_srv__turtlesim__Spawn *objp
+);
 
 /*~~~ SERVICE: turtlesim/Velocity ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -471,6 +597,34 @@ uros_err_t send_out_srv__turtlesim__Kill(
   UrosTcpRosStatus *tcpstp,
   struct out_srv__turtlesim__Kill *objp
 );
+uint8_t *serialize_in_srv__turtlesim__Kill(
+  uint8_t *bufp,
+  struct in_srv__turtlesim__Kill *objp
+);
+uint8_t *serialize_out_srv__turtlesim__Kill(
+  uint8_t *bufp,
+  struct out_srv__turtlesim__Kill *objp
+);
+void serializev_in_srv__turtlesim__Kill(
+  UrosTcpRosGather *gp,
+  struct in_srv__turtlesim__Kill *objp
+);
+void serializev_out_srv__turtlesim__Kill(
+  UrosTcpRosGather *gp,
+  struct out_srv__turtlesim__Kill *objp
+);
+uros_err_t deserialize_in_srv__turtlesim__Kill(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct in_srv__turtlesim__Kill *objp
+);
+uros_err_t deserialize_out_srv__turtlesim__Kill(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct out_srv__turtlesim__Kill *objp
+);
 
 /*~~~ SERVICE: turtlesim/Velocity ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -500,6 +654,34 @@ uros_err_t send_out_srv__turtlesim__TeleportAbsolute(
   UrosTcpRosStatus *tcpstp,
   struct out_srv__turtlesim__TeleportAbsolute *objp
 );
+uint8_t *serialize_in_srv__turtlesim__TeleportAbsolute(
+  uint8_t *bufp,
+  struct in_srv__turtlesim__TeleportAbsolute *objp
+);
+uint8_t *serialize_out_srv__turtlesim__TeleportAbsolute(
+  uint8_t *bufp,
+  struct out_srv__turtlesim__TeleportAbsolute *objp
+);
+void serializev_in_srv__turtlesim__TeleportAbsolute(
+  UrosTcpRosGather *gp,
+  struct in_srv__turtlesim__TeleportAbsolute *objp
+);
+void serializev_out_srv__turtlesim__TeleportAbsolute(
+  UrosTcpRosGather *gp,
+  struct out_srv__turtlesim__TeleportAbsolute *objp
+);
+uros_err_t deserialize_in_srv__turtlesim__TeleportAbsolute(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct in_srv__turtlesim__TeleportAbsolute *objp
+);
+uros_err_t deserialize_out_srv__turtlesim__TeleportAbsolute(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct out_srv__turtlesim__TeleportAbsolute *objp
+);
 
 /*~~~ SERVICE: turtlesim/Velocity ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -529,6 +711,34 @@ uros_err_t send_out_srv__std_srvs__Empty(
   UrosTcpRosStatus *tcpstp,
   struct out_srv__std_srvs__Empty *objp
 );
+uint8_t *serialize_in_srv__std_srvs__Empty(
+  uint8_t *bufp,
+  struct in_srv__std_srvs__Empty *objp
+);
+uint8_t *serialize_out_srv__std_srvs__Empty(
+  uint8_t *bufp,
+  struct out_srv__std_srvs__Empty *objp
+);
+void serializev_in_srv__std_srvs__Empty(
+  UrosTcpRosGather *gp,
+  struct in_srv__std_srvs__Empty *objp
+);
+void serializev_out_srv__std_srvs__Empty(
+  UrosTcpRosGather *gp,
+  struct out_srv__std_srvs__Empty *objp
+);
+uros_err_t deserialize_in_srv__std_srvs__Empty(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct in_srv__std_srvs__Empty *objp
+);
+uros_err_t deserialize_out_srv__std_srvs__Empty(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct out_srv__std_srvs__Empty *objp
+);
 
 /*~~~ SERVICE: turtlesim/Velocity ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -558,6 +768,34 @@ uros_err_t send_out_srv__turtlesim__TeleportRelative(
   UrosTcpRosStatus *tcpstp,
   struct out_srv__turtlesim__TeleportRelative *objp
 );
+uint8_t *serialize_in_srv__turtlesim__TeleportRelative(
+  uint8_t *bufp,
+  struct in_srv__turtlesim__TeleportRelative *objp
+);
+uint8_t *serialize_out_srv__turtlesim__TeleportRelative(
+  uint8_t *bufp,
+  struct out_srv__turtlesim__TeleportRelative *objp
+);
+void serializev_in_srv__turtlesim__TeleportRelative(
+  UrosTcpRosGather *gp,
+  struct in_srv__turtlesim__TeleportRelative *objp
+);
+void serializev_out_srv__turtlesim__TeleportRelative(
+  UrosTcpRosGather *gp,
+  struct out_srv__turtlesim__TeleportRelative *objp
+);
+uros_err_t deserialize_in_srv__turtlesim__TeleportRelative(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct in_srv__turtlesim__TeleportRelative *objp
+);
+uros_err_t deserialize_out_srv__turtlesim__TeleportRelative(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct out_srv__turtlesim__TeleportRelative *objp
+);
 
 /*===========================================================================*/
 /* GLOBAL PROTOTYPES                                                         */
@@ -0,0 +1,84 @@
+/*
+Copyright (c) 2012-2013, Politecnico di Milano. All rights reserved.
+
+Andrea Zoppi <texzk@email.it>
+Martino Migliavacca <martino.migliavacca@gmail.com>
+
+http://airlab.elet.polimi.it/
+http://www.openrobots.com/
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file    uros_lld_heap.h
+ * @author  Andrea Zoppi <texzk@email.it>
+ *
+ * @brief   POSIX heap type of the middleware.
+ * @details Included by the @p urosconf.h of POSIX targets, which use the
+ *          heaps of @p src/lld/posix/uros_lld_base.c.
+ */
+
+#ifndef _UROS_LLD_POSIX_HEAP_H_
+#define _UROS_LLD_POSIX_HEAP_H_
+
+/*===========================================================================*/
+/* HEADER FILES                                                              */
+/*===========================================================================*/
+
+#include <stddef.h>
+#include <pthread.h>
+
+/*===========================================================================*/
+/* TYPES & MACROS                                                            */
+/*===========================================================================*/
+
+/** @addtogroup base_types */
+/** @{ */
+
+/** @brief Number of heap size classes.*/
+#if !defined(UROS_LLD_HEAP_NUMCLASSES) || defined(__DOXYGEN__)
+#define UROS_LLD_HEAP_NUMCLASSES    20
+#endif
+
+/** @brief Payload of the smallest heap size class, as a power of two.*/
+#if !defined(UROS_LLD_HEAP_MINBLOCK) || defined(__DOXYGEN__)
+#define UROS_LLD_HEAP_MINBLOCK      16
+#endif
+
+/** @brief Heap type, with a free list for each size class.*/
+typedef struct UrosMemHeap {
+  char              *basep;     /**< @brief Heap memory area.*/
+  size_t            size;       /**< @brief Size of the heap memory area.*/
+  size_t            brk;        /**< @brief Bytes carved from the heap memory area.*/
+  void              *freep[UROS_LLD_HEAP_NUMCLASSES]; /**< @brief Free blocks of each size class.*/
+  size_t            cached;     /**< @brief Bytes of the free blocks.*/
+  unsigned long     numCached;  /**< @brief Number of free blocks.*/
+  size_t            used;       /**< @brief Bytes of the allocated blocks.*/
+  size_t            requested;  /**< @brief Bytes requested for the allocated blocks.*/
+  size_t            peak;       /**< @brief High-water mark of @p used.*/
+  unsigned long     numFails;   /**< @brief Number of failed allocations.*/
+  pthread_mutex_t   lock;       /**< @brief Heap lock.*/
+} UrosMemHeap;
+
+/** @} */
+
+#endif /* _UROS_LLD_POSIX_HEAP_H_ */
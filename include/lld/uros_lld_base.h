@@ -55,6 +55,8 @@ extern "C" {
 void uros_lld_init(void);
 void *uros_lld_alloc(UrosMemHeap *heapp, size_t size);
 void uros_lld_free(void *chunkp);
+void uros_lld_heap_objectinit(UrosMemHeap *heapp, void *bufp, size_t size);
+void uros_lld_heap_stats(UrosMemHeap *heapp, UrosMemHeapStats *statsp);
 
 #if UROS_USE_BUILTIN_MEMPOOL == UROS_FALSE
 void uros_lld_mempool_objectinit(UrosMemPool *poolp, size_t blocksize,
@@ -65,11 +65,13 @@ uros_err_t  uros_lld_conn_recv(UrosConn *cp,
                                void **bufpp, size_t *buflenp);
 uros_err_t  uros_lld_conn_recvfrom(UrosConn *cp,
                                    void **bufpp, size_t *buflenp,
-                                   const UrosAddr *remaddrp);
+                                   UrosAddr *remaddrp);
 uros_err_t  uros_lld_conn_send(UrosConn *cp,
                                const void *bufp, size_t buflen);
 uros_err_t  uros_lld_conn_sendconst(UrosConn *cp,
                                     const void *bufp, size_t buflen);
+uros_err_t  uros_lld_conn_sendv(UrosConn *cp,
+                                const UrosIoVec *iovp, uros_cnt_t count);
 uros_err_t  uros_lld_conn_sendto(UrosConn *cp,
                                  const void *bufp, size_t buflen,
                                  const UrosAddr *remaddrp);
@@ -220,6 +220,57 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
   uint8_t varname[(numstacks)][UROS_STACKPOOL_BLKSIZE(stksize)]
 #endif /* !defined(UROS_STACKPOOL) || defined(__DOXYGEN__) */
 
+/**
+ * @brief   Number of free lists of a built-in memory pool.
+ * @details Each free list has its own lock. A thread allocates from, and
+ *          releases to, the free list selected by its thread ID, and takes
+ *          blocks from the other lists only when its own is empty. This way,
+ *          threads sharing a pool seldom contend for the same lock.
+ *          A single free list behaves like a plain locked free list.
+ */
+#if !defined(UROS_MEMPOOL_STRIPES) || defined(__DOXYGEN__)
+#define UROS_MEMPOOL_STRIPES    4
+#endif
+
+/**
+ * @brief   Number of buckets of the string intern table.
+ * @details Interned strings are stored once, and shared by reference.
+ *          Buckets are chained, so this is not a limit to the number of
+ *          distinct strings; it should be a power of two.
+ */
+#if !defined(UROS_STRINTERN_BUCKETS) || defined(__DOXYGEN__)
+#define UROS_STRINTERN_BUCKETS  64
+#endif
+
+/**
+ * @brief   Heap of the XMLRPC subsystem.
+ * @details Pointer to an initialized @p UrosMemHeap object, used for the
+ *          XMLRPC buffers and parameters. The default heap if @p NULL.
+ */
+#if !defined(UROS_XMLRPC_HEAP) || defined(__DOXYGEN__)
+#define UROS_XMLRPC_HEAP        NULL
+#endif
+
+/**
+ * @brief   Heap of the TCPROS subsystem.
+ * @details Pointer to an initialized @p UrosMemHeap object, used for the
+ *          TCPROS headers and message frame buffers. The default heap if
+ *          @p NULL.
+ */
+#if !defined(UROS_TCPROS_HEAP) || defined(__DOXYGEN__)
+#define UROS_TCPROS_HEAP        NULL
+#endif
+
+/**
+ * @brief   Heap of the received message contents.
+ * @details Pointer to an initialized @p UrosMemHeap object, used for the
+ *          strings and arrays of the received messages, and for the message
+ *          arenas. The default heap if @p NULL.
+ */
+#if !defined(UROS_MSG_HEAP) || defined(__DOXYGEN__)
+#define UROS_MSG_HEAP           NULL
+#endif
+
 #if UROS_USE_ASSERT == UROS_FALSE || !defined(urosAssert) || defined(__DOXYGEN__)
 #  if defined(urosAssert)
 #    undef urosAssert
@@ -456,6 +507,46 @@ enum {
  */
 typedef uros_err_t (*uros_proc_f)(void *data);
 
+struct UrosTcpRosStatus;
+
+/**
+ * @brief   Message handler of a topic.
+ * @details Handles a message object published by the node itself, without
+ *          serializing and deserializing it.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to the TCPROS status of the intra-process link.
+ * @param[in] msgp
+ *          Pointer to the shared message object. It is read-only, and valid
+ *          only during the call.
+ * @return
+ *          Error code.
+ */
+typedef uros_err_t (*uros_msgproc_f)(struct UrosTcpRosStatus *tcpstp,
+                                     const void *msgp);
+
+/**
+ * @brief   Frame handler of a topic.
+ * @details Called by the TCPROS reactor for each complete message frame
+ *          received on a subscribed topic link.
+ * @note    The frame buffer is owned by the reactor, and it is valid only
+ *          during the call.
+ * @warning The handler runs inside a reactor thread shared with other links,
+ *          so it must never block.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to the TCPROS status of the link.
+ * @param[in] framep
+ *          Pointer to the message frame body, without the length prefix.
+ * @param[in] framelen
+ *          Length of the message frame body, in bytes.
+ * @return
+ *          Error code. Anything but @p UROS_OK closes the link.
+ */
+typedef uros_err_t (*uros_tcpframe_f)(struct UrosTcpRosStatus *tcpstp,
+                                      const uint8_t *framep,
+                                      size_t framelen);
+
 /**
  * @brief   Predicate function.
  * @details Used to evaluate a predicate on an object.
@@ -511,16 +602,33 @@ typedef void (*uros_delete_f)(void *objp);
 
 /** @} */
 
+/**
+ * @brief   Heap statistics.
+ * @details Fields not tracked by the platform heap are zero.
+ */
+typedef struct UrosMemHeapStats {
+  size_t        size;           /**< @brief Size of the heap memory area.*/
+  size_t        used;           /**< @brief Bytes of the allocated blocks.*/
+  size_t        requested;      /**< @brief Bytes requested for the allocated blocks.*/
+  size_t        peak;           /**< @brief High-water mark of @p used.*/
+  size_t        free;           /**< @brief Bytes available for allocation.*/
+  size_t        fragmented;     /**< @brief Free bytes held by fragments.*/
+  uros_cnt_t    numFrags;       /**< @brief Number of free fragments.*/
+  uros_cnt_t    numFails;       /**< @brief Number of failed allocations.*/
+} UrosMemHeapStats;
+
 #if UROS_USE_BUILTIN_MEMPOOL || defined(__DOXYGEN__)
 /**
  * @brief   Built-in memory pool object.
  */
 typedef struct UrosMemPool {
-  void          *headp;         /**< @brief Pointer to the first free block.*/
   size_t        blockSize;      /**< @brief Block size.*/
   uros_alloc_f  allocator;      /**< @brief Allocation provider.*/
-  uros_cnt_t    free;           /**< @brief Number of free blocks.*/
-  UrosMutex     lock;           /**< @brief Memory pool lock.*/
+  struct {
+    void        *headp;         /**< @brief Pointer to the first free block.*/
+    uros_cnt_t  free;           /**< @brief Number of free blocks.*/
+    UrosMutex   lock;           /**< @brief Free list lock.*/
+  } stripes[UROS_MEMPOOL_STRIPES]; /**< @brief Free lists.*/
 } UrosMemPool;
 #endif
 
@@ -553,6 +661,26 @@ typedef struct UrosList {
   uros_cnt_t    length;         /**< @brief Number of list entries.*/
 } UrosList;
 
+/**
+ * @brief   Hash index entry.
+ */
+typedef struct UrosListIndexEntry {
+  uint32_t              hash;   /**< @brief Hash of the key string.*/
+  const UrosString      *keyp;  /**< @brief Key string, @p NULL if free.*/
+  UrosListNode          *nodep; /**< @brief Indexed list node.*/
+} UrosListIndexEntry;
+
+/**
+ * @brief   Hash index of list nodes, keyed by name.
+ * @details Open addressing table with linear probing, which indexes the nodes
+ *          of a @p UrosList by a key string they reference.
+ */
+typedef struct UrosListIndex {
+  UrosListIndexEntry    *entriesp;  /**< @brief Table entries.*/
+  uros_cnt_t            size;       /**< @brief Table size, a power of two.*/
+  uros_cnt_t            length;     /**< @brief Number of indexed nodes.*/
+} UrosListIndex;
+
 /** @} */
 
 /** @name Messaging related */
@@ -578,6 +706,13 @@ typedef struct uros_topicflags_t {
                                             last value to new subscribers).*/
   unsigned noDelay    : 1;      /**< @brief Nagle algorithm disabled.*/
   unsigned deleted    : 1;      /**< @brief Deleted topic descriptor, free asap.*/
+  unsigned reactor    : 1;      /**< @brief Links handled by the TCPROS reactor,
+                                            with the @p framef handler.*/
+  unsigned blocking   : 1;      /**< @brief Fan-out publishing waits for slow
+                                            subscribers, instead of making
+                                            them skip frames.*/
+  unsigned udp        : 1;      /**< @brief Subscribe through UDPROS, if
+                                            supported by the publisher.*/
 } uros_topicflags_t;
 
 /**
@@ -587,7 +722,10 @@ typedef struct UrosTopic {
   UrosString        name;       /**< @brief Topic/Service name.*/
   const UrosMsgType *typep;     /**< @brief Topic/Service message type.*/
   uros_proc_f       procf;      /**< @brief Procedure handler.*/
+  uros_msgproc_f    msgprocf;   /**< @brief Message handler of intra-process links, if any.*/
+  uros_tcpframe_f   framef;     /**< @brief Frame handler of @p reactor topics.*/
   uros_topicflags_t flags;      /**< @brief Topic/Service flags.*/
+  struct UrosTcpRosFanout *fanoutp; /**< @brief Fan-out frame ring, if any.*/
 
   /* Allocation stuff.*/
   uros_cnt_t        refcnt;     /**< @brief Reference counter.*/
@@ -619,6 +757,8 @@ const char *urosErrorText(uros_err_t err);
 
 void *urosAlloc(UrosMemHeap *heapp, size_t size);
 void urosFree(void *chunkp);
+void urosMemHeapObjectInit(UrosMemHeap *heapp, void *bufp, size_t size);
+void urosMemHeapStats(UrosMemHeap *heapp, UrosMemHeapStats *statsp);
 
 void urosMemPoolObjectInit(UrosMemPool *poolp, size_t blocksize,
                            uros_alloc_f allocator);
@@ -639,6 +779,14 @@ void urosStringDelete(UrosString *strp);
 uros_bool_t urosStringIsValid(const UrosString *strp);
 uros_bool_t urosStringNotEmpty(const UrosString *strp);
 int urosStringCmp(const UrosString *str1, const UrosString *str2);
+uint32_t urosStringHash(const UrosString *strp);
+UrosString urosStringIntern(const UrosString *strp);
+UrosString urosStringInternN(const char *datap, size_t datalen);
+UrosString urosStringInternStatic(const UrosString *strp);
+void urosStringRelease(UrosString *strp);
+uros_bool_t urosStringIsSame(const UrosString *str1, const UrosString *str2);
+uros_bool_t urosStringIsSameInterned(const UrosString *str1,
+                                     const UrosString *str2);
 
 void urosMsgTypeObjectInit(UrosMsgType *typep);
 void urosMsgTypeClean(UrosMsgType *typep);
@@ -685,6 +833,7 @@ int urosListIndexOf(const UrosList *lstp, const UrosListNode *np);
 UrosListNode *urosListFind(const UrosList *lstp,
                            uros_cmp_f filter, const void *featurep);
 void urosListAdd(UrosList *lstp, UrosListNode *np);
+void urosListAppend(UrosList *lstp, UrosListNode *np);
 UrosListNode *urosListRemove(UrosList *lstp, const UrosListNode *np);
 
 uros_bool_t urosStringListNodeHasString(const UrosListNode *np,
@@ -701,6 +850,14 @@ UrosListNode *urosTopicListFindByTopic(const UrosList *lstp,
 UrosListNode *urosTopicListFindByName(const UrosList *lstp,
                                       const UrosString *namep);
 
+void urosListIndexObjectInit(UrosListIndex *idxp);
+void urosListIndexClean(UrosListIndex *idxp);
+uros_err_t urosListIndexAdd(UrosListIndex *idxp, const UrosString *keyp,
+                            UrosListNode *np);
+void urosListIndexRemove(UrosListIndex *idxp, const UrosString *keyp);
+UrosListNode *urosListIndexFind(const UrosListIndex *idxp,
+                                const UrosString *keyp);
+
 #ifdef __cplusplus
 }
 #endif
@@ -199,6 +199,14 @@ typedef struct UrosAddr {
   uint16_t  port;       /**< @brief Transport layer port.*/
 } UrosAddr;
 
+/**
+ * @brief   Scatter/gather data chunk.
+ */
+typedef struct UrosIoVec {
+  const void  *bufp;    /**< @brief Pointer to the chunk data.*/
+  size_t      buflen;   /**< @brief Length of the chunk data, in bytes.*/
+} UrosIoVec;
+
 /**
  * @brief   Connection information record.
  * @pre     @p UrosConn_LLD defines additional platform-dependent fields.
@@ -239,11 +247,13 @@ uros_err_t urosConnRecv(UrosConn *cp,
                         void **bufpp, size_t *buflenp);
 uros_err_t urosConnRecvFrom(UrosConn *cp,
                             void **bufpp, size_t *buflenp,
-                            const UrosAddr *remaddrp);
+                            UrosAddr *remaddrp);
 uros_err_t urosConnSend(UrosConn *cp,
                         const void *bufp, size_t buflen);
 uros_err_t urosConnSendConst(UrosConn *cp,
                              const void *bufp, size_t buflen);
+uros_err_t urosConnSendV(UrosConn *cp,
+                         const UrosIoVec *iovp, uros_cnt_t count);
 uros_err_t urosConnSendTo(UrosConn *cp,
                           const void *bufp, size_t buflen,
                           const UrosAddr *remaddrp);
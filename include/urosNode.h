@@ -64,6 +64,56 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define UROS_NODE_POLL_PERIOD       2000
 #endif
 
+/**
+ * @brief   Master calls packed into a single @p system.multicall request.
+ * @details Topic and service (un)registrations issued while the node
+ *          (un)registers all its resources are batched, up to this number of
+ *          calls per request. If the Master does not support
+ *          @p system.multicall, each batch is sent as pipelined requests on
+ *          a single connection. Set to @p 0 to issue a request per call.
+ */
+#if !defined(UROS_NODE_MULTICALL_LENGTH) || defined(__DOXYGEN__)
+#define UROS_NODE_MULTICALL_LENGTH  8
+#endif
+
+/**
+ * @brief   Number of cached service providers.
+ * @details Service URIs resolved by @p urosNodeResolveServicePublisher() are
+ *          cached, to skip the @p lookupService() call to the Master when
+ *          calling the same services again. Set to @p 0 to disable.
+ */
+#if !defined(UROS_NODE_SRVCACHE_LENGTH) || defined(__DOXYGEN__)
+#define UROS_NODE_SRVCACHE_LENGTH   8
+#endif
+
+/**
+ * @brief   Cached service provider lifetime, in milliseconds.
+ * @details Providers used past half their lifetime are looked up again in
+ *          the background, by the asynchronous XMLRPC call threads, so that
+ *          frequently called services do not wait for the Master.
+ */
+#if !defined(UROS_NODE_SRVCACHE_TTL) || defined(__DOXYGEN__)
+#define UROS_NODE_SRVCACHE_TTL      5000
+#endif
+
+/**
+ * @brief   Publishes a message on a fan-out topic.
+ * @see     urosNodePublishSZ()
+ *
+ * @param[in] namep
+ *          Pointer to the topic name null-terminated string.
+ * @param[in] msgp
+ *          Pointer to an initialized message object.
+ * @param[in] ctypename
+ *          Mangled version of the type name (@p msg_*).
+ * @return
+ *          Error code.
+ */
+#define urosNodePublishMsgSZ(namep, msgp, ctypename) \
+  urosNodePublishSZ((namep), (msgp), \
+                    (uros_msglen_f)length_##ctypename, \
+                    (uros_msgser_f)serialize_##ctypename)
+
 /** @} */
 
 /** @addtogroup node_types */
@@ -80,6 +130,20 @@ typedef enum uros_nodestate_t {
   UROS_NODE_SHUTDOWN                    /**< @brief Shutdown sequence.*/
 } uros_nodestate_t;
 
+#if UROS_NODE_SRVCACHE_LENGTH > 0 || defined(__DOXYGEN__)
+/**
+ * @brief   Cached service provider.
+ */
+typedef struct uros_srvcache_t {
+  UrosString        name;               /**< @brief Service name, empty if unused.*/
+  UrosAddr          addr;               /**< @brief Service provider address.*/
+  uint32_t          stampMsec;          /**< @brief Lookup timestamp, in milliseconds.*/
+#if UROS_RPCCALL_ASYNC_THREADS > 0 || defined(__DOXYGEN__)
+  uros_bool_t       refreshing;         /**< @brief Being looked up again.*/
+#endif
+} uros_srvcache_t;
+#endif
+
 /**
  * @brief   Node configuration descriptor.
  */
@@ -107,8 +171,21 @@ typedef struct UrosNodeStatus {
   UrosList          pubTopicList;       /**< @brief List of published topics.*/
   UrosList          pubServiceList;     /**< @brief List of published services.*/
   UrosList          subParamList;       /**< @brief List of parameter subscriptions.*/
+  UrosListIndex     subTopicIndex;      /**< @brief Subscribed topics, by name.*/
+  UrosListIndex     pubTopicIndex;      /**< @brief Published topics, by name.*/
+  UrosListIndex     pubServiceIndex;    /**< @brief Published services, by name.*/
+  UrosListIndex     subParamIndex;      /**< @brief Parameter subscriptions, by name.*/
   UrosList          subTcpList;         /**< @brief Subscribed TCPROS connections.*/
   UrosList          pubTcpList;         /**< @brief Published TCPROS connections.*/
+  UrosList          masterCallList;     /**< @brief Batched Master calls.*/
+  uros_bool_t       masterCallBatch;    /**< @brief Master calls are being batched.*/
+  UrosList          tcpcliPendingList;  /**< @brief Publisher connections waiting for a TCPROS Client worker.*/
+  uros_cnt_t        tcpcliBusyCnt;      /**< @brief TCPROS Client workers running or being started.*/
+  uros_cnt_t        persistentCnt;      /**< @brief Persistent service links being served.*/
+#if UROS_NODE_SRVCACHE_LENGTH > 0 || defined(__DOXYGEN__)
+  uros_srvcache_t   srvCache[UROS_NODE_SRVCACHE_LENGTH];
+                                        /**< @brief Cached service providers.*/
+#endif
 
   UrosMutex         stateLock;          /**< @brief State and exit lock.*/
   UrosMutex         xmlrpcPidLock;      /**< @brief PID lock.*/
@@ -118,6 +195,11 @@ typedef struct UrosNodeStatus {
   UrosMutex         subParamListLock;   /**< @brief Parameter subscriptions lock.*/
   UrosMutex         subTcpListLock;     /**< @brief Subscribed connections lock.*/
   UrosMutex         pubTcpListLock;     /**< @brief Published connections lock.*/
+  UrosMutex         masterCallListLock; /**< @brief Batched Master calls lock.*/
+  UrosMutex         tcpcliPendingLock;  /**< @brief Pending publisher connections lock.*/
+#if UROS_NODE_SRVCACHE_LENGTH > 0 || defined(__DOXYGEN__)
+  UrosMutex         srvCacheLock;       /**< @brief Cached service providers lock.*/
+#endif
 
   /* Threads stuff.*/
   UrosMemPool       tcpcliMemPool;      /**< @brief TCPROS Client worker stack pool.*/
@@ -128,6 +210,14 @@ typedef struct UrosNodeStatus {
   UrosThreadPool    slaveThdPool;       /**< @brief XMLRPC Slave worker thread pool.*/
   UrosThreadId      xmlrpcListenerId;   /**< @brief XMLRPC Listener thread id.*/
   UrosThreadId      tcprosListenerId;   /**< @brief TCPROS Listener thread id.*/
+#if UROS_TCPROS_USE_REACTOR || defined(__DOXYGEN__)
+  UrosThreadId      tcprosReactorIds[UROS_TCPROS_REACTOR_THREADS];
+                                        /**< @brief TCPROS reactor thread ids.*/
+#endif
+#if UROS_RPCCALL_ASYNC_THREADS > 0 || defined(__DOXYGEN__)
+  UrosThreadId      rpccallAsyncIds[UROS_RPCCALL_ASYNC_THREADS];
+                                        /**< @brief Asynchronous XMLRPC call thread ids.*/
+#endif
   UrosThreadId      nodeThreadId;       /**< @brief Node thread id.*/
   uros_bool_t       exitFlag;           /**< @brief Thread exit flag.*/
   UrosString        exitMsg;            /**< @brief Exit message string.*/
@@ -174,6 +264,18 @@ uros_err_t urosNodePublishTopicSZ(const char *namep,
 uros_err_t urosNodePublishTopicByDesc(UrosTopic *topicp);
 uros_err_t urosNodeUnpublishTopic(const UrosString *namep);
 uros_err_t urosNodeUnpublishTopicSZ(const char *namep);
+uros_err_t urosNodePublish(const UrosString *namep, void *msgp,
+                           uros_msglen_f lengthf, uros_msgser_f serializef);
+uros_err_t urosNodePublishSZ(const char *namep, void *msgp,
+                             uros_msglen_f lengthf, uros_msgser_f serializef);
+uros_err_t urosNodePublishShared(const UrosString *namep, void *msgp,
+                                 uros_msglen_f lengthf,
+                                 uros_msgser_f serializef,
+                                 uros_delete_f deletef);
+uros_err_t urosNodePublishSharedSZ(const char *namep, void *msgp,
+                                   uros_msglen_f lengthf,
+                                   uros_msgser_f serializef,
+                                   uros_delete_f deletef);
 
 uros_err_t urosNodeSubscribeTopic(const UrosString *namep,
                                   const UrosString *typep,
@@ -183,6 +285,24 @@ uros_err_t urosNodeSubscribeTopicSZ(const char *namep,
                                     const char *typep,
                                     uros_proc_f procf,
                                     uros_topicflags_t flags);
+uros_err_t urosNodeSubscribeTopicShared(const UrosString *namep,
+                                        const UrosString *typep,
+                                        uros_proc_f procf,
+                                        uros_msgproc_f msgprocf,
+                                        uros_topicflags_t flags);
+uros_err_t urosNodeSubscribeTopicSharedSZ(const char *namep,
+                                          const char *typep,
+                                          uros_proc_f procf,
+                                          uros_msgproc_f msgprocf,
+                                          uros_topicflags_t flags);
+uros_err_t urosNodeSubscribeTopicFrames(const UrosString *namep,
+                                        const UrosString *typep,
+                                        uros_tcpframe_f framef,
+                                        uros_topicflags_t flags);
+uros_err_t urosNodeSubscribeTopicFramesSZ(const char *namep,
+                                          const char *typep,
+                                          uros_tcpframe_f framef,
+                                          uros_topicflags_t flags);
 uros_err_t urosNodeSubscribeTopicByDesc(UrosTopic *topicp);
 uros_err_t urosNodeUnsubscribeTopic(const UrosString *namep);
 uros_err_t urosNodeUnsubscribeTopicSZ(const char *namep);
@@ -199,6 +319,11 @@ uros_err_t urosNodeCallServiceSZ(const char *namep,
                                  void *resobjp);
 uros_err_t urosNodeCallServiceByDesc(const UrosTopic *servicep,
                                      void *resobjp);
+uros_err_t urosNodeServiceClientOpen(UrosTcpRosSrvClient *clip,
+                                     const UrosTopic *servicep);
+uros_err_t urosNodeServiceClientCall(UrosTcpRosSrvClient *clip,
+                                     void *resobjp);
+void urosNodeServiceClientClose(UrosTcpRosSrvClient *clip);
 
 uros_err_t urosNodePublishService(const UrosString *namep,
                                   const UrosString *typep,
@@ -220,11 +345,19 @@ uros_err_t urosNodeUnsubscribeParamSZ(const char *namep);
 uros_err_t urosNodeFindNewTopicPublishers(const UrosString *topicnamep,
                                           const UrosRpcParam *publishersp,
                                           UrosList *newpubsp);
+uros_err_t urosNodeRequestTopicPublisher(const UrosAddr *apiaddrp,
+                                         const UrosString *namep,
+                                         UrosRpcResponse *resp);
+uros_err_t urosNodeParseTopicPublisher(const UrosRpcResponse *resp,
+                                       UrosAddr *tcprosaddrp);
 uros_err_t urosNodeResolveTopicPublisher(const UrosAddr *apiaddrp,
                                          const UrosString *namep,
                                          UrosAddr *tcprosaddrp);
 uros_err_t urosNodeResolveServicePublisher(const UrosString *namep,
                                            UrosAddr *pubaddrp);
+#if UROS_NODE_SRVCACHE_LENGTH > 0
+void urosNodeForgetServicePublisher(const UrosString *namep);
+#endif
 
 #ifdef __cplusplus
 }
@@ -49,6 +49,58 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* TYPES & MACROS                                                            */
 /*===========================================================================*/
 
+/**
+ * @brief   Number of kept-alive XMLRPC client connections.
+ * @details Connections to remotes honoring HTTP keep-alive are cached and
+ *          reused by later calls to the same address. Set to @p 0 to close
+ *          the connection after each call.
+ */
+#if !defined(UROS_RPCCALL_KEEPALIVE_SLOTS) || defined(__DOXYGEN__)
+#define UROS_RPCCALL_KEEPALIVE_SLOTS    4
+#endif
+
+/**
+ * @brief   Number of asynchronous XMLRPC call worker threads.
+ * @details Calls queued with @p urosRpcCallAsync() are executed concurrently
+ *          by these threads, each one on its own connection. Set to @p 0 to
+ *          execute them synchronously, by the calling thread.
+ * @note    The node issues its Master registrations, the @p requestTopic()
+ *          calls to new publishers, and the refreshes of cached service
+ *          providers through these threads. With @p 0 threads, they are
+ *          issued one at a time, as blocking calls.
+ */
+#if !defined(UROS_RPCCALL_ASYNC_THREADS) || defined(__DOXYGEN__)
+#define UROS_RPCCALL_ASYNC_THREADS      2
+#endif
+
+/**
+ * @brief   Asynchronous XMLRPC call worker thread priority.
+ */
+#if !defined(UROS_RPCCALL_ASYNC_PRIO) || defined(__DOXYGEN__)
+#define UROS_RPCCALL_ASYNC_PRIO         UROS_XMLRPC_SLAVE_PRIO
+#endif
+
+/**
+ * @brief   Asynchronous XMLRPC call worker thread stack size.
+ */
+#if !defined(UROS_RPCCALL_ASYNC_STKSIZE) || defined(__DOXYGEN__)
+#define UROS_RPCCALL_ASYNC_STKSIZE      UROS_XMLRPC_SLAVE_STKSIZE
+#endif
+
+/**
+ * @brief   Preallocated XMLRPC call contexts and buffers.
+ * @details Call contexts, with their streamer and parser buffers, are
+ *          recycled through memory pools holding this many blocks each.
+ *          The pools grow on demand beyond this size, and never shrink.
+ *          By default, it covers the concurrent callers and the
+ *          kept-alive connections, which hold their buffers while idle.
+ */
+#if !defined(UROS_RPCCALL_POOLSIZE) || defined(__DOXYGEN__)
+#define UROS_RPCCALL_POOLSIZE \
+  (1 + UROS_XMLRPC_SLAVE_POOLSIZE + UROS_RPCCALL_ASYNC_THREADS + \
+   UROS_RPCCALL_KEEPALIVE_SLOTS)
+#endif
+
 /** @addtogroup rpc_types */
 /** @{ */
 
@@ -122,6 +174,51 @@ typedef struct UrosRpcResponse {
   UrosRpcParam      *valuep;        /**< @brief Response value.*/
 } UrosRpcResponse;
 
+/**
+ * @brief   Method call of a batch.
+ */
+typedef struct UrosRpcMethodCall {
+  UrosString        method;         /**< @brief Method name.*/
+  UrosRpcParamList  params;         /**< @brief Method parameters.*/
+  UrosRpcResponse   response;       /**< @brief Method response.*/
+} UrosRpcMethodCall;
+
+struct UrosRpcCallJob;
+
+/**
+ * @brief   Asynchronous XMLRPC call handler.
+ * @details Performs the actual blocking call, usually one of the
+ *          @p urosRpcCall*() functions, storing its outcome into the
+ *          @p response of the job.
+ *
+ * @param[in,out] jobp
+ *          Pointer to the running job.
+ * @return
+ *          Error code of the call.
+ */
+typedef uros_err_t (*uros_rpccall_f)(struct UrosRpcCallJob *jobp);
+
+/**
+ * @brief   Asynchronous XMLRPC call completion handler.
+ *
+ * @param[in,out] jobp
+ *          Pointer to the completed job. Owned by the handler.
+ */
+typedef void (*uros_rpcdone_f)(struct UrosRpcCallJob *jobp);
+
+/**
+ * @brief   Asynchronous XMLRPC call job.
+ */
+typedef struct UrosRpcCallJob {
+  struct UrosRpcCallJob *nextp;     /**< @brief Next queued job.*/
+  uros_rpccall_f    callf;          /**< @brief Call handler.*/
+  uros_rpcdone_f    donef;          /**< @brief Completion handler, or @p NULL.*/
+  void              *argp;          /**< @brief User argument.*/
+  UrosRpcResponse   response;       /**< @brief Call response.*/
+  uros_err_t        err;            /**< @brief Call error code.*/
+  uros_bool_t       done;           /**< @brief The call has completed.*/
+} UrosRpcCallJob;
+
 /** @} */
 
 /*===========================================================================*/
@@ -153,6 +250,34 @@ UrosRpcParamNode *urosRpcParamListUnlinkNode(UrosRpcParamList *listp,
 void urosRpcResponseObjectInit(UrosRpcResponse *rp);
 void urosRpcResponseClean(UrosRpcResponse *rp);
 
+void urosRpcCallPoolsObjectInit(void);
+
+#if UROS_RPCCALL_KEEPALIVE_SLOTS > 0
+void urosRpcCallKeepAliveObjectInit(void);
+void urosRpcCallKeepAliveFlush(void);
+#endif
+
+void urosRpcCallJobObjectInit(UrosRpcCallJob *jobp,
+                              uros_rpccall_f callf,
+                              uros_rpcdone_f donef,
+                              void *argp);
+void urosRpcCallJobClean(UrosRpcCallJob *jobp);
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+void urosRpcCallAsyncObjectInit(void);
+uros_err_t urosRpcCallAsyncThread(void *argp);
+void urosRpcCallAsyncExit(void);
+#endif
+void urosRpcCallAsync(UrosRpcCallJob *jobp);
+uros_err_t urosRpcCallAsyncWait(UrosRpcCallJob *jobp);
+
+uros_err_t urosRpcCallMulticall(
+  const UrosAddr        *addrp,
+  UrosRpcMethodCall     *callsp,
+  uros_cnt_t            count);
+uros_err_t urosRpcCallPipeline(
+  const UrosAddr        *addrp,
+  UrosRpcMethodCall     *callsp,
+  uros_cnt_t            count);
 uros_err_t urosRpcCallRegisterService(
   const UrosAddr        *addrp,
   const UrosString      *caller_id,
@@ -68,6 +68,7 @@ typedef struct UrosRpcParser {
   char          *bufp;          /**< @brief Pointer to the refill buffer.*/
   size_t        buflen;         /**< @brief Refill buffer length.*/
   size_t        contentLength;  /**< @brief Content-Length of XMLRPC message.*/
+  uros_bool_t   keepAlive;      /**< @brief The remote keeps the connection open.*/
 } UrosRpcParser;
 
 /** @} */
@@ -98,6 +99,8 @@ uros_err_t urosRpcParserExpectNoCaseQuiet(UrosRpcParser *pp,
 uros_err_t urosRpcParserLookAhead(UrosRpcParser *pp, char c);
 uros_err_t urosRpcParserLookAheadQuiet(UrosRpcParser *pp, char c);
 uros_err_t urosRpcParserSkipUntil(UrosRpcParser *pp, char c);
+uros_err_t urosRpcParserReadUntil(UrosRpcParser *pp, char c,
+                                  char *tokp, size_t *toklenp);
 uros_err_t urosRpcParserSkip(UrosRpcParser *pp, size_t length);
 uros_err_t urosRpcParserSkipAfter(UrosRpcParser *pp,
                                   const char *tokp, size_t toklen);
@@ -151,6 +154,8 @@ uros_err_t urosRpcParserParam(UrosRpcParser *pp,
 
 uros_err_t urosRpcParserMethodResponse(UrosRpcParser *pp,
                                        UrosRpcResponse *resp);
+uros_err_t urosRpcParserMulticallResponse(UrosRpcParser *pp,
+                                          UrosRpcParam *resultsp);
 
 #ifdef __cplusplus
 }
@@ -59,7 +59,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 typedef enum uros_rpcslave_methodid_t {
 
   UROS_RPCSM_GET_BUS_INFO,      /**< @brief @p getBusInfo() command.*/
-  UROS_RPCSM_GET_BUS_STATS,     /**< @brief @p getBusStatus() command.*/
+  UROS_RPCSM_GET_BUS_STATS,     /**< @brief @p getBusStats() command.*/
   UROS_RPCSM_GET_MASTER_URI,    /**< @brief @p getMasterUri() command.*/
   UROS_RPCSM_GET_PID,           /**< @brief @p getPid() command.*/
   UROS_RPCSM_GET_PUBLICATIONS,  /**< @brief @p getPublications() command.*/
@@ -84,6 +84,7 @@ extern "C" {
 
 uros_err_t urosRpcSlaveConnectToPublishers(const UrosString *topicp,
                                            const UrosList *addrlstp);
+void urosRpcSlavePoolsObjectInit(void);
 uros_err_t urosRpcSlaveListenerThread(void *data);
 uros_err_t urosRpcSlaveServerThread(UrosConn *csp);
 
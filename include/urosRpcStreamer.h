@@ -68,10 +68,13 @@ typedef struct UrosRpcStreamer {
   UrosConn      *csp;       /**< @brief Connection status.*/
   char          *bufp;      /**< @brief Pointer to the refill buffer.*/
   size_t        buflen;     /**< @brief Refill buffer length.*/
+  char          *basebufp;  /**< @brief Buffer assigned at initialization.*/
+  size_t        basebuflen; /**< @brief Assigned buffer length.*/
   char          *curp;      /**< @brief Current parsing pointer.*/
   size_t        free;       /**< @brief Remaining free buffer characters.*/
   size_t        total;      /**< @brief Total streamed characters counter.*/
-  size_t        mark;       /**< @brief Position mark, for user purposes.*/
+  size_t        mark;       /**< @brief Pending Content-Length buffer
+                                        offset, or @p 0.*/
   uros_bool_t   chunked;    /**< @brief Use HTTP chunked Transfer-Encoding.*/
 } UrosRpcStreamer;
 
@@ -102,7 +105,7 @@ uros_err_t urosRpcStreamerHttpHeader(UrosRpcStreamer *sp,
                                      const char *valp, size_t vallen);
 uros_err_t urosRpcStreamerHttpEnd(UrosRpcStreamer *sp);
 uros_err_t urosRpcStreamerHttpContentLength(UrosRpcStreamer *sp);
-uros_err_t urosRpcStreamerXmlEndHack(UrosRpcStreamer *sp);
+uros_err_t urosRpcStreamerHttpContentEnd(UrosRpcStreamer *sp);
 
 uros_err_t urosRpcStreamerXmlAttrWVal(UrosRpcStreamer *sp,
                                       const char *namep, size_t namelen,
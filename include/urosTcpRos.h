@@ -45,11 +45,141 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "urosBase.h"
 #include "urosConn.h"
 #include "urosThreading.h"
+#include "urosRpcCall.h"
 
 /*===========================================================================*/
 /* TYPES & MACROS                                                            */
 /*===========================================================================*/
 
+/** @addtogroup tcpros_macros */
+/** @{ */
+
+/*~~~ TCPROS FRAMES ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/** @name TCPROS frames */
+/** @{ */
+
+/**
+ * @brief   Maximum length of a received message, in bytes.
+ * @details Messages declaring a greater length are rejected before any
+ *          buffer is allocated for them, so that a remote peer cannot make
+ *          the node allocate arbitrary amounts of memory.
+ * @note    The default of 64 KiB suits small targets. Nodes exchanging
+ *          larger messages, like images, should raise it.
+ */
+#if !defined(UROS_TCPROS_MAXMSGLEN) || defined(__DOXYGEN__)
+#define UROS_TCPROS_MAXMSGLEN           0x10000UL
+#endif
+
+/**
+ * @brief   Minimum length of a payload sent without being copied, in bytes.
+ * @details Variable-length fields (strings, primitive arrays) of at least
+ *          this length are written straight from the message object by
+ *          @p UROS_MSG_SEND_FRAME(), instead of being copied into the frame
+ *          buffer.
+ */
+#if !defined(UROS_TCPROS_GATHER_MINLEN) || defined(__DOXYGEN__)
+#define UROS_TCPROS_GATHER_MINLEN       256
+#endif
+
+/**
+ * @brief   Maximum number of chunks of a gathered frame.
+ * @details Further large payloads of the same frame are copied.
+ */
+#if !defined(UROS_TCPROS_GATHER_LENGTH) || defined(__DOXYGEN__)
+#define UROS_TCPROS_GATHER_LENGTH       8
+#endif
+
+#if UROS_TCPROS_GATHER_LENGTH < 3
+#error "UROS_TCPROS_GATHER_LENGTH must be at least 3"
+#endif
+
+/** @} */
+
+/*~~~ TCPROS SERVICES ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/** @name TCPROS services */
+/** @{ */
+
+/**
+ * @brief   Maximum number of persistent service links served at once.
+ * @details Each persistent link holds a TCPROS Server thread while open, so
+ *          they must leave some threads to the other connections. Further
+ *          persistent clients are served one call per connection.
+ */
+#if !defined(UROS_TCPROS_MAXPERSISTENT) || defined(__DOXYGEN__)
+#define UROS_TCPROS_MAXPERSISTENT       (UROS_TCPROS_SERVER_POOLSIZE / 2)
+#endif
+
+#if UROS_TCPROS_MAXPERSISTENT >= UROS_TCPROS_SERVER_POOLSIZE
+#error "UROS_TCPROS_MAXPERSISTENT must be less than UROS_TCPROS_SERVER_POOLSIZE"
+#endif
+
+/** @} */
+
+/*~~~ TCPROS FAN-OUT ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/** @name TCPROS fan-out */
+/** @{ */
+
+/** @brief Number of frames held by a fan-out ring, as a power of two.*/
+#if !defined(UROS_TCPROS_FANOUT_LENGTH) || defined(__DOXYGEN__)
+#define UROS_TCPROS_FANOUT_LENGTH       8
+#endif
+
+#if (UROS_TCPROS_FANOUT_LENGTH & (UROS_TCPROS_FANOUT_LENGTH - 1)) != 0
+#error "UROS_TCPROS_FANOUT_LENGTH must be a power of two"
+#endif
+
+/** @} */
+
+/*~~~ TCPROS MESSAGE ARENA ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/** @name TCPROS message arena */
+/** @{ */
+
+/**
+ * @brief   Alignment of the message arena allocations, as a power of two.
+ * @details It must satisfy the alignment of any message field type.
+ */
+#if !defined(UROS_TCPROS_ARENA_ALIGN) || defined(__DOXYGEN__)
+#define UROS_TCPROS_ARENA_ALIGN         8
+#endif
+
+/**
+ * @brief   Allocates an array from a message arena.
+ * @see     urosTcpRosArenaArrayAlloc()
+ *
+ * @param[in,out] arenap
+ *          Pointer to an initialized @p UrosTcpRosArena object, or @p NULL
+ *          to allocate from the heap.
+ * @param[in] n
+ *          Number of array entries.
+ * @param[in] type
+ *          Array entry type.
+ * @return
+ *          Pointer to the allocated array.
+ * @retval NULL
+ *          Not enough free memory, or the array size overflows.
+ */
+#define urosTcpRosArenaArrayNew(arenap, n, type) \
+  ((type *)urosTcpRosArenaArrayAlloc((arenap), (size_t)(n), sizeof(type)))
+
+/**
+ * @brief   Frame data pointer.
+ *
+ * @param[in] framep
+ *          Pointer to a @p UrosTcpRosFrame descriptor.
+ * @return
+ *          Pointer to the frame data, starting with the length prefix.
+ */
+#define urosTcpRosFrameData(framep) \
+  ((uint8_t*)((UrosTcpRosFrame*)(framep) + 1))
+
+/** @} */
+
+/** @} */
+
 /** @addtogroup tcpros_types */
 /** @{ */
 
@@ -60,8 +190,24 @@ typedef struct uros_tcpcliargs_t {
   UrosString        topicName;      /**< @brief Topic name.*/
   uros_topicflags_t topicFlags;     /**< @brief Topic flags.*/
   UrosAddr          remoteAddr;     /**< @brief Remote connection address.*/
+  uros_bool_t       requested;      /**< @brief @p requestJob was issued.*/
+  UrosRpcCallJob    requestJob;     /**< @brief Asynchronous @p requestTopic() job.*/
 } uros_tcpcliargs_t;
 
+/**
+ * @brief   Message arena.
+ * @details Bump allocator for the variable-length fields of received
+ *          messages. All of its allocations are released at once by
+ *          @p urosTcpRosArenaReset().
+ */
+typedef struct UrosTcpRosArena {
+  uint8_t           *basep;         /**< @brief Arena memory chunk.*/
+  size_t            size;           /**< @brief Size of the arena memory chunk.*/
+  size_t            used;           /**< @brief Bytes used inside the arena chunk.*/
+  size_t            peak;           /**< @brief Bytes requested since the last reset.*/
+  void              *overflowp;     /**< @brief Chunks allocated when the arena was full.*/
+} UrosTcpRosArena;
+
 /**
  * @brief   TCPROS connection status object.
  */
@@ -74,8 +220,32 @@ typedef struct UrosTcpRosStatus {
   uros_bool_t       threadExit;     /**< @brief Thread exit request.*/
   UrosMutex         threadExitMtx;  /**< @brief Thread exit request mutex.*/
   UrosString        errstr;         /**< @brief Error string.*/
+  uint8_t           *sendframep;    /**< @brief Outgoing frame buffer.*/
+  size_t            sendframesize;  /**< @brief Outgoing frame buffer size.*/
+  uint8_t           *recvframep;    /**< @brief Incoming frame buffer.*/
+  size_t            recvframesize;  /**< @brief Incoming frame buffer size.*/
+  uint32_t          fanoutSeq;      /**< @brief Next fan-out frame to be sent.*/
+  struct UrosUdpRosLink *udplinkp;  /**< @brief UDPROS link, if not a TCPROS stream.*/
+  UrosTopic         *localTopicp;   /**< @brief Local published topic, for intra-process links.*/
+  struct UrosTcpRosFrame *localFramep; /**< @brief Shared frame being read by an intra-process link.*/
+  size_t            localOffset;    /**< @brief Read offset inside the shared frame.*/
+  uint32_t          connId;         /**< @brief Connection ID, unique within the node.*/
+  uint32_t          numMsgs;        /**< @brief Messages sent or received, written only by the connection thread.*/
+  UrosTcpRosArena   arena;          /**< @brief Arena of the received message contents.*/
+  void              *reactorp;      /**< @brief Reactor link, if attached to a reactor.*/
 } UrosTcpRosStatus;
 
+/**
+ * @brief   Persistent TCPROS service client.
+ * @details Keeps the connection to a service provider open across calls.
+ */
+typedef struct UrosTcpRosSrvClient {
+  UrosTopic         service;        /**< @brief Service descriptor, @p persistent set.*/
+  UrosConn          conn;           /**< @brief Connection handle.*/
+  UrosTcpRosStatus  tcpst;          /**< @brief TCPROS status of the connection.*/
+  uros_bool_t       connected;      /**< @brief The connection header was exchanged.*/
+} UrosTcpRosSrvClient;
+
 /**
  * @brief   TCPROS variable array descriptor.
  */
@@ -97,11 +267,131 @@ typedef struct UrosTcpRosArray {
 typedef uros_err_t (*uros_tcpsrvcall_t)(UrosTcpRosStatus *tcpstp,
                                         void *resobjp);
 
+/**
+ * @brief   Message length function.
+ * @details Computes the serialized length of a message, as done by the
+ *          generated @p length_*() functions.
+ *
+ * @param[in] objp
+ *          Pointer to an initialized message object.
+ * @return
+ *          Length of the serialized message body, in bytes.
+ */
+typedef size_t (*uros_msglen_f)(void *objp);
+
+/**
+ * @brief   Message serialization function.
+ * @details Serializes a message into a buffer, as done by the generated
+ *          @p serialize_*() functions.
+ *
+ * @param[out] bufp
+ *          Pointer to the buffer, large enough to hold the message body.
+ * @param[in] objp
+ *          Pointer to an initialized message object.
+ * @return
+ *          Pointer to the first byte after the serialized message.
+ */
+typedef uint8_t *(*uros_msgser_f)(uint8_t *bufp, void *objp);
+
+/**
+ * @brief   Shared TCPROS message frame.
+ * @details Reference counted message frame, including its length prefix.
+ *          The frame data follows the descriptor in the same memory chunk.
+ *
+ *          A frame can also own the published message object, which is handed
+ *          as is to intra-process subscribers. Its body is then serialized
+ *          only when a connection needs it.
+ */
+typedef struct UrosTcpRosFrame {
+  uros_cnt_t        refcnt;         /**< @brief Reference counter.*/
+  size_t            length;         /**< @brief Frame length, with prefix.*/
+  void              *msgp;          /**< @brief Owned message object, if any.*/
+  uros_delete_f     msgdelf;        /**< @brief Message object deleter.*/
+  uros_msgser_f     serializef;     /**< @brief Pending body serializer, if not serialized yet.*/
+} UrosTcpRosFrame;
+
+/**
+ * @brief   Gathered TCPROS message frame.
+ * @details Outgoing frame made of chunks. Fixed-size fields are copied into
+ *          the frame buffer, while large payloads are referenced where they
+ *          are, and written by a single gather call.
+ */
+typedef struct UrosTcpRosGather {
+  uint8_t           *bufp;          /**< @brief Next free byte of the frame buffer.*/
+  uint8_t           *stagedp;       /**< @brief Beginning of the pending copied chunk.*/
+  uros_cnt_t        count;          /**< @brief Number of closed chunks.*/
+  uros_cnt_t        maxcount;       /**< @brief Maximum number of chunks, @p 0 to copy everything.*/
+  /** @brief Closed chunks, in stream order.*/
+  UrosIoVec         chunks[UROS_TCPROS_GATHER_LENGTH];
+} UrosTcpRosGather;
+
+/**
+ * @brief   TCPROS fan-out ring.
+ * @details Ring of the latest serialized frames of a published topic.
+ *          The ring is filled once per message, and each publisher connection
+ *          drains it at its own pace.
+ */
+typedef struct UrosTcpRosFanout {
+  /** @brief Ring of the latest frames, indexed by sequence number.*/
+  UrosTcpRosFrame   *frames[UROS_TCPROS_FANOUT_LENGTH];
+  uint32_t          headSeq;        /**< @brief Sequence of the next frame.*/
+  UrosList          readerList;     /**< @brief Draining TCPROS connections.*/
+  uros_cnt_t        numDropped;     /**< @brief Frames skipped by readers.*/
+  uros_bool_t       closed;         /**< @brief No more frames to be pushed.*/
+  UrosMutex         lock;           /**< @brief Ring lock.*/
+  UrosCondVar       pushedCond;     /**< @brief A frame was pushed.*/
+  UrosCondVar       drainedCond;    /**< @brief A reader moved or left.*/
+} UrosTcpRosFanout;
+
 /** @} */
 
 /** @addtogroup tcpros_macros */
 /** @{ */
 
+/*~~~ TCPROS CLIENT ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/** @name TCPROS client */
+/** @{ */
+
+/** @brief Maximum number of publisher connections waiting for a worker.*/
+#if !defined(UROS_TCPROS_CLIENT_PENDING) || defined(__DOXYGEN__)
+#define UROS_TCPROS_CLIENT_PENDING      32
+#endif
+
+/** @} */
+
+/*~~~ TCPROS REACTOR ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/** @name TCPROS reactor */
+/** @{ */
+
+/** @brief Multiplexes @p reactor and fan-out topic links onto reactor threads.*/
+#if !defined(UROS_TCPROS_USE_REACTOR) || defined(__DOXYGEN__)
+#define UROS_TCPROS_USE_REACTOR         UROS_FALSE
+#endif
+
+/** @brief Number of TCPROS reactor threads.*/
+#if !defined(UROS_TCPROS_REACTOR_THREADS) || defined(__DOXYGEN__)
+#define UROS_TCPROS_REACTOR_THREADS     2
+#endif
+
+/** @brief TCPROS reactor thread priority.*/
+#if !defined(UROS_TCPROS_REACTOR_PRIO) || defined(__DOXYGEN__)
+#define UROS_TCPROS_REACTOR_PRIO        UROS_TCPROS_CLIENT_PRIO
+#endif
+
+/** @brief TCPROS reactor thread stack size.*/
+#if !defined(UROS_TCPROS_REACTOR_STKSIZE) || defined(__DOXYGEN__)
+#define UROS_TCPROS_REACTOR_STKSIZE     UROS_TCPROS_CLIENT_STKSIZE
+#endif
+
+/** @brief Maximum number of events handled by a single reactor wait.*/
+#if !defined(UROS_TCPROS_REACTOR_MAXEVENTS) || defined(__DOXYGEN__)
+#define UROS_TCPROS_REACTOR_MAXEVENTS   16
+#endif
+
+/** @} */
+
 /*~~~ TCPROS CONNECTION ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /** @name TCPROS connection */
@@ -155,6 +445,76 @@ typedef uros_err_t (*uros_tcpsrvcall_t)(UrosTcpRosStatus *tcpstp,
 
 /** @} */
 
+/*~~~ TCPROS SERIALIZATION ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/** @name TCPROS serialization */
+/** @{ */
+
+/**
+ * @brief   Writes some data to a serialization buffer.
+ *
+ * @param[in] bufp
+ *          Pointer to the serialization buffer.
+ * @param[in] valuep
+ *          Pointer to the data to be written.
+ * @param[in] length
+ *          Length of the data to be written, in bytes. Can be @p 0.
+ * @return
+ *          Pointer to the first byte after the written data.
+ */
+#define urosTcpRosPut(bufp, valuep, length) \
+  ((uint8_t *)memcpy((bufp), (valuep), (length)) + (length))
+
+/**
+ * @brief   Writes a raw value to a serialization buffer.
+ * @details The raw value is written in a little-endian fashion.
+ * @warning On big endian architectures, be careful not to specify a @p value
+ *          of complex (@e struct or @e union) type, because the @b whole value
+ *          will be written in reverse order, not its primitive fields
+ *          individually as expected.
+ *
+ * @param[in] bufp
+ *          Pointer to the serialization buffer.
+ * @param[in] value
+ *          Value to be written. It must be addressable by a pointer.
+ * @return
+ *          Pointer to the first byte after the written value.
+ */
+#if UROS_ENDIANNESS == 321
+#define urosTcpRosPutRaw(bufp, value) \
+  urosTcpRosPutRev((bufp), &(value), sizeof(value))
+#else
+#define urosTcpRosPutRaw(bufp, value) \
+  urosTcpRosPut((bufp), &(value), sizeof(value))
+#endif
+
+/**
+ * @brief   Reads a raw value from a deserialization buffer.
+ * @details The raw value is read in a little-endian fashion.
+ * @warning On big endian architectures, be careful not to specify a @p value
+ *          of complex (@e struct or @e union) type, because the @b whole value
+ *          will be read in reverse order, not its primitive fields
+ *          individually as expected.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the deserialization buffer pointer.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[out] value
+ *          Value to be read. It must be addressable by a pointer.
+ * @return
+ *          Error code.
+ */
+#if UROS_ENDIANNESS == 321
+#define urosTcpRosGetRaw(bufpp, buflenp, value) \
+  urosTcpRosGetRev((bufpp), (buflenp), &(value), sizeof(value))
+#else
+#define urosTcpRosGetRaw(bufpp, buflenp, value) \
+  urosTcpRosGet((bufpp), (buflenp), &(value), sizeof(value))
+#endif
+
+/** @} */
+
 /*~~~ TCPROS ARRAY ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /** @name TCPROS array */
@@ -216,6 +576,20 @@ typedef uros_err_t (*uros_tcpsrvcall_t)(UrosTcpRosStatus *tcpstp,
 #define UROS_HND_FINALLY        _finally
 #endif
 
+/**
+ * @brief   Name of the frame body pointer in frame handlers.
+ */
+#if !defined(UROS_HND_FRAMEP) || defined(__DOXYGEN__)
+#define UROS_HND_FRAMEP         framep
+#endif
+
+/**
+ * @brief   Name of the frame body length in frame handlers.
+ */
+#if !defined(UROS_HND_FRAMELEN) || defined(__DOXYGEN__)
+#define UROS_HND_FRAMELEN       framelen
+#endif
+
 /*~~~ TCPROS MESSAGES ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /** @name TCPROS messages */
@@ -278,9 +652,37 @@ typedef uros_err_t (*uros_tcpsrvcall_t)(UrosTcpRosStatus *tcpstp,
   { clean_##ctypename(msgvarp); }
 
 /**
- * @brief   Sends the length of the message (message header).
- * @details This macro handles timeouts and errors. If unsuccessful, it goes to
- *          @p UROS_HND_FINALLY.
+ * @brief   Uninitializes a message descriptor in the heap, received into the
+ *          message arena.
+ * @details The message contents are owned by the arena, so they are not
+ *          cleaned. The descriptor is deleted from the heap.
+ * @see     UROS_MSG_RECV_BODY_ARENA()
+ *
+ * @param[in] msgvarp
+ *          Pointer to the message.
+ */
+#define UROS_MSG_UNINIT_ARENA_H(msgvarp) \
+  { urosFree(msgvarp); }
+
+/**
+ * @brief   Uninitializes a message descriptor on the stack, received into the
+ *          message arena.
+ * @details The message contents are owned by the arena, so they are not
+ *          cleaned.
+ * @see     UROS_MSG_RECV_BODY_ARENA()
+ *
+ * @param[in] msgvarp
+ *          Pointer to the message.
+ */
+#define UROS_MSG_UNINIT_ARENA_S(msgvarp) \
+  { (void)(msgvarp); }
+
+/**
+ * @brief   Computes the length of the message (message header).
+ * @details The length is stored into @p UROS_HND_LENVAR. It is sent together
+ *          with the message body by @p UROS_MSG_SEND_FRAME(), as a single
+ *          frame.
+ * @see     UROS_MSG_SEND_LENGTH()
  *
  * @param[in] msgvarp
  *          Pointer to an initialized message.
@@ -288,14 +690,8 @@ typedef uros_err_t (*uros_tcpsrvcall_t)(UrosTcpRosStatus *tcpstp,
  *          Mangled version of the type name (@p msg_*, @p in_srv_*,
  *          @p out_srv_*).
  */
-#define UROS_MSG_SEND_LENGTH(msgvarp, ctypename) \
-  { size_t start = (UROS_HND_TCPSTP)->csp->sentlen; \
-    UROS_HND_LENVAR = (uint32_t)length_##ctypename(msgvarp); \
-    while (urosTcpRosSendRaw(UROS_HND_TCPSTP, UROS_HND_LENVAR) != UROS_OK) { \
-      if ((UROS_HND_TCPSTP)->err != UROS_ERR_TIMEOUT || \
-          (UROS_HND_TCPSTP)->csp->sentlen != start || \
-          urosTcpRosStatusCheckExit(UROS_HND_TCPSTP)) { \
-        goto UROS_HND_FINALLY; } } }
+#define UROS_MSG_FRAME_LENGTH(msgvarp, ctypename) \
+  { UROS_HND_LENVAR = (uint32_t)length_##ctypename(msgvarp); }
 
 /**
  * @brief   Receives the length of the message (message header).
@@ -311,10 +707,65 @@ typedef uros_err_t (*uros_tcpsrvcall_t)(UrosTcpRosStatus *tcpstp,
         goto UROS_HND_FINALLY; } } }
 
 /**
- * @brief   Sends the body of the message.
- * @details This macro handles timeouts and errors. If unsuccessful, it goes to
+ * @brief   Sends the whole message frame.
+ * @details The message length computed by @p UROS_MSG_FRAME_LENGTH() and the
+ *          message body are serialized into the frame buffer of
+ *          @p UROS_HND_TCPSTP, and sent with a single call. Variable-length
+ *          fields of at least @p UROS_TCPROS_GATHER_MINLEN bytes are not
+ *          copied, but written straight from the message object.
+ *          This macro handles timeouts and errors. If unsuccessful, it goes to
  *          @p UROS_HND_FINALLY.
  *
+ * @pre     @p UROS_MSG_FRAME_LENGTH() was called with the same message.
+ *
+ * @param[in] msgvarp
+ *          Pointer to an initialized message.
+ * @param[in] ctypename
+ *          Mangled version of the type name (@p msg_*, @p in_srv_*,
+ *          @p out_srv_*).
+ */
+#define UROS_MSG_SEND_FRAME(msgvarp, ctypename) \
+  { size_t start = (UROS_HND_TCPSTP)->csp->sentlen; UrosTcpRosGather gather; \
+    if (urosTcpRosGatherBegin(UROS_HND_TCPSTP, &gather, \
+                              UROS_HND_LENVAR) != UROS_OK) { \
+      goto UROS_HND_FINALLY; } \
+    serializev_##ctypename(&gather, msgvarp); \
+    while (urosTcpRosGatherSend(UROS_HND_TCPSTP, &gather) != UROS_OK) { \
+      if ((UROS_HND_TCPSTP)->err != UROS_ERR_TIMEOUT || \
+          (UROS_HND_TCPSTP)->csp->sentlen != start || \
+          urosTcpRosStatusCheckExit(UROS_HND_TCPSTP)) { \
+        goto UROS_HND_FINALLY; } } }
+
+/**
+ * @brief   Computes the length of the message (message header).
+ * @details Kept for existing handlers, same as @p UROS_MSG_FRAME_LENGTH().
+ *          The length is no longer sent by itself, but as the prefix of the
+ *          frame sent by @p UROS_MSG_SEND_BODY().
+ * @warning Handlers must not send anything between this macro and
+ *          @p UROS_MSG_SEND_BODY(), or it would precede the length prefix.
+ *
+ * @param[in] msgvarp
+ *          Pointer to an initialized message.
+ * @param[in] ctypename
+ *          Mangled version of the type name (@p msg_*, @p in_srv_*,
+ *          @p out_srv_*).
+ */
+#define UROS_MSG_SEND_LENGTH(msgvarp, ctypename) \
+  UROS_MSG_FRAME_LENGTH(msgvarp, ctypename)
+
+/**
+ * @brief   Sends the whole message frame, serialized into a single buffer.
+ * @details Kept for existing handlers. The message length computed by
+ *          @p UROS_MSG_SEND_LENGTH() and the whole message body are
+ *          serialized by @p serialize_*() into the frame buffer of
+ *          @p UROS_HND_TCPSTP, and sent with a single call. Unlike
+ *          @p UROS_MSG_SEND_FRAME(), nothing is gathered from the message
+ *          object.
+ *          This macro handles timeouts and errors. If unsuccessful, it goes to
+ *          @p UROS_HND_FINALLY.
+ *
+ * @pre     @p UROS_MSG_SEND_LENGTH() was called with the same message.
+ *
  * @param[in] msgvarp
  *          Pointer to an initialized message.
  * @param[in] ctypename
@@ -322,13 +773,23 @@ typedef uros_err_t (*uros_tcpsrvcall_t)(UrosTcpRosStatus *tcpstp,
  *          @p out_srv_*).
  */
 #define UROS_MSG_SEND_BODY(msgvarp, ctypename) \
-  { send_##ctypename(UROS_HND_TCPSTP, msgvarp); \
-    if ((UROS_HND_TCPSTP)->err != UROS_OK) { \
-      goto UROS_HND_FINALLY; } }
+  { size_t start = (UROS_HND_TCPSTP)->csp->sentlen; \
+    uint8_t *bodyp = urosTcpRosFrameBegin(UROS_HND_TCPSTP, UROS_HND_LENVAR); \
+    if (bodyp == NULL) { goto UROS_HND_FINALLY; } \
+    serialize_##ctypename(bodyp, msgvarp); \
+    while (urosTcpRosFrameSend(UROS_HND_TCPSTP, UROS_HND_LENVAR) != UROS_OK) { \
+      if ((UROS_HND_TCPSTP)->err != UROS_ERR_TIMEOUT || \
+          (UROS_HND_TCPSTP)->csp->sentlen != start || \
+          urosTcpRosStatusCheckExit(UROS_HND_TCPSTP)) { \
+        goto UROS_HND_FINALLY; } } }
 
 /**
  * @brief   Receives the body of the message.
- * @details This macro handles timeouts and errors. If unsuccessful, it goes to
+ * @details The whole message frame of @p UROS_HND_LENVAR bytes is received
+ *          into the frame buffer of @p UROS_HND_TCPSTP, and then decoded.
+ *          The decoder is bounded by the declared message length, which must
+ *          be consumed exactly.
+ *          This macro handles timeouts and errors. If unsuccessful, it goes to
  *          @p UROS_HND_FINALLY.
  *
  * @param[in] msgvarp
@@ -338,14 +799,78 @@ typedef uros_err_t (*uros_tcpsrvcall_t)(UrosTcpRosStatus *tcpstp,
  *          @p out_srv_*).
  */
 #define UROS_MSG_RECV_BODY(msgvarp, ctypename) \
-  { recv_##ctypename(UROS_HND_TCPSTP, msgvarp); \
+  { const uint8_t *bodyp; size_t bodylen; \
+    if (urosTcpRosFrameRecv(UROS_HND_TCPSTP, UROS_HND_LENVAR) != UROS_OK) { \
+      goto UROS_HND_FINALLY; } \
+    bodyp = (UROS_HND_TCPSTP)->recvframep; \
+    bodylen = (size_t)UROS_HND_LENVAR; \
+    (UROS_HND_TCPSTP)->err = deserialize_##ctypename(&bodyp, &bodylen, \
+                                                     NULL, msgvarp); \
     if ((UROS_HND_TCPSTP)->err != UROS_OK) { goto UROS_HND_FINALLY; } \
-    urosError((size_t)UROS_HND_LENVAR != length_##ctypename(msgvarp), \
+    urosError(bodylen != 0, \
               { (UROS_HND_TCPSTP)->err = UROS_ERR_BADPARAM; \
                 goto UROS_HND_FINALLY; }, \
-              ("Wrong message length %u, expected %u\n", \
-                (unsigned)UROS_HND_LENVAR, \
-                (unsigned)length_##ctypename(msgvarp))); }
+              ("Wrong message length %u, %u bytes not decoded\n", \
+                (unsigned)UROS_HND_LENVAR, (unsigned)bodylen)); }
+
+/**
+ * @brief   Receives the body of the message into the message arena.
+ * @details Like @p UROS_MSG_RECV_BODY(), but the variable-length fields of
+ *          the message are allocated from the arena of @p UROS_HND_TCPSTP,
+ *          which is reset first. The contents of the previously received
+ *          message are released this way, all at once.
+ * @warning The message contents must @b not be cleaned, and are valid only
+ *          until the next message is received. The message descriptor must
+ *          be uninitialized with @p UROS_MSG_UNINIT_ARENA_H() or
+ *          @p UROS_MSG_UNINIT_ARENA_S().
+ *
+ * @param[in] msgvarp
+ *          Pointer to an initialized message.
+ * @param[in] ctypename
+ *          Mangled version of the type name (@p msg_*, @p in_srv_*,
+ *          @p out_srv_*).
+ */
+#define UROS_MSG_RECV_BODY_ARENA(msgvarp, ctypename) \
+  { const uint8_t *bodyp; size_t bodylen; \
+    if (urosTcpRosFrameRecv(UROS_HND_TCPSTP, UROS_HND_LENVAR) != UROS_OK) { \
+      goto UROS_HND_FINALLY; } \
+    urosTcpRosArenaReset(&(UROS_HND_TCPSTP)->arena); \
+    bodyp = (UROS_HND_TCPSTP)->recvframep; \
+    bodylen = (size_t)UROS_HND_LENVAR; \
+    (UROS_HND_TCPSTP)->err = deserialize_##ctypename( \
+      &bodyp, &bodylen, &(UROS_HND_TCPSTP)->arena, msgvarp); \
+    if ((UROS_HND_TCPSTP)->err != UROS_OK) { goto UROS_HND_FINALLY; } \
+    urosError(bodylen != 0, \
+              { (UROS_HND_TCPSTP)->err = UROS_ERR_BADPARAM; \
+                goto UROS_HND_FINALLY; }, \
+              ("Wrong message length %u, %u bytes not decoded\n", \
+                (unsigned)UROS_HND_LENVAR, (unsigned)bodylen)); }
+
+/**
+ * @brief   Decodes the frame of a frame handler into the message arena.
+ * @details The variable-length contents are allocated in the message arena,
+ *          which is reset first. In case of errors, goes to
+ *          @p UROS_HND_FINALLY.
+ * @see     uros_tcpframe_f
+ *
+ * @param[in] msgvarp
+ *          Pointer to the message.
+ * @param[in] ctypename
+ *          Mangled version of the type name (@p msg_*, @p in_srv_*,
+ *          @p out_srv_*).
+ */
+#define UROS_MSG_DECODE_FRAME(msgvarp, ctypename) \
+  { const uint8_t *bodyp = (UROS_HND_FRAMEP); \
+    size_t bodylen = (UROS_HND_FRAMELEN); \
+    urosTcpRosArenaReset(&(UROS_HND_TCPSTP)->arena); \
+    (UROS_HND_TCPSTP)->err = deserialize_##ctypename( \
+      &bodyp, &bodylen, &(UROS_HND_TCPSTP)->arena, msgvarp); \
+    if ((UROS_HND_TCPSTP)->err != UROS_OK) { goto UROS_HND_FINALLY; } \
+    urosError(bodylen != 0, \
+              { (UROS_HND_TCPSTP)->err = UROS_ERR_BADPARAM; \
+                goto UROS_HND_FINALLY; }, \
+              ("Wrong message length %u, %u bytes not decoded\n", \
+                (unsigned)(UROS_HND_FRAMELEN), (unsigned)bodylen)); }
 
 /** @} */
 
@@ -454,6 +979,46 @@ typedef uros_err_t (*uros_tcpsrvcall_t)(UrosTcpRosStatus *tcpstp,
 #define UROS_TPC_UNINIT_S(ctypename) \
   UROS_MSG_UNINIT_S(UROS_TPC_MSGPTR_S, ctypename);
 
+/**
+ * @brief   Topic handler epilogue, for messages received into the arena.
+ * @details This macro deallocates the message descriptor from the heap,
+ *          without cleaning the contents owned by the message arena.
+ * @see     UROS_MSG_RECV_BODY_ARENA()
+ * @note    This macro should be placed after the @p UROS_HND_FINALLY label.
+ */
+#define UROS_TPC_UNINIT_ARENA_H() \
+  UROS_MSG_UNINIT_ARENA_H(UROS_TPC_MSGPTR_H);
+
+/**
+ * @brief   Topic handler epilogue, for messages received into the arena.
+ * @details The contents owned by the message arena are not cleaned.
+ * @see     UROS_MSG_RECV_BODY_ARENA()
+ * @note    This macro should be placed after the @p UROS_HND_FINALLY label.
+ */
+#define UROS_TPC_UNINIT_ARENA_S() \
+  UROS_MSG_UNINIT_ARENA_S(UROS_TPC_MSGPTR_S);
+
+/**
+ * @brief   Frame handler prologue.
+ * @details This macro defines the following:
+ *          -# declaration of the @p UROS_TPC_MSGDECL_S message descriptor;
+ *          -# assertions about the @p UROS_HND_TCPSTP object and the frame;
+ *          -# initialization of the message descriptor.
+ * @see     UROS_MSG_DECODE_FRAME()
+ * @note    This macro should be placed at the beginning of the handler
+ *          function, just after variable declarations (if any).
+ *
+ * @param[in] ctypename
+ *          Mangled version of the type name (@p msg_*).
+ */
+#define UROS_FRM_INIT_S(ctypename) \
+  struct ctypename UROS_TPC_MSGDECL_S; \
+  urosAssert((UROS_HND_TCPSTP) != NULL); \
+  urosAssert((UROS_HND_TCPSTP)->topicp != NULL); \
+  urosAssert((UROS_HND_TCPSTP)->topicp->flags.reactor); \
+  urosAssert(!((UROS_HND_FRAMELEN) > 0) || (UROS_HND_FRAMEP) != NULL); \
+  UROS_MSG_INIT_S(UROS_TPC_MSGPTR_S, ctypename)
+
 /** @} */
 
 /*~~~ TCPROS SERVICES ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -762,7 +1327,6 @@ typedef uros_err_t (*uros_tcpsrvcall_t)(UrosTcpRosStatus *tcpstp,
   urosAssert((UROS_HND_TCPSTP) != NULL); \
   urosAssert((UROS_HND_TCPSTP)->topicp != NULL); \
   urosAssert((UROS_HND_TCPSTP)->topicp->flags.service); \
-  urosAssert(!(UROS_HND_TCPSTP)->topicp->flags.persistent); \
   urosAssert(urosConnIsValid((UROS_HND_TCPSTP)->csp)); \
   init_##outctypename(UROS_SRV_OUTPTR_H);
 
@@ -779,12 +1343,21 @@ extern "C" {
 #endif
 
 void urosTopicSubParamsDelete(uros_tcpcliargs_t *parp);
+void urosTopicSubParamsRequest(uros_tcpcliargs_t *parp);
+
+void urosTcpRosArenaObjectInit(UrosTcpRosArena *arenap);
+void urosTcpRosArenaClean(UrosTcpRosArena *arenap);
+void urosTcpRosArenaReset(UrosTcpRosArena *arenap);
+void *urosTcpRosArenaAlloc(UrosTcpRosArena *arenap, size_t size);
+void *urosTcpRosArenaArrayAlloc(UrosTcpRosArena *arenap,
+                                size_t n, size_t size);
 
 void urosTcpRosStatusObjectInit(UrosTcpRosStatus *tcpstp, UrosConn *csp);
 void urosTcpRosStatusClean(UrosTcpRosStatus *tcpstp, uros_bool_t deep);
 void urosTcpRosStatusDelete(UrosTcpRosStatus *tcpstp, uros_bool_t deep);
 void urosTcpRosStatusIssueExit(UrosTcpRosStatus *tcpstp);
 uros_bool_t urosTcpRosStatusCheckExit(UrosTcpRosStatus *tcpstp);
+const UrosConn *urosTcpRosStatusConn(const UrosTcpRosStatus *tcpstp);
 
 void urosTcpRosArrayObjectInit(UrosTcpRosArray *arrayp);
 void urosTcpRosArrayClean(UrosTcpRosArray *arrayp);
@@ -801,6 +1374,8 @@ uros_err_t urosTcpRosRecvString(UrosTcpRosStatus *tcpstp,
                                 UrosString *strp);
 uros_err_t urosTcpRosSend(UrosTcpRosStatus *tcpstp,
                           const void *bufp, size_t buflen);
+uros_err_t urosTcpRosSendV(UrosTcpRosStatus *tcpstp,
+                           const UrosIoVec *iovp, uros_cnt_t count);
 uros_err_t urosTcpRosSendRev(UrosTcpRosStatus *tcpstp,
                              const void *bufp, size_t buflen);
 uros_err_t urosTcpRosSendString(UrosTcpRosStatus *tcpstp,
@@ -808,8 +1383,30 @@ uros_err_t urosTcpRosSendString(UrosTcpRosStatus *tcpstp,
 uros_err_t urosTcpRosSendStringSZ(UrosTcpRosStatus *tcpstp,
                                   const char *strp);
 uros_err_t urosTcpRosSendError(UrosTcpRosStatus *tcpstp);
+uint8_t *urosTcpRosPutRev(uint8_t *bufp, const void *valuep, size_t length);
+uint8_t *urosTcpRosPutString(uint8_t *bufp, const UrosString *strp);
+uint8_t *urosTcpRosFrameBegin(UrosTcpRosStatus *tcpstp, uint32_t msglen);
+uros_err_t urosTcpRosFrameSend(UrosTcpRosStatus *tcpstp, uint32_t msglen);
+uros_err_t urosTcpRosGatherBegin(UrosTcpRosStatus *tcpstp,
+                                 UrosTcpRosGather *gp, uint32_t msglen);
+void urosTcpRosGather(UrosTcpRosGather *gp,
+                      const void *datap, size_t length);
+void urosTcpRosGatherString(UrosTcpRosGather *gp, const UrosString *strp);
+uros_err_t urosTcpRosGatherSend(UrosTcpRosStatus *tcpstp,
+                                UrosTcpRosGather *gp);
+uros_err_t urosTcpRosGet(const uint8_t **bufpp, size_t *buflenp,
+                         void *valuep, size_t length);
+uros_err_t urosTcpRosGetRev(const uint8_t **bufpp, size_t *buflenp,
+                            void *valuep, size_t length);
+uros_err_t urosTcpRosGetString(const uint8_t **bufpp, size_t *buflenp,
+                               UrosTcpRosArena *arenap,
+                               UrosString *strp);
+uros_err_t urosTcpRosFrameRecv(UrosTcpRosStatus *tcpstp, uint32_t msglen);
 uros_err_t urosTcpRosSendHeader(UrosTcpRosStatus *tcpstp,
                                 uros_bool_t isrequest);
+uros_err_t urosTcpRosPackHeader(const UrosTcpRosStatus *tcpstp,
+                                uros_bool_t isrequest,
+                                UrosString *hdrp);
 uros_err_t urosTcpRosRecvHeader(UrosTcpRosStatus *tcpstp,
                                 uros_bool_t isrequest,
                                 uros_bool_t isservice);
@@ -817,6 +1414,13 @@ uros_err_t urosTcpRosRecvHeader(UrosTcpRosStatus *tcpstp,
 uros_err_t urosTcpRosCallService(const UrosAddr *pubaddrp,
                                  const UrosTopic *servicep,
                                  void *resobjp);
+void urosTcpRosSrvClientObjectInit(UrosTcpRosSrvClient *clip,
+                                   const UrosTopic *servicep);
+void urosTcpRosSrvClientClean(UrosTcpRosSrvClient *clip);
+uros_err_t urosTcpRosSrvClientConnect(UrosTcpRosSrvClient *clip,
+                                      const UrosAddr *pubaddrp);
+void urosTcpRosSrvClientDisconnect(UrosTcpRosSrvClient *clip);
+uros_err_t urosTcpRosSrvClientCall(UrosTcpRosSrvClient *clip, void *resobjp);
 uros_err_t urosTcpRosListenerThread(void *data);
 uros_err_t urosTcpRosServerThread(UrosConn *csp);
 uros_err_t urosTcpRosClientThread(uros_tcpcliargs_t *argsp);
@@ -824,6 +1428,34 @@ void urosTcpRosTopicSubscriberDone(UrosTcpRosStatus *tcpstp);
 void urosTcpRosTopicPublisherDone(UrosTcpRosStatus *tcpstp);
 void urosTcpRosServiceDone(UrosTcpRosStatus *tcpstp);
 
+#if UROS_TCPROS_USE_REACTOR
+void urosTcpRosReactorObjectInit(void);
+uros_err_t urosTcpRosReactorThread(void *argp);
+uros_err_t urosTcpRosReactorAttach(UrosTcpRosStatus *tcpstp);
+uros_err_t urosTcpRosReactorAttachDrain(UrosTcpRosStatus *tcpstp);
+#endif
+uros_err_t urosTcpRosReactorFrame(UrosTcpRosStatus *tcpstp,
+                                  const uint8_t *framep, size_t framelen);
+uros_err_t urosTcpRosReactorNext(UrosTcpRosStatus *tcpstp,
+                                 UrosTcpRosFrame **framepp);
+void urosTcpRosReactorRelease(UrosTcpRosStatus *tcpstp,
+                              UrosTcpRosFrame *framep, uros_bool_t sent);
+void urosTcpRosReactorDone(UrosTcpRosStatus *tcpstp);
+
+UrosTcpRosFrame *urosTcpRosFrameNew(uint32_t msglen);
+void urosTcpRosFrameRelease(UrosTcpRosFrame *framep);
+void urosTcpRosFanoutObjectInit(UrosTcpRosFanout *fop);
+void urosTcpRosFanoutClean(UrosTcpRosFanout *fop);
+UrosTcpRosFanout *urosTcpRosFanoutNew(void);
+void urosTcpRosFanoutDelete(UrosTcpRosFanout *fop);
+uros_err_t urosTcpRosFanoutPush(UrosTcpRosFanout *fop,
+                                UrosTcpRosFrame *framep,
+                                uros_bool_t blocking);
+void urosTcpRosFanoutClose(UrosTcpRosFanout *fop);
+void urosTcpRosFanoutWakeup(UrosTcpRosFanout *fop);
+uros_err_t urosTcpRosSendLatched(UrosTcpRosStatus *tcpstp);
+uros_err_t urosTcpRosFanoutDrain(UrosTcpRosStatus *tcpstp);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,139 @@
+/*
+Copyright (c) 2012-2013, Politecnico di Milano. All rights reserved.
+
+Andrea Zoppi <texzk@email.it>
+Martino Migliavacca <martino.migliavacca@gmail.com>
+
+http://airlab.elet.polimi.it/
+http://www.openrobots.com/
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file    urosUdpRos.h
+ * @author  Andrea Zoppi <texzk@email.it>
+ *
+ * @brief   UDPROS features of the middleware.
+ */
+
+#ifndef _UROSUDPROS_H_
+#define _UROSUDPROS_H_
+
+/*===========================================================================*/
+/* HEADER FILES                                                              */
+/*===========================================================================*/
+
+#include "urosBase.h"
+#include "urosConn.h"
+#include "urosTcpRos.h"
+
+/*===========================================================================*/
+/* TYPES & MACROS                                                            */
+/*===========================================================================*/
+
+/** @addtogroup udpros_config */
+/** @{ */
+
+/** @brief Maximum UDPROS datagram size, including the datagram header.*/
+#if !defined(UROS_UDPROS_DGRAMSIZE) || defined(__DOXYGEN__)
+#define UROS_UDPROS_DGRAMSIZE           (UROS_MTU_SIZE - 28)
+#endif
+
+/** @} */
+
+/** @addtogroup udpros_macros */
+/** @{ */
+
+/** @brief Length of the UDPROS datagram header, in bytes.*/
+#define UROS_UDPROS_HDRLEN              8
+
+/** @name UDPROS datagram opcodes */
+/** @{ */
+
+#define UROS_UDPROS_OP_DATA0            0   /**< @brief First block of a message.*/
+#define UROS_UDPROS_OP_DATAN            1   /**< @brief Further block of a message.*/
+#define UROS_UDPROS_OP_PING             2   /**< @brief Keep-alive.*/
+#define UROS_UDPROS_OP_ERR              3   /**< @brief Connection error.*/
+
+/** @} */
+
+/** @} */
+
+/** @addtogroup udpros_types */
+/** @{ */
+
+/**
+ * @brief   UDPROS link.
+ * @details A UDPROS connection is handled through a TCPROS status, as if it
+ *          were a TCPROS stream. Outgoing frames are fragmented into
+ *          datagrams, and incoming datagrams are reassembled into frames.
+ * @note    The connection is the first member, so that a link can be handed
+ *          to the TCPROS Server thread pool as a @p UrosConn object.
+ */
+typedef struct UrosUdpRosLink {
+  UrosConn          conn;           /**< @brief Datagram connection.*/
+  uint32_t          connId;         /**< @brief Connection ID.*/
+  size_t            dgramSize;      /**< @brief Negotiated datagram size.*/
+  uint8_t           sendMsgId;      /**< @brief Outgoing message ID.*/
+  uint8_t           recvMsgId;      /**< @brief Incoming message ID.*/
+  uint16_t          numBlocks;      /**< @brief Blocks of the incoming message.*/
+  uint16_t          nextBlock;      /**< @brief Next expected block, @p 0 if none.*/
+  uint8_t           *msgp;          /**< @brief Incoming frame buffer.*/
+  size_t            msgsize;        /**< @brief Incoming frame buffer size.*/
+  size_t            msglen;         /**< @brief Incoming frame length.*/
+  size_t            msgfill;        /**< @brief Reassembled frame bytes.*/
+  size_t            msgoff;         /**< @brief Read offset inside the frame.*/
+  uint32_t          numDropped;     /**< @brief Incomplete incoming messages.*/
+} UrosUdpRosLink;
+
+/** @} */
+
+/*===========================================================================*/
+/* GLOBAL PROTOTYPES                                                         */
+/*===========================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void urosUdpRosLinkObjectInit(UrosUdpRosLink *linkp);
+void urosUdpRosLinkClean(UrosUdpRosLink *linkp);
+void urosUdpRosLinkDelete(UrosUdpRosLink *linkp);
+uros_err_t urosUdpRosLinkLoad(UrosUdpRosLink *linkp,
+                              const void *bufp, size_t buflen);
+uros_err_t urosUdpRosSendFrame(UrosTcpRosStatus *tcpstp,
+                               const void *bufp, size_t buflen);
+uros_err_t urosUdpRosRecv(UrosTcpRosStatus *tcpstp,
+                          void **bufpp, size_t *buflenp);
+uros_err_t urosUdpRosPublisherLink(const UrosString *namep,
+                                   const UrosString *hdrp,
+                                   const UrosAddr *subaddrp,
+                                   size_t dgramsize,
+                                   UrosUdpRosLink **linkpp,
+                                   UrosString *reshdrp);
+uros_err_t urosUdpRosConnect(UrosTcpRosStatus *tcpstp,
+                             const UrosAddr *apiaddrp);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* _UROSUDPROS_H_ */
@@ -6,5 +6,6 @@ endif
 
 # Low Level Driver bindings for POSIX
 UROSLLDSRC += $(UROS)/src/lld/posix/uros_lld_base.c \
-              $(UROS)/src/lld/posix/uros_lld_conn.c \
+              $(UROS)/src/lld/posix/uros_lld_conn.c \
+              $(UROS)/src/lld/posix/uros_lld_reactor.c \
               $(UROS)/src/lld/posix/uros_lld_threading.c
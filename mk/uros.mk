@@ -16,7 +16,8 @@ UROSSRC = $(UROS)/src/urosBase.c \
           $(UROS)/src/urosRpcSlave.c \
           $(UROS)/src/urosRpcStreamer.c \
           $(UROS)/src/urosTcpRos.c \
-          $(UROS)/src/urosThreading.c
+          $(UROS)/src/urosThreading.c \
+          $(UROS)/src/urosUdpRos.c
 
 # Required include directories
 UROSINC = $(UROS)/include
@@ -111,6 +111,45 @@ void uros_lld_free(void *chunkp) {
   }
 }
 
+/**
+ * @brief   Initializes a heap object.
+ * @see     urosMemHeapObjectInit()
+ *
+ * @pre     The object addressed by @p heapp is allocated but not initialized.
+ *
+ * @param[in,out] heapp
+ *          Pointer to an allocated @p UrosMemHeap object.
+ * @param[in] bufp
+ *          Pointer to the heap memory area.
+ * @param[in] size
+ *          Size of the heap memory area, in bytes.
+ */
+void uros_lld_heap_objectinit(UrosMemHeap *heapp, void *bufp, size_t size) {
+
+  chHeapInit(heapp, bufp, size);
+}
+
+/**
+ * @brief   Reads the statistics of a heap.
+ * @details Only the free fragments are tracked by the ChibiOS/RT heap, the
+ *          other statistics are zeroed.
+ * @see     urosMemHeapStats()
+ *
+ * @param[in] heapp
+ *          Pointer to an initialized @p UrosMemHeap object.
+ * @param[out] statsp
+ *          Pointer to the @p UrosMemHeapStats object to be written.
+ */
+void uros_lld_heap_stats(UrosMemHeap *heapp, UrosMemHeapStats *statsp) {
+
+  size_t fragsize;
+
+  memset(statsp, 0, sizeof(UrosMemHeapStats));
+  statsp->numFrags = (uros_cnt_t)chHeapStatus(heapp, &fragsize);
+  statsp->free = fragsize;
+  statsp->fragmented = fragsize;
+}
+
 /*~~~ MEMORY POOL ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #if UROS_USE_BUILTIN_MEMPOOL == UROS_FALSE || defined(__DOXYGEN__)
@@ -63,6 +63,66 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define urosAssert(expr)
 #endif
 
+/*===========================================================================*/
+/* LOCAL FUNCTIONS                                                           */
+/*===========================================================================*/
+
+/**
+ * @brief   Sends a datagram.
+ * @details The chunks are gathered into a single Netbuf, which is sent as a
+ *          single datagram.
+ *
+ * @param[in,out] cp
+ *          Pointer to a communicating UDP connection object.
+ * @param[in] iovp
+ *          Pointer to the array of chunks to be sent. Chunks can be empty.
+ * @param[in] count
+ *          Number of chunks.
+ * @param[in] remaddrp
+ *          Pointer to the remote address, or @p NULL if connected.
+ * @return
+ *          Error code.
+ */
+static uros_err_t uros_lwip_udpsend(UrosConn *cp, const UrosIoVec *iovp,
+                                     uros_cnt_t count,
+                                     const UrosAddr *remaddrp) {
+
+  struct netbuf *nbp;
+  struct ip_addr remaddr;
+  uint8_t *curp;
+  size_t length = 0;
+  uros_cnt_t i;
+
+  for (i = 0; i < count; ++i) { length += iovp[i].buflen; }
+  urosAssert(length <= 0xFFFF);
+
+  nbp = netbuf_new();
+  if (nbp == NULL) { return UROS_ERR_NOMEM; }
+  curp = (uint8_t *)netbuf_alloc(nbp, (u16_t)length);
+  if (curp == NULL) { netbuf_delete(nbp); return UROS_ERR_NOMEM; }
+  for (i = 0; i < count; ++i) {
+    if (iovp[i].buflen > 0) {
+      memcpy(curp, iovp[i].bufp, iovp[i].buflen);
+      curp += iovp[i].buflen;
+    }
+  }
+  if (remaddrp != NULL) {
+    remaddr.addr = htonl(remaddrp->ip.dword);
+    cp->lwiperr = netconn_sendto(cp->netconnp, nbp, &remaddr, remaddrp->port);
+  } else {
+    cp->lwiperr = netconn_send(cp->netconnp, nbp);
+  }
+  netbuf_delete(nbp);
+  switch (cp->lwiperr) {
+  case ERR_OK:      { return UROS_OK; }
+  case ERR_RST:
+  case ERR_CLSD:    { return UROS_ERR_NOCONN; }
+  case ERR_TIMEOUT: { return UROS_ERR_TIMEOUT; }
+  case ERR_MEM:     { return UROS_ERR_NOMEM; }
+  default:          { return UROS_ERR_BADCONN; }
+  }
+}
+
 /*===========================================================================*/
 /* GLOBAL FUNCTIONS                                                          */
 /*===========================================================================*/
@@ -196,7 +256,17 @@ uros_err_t uros_lld_conn_bind(UrosConn *cp, const UrosAddr *locaddrp) {
 
   locaddr.addr = htonl(locaddrp->ip.dword);
   cp->lwiperr = netconn_bind(cp->netconnp, &locaddr, locaddrp->port);
-  return (cp->lwiperr == ERR_OK) ? UROS_OK : UROS_ERR_BADCONN;
+  if (cp->lwiperr != ERR_OK) { return UROS_ERR_BADCONN; }
+
+  cp->locaddr = *locaddrp;
+  if (locaddrp->port == UROS_ANY_PORT) {
+    /* Get the port chosen by the stack.*/
+    u16_t port;
+    if (netconn_getaddr(cp->netconnp, &locaddr, &port, 1) == ERR_OK) {
+      cp->locaddr.port = port;
+    }
+  }
+  return UROS_OK;
 }
 
 /**
@@ -398,19 +468,52 @@ uros_err_t uros_lld_conn_recv(UrosConn *cp,
  */
 uros_err_t uros_lld_conn_recvfrom(UrosConn *cp,
                                   void **bufpp, size_t *buflenp,
-                                  const UrosAddr *remaddrp) {
+                                  UrosAddr *remaddrp) {
+
+  void *datap;
+  u16_t datalen16;
+  struct pbuf *pp;
 
   urosAssert(urosConnIsValid(cp));
+  urosAssert(cp->protocol == UROS_PROTO_UDP);
   urosAssert(bufpp != NULL);
   urosAssert(buflenp != NULL);
-  urosAssert(remaddrp != NULL);
 
-  /* TODO: Receive a new buffer from the remote address.*/
-  (void)cp;
-  (void)bufpp;
-  (void)buflenp;
-  (void)remaddrp;
-  return UROS_ERR_NOTIMPL;
+  if (*buflenp == 0) { return UROS_OK; }
+
+  /* Free the previous datagram and receive a new one.*/
+  if (cp->recvnetbufp != NULL) {
+    netbuf_delete(cp->recvnetbufp);
+    cp->recvnetbufp = NULL;
+  }
+  cp->recvchkoff = 0;
+  cp->lwiperr = netconn_recv(cp->netconnp, &cp->recvnetbufp);
+  if (cp->lwiperr != ERR_OK) {
+    cp->recvnetbufp = NULL;
+    switch (cp->lwiperr) {
+    case ERR_RST:
+    case ERR_CLSD:    { return UROS_ERR_EOF; }
+    case ERR_TIMEOUT: { return UROS_ERR_TIMEOUT; }
+    case ERR_MEM:     { return UROS_ERR_NOMEM; }
+    default:          { return UROS_ERR_BADCONN; }
+    }
+  }
+
+  /* A datagram must be contiguous.*/
+  if (cp->recvnetbufp->p->next != NULL) {
+    pp = pbuf_coalesce(cp->recvnetbufp->p, PBUF_RAW);
+    if (pp->next != NULL) { return UROS_ERR_NOMEM; }
+    cp->recvnetbufp->p = cp->recvnetbufp->ptr = pp;
+  }
+  netbuf_data(cp->recvnetbufp, &datap, &datalen16);
+  if (remaddrp != NULL) {
+    remaddrp->ip.dword = ntohl(netbuf_fromaddr(cp->recvnetbufp)->addr);
+    remaddrp->port = netbuf_fromport(cp->recvnetbufp);
+  }
+  *bufpp = datap;
+  if (*buflenp > (size_t)datalen16) { *buflenp = (size_t)datalen16; }
+  cp->recvchkoff = (size_t)datalen16;
+  return UROS_OK;
 }
 
 /**
@@ -443,7 +546,10 @@ uros_err_t uros_lld_conn_send(UrosConn *cp,
   if (cp->protocol == UROS_PROTO_TCP) {
     cp->lwiperr = netconn_write(cp->netconnp, bufp, buflen, NETCONN_COPY);
   } else if (cp->protocol == UROS_PROTO_UDP) {
-    /* TODO */
+    UrosIoVec iov;
+    iov.bufp = bufp;
+    iov.buflen = buflen;
+    return uros_lwip_udpsend(cp, &iov, 1, NULL);
   } else {
     return UROS_ERR_BADPARAM;
   }
@@ -491,7 +597,10 @@ uros_err_t uros_lld_conn_sendconst(UrosConn *cp,
   if (cp->protocol == UROS_PROTO_TCP) {
     cp->lwiperr = netconn_write(cp->netconnp, bufp, buflen, NETCONN_NOCOPY);
   } else if (cp->protocol == UROS_PROTO_UDP) {
-    /* TODO */
+    UrosIoVec iov;
+    iov.bufp = bufp;
+    iov.buflen = buflen;
+    return uros_lwip_udpsend(cp, &iov, 1, NULL);
   } else {
     return UROS_ERR_BADPARAM;
   }
@@ -505,6 +614,58 @@ uros_err_t uros_lld_conn_sendconst(UrosConn *cp,
   }
 }
 
+/**
+ * @brief   Sends a sequence of data chunks.
+ * @details Sends the chunks to the remote address, in order, with chained
+ *          @p netconn_write() calls. Every chunk but the last one is flagged
+ *          with @p NETCONN_MORE, so that they can be coalesced into the same
+ *          segments.
+ * @warning Not conceptually equivalent to POSIX writev(), as all the data
+ *          is granted to be sent with a single call to this function
+ *          (if no connection errors occurred).
+ *
+ * @pre     The connection must be open and working.
+ * @post    All the chunks are sent.
+ *
+ * @param[in,out] cp
+ *          Pointer to a communicating connection object.
+ * @param[in] iovp
+ *          Pointer to the array of chunks to be sent. Chunks can be empty.
+ * @param[in] count
+ *          Number of chunks. Can be @p 0.
+ * @return
+ *          Error code.
+ */
+uros_err_t uros_lld_conn_sendv(UrosConn *cp,
+                               const UrosIoVec *iovp, uros_cnt_t count) {
+
+  u8_t flags;
+
+  urosAssert(urosConnIsValid(cp));
+  urosAssert(!(count > 0) || (iovp != NULL));
+
+  if (cp->protocol == UROS_PROTO_UDP) {
+    /* The chunks make up a single datagram.*/
+    return uros_lwip_udpsend(cp, iovp, count, NULL);
+  }
+  if (cp->protocol != UROS_PROTO_TCP) { return UROS_ERR_BADPARAM; }
+  cp->lwiperr = ERR_OK;
+  for (; count > 0 && cp->lwiperr == ERR_OK; ++iovp, --count) {
+    if (iovp->buflen == 0) { continue; }
+    flags = (count > 1) ? (NETCONN_COPY | NETCONN_MORE) : NETCONN_COPY;
+    cp->lwiperr = netconn_write(cp->netconnp, iovp->bufp, iovp->buflen,
+                                flags);
+  }
+  switch (cp->lwiperr) {
+  case ERR_OK:      { return UROS_OK; }
+  case ERR_RST:
+  case ERR_CLSD:    { return UROS_ERR_NOCONN; }
+  case ERR_TIMEOUT: { return UROS_ERR_TIMEOUT; }
+  case ERR_MEM:     { return UROS_ERR_NOMEM; }
+  default:          { return UROS_ERR_BADCONN; }
+  }
+}
+
 /**
  * @brief   Sends some data to a remote address.
  * @details Sends the buffered data to the remote address. The data is copied
@@ -532,16 +693,16 @@ uros_err_t uros_lld_conn_sendto(UrosConn *cp,
                                 const void *bufp, size_t buflen,
                                 const UrosAddr *remaddrp) {
 
+  UrosIoVec iov;
+
   urosAssert(urosConnIsValid(cp));
+  urosAssert(cp->protocol == UROS_PROTO_UDP);
   urosAssert(!(buflen > 0) || (bufp != NULL));
   urosAssert(remaddrp != NULL);
 
-  /* TODO: Send the buffer data to the remote address.*/
-  (void)cp;
-  (void)bufp;
-  (void)buflen;
-  (void)remaddrp;
-  return UROS_ERR_NOTIMPL;
+  iov.bufp = bufp;
+  iov.buflen = buflen;
+  return uros_lwip_udpsend(cp, &iov, 1, remaddrp);
 }
 
 /**
@@ -575,16 +736,16 @@ uros_err_t uros_lld_conn_sendtoconst(UrosConn *cp,
                                      const void *bufp, size_t buflen,
                                      const UrosAddr *remaddrp) {
 
+  UrosIoVec iov;
+
   urosAssert(urosConnIsValid(cp));
+  urosAssert(cp->protocol == UROS_PROTO_UDP);
   urosAssert(!(buflen > 0) || (bufp != NULL));
   urosAssert(remaddrp != NULL);
 
-  /* TODO: Send the buffer data to the remote address.*/
-  (void)cp;
-  (void)bufp;
-  (void)buflen;
-  (void)remaddrp;
-  return UROS_ERR_NOTIMPL;
+  iov.bufp = bufp;
+  iov.buflen = buflen;
+  return uros_lwip_udpsend(cp, &iov, 1, remaddrp);
 }
 
 /**
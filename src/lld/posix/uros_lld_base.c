@@ -52,6 +52,37 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define urosAssert(expr)
 #endif
 
+/**
+ * @brief   Memory block header.
+ * @details Precedes each memory block, keeping the alignment of the payload.
+ */
+typedef union uros_lld_blkhdr_t {
+  struct {
+    UrosMemHeap *heapp;     /**< @brief Owner heap, @p NULL for the default heap.*/
+    size_t      size;       /**< @brief Requested size, in bytes.*/
+  }             info;       /**< @brief Block information.*/
+  long          alignl;     /**< @brief Integer alignment.*/
+  double        alignd;     /**< @brief Floating point alignment.*/
+  void          *alignp;    /**< @brief Pointer alignment.*/
+} uros_lld_blkhdr_t;
+
+/*===========================================================================*/
+/* LOCAL FUNCTIONS                                                           */
+/*===========================================================================*/
+
+unsigned uros_lld_heap_sizeclass(size_t size) {
+
+  unsigned sizeclass = 0;
+  size_t payload = UROS_LLD_HEAP_MINBLOCK;
+
+  /* Bounded by the number of size classes.*/
+  while (payload < size && sizeclass < UROS_LLD_HEAP_NUMCLASSES) {
+    payload <<= 1;
+    ++sizeclass;
+  }
+  return sizeclass;
+}
+
 /*===========================================================================*/
 /* GLOBAL FUNCTIONS                                                          */
 /*===========================================================================*/
@@ -72,10 +103,14 @@ void uros_lld_init(void) {
 /**
  * @brief   Allocates a memory block.
  * @details This function tries to allocate a memory block of the required size
- *          inside the default heap of the operating system.
+ *          inside the provided heap, or the default heap of the operating
+ *          system.
+ *          A heap serves each request with a free block of the matching size
+ *          class, or carves a new block from its memory area, in bounded
+ *          time.
  * @see     urosAlloc()
  *
- * @pre     There is enough contiguous free space inside the default heap.
+ * @pre     There is enough contiguous free space inside the heap.
  *
  * @param[in,out] heapp
  *          Pointer to an initialized @p UrosMemHeap object, default @p NULL.
@@ -89,16 +124,57 @@ void uros_lld_init(void) {
  */
 void *uros_lld_alloc(UrosMemHeap *heapp, size_t size) {
 
-  (void)heapp;
+  uros_lld_blkhdr_t *hdrp;
+  unsigned sizeclass;
+  size_t payload;
 
-  urosAssert(heapp == NULL);
+  if (heapp == NULL) {
+    /* Default memory block allocation.*/
+    hdrp = (uros_lld_blkhdr_t *)malloc(sizeof(uros_lld_blkhdr_t) + size);
+    if (hdrp == NULL) { return NULL; }
+    hdrp->info.heapp = NULL;
+    hdrp->info.size = size;
+    return hdrp + 1;
+  }
 
-  /* Default memory block allocation.*/
-  return malloc(size);
+  sizeclass = uros_lld_heap_sizeclass(size);
+  payload = (size_t)UROS_LLD_HEAP_MINBLOCK << sizeclass;
+  pthread_mutex_lock(&heapp->lock);
+  if (sizeclass >= UROS_LLD_HEAP_NUMCLASSES) {
+    hdrp = NULL;
+  } else if (heapp->freep[sizeclass] != NULL) {
+    /* Reuse a free block of the same size class.*/
+    hdrp = (uros_lld_blkhdr_t *)heapp->freep[sizeclass];
+    heapp->freep[sizeclass] = *(void **)(hdrp + 1);
+    heapp->cached -= payload;
+    --heapp->numCached;
+  } else if (sizeof(uros_lld_blkhdr_t) + payload <= heapp->size - heapp->brk) {
+    /* Carve a new block from the unallocated area.*/
+    hdrp = (uros_lld_blkhdr_t *)(heapp->basep + heapp->brk);
+    heapp->brk += sizeof(uros_lld_blkhdr_t) + payload;
+  } else {
+    hdrp = NULL;
+  }
+  if (hdrp == NULL) {
+    ++heapp->numFails;
+    pthread_mutex_unlock(&heapp->lock);
+    return NULL;
+  }
+  heapp->used += payload;
+  heapp->requested += size;
+  if (heapp->peak < heapp->used) {
+    heapp->peak = heapp->used;
+  }
+  pthread_mutex_unlock(&heapp->lock);
+
+  hdrp->info.heapp = heapp;
+  hdrp->info.size = size;
+  return hdrp + 1;
 }
 
 /**
  * @brief   Deallocates a memory block.
+ * @details The block is returned to the heap it was allocated from.
  * @see     urosFree()
  *
  * @pre     The block pointed by @p chunkp must have been allocated with
@@ -111,10 +187,84 @@ void *uros_lld_alloc(UrosMemHeap *heapp, size_t size) {
  */
 void uros_lld_free(void *chunkp) {
 
-  /* Default memory block deallocation.*/
-  if (chunkp != NULL) {
-    free(chunkp);
+  uros_lld_blkhdr_t *hdrp;
+  UrosMemHeap *heapp;
+  unsigned sizeclass;
+  size_t payload;
+
+  if (chunkp == NULL) { return; }
+  hdrp = (uros_lld_blkhdr_t *)chunkp - 1;
+  heapp = hdrp->info.heapp;
+  if (heapp == NULL) {
+    /* Default memory block deallocation.*/
+    free(hdrp);
+    return;
   }
+
+  /* Push the block onto the free list of its size class.*/
+  sizeclass = uros_lld_heap_sizeclass(hdrp->info.size);
+  payload = (size_t)UROS_LLD_HEAP_MINBLOCK << sizeclass;
+  pthread_mutex_lock(&heapp->lock);
+  *(void **)chunkp = heapp->freep[sizeclass];
+  heapp->freep[sizeclass] = hdrp;
+  heapp->cached += payload;
+  ++heapp->numCached;
+  heapp->used -= payload;
+  heapp->requested -= hdrp->info.size;
+  pthread_mutex_unlock(&heapp->lock);
+}
+
+/**
+ * @brief   Initializes a heap object.
+ * @details The heap manages the provided memory area, with a free list for
+ *          each size class.
+ * @see     urosMemHeapObjectInit()
+ *
+ * @pre     The object addressed by @p heapp is allocated but not initialized.
+ * @pre     The memory area is aligned like any @p urosAlloc() block.
+ *
+ * @param[in,out] heapp
+ *          Pointer to an allocated @p UrosMemHeap object.
+ * @param[in] bufp
+ *          Pointer to the heap memory area.
+ * @param[in] size
+ *          Size of the heap memory area, in bytes.
+ */
+void uros_lld_heap_objectinit(UrosMemHeap *heapp, void *bufp, size_t size) {
+
+  urosAssert(heapp != NULL);
+  urosAssert(!(size > 0) || bufp != NULL);
+
+  memset(heapp, 0, sizeof(UrosMemHeap));
+  heapp->basep = (char *)bufp;
+  heapp->size = size;
+  pthread_mutex_init(&heapp->lock, NULL);
+}
+
+/**
+ * @brief   Reads the statistics of a heap.
+ * @see     urosMemHeapStats()
+ *
+ * @param[in] heapp
+ *          Pointer to an initialized @p UrosMemHeap object.
+ * @param[out] statsp
+ *          Pointer to the @p UrosMemHeapStats object to be written.
+ */
+void uros_lld_heap_stats(UrosMemHeap *heapp, UrosMemHeapStats *statsp) {
+
+  urosAssert(heapp != NULL);
+  urosAssert(statsp != NULL);
+
+  pthread_mutex_lock(&heapp->lock);
+  statsp->size = heapp->size;
+  statsp->used = heapp->used;
+  statsp->requested = heapp->requested;
+  statsp->peak = heapp->peak;
+  statsp->free = heapp->size - heapp->brk + heapp->cached;
+  statsp->fragmented = heapp->cached;
+  statsp->numFrags = (uros_cnt_t)heapp->numCached;
+  statsp->numFails = (uros_cnt_t)heapp->numFails;
+  pthread_mutex_unlock(&heapp->lock);
 }
 
 /** @} */
@@ -53,12 +53,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sys/time.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netdb.h>
 #include <arpa/inet.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <poll.h>
 
 /*===========================================================================*/
 /* LOCAL TYPES & MACROS                                                      */
@@ -71,19 +73,83 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 /**
  * @brief   Receiving buffer length, in bytes.
+ * @details Large enough for most XMLRPC messages to be parsed straight from a
+ *          single receive.
  */
 #if !defined(UROS_CONN_RECVBUFLEN) || defined(__DOXYGEN__)
-#define UROS_CONN_RECVBUFLEN    256
+#define UROS_CONN_RECVBUFLEN    2048
+#endif
+
+/**
+ * @brief   Maximum number of chunks sent by a single @p sendmsg() call.
+ */
+#if !defined(UROS_CONN_IOVMAX) || defined(__DOXYGEN__)
+#define UROS_CONN_IOVMAX        16
 #endif
 
 /*===========================================================================*/
 /* LOCAL FUNCTIONS                                                           */
 /*===========================================================================*/
 
+/**
+ * @brief   Waits for a socket to become ready.
+ *
+ * @param sock
+ *          Socket descriptor.
+ * @param events
+ *          Events to wait for, as for @p poll().
+ * @param ms
+ *          Timeout in milliseconds, @p 0 for blocking behavior.
+ * @return
+ *          Readiness state, or error code.
+ * @retval 0
+ *          The socket is ready.
+ * @retval -1
+ *          Socket error, see @p errno.
+ * @retval -2
+ *          Operation timed out.
+ */
+int wait_to(int sock, short events, uint32_t ms) {
+
+  struct pollfd pfd;
+  int err;
+
+  pfd.fd = sock;
+  pfd.events = events;
+  pfd.revents = 0;
+  do {
+    err = poll(&pfd, 1, (ms > 0) ? (int)ms : -1);
+  } while (err < 0 && errno == EINTR);
+  if (err < 0) { return -1; }
+  return (err > 0) ? 0 : -2;
+}
+
+/**
+ * @brief   Switches a socket to non-blocking mode.
+ * @details Done once per socket, so that the timeout of each transfer only
+ *          costs a @p poll() call when the socket is not ready.
+ *
+ * @param sock
+ *          Socket descriptor.
+ * @return
+ *          @p 0 on success, @p -1 on error (see @p errno).
+ */
+int set_nonblocking(int sock) {
+
+  int iof;
+
+  iof = fcntl(sock, F_GETFL, 0);
+  if (iof == -1) { return -1; }
+  if (iof & O_NONBLOCK) { return 0; }
+  return fcntl(sock, F_SETFL, iof | O_NONBLOCK);
+}
+
 /**
  * @brief   Receive with timeout.
  * @details Works like @p recv(), but it also checks for timeout.
  *
+ * @pre     The socket is in non-blocking mode.
+ *
  * @param fd
  *          Socket descriptor.
  * @param bufp
@@ -101,8 +167,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * @retval 0
  *          Connection closed by peer.
  * @retval -1
- *          Socket error, see @p errno. It @e will raise @p EAGAIN or
- *          @p EWOULDBLOCK when expected by a non-blocking socket.
+ *          Socket error, see @p errno.
  * @retval -2
  *          Operation timed out.
  */
@@ -110,35 +175,26 @@ ssize_t recv_to(int sock, void *bufp, size_t buflen, int flags,
                 uint32_t ms) {
 
   ssize_t nb;
-  int err, iof;
-  struct timeval tv;
-  fd_set fdset;
+  int err;
 
-  if (ms == 0) {
+  while (UROS_TRUE) {
     nb = recv(sock, bufp, buflen, flags);
-    return (nb >= 0) ? nb : -1;
-  }
+    if (nb >= 0) { return nb; }
+    if (errno == EINTR) { continue; }
+    if (errno != EAGAIN && errno != EWOULDBLOCK) { return -1; }
 
-  FD_ZERO(&fdset);
-  FD_SET(sock, &fdset);
-  tv.tv_sec = (time_t)(ms / 1000);
-  tv.tv_usec = (time_t)((ms % 1000) * 1000);
-  err = select(sock + 1, &fdset, NULL, NULL, &tv);
-  if (err < 0) { return -1; }
-  if (err > 0 && FD_ISSET(sock, &fdset)) {
-    iof = fcntl(sock, F_GETFL, 0);
-    if (iof != -1) { fcntl(sock, F_SETFL, iof | O_NONBLOCK); }
-    nb = recv(sock, bufp, buflen, flags);
-    if (iof != -1) { fcntl(sock, F_SETFL, iof); }
-    return (nb >= 0) ? nb : -1;
+    /* Nothing to read yet, wait for some data.*/
+    err = wait_to(sock, POLLIN, ms);
+    if (err != 0) { return err; }
   }
-  return -2;
 }
 
 /**
  * @brief   Sends with timeout.
  * @details Works like @p send(), but it also checks for timeout.
  *
+ * @pre     The socket is in non-blocking mode.
+ *
  * @param fd
  *          Socket descriptor.
  * @param bufp
@@ -154,8 +210,7 @@ ssize_t recv_to(int sock, void *bufp, size_t buflen, int flags,
  * @retval >= 0
  *          Number of bytes sent.
  * @retval -1
- *          Socket error, see @p errno. It <i>will</i> raise @p EAGAIN or
- *          @p EWOULDBLOCK when expected by a non-blocking socket.
+ *          Socket error, see @p errno.
  * @retval -2
  *          Operation timed out.
  */
@@ -163,35 +218,18 @@ ssize_t send_to(int sock, const void *bufp, size_t buflen, int flags,
                 uint32_t ms) {
 
   ssize_t nb;
-  int err, iof;
-  struct timeval tv;
-  fd_set fdset;
+  int err;
 
-  if (ms == 0) {
+  while (UROS_TRUE) {
     nb = send(sock, bufp, buflen, flags);
-    return (nb >= 0) ? nb : -1;
-  }
-
-  do {
-    iof = fcntl(sock, F_GETFL, 0);
-    if (iof != -1) { fcntl(sock, F_SETFL, iof | O_NONBLOCK); }
-    nb = send(sock, bufp, buflen, flags);
-    if (iof != -1) { fcntl(sock, F_SETFL, iof); }
     if (nb >= 0) { return nb; }
-    else {
-      if (errno == EAGAIN || errno == EWOULDBLOCK) {
-        FD_ZERO(&fdset);
-        FD_SET(sock, &fdset);
-        tv.tv_sec = (time_t)(ms / 1000);
-        tv.tv_usec = (time_t)((ms % 1000) * 1000);
-        err = select(sock + 1, &fdset, NULL, NULL, &tv);
-        if (err < 0) { return -1; }
-      } else {
-        return -1;
-      }
-    }
-  } while (err > 0 && FD_ISSET(sock, &fdset));
-  return -2;
+    if (errno == EINTR) { continue; }
+    if (errno != EAGAIN && errno != EWOULDBLOCK) { return -1; }
+
+    /* The send buffer is full, wait for some room.*/
+    err = wait_to(sock, POLLOUT, ms);
+    if (err != 0) { return err; }
+  }
 }
 
 /*===========================================================================*/
@@ -322,6 +360,10 @@ uros_err_t uros_lld_conn_create(UrosConn *cp, uros_connproto_t protocol) {
   urosError(sock < 0, return UROS_ERR_BADCONN,
             ("Cannot create a connection with protocol id %d\n",
              (int)protocol));
+  urosError(set_nonblocking(sock) != 0,
+            { close(sock); return UROS_ERR_BADCONN; },
+            ("Socket error [%s] while setting non-blocking mode\n",
+             strerror(errno)));
 
   /* Fill the connection record.*/
   cp->locaddr.ip.dword = UROS_ANY_IP;
@@ -375,6 +417,13 @@ uros_err_t uros_lld_conn_bind(UrosConn *cp, const UrosAddr *locaddrp) {
              strerror(errno), UROS_ADDRARG(locaddrp)));
 
   cp->locaddr = *locaddrp;
+  if (locaddrp->port == UROS_ANY_PORT) {
+    /* Get the port chosen by the system.*/
+    socklen_t locsize = sizeof(locaddr);
+    if (getsockname(cp->socket, (struct sockaddr *)&locaddr, &locsize) == 0) {
+      cp->locaddr.port = ntohs(locaddr.sin_port);
+    }
+  }
   return UROS_OK;
 }
 
@@ -406,7 +455,16 @@ uros_err_t uros_lld_conn_accept(UrosConn *cp, UrosConn *spawnedp) {
   urosAssert(spawnedp != NULL);
   urosAssert(spawnedp->socket == -1);
 
-  remsock = accept(cp->socket, (struct sockaddr *)&remaddr, &remsize);
+  /* The listening socket is non-blocking, wait for incoming connections.*/
+  while (UROS_TRUE) {
+    remsock = accept(cp->socket, (struct sockaddr *)&remaddr, &remsize);
+    if (remsock >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK &&
+                         errno != EINTR)) {
+      break;
+    }
+    if (wait_to(cp->socket, POLLIN, 0) != 0) { break; }
+    remsize = sizeof(struct sockaddr_in);
+  }
   urosError(remsock < 0, return UROS_ERR_BADCONN,
             ("Socket error [%s] while accepting as "UROS_ADDRFMT"\n",
              strerror(errno), UROS_ADDRARG(&cp->locaddr)));
@@ -414,6 +472,10 @@ uros_err_t uros_lld_conn_accept(UrosConn *cp, UrosConn *spawnedp) {
             { close(remsock); return UROS_ERR_BADCONN; },
             ("Wrong remote socket size (%u instead of %u)\n",
              (unsigned)remsize, (unsigned)sizeof(struct sockaddr_in)));
+  urosError(set_nonblocking(remsock) != 0,
+            { close(remsock); return UROS_ERR_BADCONN; },
+            ("Socket error [%s] while setting non-blocking mode\n",
+             strerror(errno)));
 
   spawnedp->locaddr = cp->locaddr;
   spawnedp->remaddr.port = ntohs(remaddr.sin_port);
@@ -467,6 +529,7 @@ uros_err_t uros_lld_conn_listen(UrosConn *cp, uros_cnt_t backlog) {
 uros_err_t uros_lld_conn_connect(UrosConn *cp, const UrosAddr *remaddrp) {
 
   int err;
+  socklen_t errlen;
   struct sockaddr_in remaddr;
 
   urosAssert(urosConnIsValid(cp));
@@ -479,6 +542,24 @@ uros_err_t uros_lld_conn_connect(UrosConn *cp, const UrosAddr *remaddrp) {
   cp->remaddr = *remaddrp;
 
   err = connect(cp->socket, (struct sockaddr *)&remaddr, sizeof(remaddr));
+  if (err != 0 && (errno == EINPROGRESS || errno == EINTR)) {
+    /* The socket is non-blocking, wait for the connection to complete.*/
+    err = wait_to(cp->socket, POLLOUT, cp->sendtimeout);
+    if (err == 0) {
+      errlen = sizeof(err);
+      if (getsockopt(cp->socket, SOL_SOCKET, SO_ERROR,
+                     &err, &errlen) != 0) {
+        err = errno;
+      }
+    } else if (err == -2) {
+      err = ETIMEDOUT;
+    } else {
+      err = errno;
+    }
+  } else if (err != 0) {
+    err = errno;
+  }
+  errno = err;
   urosError(err == ETIMEDOUT, return UROS_ERR_NOCONN,
             ("Connection to "UROS_ADDRFMT" timed out\n",
              UROS_ADDRARG(remaddrp)));
@@ -531,10 +612,8 @@ uros_err_t uros_lld_conn_recv(UrosConn *cp,
     cp->recvbuflen = UROS_CONN_RECVBUFLEN;
   }
   if (*buflenp > cp->recvbuflen) { *buflenp = cp->recvbuflen; }
-  do {
-    nb = recv_to(cp->socket, cp->recvbufp, *buflenp, MSG_NOSIGNAL,
-                 cp->recvtimeout);
-  } while (nb == -1 && (errno == EAGAIN || errno == EWOULDBLOCK));
+  nb = recv_to(cp->socket, cp->recvbufp, *buflenp, MSG_NOSIGNAL,
+               cp->recvtimeout);
   urosError(nb == 0, return UROS_ERR_EOF,
             ("Socket closed by remote before receiving at most %u bytes from "
              UROS_ADDRFMT"\n",
@@ -568,26 +647,62 @@ uros_err_t uros_lld_conn_recv(UrosConn *cp,
  *          Pointer to the buffer length in bytes, with the following meaning:
  *          - At call, it indicates the maximum length of the received data.
  *          - At return, it is the actual length of the received data.
- * @param[in] remaddrp
- *          Pointer to the remote address descriptor.
+ * @param[out] remaddrp
+ *          Pointer to the source address of the datagram, or @p NULL.
  * @return
  *          Error code.
  */
 uros_err_t uros_lld_conn_recvfrom(UrosConn *cp,
                                   void **bufpp, size_t *buflenp,
-                                  const UrosAddr *remaddrp) {
+                                  UrosAddr *remaddrp) {
+
+  ssize_t nb;
+  int err;
+  struct sockaddr_in remaddr;
+  socklen_t remsize;
 
   urosAssert(urosConnIsValid(cp));
+  urosAssert(cp->protocol == UROS_PROTO_UDP);
   urosAssert(bufpp != NULL);
   urosAssert(buflenp != NULL);
-  urosAssert(remaddrp != NULL);
 
-  /* TODO: Receive a new buffer from the remote address.*/
-  (void)cp;
-  (void)bufpp;
-  (void)buflenp;
-  (void)remaddrp;
-  return UROS_ERR_NOTIMPL;
+  if (*buflenp == 0) { return UROS_OK; }
+  if (cp->recvbuflen < *buflenp) {
+    /* A datagram must be received as a whole, grow the buffer.*/
+    if (cp->recvbufp != NULL) { urosFree(cp->recvbufp); }
+    cp->recvbuflen = (*buflenp > UROS_CONN_RECVBUFLEN)
+                     ? *buflenp : UROS_CONN_RECVBUFLEN;
+    cp->recvbufp = urosAlloc(NULL, cp->recvbuflen);
+    if (cp->recvbufp == NULL) { cp->recvbuflen = 0; return UROS_ERR_NOMEM; }
+  }
+
+  while (UROS_TRUE) {
+    remsize = sizeof(remaddr);
+    nb = recvfrom(cp->socket, cp->recvbufp, *buflenp, 0,
+                  (struct sockaddr *)&remaddr, &remsize);
+    if (nb >= 0) { break; }
+    if (errno == EINTR) { continue; }
+    if (errno != EAGAIN && errno != EWOULDBLOCK) { break; }
+
+    /* Nothing to read yet, wait for a datagram.*/
+    err = wait_to(cp->socket, POLLIN, cp->recvtimeout);
+    if (err == -2) { return UROS_ERR_TIMEOUT; }
+    if (err != 0) { nb = -1; break; }
+  }
+  urosError(nb < 0, return UROS_ERR_BADCONN,
+            ("Socket error [%s] while receiving a datagram of at most %u "
+             "bytes as "UROS_ADDRFMT"\n",
+             strerror(errno), (unsigned)*buflenp,
+             UROS_ADDRARG(&cp->locaddr)));
+
+  if (remaddrp != NULL) {
+    remaddrp->port = ntohs(remaddr.sin_port);
+    remaddrp->ip.dword = ntohl(remaddr.sin_addr.s_addr);
+  }
+  *bufpp = cp->recvbufp;
+  *buflenp = (size_t)nb;
+  cp->recvlen += (size_t)nb;
+  return UROS_OK;
 }
 
 /**
@@ -619,9 +734,7 @@ uros_err_t uros_lld_conn_send(UrosConn *cp,
   urosAssert(!(buflen > 0) || (bufp != NULL));
 
   while (buflen > 0) {
-    do {
-      nb = send_to(cp->socket, bufp, buflen, MSG_NOSIGNAL, cp->sendtimeout);
-    } while (nb == -1 && (errno == EAGAIN || errno == EWOULDBLOCK));
+    nb = send_to(cp->socket, bufp, buflen, MSG_NOSIGNAL, cp->sendtimeout);
     urosError(nb == -1, return UROS_ERR_BADCONN,
               ("Socket error [%s] while sending [%.*s] (%u bytes) to "
                UROS_ADDRFMT"\n",
@@ -669,6 +782,78 @@ uros_err_t uros_lld_conn_sendconst(UrosConn *cp,
   return uros_lld_conn_send(cp, bufp, buflen);
 }
 
+/**
+ * @brief   Sends a sequence of data chunks.
+ * @details Sends the chunks to the remote address, in order, with as few
+ *          @p sendmsg() calls as possible. The chunks are not copied.
+ * @warning Not conceptually equivalent to POSIX writev(), as all the data
+ *          is granted to be sent with a single call to this function
+ *          (if no connection errors occurred).
+ *
+ * @pre     The connection must be open and working.
+ * @post    All the chunks are sent.
+ *
+ * @param[in,out] cp
+ *          Pointer to a communicating connection object.
+ * @param[in] iovp
+ *          Pointer to the array of chunks to be sent. Chunks can be empty.
+ * @param[in] count
+ *          Number of chunks. Can be @p 0.
+ * @return
+ *          Error code.
+ */
+uros_err_t uros_lld_conn_sendv(UrosConn *cp,
+                               const UrosIoVec *iovp, uros_cnt_t count) {
+
+  struct iovec iov[UROS_CONN_IOVMAX];
+  struct msghdr msg;
+  size_t skip = 0;
+  ssize_t nb;
+  int n, err;
+
+  urosAssert(urosConnIsValid(cp));
+  urosAssert(!(count > 0) || (iovp != NULL));
+
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = iov;
+  while (UROS_TRUE) {
+    /* Skip the chunks already sent.*/
+    while (count > 0 && skip >= iovp->buflen) {
+      skip -= iovp->buflen;
+      ++iovp;
+      --count;
+    }
+    if (count == 0) { return UROS_OK; }
+
+    /* Gather the next batch of chunks.*/
+    for (n = 0; n < UROS_CONN_IOVMAX && (uros_cnt_t)n < count; ++n) {
+      urosAssert(!(iovp[n].buflen > 0) || (iovp[n].bufp != NULL));
+      iov[n].iov_base = (void *)iovp[n].bufp;
+      iov[n].iov_len = iovp[n].buflen;
+    }
+    iov[0].iov_base = (void *)((const uint8_t *)iovp->bufp + skip);
+    iov[0].iov_len -= skip;
+    msg.msg_iovlen = n;
+
+    nb = sendmsg(cp->socket, &msg, MSG_NOSIGNAL);
+    if (nb < 0) {
+      if (errno == EINTR) { continue; }
+      if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        /* The send buffer is full, wait for some room.*/
+        err = wait_to(cp->socket, POLLOUT, cp->sendtimeout);
+        if (err == -2) { return UROS_ERR_TIMEOUT; }
+        if (err == 0) { continue; }
+      }
+    }
+    urosError(nb < 0, return UROS_ERR_BADCONN,
+              ("Socket error [%s] while sending %d chunks to "
+               UROS_ADDRFMT"\n",
+               strerror(errno), n, UROS_ADDRARG(&cp->remaddr)));
+    skip += (size_t)nb;
+    cp->sentlen += (size_t)nb;
+  }
+}
+
 /**
  * @brief   Sends some data to a remote address.
  * @details Sends the buffered data to the remote address. The data is copied
@@ -696,16 +881,42 @@ uros_err_t uros_lld_conn_sendto(UrosConn *cp,
                                 const void *bufp, size_t buflen,
                                 const UrosAddr *remaddrp) {
 
+  struct sockaddr_in remaddr;
+  ssize_t nb;
+  int err;
+
   urosAssert(urosConnIsValid(cp));
+  urosAssert(cp->protocol == UROS_PROTO_UDP);
   urosAssert(!(buflen > 0) || (bufp != NULL));
   urosAssert(remaddrp != NULL);
 
-  /* TODO: Send the buffer data to the remote address.*/
-  (void)cp;
-  (void)bufp;
-  (void)buflen;
-  (void)remaddrp;
-  return UROS_ERR_NOTIMPL;
+  remaddr.sin_family = AF_INET;
+  remaddr.sin_port = htons(remaddrp->port);
+  remaddr.sin_addr.s_addr = htonl(remaddrp->ip.dword);
+  memset(remaddr.sin_zero, 0, sizeof(remaddr.sin_zero));
+
+  while (UROS_TRUE) {
+    nb = sendto(cp->socket, bufp, buflen, MSG_NOSIGNAL,
+                (struct sockaddr *)&remaddr, sizeof(remaddr));
+    if (nb >= 0) { break; }
+    if (errno == EINTR) { continue; }
+    if (errno != EAGAIN && errno != EWOULDBLOCK) { break; }
+
+    /* The send buffer is full, wait for some room.*/
+    err = wait_to(cp->socket, POLLOUT, cp->sendtimeout);
+    if (err == -2) { return UROS_ERR_TIMEOUT; }
+    if (err != 0) { nb = -1; break; }
+  }
+  urosError(nb < 0, return UROS_ERR_BADCONN,
+            ("Socket error [%s] while sending a datagram of %u bytes to "
+             UROS_ADDRFMT"\n",
+             strerror(errno), (unsigned)buflen, UROS_ADDRARG(remaddrp)));
+  urosError((size_t)nb != buflen, return UROS_ERR_BADCONN,
+            ("Datagram truncated to %u bytes out of %u, to "UROS_ADDRFMT"\n",
+             (unsigned)nb, (unsigned)buflen, UROS_ADDRARG(remaddrp)));
+
+  cp->sentlen += buflen;
+  return UROS_OK;
 }
 
 /**
@@ -743,12 +954,7 @@ uros_err_t uros_lld_conn_sendtoconst(UrosConn *cp,
   urosAssert(!(buflen > 0) || (bufp != NULL));
   urosAssert(remaddrp != NULL);
 
-  /* TODO: Send the buffer data to the remote address.*/
-  (void)cp;
-  (void)bufp;
-  (void)buflen;
-  (void)remaddrp;
-  return UROS_ERR_NOTIMPL;
+  return uros_lld_conn_sendto(cp, bufp, buflen, remaddrp);
 }
 
 /**
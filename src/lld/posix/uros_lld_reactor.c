@@ -0,0 +1,502 @@
+/*
+Copyright (c) 2012-2013, Politecnico di Milano. All rights reserved.
+
+Andrea Zoppi <texzk@email.it>
+Martino Migliavacca <martino.migliavacca@gmail.com>
+
+http://airlab.elet.polimi.it/
+http://www.openrobots.com/
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file    uros_lld_reactor.c
+ * @author  Andrea Zoppi <texzk@email.it>
+ *
+ * @brief   Low-level TCPROS reactor implementation, based on @p epoll.
+ */
+
+/*===========================================================================*/
+/* HEADER FILES                                                              */
+/*===========================================================================*/
+
+#include "../../../include/lld/uros_lld_reactor.h"
+
+#include <string.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+
+/*===========================================================================*/
+/* LOCAL TYPES & MACROS                                                      */
+/*===========================================================================*/
+
+#if UROS_TCPROS_C_USE_ASSERT == UROS_FALSE && !defined(__DOXYGEN__)
+#undef urosAssert
+#define urosAssert(expr)
+#endif
+
+#if UROS_TCPROS_C_USE_ERROR_MSG == UROS_FALSE && !defined(__DOXYGEN__)
+#undef urosError
+#define urosError(when, action, msgargs) { if (when) { action; } }
+#endif
+
+/**
+ * @brief   Reactor descriptor.
+ */
+typedef struct uros_reactor_t {
+  int               epfd;           /**< @brief @p epoll descriptor.*/
+  UrosList          linkList;       /**< @brief Attached links.*/
+  UrosMutex         linkListLock;   /**< @brief Attached links lock.*/
+  uint32_t          sweepTime;      /**< @brief Last exit requests check, in milliseconds.*/
+} uros_reactor_t;
+
+/**
+ * @brief   Link attached to a reactor.
+ */
+typedef struct uros_reactorlink_t {
+  UrosListNode      node;           /**< @brief Node of the reactor link list.*/
+  uros_reactor_t    *reactorp;      /**< @brief Owner reactor.*/
+  UrosTcpRosStatus  *tcpstp;        /**< @brief TCPROS status of the link.*/
+  size_t            buflen;         /**< @brief Pending bytes in the frame buffer.*/
+  uros_bool_t       drain;          /**< @brief Publisher link, draining a fan-out ring.*/
+  uros_bool_t       sending;        /**< @brief Polled for writing, under the ring lock.*/
+  UrosTcpRosFrame   *framep;        /**< @brief Frame being sent, if any.*/
+  size_t            sentoff;        /**< @brief Bytes of @p framep already sent.*/
+} uros_reactorlink_t;
+
+/*===========================================================================*/
+/* LOCAL VARIABLES                                                           */
+/*===========================================================================*/
+
+/** @brief Reactors, one for each reactor thread.*/
+static uros_reactor_t reactors[UROS_TCPROS_REACTOR_THREADS];
+
+/*===========================================================================*/
+/* LOCAL FUNCTIONS                                                           */
+/*===========================================================================*/
+
+uros_err_t uros_reactor_reserve(uros_reactorlink_t *linkp, size_t size) {
+
+  UrosTcpRosStatus *tcpstp = linkp->tcpstp;
+  uint8_t *bufp;
+
+  if (tcpstp->recvframesize >= size) { return UROS_OK; }
+
+  /* Move the pending bytes to a larger frame buffer.*/
+  bufp = (uint8_t *)urosAlloc(UROS_TCPROS_HEAP, size);
+  if (bufp == NULL) { return UROS_ERR_NOMEM; }
+  if (linkp->buflen > 0) {
+    memcpy(bufp, tcpstp->recvframep, linkp->buflen);
+  }
+  urosFree(tcpstp->recvframep);
+  tcpstp->recvframep = bufp;
+  tcpstp->recvframesize = size;
+  return UROS_OK;
+}
+
+void uros_reactor_detach(uros_reactor_t *rp, uros_reactorlink_t *linkp) {
+
+  struct epoll_event ev;
+
+  /* Stop polling the link, then let the TCPROS layer release it.*/
+  memset(&ev, 0, sizeof(ev));
+  epoll_ctl(rp->epfd, EPOLL_CTL_DEL, linkp->tcpstp->csp->socket, &ev);
+  urosMutexLock(&rp->linkListLock);
+  urosListRemove(&rp->linkList, &linkp->node);
+  urosMutexUnlock(&rp->linkListLock);
+  if (linkp->framep != NULL) {
+    urosTcpRosReactorRelease(linkp->tcpstp, linkp->framep, UROS_FALSE);
+  }
+  urosTcpRosReactorDone(linkp->tcpstp);
+  urosFree(linkp);
+}
+
+uros_err_t uros_reactor_dispatch(uros_reactorlink_t *linkp) {
+
+  UrosTcpRosStatus *tcpstp = linkp->tcpstp;
+  const uint8_t *bufp = tcpstp->recvframep;
+  size_t offset = 0;
+  uint32_t framelen = 0;
+  uros_err_t err;
+
+  /* Call the frame handler for each complete frame.*/
+  while (linkp->buflen - offset >= sizeof(uint32_t)) {
+    framelen = (uint32_t)bufp[offset] |
+               ((uint32_t)bufp[offset + 1] << 8) |
+               ((uint32_t)bufp[offset + 2] << 16) |
+               ((uint32_t)bufp[offset + 3] << 24);
+    urosError(framelen > UROS_TCPROS_MAXMSGLEN, return UROS_ERR_BADPARAM,
+              ("Message length %lu exceeds the maximum %lu\n",
+               (unsigned long)framelen,
+               (unsigned long)UROS_TCPROS_MAXMSGLEN));
+    if (linkp->buflen - offset - sizeof(uint32_t) < (size_t)framelen) {
+      break;
+    }
+    err = urosTcpRosReactorFrame(tcpstp, bufp + offset + sizeof(uint32_t),
+                                 (size_t)framelen);
+    if (err != UROS_OK) { return err; }
+    offset += sizeof(uint32_t) + (size_t)framelen;
+  }
+
+  /* Keep the pending bytes at the beginning of the buffer.*/
+  if (offset > 0) {
+    linkp->buflen -= offset;
+    if (linkp->buflen > 0) {
+      memmove(tcpstp->recvframep, tcpstp->recvframep + offset, linkp->buflen);
+    }
+  }
+
+  /* Make room for the whole pending frame.*/
+  if (linkp->buflen >= sizeof(uint32_t)) {
+    return uros_reactor_reserve(linkp, sizeof(uint32_t) + (size_t)framelen);
+  }
+  return UROS_OK;
+}
+
+uros_err_t uros_reactor_read(uros_reactorlink_t *linkp) {
+
+  UrosTcpRosStatus *tcpstp = linkp->tcpstp;
+  UrosConn *csp = tcpstp->csp;
+  size_t room;
+  ssize_t nb;
+  uros_err_t err;
+
+  while (UROS_TRUE) {
+    /* Read as much as the frame buffer can hold, without blocking.*/
+    room = tcpstp->recvframesize - linkp->buflen;
+    nb = recv(csp->socket, tcpstp->recvframep + linkp->buflen, room,
+              MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (nb < 0) {
+      if (errno == EINTR) { continue; }
+      if (errno == EAGAIN || errno == EWOULDBLOCK) { return UROS_OK; }
+    }
+    urosError(nb < 0, return UROS_ERR_BADCONN,
+              ("Socket error [%s] while receiving from "UROS_ADDRFMT"\n",
+               strerror(errno), UROS_ADDRARG(&csp->remaddr)));
+    if (nb == 0) { return UROS_ERR_EOF; }
+    csp->recvlen += (size_t)nb;
+
+    /* Subscribers do not send anything to publisher links, discard it.*/
+    if (!linkp->drain) {
+      linkp->buflen += (size_t)nb;
+      err = uros_reactor_dispatch(linkp);
+      if (err != UROS_OK) { return err; }
+    }
+
+    /* A short read means that the socket was drained.*/
+    if ((size_t)nb < room) { return UROS_OK; }
+  }
+}
+
+uros_err_t uros_reactor_write(uros_reactorlink_t *linkp) {
+
+  UrosTcpRosStatus *tcpstp = linkp->tcpstp;
+  UrosConn *csp = tcpstp->csp;
+  const uint8_t *datap;
+  ssize_t nb;
+  uros_err_t err;
+
+  while (UROS_TRUE) {
+    /* Fetch the next frame of the fan-out ring, if any.*/
+    if (linkp->framep == NULL) {
+      err = urosTcpRosReactorNext(tcpstp, &linkp->framep);
+      if (err != UROS_OK || linkp->framep == NULL) { return err; }
+      linkp->sentoff = 0;
+    }
+
+    /* Send as much as the socket can hold, without blocking.*/
+    datap = urosTcpRosFrameData(linkp->framep);
+    nb = send(csp->socket, datap + linkp->sentoff,
+              linkp->framep->length - linkp->sentoff,
+              MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (nb < 0) {
+      if (errno == EINTR) { continue; }
+      if (errno == EAGAIN || errno == EWOULDBLOCK) { return UROS_OK; }
+    }
+    urosError(nb < 0, return UROS_ERR_BADCONN,
+              ("Socket error [%s] while sending to "UROS_ADDRFMT"\n",
+               strerror(errno), UROS_ADDRARG(&csp->remaddr)));
+    linkp->sentoff += (size_t)nb;
+    csp->sentlen += (size_t)nb;
+
+    if (linkp->sentoff == linkp->framep->length) {
+      urosTcpRosReactorRelease(tcpstp, linkp->framep, UROS_TRUE);
+      linkp->framep = NULL;
+    }
+  }
+}
+
+void uros_reactor_sweep(uros_reactor_t *rp) {
+
+  UrosListNode *nodep, *nextp;
+  uros_reactorlink_t *linkp;
+
+  /* Detach the links whose exit was requested.*/
+  urosMutexLock(&rp->linkListLock);
+  nodep = rp->linkList.headp;
+  urosMutexUnlock(&rp->linkListLock);
+  while (nodep != NULL) {
+    urosMutexLock(&rp->linkListLock);
+    nextp = nodep->nextp;
+    urosMutexUnlock(&rp->linkListLock);
+    linkp = (uros_reactorlink_t *)nodep->datap;
+    if (urosTcpRosStatusCheckExit(linkp->tcpstp)) {
+      uros_reactor_detach(rp, linkp);
+    }
+    nodep = nextp;
+  }
+}
+
+/*===========================================================================*/
+/* GLOBAL FUNCTIONS                                                          */
+/*===========================================================================*/
+
+/** @addtogroup tcpros_lld_funcs */
+/** @{ */
+
+/**
+ * @brief   Initializes the TCPROS reactors.
+ * @details Creates the @p epoll descriptor of each reactor thread.
+ *
+ * @pre     The reactors are not initialized.
+ *
+ * @return
+ *          Error code.
+ */
+uros_err_t uros_lld_reactor_init(void) {
+
+  unsigned i;
+
+  for (i = 0; i < UROS_TCPROS_REACTOR_THREADS; ++i) {
+    uros_reactor_t *rp = &reactors[i];
+
+    urosListObjectInit(&rp->linkList);
+    urosMutexObjectInit(&rp->linkListLock);
+    rp->sweepTime = urosGetTimestampMsec();
+    rp->epfd = epoll_create(UROS_TCPROS_REACTOR_MAXEVENTS);
+    urosError(rp->epfd == -1, return UROS_ERR_BADCONN,
+              ("Error [%s] while creating reactor #%u\n",
+               strerror(errno), i));
+  }
+  return UROS_OK;
+}
+
+/**
+ * @brief   Attaches a TCPROS link to a reactor.
+ * @details The link is assigned to the least loaded reactor, which will read
+ *          its incoming frames from now on. A @p drain link sends the frames
+ *          of its fan-out ring instead, whenever the socket has room.
+ *
+ * @pre     The TCPROS handshake was completed.
+ * @pre     A @p drain link is registered as a reader of its fan-out ring.
+ * @post    If successful, the reactor owns @p tcpstp and its connection, and
+ *          the caller must not access them anymore.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status with a working connection, allocated
+ *          with @p urosAlloc().
+ * @param[in] drain
+ *          Publisher link, draining the fan-out ring of its topic.
+ * @return
+ *          Error code.
+ */
+uros_err_t uros_lld_reactor_attach(UrosTcpRosStatus *tcpstp,
+                                   uros_bool_t drain) {
+
+  uros_reactor_t *rp = &reactors[0];
+  uros_reactorlink_t *linkp;
+  struct epoll_event ev;
+  uros_err_t err;
+  unsigned i;
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(urosConnIsValid(tcpstp->csp));
+
+  /* Choose the reactor with the fewest links.*/
+  for (i = 1; i < UROS_TCPROS_REACTOR_THREADS; ++i) {
+    if (reactors[i].linkList.length < rp->linkList.length) {
+      rp = &reactors[i];
+    }
+  }
+
+  linkp = urosNew(NULL, uros_reactorlink_t);
+  if (linkp == NULL) { return UROS_ERR_NOMEM; }
+  urosListNodeObjectInit(&linkp->node);
+  linkp->node.datap = linkp;
+  linkp->reactorp = rp;
+  linkp->tcpstp = tcpstp;
+  linkp->buflen = 0;
+  linkp->drain = drain;
+  linkp->sending = drain;
+  linkp->framep = NULL;
+  linkp->sentoff = 0;
+  /* Drain links only discard what they receive.*/
+  err = uros_reactor_reserve(linkp, drain ? 64 : UROS_MTU_SIZE);
+  if (err != UROS_OK) { urosFree(linkp); return err; }
+
+  /* Register the link, before the reactor can see any events. Drain links
+     start by sending the frames already pending.*/
+  memset(&ev, 0, sizeof(ev));
+  ev.events = EPOLLIN | EPOLLRDHUP;
+  if (drain) { ev.events |= EPOLLOUT; }
+  ev.data.ptr = linkp;
+  tcpstp->reactorp = linkp;
+  urosMutexLock(&rp->linkListLock);
+  urosListAdd(&rp->linkList, &linkp->node);
+  if (epoll_ctl(rp->epfd, EPOLL_CTL_ADD, tcpstp->csp->socket, &ev) != 0) {
+    urosListRemove(&rp->linkList, &linkp->node);
+    urosMutexUnlock(&rp->linkListLock);
+    tcpstp->reactorp = NULL;
+    urosError(UROS_TRUE, UROS_NOP,
+              ("Error [%s] while attaching "UROS_ADDRFMT" to a reactor\n",
+               strerror(errno), UROS_ADDRARG(&tcpstp->csp->remaddr)));
+    urosFree(linkp);
+    return UROS_ERR_BADCONN;
+  }
+  urosMutexUnlock(&rp->linkListLock);
+  return UROS_OK;
+}
+
+/**
+ * @brief   Enables or disables the sending of a drain link.
+ * @details The reactor polls the link for writing only while its fan-out
+ *          ring has frames to be sent.
+ *
+ * @pre     The link is a drain link attached to a reactor.
+ * @pre     The lock of the fan-out ring of the link is held.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status handled by a reactor.
+ * @param[in] enable
+ *          Polls the link for writing.
+ */
+void uros_lld_reactor_wantsend(UrosTcpRosStatus *tcpstp, uros_bool_t enable) {
+
+  uros_reactorlink_t *linkp;
+  struct epoll_event ev;
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(tcpstp->reactorp != NULL);
+
+  linkp = (uros_reactorlink_t *)tcpstp->reactorp;
+  urosAssert(linkp->drain);
+  if (linkp->sending == enable) { return; }
+  linkp->sending = enable;
+
+  /* A detaching link is not polled anymore, ignore any errors.*/
+  memset(&ev, 0, sizeof(ev));
+  ev.events = EPOLLIN | EPOLLRDHUP;
+  if (enable) { ev.events |= EPOLLOUT; }
+  ev.data.ptr = linkp;
+  epoll_ctl(linkp->reactorp->epfd, EPOLL_CTL_MOD, tcpstp->csp->socket, &ev);
+}
+
+/**
+ * @brief   Runs a reactor round.
+ * @details Waits for events on the links of a reactor, and dispatches their
+ *          complete frames, or sends the pending frames of drain links. Links
+ *          which were closed, failed, or were asked to exit are detached.
+ *
+ * @pre     Called only by the reactor thread with the same @p index.
+ *
+ * @param[in] index
+ *          Reactor index.
+ * @param[in] ms
+ *          Maximum wait time, in milliseconds.
+ * @return
+ *          Error code.
+ */
+uros_err_t uros_lld_reactor_poll(unsigned index, uint32_t ms) {
+
+  uros_reactor_t *rp;
+  struct epoll_event events[UROS_TCPROS_REACTOR_MAXEVENTS];
+  uros_reactorlink_t *linkp;
+  uros_err_t err;
+  uint32_t now;
+  int n, i;
+
+  urosAssert(index < UROS_TCPROS_REACTOR_THREADS);
+  rp = &reactors[index];
+
+  n = epoll_wait(rp->epfd, events, UROS_TCPROS_REACTOR_MAXEVENTS, (int)ms);
+  urosError(n < 0 && errno != EINTR, return UROS_ERR_BADCONN,
+            ("Error [%s] while waiting on reactor #%u\n",
+             strerror(errno), index));
+
+  for (i = 0; i < n; ++i) {
+    linkp = (uros_reactorlink_t *)events[i].data.ptr;
+    err = UROS_OK;
+    if (events[i].events & EPOLLIN) {
+      err = uros_reactor_read(linkp);
+    }
+    if (err == UROS_OK && (events[i].events & EPOLLOUT)) {
+      err = uros_reactor_write(linkp);
+    }
+    if (err == UROS_OK &&
+        (events[i].events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP))) {
+      /* Drain the pending data, up to the end of the stream.*/
+      err = uros_reactor_read(linkp);
+      if (err == UROS_OK) { err = UROS_ERR_EOF; }
+    }
+    if (err != UROS_OK) {
+      uros_reactor_detach(rp, linkp);
+    }
+  }
+
+  /* Check for exit requests once in a while.*/
+  now = urosGetTimestampMsec();
+  if (n <= 0 || now - rp->sweepTime >= ms) {
+    rp->sweepTime = now;
+    uros_reactor_sweep(rp);
+  }
+  return UROS_OK;
+}
+
+/**
+ * @brief   Detaches all the links of a reactor.
+ *
+ * @pre     Called only by the reactor thread with the same @p index.
+ * @post    The reactor has no links.
+ *
+ * @param[in] index
+ *          Reactor index.
+ */
+void uros_lld_reactor_detachall(unsigned index) {
+
+  uros_reactor_t *rp;
+  UrosListNode *nodep;
+
+  urosAssert(index < UROS_TCPROS_REACTOR_THREADS);
+  rp = &reactors[index];
+
+  while (UROS_TRUE) {
+    urosMutexLock(&rp->linkListLock);
+    nodep = rp->linkList.headp;
+    urosMutexUnlock(&rp->linkListLock);
+    if (nodep == NULL) { break; }
+    uros_reactor_detach(rp, (uros_reactorlink_t *)nodep->datap);
+  }
+}
+
+/** @} */
@@ -60,6 +60,28 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define urosError(when, action, msgargs) { if (when) { action; } }
 #endif
 
+/**
+ * @brief   Interned string entry.
+ * @details Unless the entry is static, the character data is stored right
+ *          after the entry itself, in the same memory chunk.
+ */
+typedef struct uros_strintern_t {
+  struct uros_strintern_t   *nextp;     /**< @brief Next entry in bucket.*/
+  uint32_t                  hash;       /**< @brief String hash.*/
+  uros_cnt_t                refcnt;     /**< @brief Reference count.*/
+  UrosString                str;        /**< @brief Interned string.*/
+} uros_strintern_t;
+
+/*===========================================================================*/
+/* LOCAL VARIABLES                                                           */
+/*===========================================================================*/
+
+/** @brief String intern table buckets.*/
+static uros_strintern_t *uros_strintern_buckets[UROS_STRINTERN_BUCKETS];
+
+/** @brief String intern table lock.*/
+static UrosMutex uros_strintern_lock;
+
 /*===========================================================================*/
 /* GLOBAL VARIABLES                                                          */
 /*===========================================================================*/
@@ -80,11 +102,136 @@ UrosList urosSrvTypeList;
 
 /** @brief Null topic flags.*/
 const uros_topicflags_t uros_nulltopicflags =
-  { UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE };
+  { UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE,
+    UROS_FALSE, UROS_FALSE, UROS_FALSE };
 
 /** @brief Null service flags.*/
 const uros_topicflags_t uros_nullserviceflags =
-  { UROS_TRUE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE };
+  { UROS_TRUE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE,
+    UROS_FALSE, UROS_FALSE, UROS_FALSE };
+
+/*===========================================================================*/
+/* LOCAL FUNCTIONS                                                           */
+/*===========================================================================*/
+
+#if UROS_USE_BUILTIN_MEMPOOL != UROS_FALSE
+
+unsigned uros_mempool_homestripe(void) {
+
+#if UROS_MEMPOOL_STRIPES > 1
+  unsigned long id;
+
+  /* Thread IDs are usually aligned addresses, fold the higher bits.*/
+  id = (unsigned long)urosThreadSelf();
+  id ^= (id >> 7) ^ (id >> 13) ^ (id >> 21);
+  return (unsigned)(id % UROS_MEMPOOL_STRIPES);
+#else
+  return 0;
+#endif
+}
+
+#endif /* UROS_USE_BUILTIN_MEMPOOL != UROS_FALSE */
+
+UrosString uros_strintern_get(const char *datap, size_t datalen,
+                              uros_bool_t copy) {
+
+  UrosString str;
+  uros_strintern_t *entryp;
+  uros_strintern_t **bucketpp;
+  uint32_t hash;
+
+  urosAssert(!(datalen > 0) || datap != NULL);
+
+  str.length = datalen;
+  str.datap = (char*)datap;
+  if (datalen == 0) {
+    str.datap = NULL;
+    return str;
+  }
+  hash = urosStringHash(&str);
+  bucketpp = &uros_strintern_buckets[hash % UROS_STRINTERN_BUCKETS];
+
+  urosMutexLock(&uros_strintern_lock);
+  for (entryp = *bucketpp; entryp != NULL; entryp = entryp->nextp) {
+    if (entryp->hash == hash && entryp->str.length == datalen &&
+        0 == memcmp(entryp->str.datap, datap, datalen)) {
+      ++entryp->refcnt;
+      break;
+    }
+  }
+  if (entryp == NULL) {
+    /* Add a new entry, with a copy of the string data if requested.*/
+    entryp = (uros_strintern_t *)urosAlloc(NULL, sizeof(uros_strintern_t) +
+                                                 (copy ? datalen : 0));
+    if (entryp != NULL) {
+      entryp->hash = hash;
+      entryp->refcnt = 1;
+      entryp->str.length = datalen;
+      if (copy) {
+        entryp->str.datap = (char*)(entryp + 1);
+        memcpy(entryp->str.datap, datap, datalen);
+      } else {
+        entryp->str.datap = (char*)datap;
+      }
+      entryp->nextp = *bucketpp;
+      *bucketpp = entryp;
+    }
+  }
+  urosMutexUnlock(&uros_strintern_lock);
+
+  if (entryp == NULL) {
+    str.length = 0;
+    str.datap = NULL;
+    return str;
+  }
+  return entryp->str;
+}
+
+UrosString uros_strintern_find(const UrosString *strp) {
+
+  UrosString str;
+  const uros_strintern_t *entryp;
+  uint32_t hash;
+
+  urosAssert(urosStringNotEmpty(strp));
+
+  hash = urosStringHash(strp);
+  urosMutexLock(&uros_strintern_lock);
+  for (entryp = uros_strintern_buckets[hash % UROS_STRINTERN_BUCKETS];
+       entryp != NULL; entryp = entryp->nextp) {
+    if (entryp->hash == hash && entryp->str.length == strp->length &&
+        0 == memcmp(entryp->str.datap, strp->datap, strp->length)) {
+      break;
+    }
+  }
+  if (entryp != NULL) {
+    str = entryp->str;
+  } else {
+    urosStringObjectInit(&str);
+  }
+  urosMutexUnlock(&uros_strintern_lock);
+  return str;
+}
+
+const UrosMsgType *uros_statictype_find(const UrosList *lstp,
+                                        const UrosString *namep) {
+
+  UrosString key;
+  const UrosListNode *nodep;
+  const UrosMsgType *typep;
+
+  /* Registered type names are interned, so a name which is not interned is
+     not registered, and the others are matched by their data pointers.*/
+  key = uros_strintern_find(namep);
+  if (key.datap == NULL) { return NULL; }
+  for (nodep = lstp->headp; nodep != NULL; nodep = nodep->nextp) {
+    typep = (const UrosMsgType *)nodep->datap;
+    if (urosStringIsSameInterned(&typep->name, &key)) {
+      return typep;
+    }
+  }
+  return NULL;
+}
 
 /*===========================================================================*/
 /* GLOBAL FUNCTIONS                                                          */
@@ -112,6 +259,7 @@ void urosInit(void) {
 
   /* Initialize low-level services and data.*/
   uros_lld_init();
+  urosMutexObjectInit(&uros_strintern_lock);
 
   /* Initialize the Node module.*/
   urosNodeObjectInit(&urosNode);
@@ -196,6 +344,47 @@ void urosFree(void *chunkp) {
   uros_lld_free(chunkp);
 }
 
+/**
+ * @brief   Initializes a heap object.
+ * @details The heap manages the provided memory area. Its blocks are
+ *          allocated by passing @p heapp to @p urosAlloc(), and released with
+ *          @p urosFree() as usual.
+ *
+ * @pre     The object addressed by @p heapp is allocated but not initialized.
+ * @post    The heap is initialized, with all its memory area free.
+ *
+ * @param[in,out] heapp
+ *          Pointer to an allocated @p UrosMemHeap object.
+ * @param[in] bufp
+ *          Pointer to the heap memory area.
+ * @param[in] size
+ *          Size of the heap memory area, in bytes.
+ */
+void urosMemHeapObjectInit(UrosMemHeap *heapp, void *bufp, size_t size) {
+
+  urosAssert(heapp != NULL);
+  urosAssert(bufp != NULL);
+
+  uros_lld_heap_objectinit(heapp, bufp, size);
+}
+
+/**
+ * @brief   Reads the statistics of a heap.
+ * @details The statistics are a consistent snapshot of the heap usage.
+ *
+ * @param[in] heapp
+ *          Pointer to an initialized @p UrosMemHeap object.
+ * @param[out] statsp
+ *          Pointer to the @p UrosMemHeapStats object to be written.
+ */
+void urosMemHeapStats(UrosMemHeap *heapp, UrosMemHeapStats *statsp) {
+
+  urosAssert(heapp != NULL);
+  urosAssert(statsp != NULL);
+
+  uros_lld_heap_stats(heapp, statsp);
+}
+
 /** @} */
 
 /*~~~ MEMORY POOL ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -222,14 +411,18 @@ void urosMemPoolObjectInit(UrosMemPool *poolp, size_t blocksize,
                            uros_alloc_f allocator) {
 
 #if UROS_USE_BUILTIN_MEMPOOL != UROS_FALSE
+  unsigned i;
+
   urosAssert(poolp != NULL);
   urosAssert(blocksize > sizeof(void*));
 
   poolp->blockSize = blocksize;
   poolp->allocator = allocator;
-  poolp->headp = NULL;
-  poolp->free = 0;
-  urosMutexObjectInit(&poolp->lock);
+  for (i = 0; i < UROS_MEMPOOL_STRIPES; ++i) {
+    poolp->stripes[i].headp = NULL;
+    poolp->stripes[i].free = 0;
+    urosMutexObjectInit(&poolp->stripes[i].lock);
+  }
 #else
   uros_lld_mempool_objectinit(poolp, blocksize, allocator);
 #endif
@@ -257,28 +450,31 @@ void *urosMemPoolAlloc(UrosMemPool *poolp) {
 
 #if UROS_USE_BUILTIN_MEMPOOL != UROS_FALSE
   void *datap = NULL;
+  unsigned home, i, n;
 
   urosAssert(poolp != NULL);
 
-  urosMutexLock(&poolp->lock);
-  if (poolp->free > 0) {
-    /* There is a free block, get it.*/
-    --poolp->free;
-    datap = poolp->headp;
-    poolp->headp = *(void**)datap;
-
-    /* Skip the reserved pointer.*/
-    datap = (void*)((uint8_t*)datap + sizeof(void*));
-  } else if (poolp->allocator != NULL) {
+  /* Look for a free block, starting from the free list of this thread.*/
+  home = uros_mempool_homestripe();
+  for (n = 0; n < UROS_MEMPOOL_STRIPES && datap == NULL; ++n) {
+    i = (home + n) % UROS_MEMPOOL_STRIPES;
+    urosMutexLock(&poolp->stripes[i].lock);
+    if (poolp->stripes[i].free > 0) {
+      /* There is a free block, get it.*/
+      --poolp->stripes[i].free;
+      datap = poolp->stripes[i].headp;
+      poolp->stripes[i].headp = *(void**)datap;
+    }
+    urosMutexUnlock(&poolp->stripes[i].lock);
+  }
+  if (datap == NULL && poolp->allocator != NULL) {
     /* Allocate a new block.*/
     datap = poolp->allocator(poolp->blockSize);
-    if (datap != NULL) {
-      /* Skip the reserved pointer.*/
-      datap = (void*)((uint8_t*)datap + sizeof(void*));
-    }
   }
-  urosMutexUnlock(&poolp->lock);
-
+  if (datap != NULL) {
+    /* Skip the reserved pointer.*/
+    datap = (void*)((uint8_t*)datap + sizeof(void*));
+  }
   return datap;
 #else
   return uros_lld_mempool_alloc(poolp);
@@ -303,18 +499,21 @@ void *urosMemPoolAlloc(UrosMemPool *poolp) {
 void urosMemPoolFree(UrosMemPool *poolp, void *objp) {
 
 #if UROS_USE_BUILTIN_MEMPOOL != UROS_FALSE
+  unsigned i;
+
   urosAssert(poolp != NULL);
   urosAssert(objp != NULL);
 
   /* Include the reserved pointer.*/
   objp = (void*)((uint8_t*)objp - sizeof(void*));
 
-  /* Set as the first free block available.*/
-  urosMutexLock(&poolp->lock);
-  *(void**)objp = poolp->headp;
-  poolp->headp = objp;
-  ++poolp->free;
-  urosMutexUnlock(&poolp->lock);
+  /* Set as the first free block available to this thread.*/
+  i = uros_mempool_homestripe();
+  urosMutexLock(&poolp->stripes[i].lock);
+  *(void**)objp = poolp->stripes[i].headp;
+  poolp->stripes[i].headp = objp;
+  ++poolp->stripes[i].free;
+  urosMutexUnlock(&poolp->stripes[i].lock);
 #else
   uros_lld_mempool_free(poolp, objp);
 #endif
@@ -331,13 +530,16 @@ void urosMemPoolFree(UrosMemPool *poolp, void *objp) {
 uros_cnt_t urosMemPoolNumFree(UrosMemPool *poolp) {
 
 #if UROS_USE_BUILTIN_MEMPOOL != UROS_FALSE
-  uros_cnt_t free;
+  uros_cnt_t free = 0;
+  unsigned i;
 
   urosAssert(poolp != NULL);
 
-  urosMutexLock(&poolp->lock);
-  free = poolp->free;
-  urosMutexUnlock(&poolp->lock);
+  for (i = 0; i < UROS_MEMPOOL_STRIPES; ++i) {
+    urosMutexLock(&poolp->stripes[i].lock);
+    free += poolp->stripes[i].free;
+    urosMutexUnlock(&poolp->stripes[i].lock);
+  }
   return free;
 #else
   return uros_lld_mempool_numfree(poolp);
@@ -365,16 +567,21 @@ void urosMemPoolLoadArray(UrosMemPool *poolp, void *arrayp, uros_cnt_t n) {
 
 #if UROS_USE_BUILTIN_MEMPOOL != UROS_FALSE
   uros_cnt_t i;
+  unsigned k;
 
   urosAssert(poolp != NULL);
   urosAssert(arrayp != NULL);
   urosAssert(n > 0);
 
-  /* Add each block to the pool.*/
+  /* Spread the blocks among the free lists.*/
   for (i = 0; i < n; ++i) {
-    void *blockp = (void*)((uint8_t*)arrayp + i * poolp->blockSize +
-                           sizeof(void*));
-    urosMemPoolFree(poolp, blockp);
+    void *blockp = (void*)((uint8_t*)arrayp + i * poolp->blockSize);
+    k = (unsigned)(i % UROS_MEMPOOL_STRIPES);
+    urosMutexLock(&poolp->stripes[k].lock);
+    *(void**)blockp = poolp->stripes[k].headp;
+    poolp->stripes[k].headp = blockp;
+    ++poolp->stripes[k].free;
+    urosMutexUnlock(&poolp->stripes[k].lock);
   }
 #else
   uros_lld_mempool_loadarray(poolp, arrayp, n);
@@ -694,6 +901,186 @@ int urosStringCmp(const UrosString *str1, const UrosString *str2) {
   }
 }
 
+/**
+ * @brief   Computes the hash of a string.
+ * @details Uses the 32-bit <i>FNV-1a</i> hash function.
+ *
+ * @param[in] strp
+ *          Pointer to a valid @p UrosString object.
+ * @return
+ *          Hash value of the string.
+ */
+uint32_t urosStringHash(const UrosString *strp) {
+
+  uint32_t hash = 2166136261UL;
+  const uint8_t *curp;
+  size_t left;
+
+  urosAssert(urosStringIsValid(strp));
+
+  for (curp = (const uint8_t *)strp->datap, left = strp->length;
+       left > 0; ++curp, --left) {
+    hash = (hash ^ *curp) * 16777619UL;
+  }
+  return hash;
+}
+
+/**
+ * @brief   Interns a string object.
+ * @details Looks up the string intern table, and returns a reference to the
+ *          shared copy of the string. The copy is created if not found.
+ *          Equal interned strings share the same data, so that they can be
+ *          compared by their data pointers only.
+ * @see     urosStringIsSame()
+ *
+ * @post    The returned string is read-only, and must be released with
+ *          @p urosStringRelease().
+ *
+ * @param[in] strp
+ *          Pointer to a valid @p UrosString object.
+ * @return
+ *          The interned string object (descriptor).
+ * @retval NULL
+ *          Not enough free memory, or empty string.
+ */
+UrosString urosStringIntern(const UrosString *strp) {
+
+  urosAssert(urosStringIsValid(strp));
+
+  return uros_strintern_get(strp->datap, strp->length, UROS_TRUE);
+}
+
+/**
+ * @brief   Interns a string from a memory chunk.
+ * @see     urosStringIntern()
+ *
+ * @param[in] datap
+ *          Pointer to a valid memory address.
+ * @param[in] datalen
+ *          Length of the string.
+ * @return
+ *          The interned string object (descriptor).
+ * @retval NULL
+ *          Not enough free memory, or empty string.
+ */
+UrosString urosStringInternN(const char *datap, size_t datalen) {
+
+  return uros_strintern_get(datap, datalen, UROS_TRUE);
+}
+
+/**
+ * @brief   Interns a static string object.
+ * @details Like @p urosStringIntern(), but if the string was not interned
+ *          yet, the interned string references the provided data instead of
+ *          a copy.
+ *
+ * @param[in] strp
+ *          Pointer to a valid @p UrosString object. Its contents must be valid
+ *          for the whole life of the program.
+ * @return
+ *          The interned string object (descriptor).
+ * @retval NULL
+ *          Not enough free memory, or empty string.
+ */
+UrosString urosStringInternStatic(const UrosString *strp) {
+
+  urosAssert(urosStringIsValid(strp));
+
+  return uros_strintern_get(strp->datap, strp->length, UROS_FALSE);
+}
+
+/**
+ * @brief   Releases a string object.
+ * @details Drops a reference to an interned string. The shared copy is
+ *          removed from the string intern table when no more referenced.
+ *          A string which was not interned is simply deallocated.
+ *
+ * @pre     The string was interned, or its data was allocated with
+ *          @p urosAlloc().
+ * @post    @p strp points to an empty @p UrosString string object.
+ *
+ * @param[in,out] strp
+ *          Pointer to an initialized @p UrosString object.
+ */
+void urosStringRelease(UrosString *strp) {
+
+  uros_strintern_t *entryp;
+  uros_strintern_t **prevpp;
+  void *freep = NULL;
+
+  urosAssert(urosStringIsValid(strp));
+
+  if (strp->datap == NULL) { return; }
+
+  prevpp = &uros_strintern_buckets[urosStringHash(strp) %
+                                   UROS_STRINTERN_BUCKETS];
+  urosMutexLock(&uros_strintern_lock);
+  for (entryp = *prevpp; entryp != NULL; entryp = entryp->nextp) {
+    if (entryp->str.datap == strp->datap) { break; }
+    prevpp = &entryp->nextp;
+  }
+  if (entryp == NULL) {
+    /* Not interned, deallocate it as a plain string.*/
+    freep = strp->datap;
+  } else if (--entryp->refcnt == 0) {
+    *prevpp = entryp->nextp;
+    freep = entryp;
+  }
+  urosMutexUnlock(&uros_strintern_lock);
+  urosFree(freep);
+
+  strp->length = 0;
+  strp->datap = NULL;
+}
+
+/**
+ * @brief   Checks if two strings are equal.
+ * @details Interned strings are equal <i>iif</i> they share the same data,
+ *          so this is just a pointer comparison when both strings are
+ *          interned. Other strings are compared by their contents.
+ *
+ * @param[in] str1
+ *          Pointer to the first @p UrosString operand, valid string.
+ * @param[in] str2
+ *          Pointer to the second @p UrosString operand, valid string.
+ * @return
+ *          @p true <i>iif</i> the strings are equal.
+ */
+uros_bool_t urosStringIsSame(const UrosString *str1, const UrosString *str2) {
+
+  urosAssert(urosStringIsValid(str1));
+  urosAssert(urosStringIsValid(str2));
+
+  if (str1->length != str2->length) { return UROS_FALSE; }
+  return str1->datap == str2->datap ||
+         0 == memcmp(str1->datap, str2->datap, str1->length);
+}
+
+/**
+ * @brief   Checks if two interned strings are equal.
+ * @details Equal interned strings share the same data, so this is just a
+ *          pointer comparison, even when the strings differ.
+ * @see     urosStringIntern()
+ *
+ * @pre     Both strings are interned, or empty.
+ *
+ * @param[in] str1
+ *          Pointer to the first interned @p UrosString operand.
+ * @param[in] str2
+ *          Pointer to the second interned @p UrosString operand.
+ * @return
+ *          @p true <i>iif</i> the strings are equal.
+ */
+uros_bool_t urosStringIsSameInterned(const UrosString *str1,
+                                     const UrosString *str2) {
+
+  urosAssert(urosStringIsValid(str1));
+  urosAssert(urosStringIsValid(str2));
+  urosAssert(str1->datap != str2->datap || str1->length == str2->length);
+
+  return str1->datap == str2->datap;
+}
+
 /** @} */
 
 /*~~~ MESSAGE TYPE ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -725,7 +1112,8 @@ void urosMsgTypeObjectInit(UrosMsgType *typep) {
  * @details Deallocates all the memory chunks allocated by the fields of the
  *          object.
  *
- * @pre     The string data must have been allocated with @p urosAlloc().
+ * @pre     The name and the MD5 sum are interned, or allocated with
+ *          @p urosAlloc(), like the description.
  * @post    The fields of the object are deallocated, strings are empty.
  * @post    @p typep points to an empty @p UrosMsgType descriptor.
  *
@@ -736,9 +1124,9 @@ void urosMsgTypeClean(UrosMsgType *typep) {
 
   urosAssert(typep != NULL);
 
-  urosStringClean(&typep->name);
+  urosStringRelease(&typep->name);
   urosStringClean(&typep->desc);
-  urosStringClean(&typep->md5str);
+  urosStringRelease(&typep->md5str);
 }
 
 /**
@@ -763,7 +1151,7 @@ void urosMsgTypeDelete(UrosMsgType *typep) {
 /**
  * @brief   Checks if the list node links to a message type with the requested
  *          name.
- * @see     urosStringCmp()
+ * @see     urosStringIsSame()
  *
  * @param[in] nodep
  *          Pointer to an initialized @p UrosListNode which points to an
@@ -777,8 +1165,7 @@ void urosMsgTypeDelete(UrosMsgType *typep) {
 uros_bool_t urosMsgTypeNodeHasName(const UrosListNode *nodep,
                                    const UrosString *namep) {
 
-  return 0 == urosStringCmp(&((const UrosMsgType *)nodep->datap)->name,
-                            namep);
+  return urosStringIsSame(&((const UrosMsgType *)nodep->datap)->name, namep);
 }
 
 /**
@@ -813,9 +1200,10 @@ void urosRegisterStaticMsgType(const UrosString *namep,
 
   typep = urosNew(NULL, UrosMsgType);
   urosAssert(typep != NULL);
-  typep->name = *namep;
+  typep->name = urosStringInternStatic(namep);
   typep->desc = *descp;
-  typep->md5str = *md5sump;
+  typep->md5str = urosStringInternStatic(md5sump);
+  urosAssert(typep->name.datap != NULL && typep->md5str.datap != NULL);
 
   nodep = urosNew(NULL, UrosListNode);
   urosAssert(nodep != NULL);
@@ -859,8 +1247,11 @@ void urosRegisterStaticMsgTypeSZ(const char *namep,
   typep = urosNew(NULL, UrosMsgType);
   urosAssert(typep != NULL);
   typep->name = urosStringAssignZ(namep);
+  typep->name = urosStringInternStatic(&typep->name);
   typep->desc = urosStringAssignZ(descp);
   typep->md5str = urosStringAssignZ(md5sump);
+  typep->md5str = urosStringInternStatic(&typep->md5str);
+  urosAssert(typep->name.datap != NULL && typep->md5str.datap != NULL);
 
   nodep = urosNew(NULL, UrosListNode);
   urosAssert(nodep != NULL);
@@ -889,13 +1280,9 @@ void urosRegisterStaticMsgTypeSZ(const char *namep,
  */
 const UrosMsgType *urosFindStaticMsgType(const UrosString *namep) {
 
-  const UrosListNode *foundp;
-
   urosAssert(urosStringNotEmpty(namep));
 
-  foundp = urosListFind(&urosMsgTypeList,
-                        (uros_cmp_f)urosMsgTypeNodeHasName, namep);
-  return (foundp != NULL) ? (const UrosMsgType *)foundp->datap : NULL;
+  return uros_statictype_find(&urosMsgTypeList, namep);
 }
 
 /**
@@ -919,15 +1306,12 @@ const UrosMsgType *urosFindStaticMsgType(const UrosString *namep) {
 const UrosMsgType *urosFindStaticMsgTypeSZ(const char *namep) {
 
   UrosString namestr;
-  const UrosListNode *foundp;
 
   urosAssert(namep != NULL);
   urosAssert(namep[0] != 0);
 
   namestr = urosStringAssignZ(namep);
-  foundp = urosListFind(&urosMsgTypeList,
-                        (uros_cmp_f)urosMsgTypeNodeHasName, &namestr);
-  return (foundp != NULL) ? (const UrosMsgType *)foundp->datap : NULL;
+  return uros_statictype_find(&urosMsgTypeList, &namestr);
 }
 
 /** @} */
@@ -969,9 +1353,10 @@ void urosRegisterStaticSrvType(const UrosString *namep,
 
   typep = urosNew(NULL, UrosMsgType);
   urosAssert(typep != NULL);
-  typep->name = *namep;
+  typep->name = urosStringInternStatic(namep);
   typep->desc = *descp;
-  typep->md5str = *md5sump;
+  typep->md5str = urosStringInternStatic(md5sump);
+  urosAssert(typep->name.datap != NULL && typep->md5str.datap != NULL);
 
   nodep = urosNew(NULL, UrosListNode);
   urosAssert(nodep != NULL);
@@ -1015,8 +1400,11 @@ void urosRegisterStaticSrvTypeSZ(const char *namep,
   typep = urosNew(NULL, UrosMsgType);
   urosAssert(typep != NULL);
   typep->name = urosStringAssignZ(namep);
+  typep->name = urosStringInternStatic(&typep->name);
   typep->desc = urosStringAssignZ(descp);
   typep->md5str = urosStringAssignZ(md5sump);
+  typep->md5str = urosStringInternStatic(&typep->md5str);
+  urosAssert(typep->name.datap != NULL && typep->md5str.datap != NULL);
 
   nodep = urosNew(NULL, UrosListNode);
   urosAssert(nodep != NULL);
@@ -1045,13 +1433,9 @@ void urosRegisterStaticSrvTypeSZ(const char *namep,
  */
 const UrosMsgType *urosFindStaticSrvType(const UrosString *namep) {
 
-  const UrosListNode *foundp;
-
   urosAssert(urosStringNotEmpty(namep));
 
-  foundp = urosListFind(&urosSrvTypeList,
-                        (uros_cmp_f)urosMsgTypeNodeHasName, namep);
-  return (foundp != NULL) ? (const UrosMsgType *)foundp->datap : NULL;
+  return uros_statictype_find(&urosSrvTypeList, namep);
 }
 
 /**
@@ -1075,15 +1459,12 @@ const UrosMsgType *urosFindStaticSrvType(const UrosString *namep) {
 const UrosMsgType *urosFindStaticSrvTypeSZ(const char *namep) {
 
   UrosString namestr;
-  const UrosListNode *foundp;
 
   urosAssert(namep != NULL);
   urosAssert(namep[0] != 0);
 
   namestr = urosStringAssignZ(namep);
-  foundp = urosListFind(&urosSrvTypeList,
-                        (uros_cmp_f)urosMsgTypeNodeHasName, &namestr);
-  return (foundp != NULL) ? (const UrosMsgType *)foundp->datap : NULL;
+  return uros_statictype_find(&urosSrvTypeList, &namestr);
 }
 
 /** @} */
@@ -1111,6 +1492,9 @@ void urosTopicObjectInit(UrosTopic *tp) {
   urosStringObjectInit(&tp->name);
   tp->typep = NULL;
   tp->procf = NULL;
+  tp->msgprocf = NULL;
+  tp->framef = NULL;
+  tp->fanoutp = NULL;
   tp->refcnt = 0;
   memset(&tp->flags, 0, sizeof(tp->flags));
 }
@@ -1120,7 +1504,7 @@ void urosTopicObjectInit(UrosTopic *tp) {
  * @details Deallocates all the memory chunks allocated by the fields of the
  *          object.
  *
- * @pre     The string data must have been allocated with @p urosAlloc().
+ * @pre     The name is interned, or allocated with @p urosAlloc().
  * @post    The fields of the object are deallocated, strings are empty.
  * @post    @p tp points to a nullified @p UrosTopic descriptor.
  *
@@ -1132,9 +1516,13 @@ void urosTopicClean(UrosTopic *tp) {
   urosAssert(tp != NULL);
   urosAssert(tp->refcnt == 0);
 
-  urosStringClean(&tp->name);
+  urosStringRelease(&tp->name);
   tp->typep = NULL;
   tp->procf = NULL;
+  tp->msgprocf = NULL;
+  tp->framef = NULL;
+  urosTcpRosFanoutDelete(tp->fanoutp);
+  tp->fanoutp = NULL;
   tp->refcnt = 0;
 }
 
@@ -1486,6 +1874,34 @@ void urosListAdd(UrosList *lstp, UrosListNode *np) {
   ++lstp->length;
 }
 
+/**
+ * @brief   Appends a node to the list.
+ * @details The node is added to the tail of the list, so that taking nodes
+ *          from the head serves them in insertion order.
+ * @note    The list is scanned to find its tail.
+ *
+ * @pre     No node of the list has the same address of @p np (it is unique).
+ * @post    The tail of the list is @p np.
+ * @post    The list length is incremented by one.
+ *
+ * @param[in,out] lstp
+ *          Pointer to an initialized @p UrosList object.
+ * @param[in] np
+ *          Pointer to the node to be appended, @p NULL forbidden.
+ */
+void urosListAppend(UrosList *lstp, UrosListNode *np) {
+
+  UrosListNode **tailpp;
+
+  urosAssert(urosListIsValid(lstp));
+  urosAssert(np != NULL);
+  urosAssert(np->nextp == NULL);
+
+  for (tailpp = &lstp->headp; *tailpp != NULL; tailpp = &(*tailpp)->nextp) {}
+  *tailpp = np;
+  ++lstp->length;
+}
+
 /**
  * @brief   Removes a node from the list.
  * @details The node, if found, is unlinked from the list and returned.
@@ -1595,7 +2011,7 @@ uros_bool_t urosTopicListNodeHasTopic(const UrosListNode *np,
 
 /**
  * @brief   Checks if the list node links to a topic with the requested name.
- * @see     urosStringCmp()
+ * @see     urosStringIsSame()
  *
  * @param[in] np
  *          Pointer to an initialized @p UrosListNode which points to an
@@ -1611,7 +2027,7 @@ uros_bool_t urosTopicListNodeHasName(const UrosListNode *np,
   urosAssert(np != NULL);
   urosAssert(urosStringNotEmpty(namep));
 
-  return 0 == urosStringCmp(&((const UrosTopic *)np->datap)->name, namep);
+  return urosStringIsSame(&((const UrosTopic *)np->datap)->name, namep);
 }
 
 /**
@@ -1661,6 +2077,196 @@ UrosListNode *urosTopicListFindByName(const UrosList *lstp,
   return urosListFind(lstp, (uros_cmp_f)urosTopicListNodeHasName, namep);
 }
 
+uros_bool_t uros_listindex_match(const UrosListIndexEntry *entryp,
+                                 uint32_t hash, const UrosString *keyp) {
+
+  return entryp->hash == hash && urosStringIsSame(entryp->keyp, keyp);
+}
+
+uros_err_t uros_listindex_resize(UrosListIndex *idxp, uros_cnt_t size) {
+
+  UrosListIndexEntry *oldp = idxp->entriesp, *entryp;
+  uros_cnt_t oldsize = idxp->size, i, j;
+
+  idxp->entriesp = urosArrayNew(NULL, size, UrosListIndexEntry);
+  if (idxp->entriesp == NULL) {
+    idxp->entriesp = oldp;
+    return UROS_ERR_NOMEM;
+  }
+  memset(idxp->entriesp, 0, (size_t)size * sizeof(UrosListIndexEntry));
+  idxp->size = size;
+
+  /* Rehash the old entries.*/
+  for (i = 0; i < oldsize; ++i) {
+    entryp = &oldp[i];
+    if (entryp->keyp != NULL) {
+      for (j = entryp->hash & (size - 1);
+           idxp->entriesp[j].keyp != NULL;
+           j = (j + 1) & (size - 1)) {}
+      idxp->entriesp[j] = *entryp;
+    }
+  }
+  urosFree(oldp);
+  return UROS_OK;
+}
+
+/**
+ * @brief   Initializes a list hash index.
+ * @details The index is empty, and it is allocated when the first node is
+ *          added.
+ *
+ * @param[in,out] idxp
+ *          Pointer to an allocated @p UrosListIndex object.
+ */
+void urosListIndexObjectInit(UrosListIndex *idxp) {
+
+  urosAssert(idxp != NULL);
+
+  idxp->entriesp = NULL;
+  idxp->size = 0;
+  idxp->length = 0;
+}
+
+/**
+ * @brief   Cleans a list hash index.
+ * @details Deallocates the index table. Indexed nodes are left untouched.
+ *
+ * @param[in,out] idxp
+ *          Pointer to an initialized @p UrosListIndex object.
+ */
+void urosListIndexClean(UrosListIndex *idxp) {
+
+  urosAssert(idxp != NULL);
+
+  urosFree(idxp->entriesp);
+  urosListIndexObjectInit(idxp);
+}
+
+/**
+ * @brief   Indexes a list node.
+ * @details The table grows so that it is at most half full.
+ * @note    This function is not thread safe, please lock it with the same
+ *          locking primitive of the indexed list.
+ *
+ * @pre     No nodes are indexed with the same key.
+ * @pre     The key string is not modified nor deallocated while indexed.
+ *
+ * @param[in,out] idxp
+ *          Pointer to an initialized @p UrosListIndex object.
+ * @param[in] keyp
+ *          Pointer to the key string, referenced by the node itself.
+ * @param[in] np
+ *          Pointer to the indexed list node.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosListIndexAdd(UrosListIndex *idxp, const UrosString *keyp,
+                            UrosListNode *np) {
+
+  uint32_t hash;
+  uros_cnt_t i;
+  uros_err_t err;
+
+  urosAssert(idxp != NULL);
+  urosAssert(urosStringIsValid(keyp));
+  urosAssert(np != NULL);
+  urosAssert(urosListIndexFind(idxp, keyp) == NULL);
+
+  if ((idxp->length + 1) * 2 > idxp->size) {
+    err = uros_listindex_resize(idxp, (idxp->size > 0) ? idxp->size * 2 : 16);
+    if (err != UROS_OK) { return err; }
+  }
+
+  hash = urosStringHash(keyp);
+  for (i = hash & (idxp->size - 1);
+       idxp->entriesp[i].keyp != NULL;
+       i = (i + 1) & (idxp->size - 1)) {}
+  idxp->entriesp[i].hash = hash;
+  idxp->entriesp[i].keyp = keyp;
+  idxp->entriesp[i].nodep = np;
+  ++idxp->length;
+  return UROS_OK;
+}
+
+/**
+ * @brief   Removes a list node from the index.
+ * @details The following entries of the same cluster are moved back, so that
+ *          no deletion markers are needed.
+ * @note    This function is not thread safe, please lock it with the same
+ *          locking primitive of the indexed list.
+ *
+ * @param[in,out] idxp
+ *          Pointer to an initialized @p UrosListIndex object.
+ * @param[in] keyp
+ *          Pointer to the key of the indexed node.
+ */
+void urosListIndexRemove(UrosListIndex *idxp, const UrosString *keyp) {
+
+  UrosListIndexEntry *entriesp;
+  uros_cnt_t mask, i, j, k;
+  uint32_t hash;
+
+  urosAssert(idxp != NULL);
+  urosAssert(urosStringIsValid(keyp));
+
+  if (idxp->length == 0) { return; }
+  entriesp = idxp->entriesp;
+  mask = idxp->size - 1;
+  hash = urosStringHash(keyp);
+  for (i = hash & mask; entriesp[i].keyp != NULL; i = (i + 1) & mask) {
+    if (uros_listindex_match(&entriesp[i], hash, keyp)) { break; }
+  }
+  if (entriesp[i].keyp == NULL) { return; }
+
+  /* Shift back the entries which would not be reachable anymore.*/
+  for (j = (i + 1) & mask; entriesp[j].keyp != NULL; j = (j + 1) & mask) {
+    k = entriesp[j].hash & mask;
+    if ((j > i && (k <= i || k > j)) || (j < i && (k <= i && k > j))) {
+      entriesp[i] = entriesp[j];
+      i = j;
+    }
+  }
+  entriesp[i].keyp = NULL;
+  entriesp[i].nodep = NULL;
+  --idxp->length;
+}
+
+/**
+ * @brief   Gets the list node indexed by a key.
+ * @note    This function is not thread safe, please lock it with the same
+ *          locking primitive of the indexed list.
+ *
+ * @param[in] idxp
+ *          Pointer to an initialized @p UrosListIndex object.
+ * @param[in] keyp
+ *          Pointer to the requested key.
+ * @return
+ *          Pointer to the list node with the requested key.
+ * @retval NULL
+ *          No such node found.
+ */
+UrosListNode *urosListIndexFind(const UrosListIndex *idxp,
+                                const UrosString *keyp) {
+
+  const UrosListIndexEntry *entriesp;
+  uros_cnt_t mask, i;
+  uint32_t hash;
+
+  urosAssert(idxp != NULL);
+  urosAssert(urosStringIsValid(keyp));
+
+  if (idxp->length == 0) { return NULL; }
+  entriesp = idxp->entriesp;
+  mask = idxp->size - 1;
+  hash = urosStringHash(keyp);
+  for (i = hash & mask; entriesp[i].keyp != NULL; i = (i + 1) & mask) {
+    if (uros_listindex_match(&entriesp[i], hash, keyp)) {
+      return entriesp[i].nodep;
+    }
+  }
+  return NULL;
+}
+
 /** @} */
 
 /** @} */
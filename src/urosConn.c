@@ -349,14 +349,14 @@ uros_err_t  urosConnRecv(UrosConn *cp,
  *          Pointer to the buffer length in bytes, with the following meaning:
  *          - At call, it indicates the maximum length of the received data.
  *          - At return, it is the actual length of the received data.
- * @param[in] remaddrp
- *          Pointer to the remote address descriptor.
+ * @param[out] remaddrp
+ *          Pointer to the source address of the datagram, or @p NULL.
  * @return
  *          Error code.
  */
 uros_err_t  urosConnRecvFrom(UrosConn *cp,
                              void **bufpp, size_t *buflenp,
-                             const UrosAddr *remaddrp) {
+                             UrosAddr *remaddrp) {
 
   return uros_lld_conn_recvfrom(cp, bufpp, buflenp, remaddrp);
 }
@@ -419,6 +419,33 @@ uros_err_t  urosConnSendConst(UrosConn *cp,
   return uros_lld_conn_sendconst(cp, bufp, buflen);
 }
 
+/**
+ * @brief   Sends a sequence of data chunks.
+ * @details Sends the chunks to the remote address, in order, as a single
+ *          contiguous stream, without copying them into a staging buffer.
+ * @see     uros_lld_conn_sendv()
+ * @warning Not conceptually equivalent to POSIX writev(), as all the data
+ *          is granted to be sent with a single call to this function
+ *          (if no connection errors occurred).
+ *
+ * @pre     The connection must be open and working.
+ * @post    All the chunks are sent.
+ *
+ * @param[in,out] cp
+ *          Pointer to a communicating connection object.
+ * @param[in] iovp
+ *          Pointer to the array of chunks to be sent. Chunks can be empty.
+ * @param[in] count
+ *          Number of chunks. Can be @p 0.
+ * @return
+ *          Error code.
+ */
+uros_err_t  urosConnSendV(UrosConn *cp,
+                          const UrosIoVec *iovp, uros_cnt_t count) {
+
+  return uros_lld_conn_sendv(cp, iovp, count);
+}
+
 /**
  * @brief   Sends some data to a remote address.
  * @details Sends the buffered data to the remote address. The data is copied
@@ -44,6 +44,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../include/urosNode.h"
 #include "../include/urosRpcCall.h"
 #include "../include/urosRpcParser.h"
+#include "../include/urosRpcSlave.h"
 
 #include <string.h>
 
@@ -61,6 +62,56 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define urosError(when, action, msgargs) { if (when) { action; } }
 #endif
 
+/** @addtogroup node_types */
+/** @{ */
+
+/**
+ * @brief   Kind of a batched Master call.
+ */
+typedef enum uros_node_callkind_t {
+  UROS_NODE_CALL_REGPUBLISHER,          /**< @brief @p registerPublisher().*/
+  UROS_NODE_CALL_REGSUBSCRIBER,         /**< @brief @p registerSubscriber().*/
+  UROS_NODE_CALL_REGSERVICE,            /**< @brief @p registerService().*/
+  UROS_NODE_CALL_UNREGPUBLISHER,        /**< @brief @p unregisterPublisher().*/
+  UROS_NODE_CALL_UNREGSUBSCRIBER,       /**< @brief @p unregisterSubscriber().*/
+  UROS_NODE_CALL_UNREGSERVICE           /**< @brief @p unregisterService().*/
+} uros_node_callkind_t;
+
+/**
+ * @brief   Batched Master call.
+ */
+typedef struct uros_node_batchcall_t {
+  uros_node_callkind_t  kind;           /**< @brief Master call kind.*/
+  UrosTopic             *topicp;        /**< @brief Descriptor to be registered, or @p NULL.*/
+  UrosString            name;           /**< @brief Topic/service name.*/
+  UrosRpcParamNode      args[4];        /**< @brief Call arguments.*/
+} uros_node_batchcall_t;
+
+#if UROS_NODE_MULTICALL_LENGTH > 0 || defined(__DOXYGEN__)
+/**
+ * @brief   Batched Master calls issued as a single multicall job.
+ */
+typedef struct uros_node_batchjob_t {
+  UrosRpcCallJob        job;            /**< @brief Asynchronous multicall job.*/
+  uros_cnt_t            count;          /**< @brief Number of batched calls.*/
+  uros_node_batchcall_t *callspp[UROS_NODE_MULTICALL_LENGTH]; /**< @brief Batched calls.*/
+  UrosRpcMethodCall     methods[UROS_NODE_MULTICALL_LENGTH]; /**< @brief Multicall methods.*/
+} uros_node_batchjob_t;
+#endif
+
+#if (UROS_NODE_SRVCACHE_LENGTH > 0 && UROS_RPCCALL_ASYNC_THREADS > 0) || \
+    defined(__DOXYGEN__)
+/**
+ * @brief   Background refresh of a cached service provider.
+ */
+typedef struct uros_node_srvjob_t {
+  UrosRpcCallJob        job;            /**< @brief Asynchronous @p lookupService() job.*/
+  UrosString            name;           /**< @brief Service name.*/
+} uros_node_srvjob_t;
+#endif
+
+/** @} */
+
 /*===========================================================================*/
 /* LOCAL VARIABLES                                                           */
 /*===========================================================================*/
@@ -86,6 +137,18 @@ static UROS_STACKPOOL(tcpcliMemPoolChunk, UROS_TCPROS_CLIENT_STKSIZE,
 static UROS_STACKPOOL(tcpsvrMemPoolChunk, UROS_TCPROS_SERVER_STKSIZE,
                       UROS_TCPROS_SERVER_POOLSIZE);
 
+#if UROS_TCPROS_USE_REACTOR
+/** @brief TCPROS reactor thread stacks.*/
+static UROS_STACKPOOL(tcprosReactorStacks, UROS_TCPROS_REACTOR_STKSIZE,
+                      UROS_TCPROS_REACTOR_THREADS);
+#endif
+
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+/** @brief Asynchronous XMLRPC call thread stacks.*/
+static UROS_STACKPOOL(rpccallAsyncStacks, UROS_RPCCALL_ASYNC_STKSIZE,
+                      UROS_RPCCALL_ASYNC_THREADS);
+#endif
+
 /*===========================================================================*/
 /* GLOBAL VARIABLES                                                          */
 /*===========================================================================*/
@@ -104,6 +167,9 @@ void uros_node_createthreads(void) {
   static UrosNodeStatus *const stp = &urosNode.status;
 
   uros_err_t err;
+#if UROS_TCPROS_USE_REACTOR || UROS_RPCCALL_ASYNC_THREADS > 0
+  unsigned i;
+#endif
   (void)err;
 
   urosAssert(stp->xmlrpcListenerId == UROS_NULL_THREADID);
@@ -134,6 +200,35 @@ void uros_node_createthreads(void) {
                                tcprosListenerStack,
                                UROS_TCPROS_LISTENER_STKSIZE);
   urosAssert(err == UROS_OK);
+
+#if UROS_TCPROS_USE_REACTOR
+  /* Spawn the TCPROS reactor threads.*/
+  for (i = 0; i < UROS_TCPROS_REACTOR_THREADS; ++i) {
+    urosAssert(stp->tcprosReactorIds[i] == UROS_NULL_THREADID);
+    err = urosThreadCreateStatic(&stp->tcprosReactorIds[i],
+                                 "TcpRosReactor",
+                                 UROS_TCPROS_REACTOR_PRIO,
+                                 (uros_proc_f)urosTcpRosReactorThread,
+                                 (void*)(size_t)i,
+                                 tcprosReactorStacks[i],
+                                 UROS_TCPROS_REACTOR_STKSIZE);
+    urosAssert(err == UROS_OK);
+  }
+#endif
+
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+  /* Spawn the asynchronous XMLRPC call threads.*/
+  for (i = 0; i < UROS_RPCCALL_ASYNC_THREADS; ++i) {
+    urosAssert(stp->rpccallAsyncIds[i] == UROS_NULL_THREADID);
+    err = urosThreadCreateStatic(&stp->rpccallAsyncIds[i],
+                                 "RpcCallAsync",
+                                 UROS_RPCCALL_ASYNC_PRIO,
+                                 (uros_proc_f)urosRpcCallAsyncThread, NULL,
+                                 rpccallAsyncStacks[i],
+                                 UROS_RPCCALL_ASYNC_STKSIZE);
+    urosAssert(err == UROS_OK);
+  }
+#endif
 }
 
 void uros_node_jointhreads(void) {
@@ -143,6 +238,9 @@ void uros_node_jointhreads(void) {
 
   UrosConn conn;
   uros_err_t err;
+#if UROS_TCPROS_USE_REACTOR || UROS_RPCCALL_ASYNC_THREADS > 0
+  unsigned i;
+#endif
   (void)err;
 
   urosAssert(stp->xmlrpcListenerId != UROS_NULL_THREADID);
@@ -173,6 +271,31 @@ void uros_node_jointhreads(void) {
   urosAssert(err == UROS_OK);
   err = urosThreadPoolJoinAll(&stp->slaveThdPool);
   urosAssert(err == UROS_OK);
+
+  /* Drop the publisher connections left pending.*/
+  urosMutexLock(&stp->tcpcliPendingLock);
+  urosListClean(&stp->tcpcliPendingList,
+                (uros_delete_f)urosTopicSubParamsDelete);
+  urosMutexUnlock(&stp->tcpcliPendingLock);
+
+#if UROS_TCPROS_USE_REACTOR
+  /* Join the TCPROS reactor threads, which detach their links.*/
+  for (i = 0; i < UROS_TCPROS_REACTOR_THREADS; ++i) {
+    err = urosThreadJoin(stp->tcprosReactorIds[i]);
+    urosAssert(err == UROS_OK);
+    stp->tcprosReactorIds[i] = UROS_NULL_THREADID;
+  }
+#endif
+
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+  /* Join the asynchronous XMLRPC call threads, once their jobs are done.*/
+  urosRpcCallAsyncExit();
+  for (i = 0; i < UROS_RPCCALL_ASYNC_THREADS; ++i) {
+    err = urosThreadJoin(stp->rpccallAsyncIds[i]);
+    urosAssert(err == UROS_OK);
+    stp->rpccallAsyncIds[i] = UROS_NULL_THREADID;
+  }
+#endif
 }
 
 uros_err_t uros_node_pollmaster(void) {
@@ -193,8 +316,451 @@ uros_err_t uros_node_pollmaster(void) {
   return err;
 }
 
+uros_err_t uros_node_publishtopic_end(UrosTopic *topicp,
+                                      const UrosRpcResponse *resp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  UrosListNode *nodep;
+  uros_err_t err;
+
+  urosAssert(topicp != NULL);
+  urosAssert(resp != NULL);
+
+  /* Check for valid codes.*/
+  urosError(resp->code != UROS_RPCC_SUCCESS, return UROS_ERR_BADPARAM,
+            ("Response code %d, expected %d\n",
+             resp->code, UROS_RPCC_SUCCESS));
+  urosError(resp->httpcode != 200, return UROS_ERR_BADPARAM,
+            ("Response HTTP code %d, expected 200\n", resp->httpcode));
+
+  /* Add to the published topics list.*/
+  nodep = urosNew(NULL, UrosListNode);
+  if (nodep == NULL) { return UROS_ERR_NOMEM; }
+  urosListNodeObjectInit(nodep);
+  nodep->datap = (void*)topicp;
+  err = urosListIndexAdd(&stp->pubTopicIndex, &topicp->name, nodep);
+  if (err != UROS_OK) { urosFree(nodep); return err; }
+  urosListAdd(&stp->pubTopicList, nodep);
+  return UROS_OK;
+}
+
+uros_err_t uros_node_subscribetopic_end(UrosTopic *topicp,
+                                        UrosRpcResponse *resp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  UrosList newpubs;
+  UrosListNode *nodep;
+  uros_err_t err;
+
+  urosAssert(topicp != NULL);
+  urosAssert(resp != NULL);
+
+  /* Check for valid codes.*/
+  urosError(resp->code != UROS_RPCC_SUCCESS, return UROS_ERR_BADPARAM,
+            ("Response code %d, expected %d\n",
+             resp->code, UROS_RPCC_SUCCESS));
+  urosError(resp->httpcode != 200, return UROS_ERR_BADPARAM,
+            ("Response HTTP code %d, expected 200\n", resp->httpcode));
+
+  /* Connect to registered publishers.*/
+  urosListObjectInit(&newpubs);
+  err = urosNodeFindNewTopicPublishers(&topicp->name, resp->valuep, &newpubs);
+  urosError(err != UROS_OK, goto _finally,
+            ("Error %s while finding new publishers of topic [%.*s]\n",
+             urosErrorText(err), UROS_STRARG(&topicp->name)));
+  urosRpcResponseClean(resp);
+  err = urosRpcSlaveConnectToPublishers(&topicp->name, &newpubs);
+  urosError(err != UROS_OK, goto _finally,
+            ("Error %s while connecting to new publishers of topic [%.*s]\n",
+             urosErrorText(err), UROS_STRARG(&topicp->name)));
+
+  /* Add to the subscribed topics list.*/
+  nodep = urosNew(NULL, UrosListNode);
+  if (nodep == NULL) { err = UROS_ERR_NOMEM; goto _finally; }
+  urosListNodeObjectInit(nodep);
+  nodep->datap = (void*)topicp;
+  err = urosListIndexAdd(&stp->subTopicIndex, &topicp->name, nodep);
+  if (err != UROS_OK) { urosFree(nodep); goto _finally; }
+  urosListAdd(&stp->subTopicList, nodep);
+
+  err = UROS_OK;
+_finally:
+  urosListClean(&newpubs, (uros_delete_f)urosFree);
+  return err;
+}
+
+uros_err_t uros_node_publishservice_end(const UrosTopic *servicep,
+                                        const UrosRpcResponse *resp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  UrosListNode *nodep;
+  uros_err_t err;
+
+  urosAssert(servicep != NULL);
+  urosAssert(resp != NULL);
+
+  /* Check for valid codes.*/
+  urosError(resp->code != UROS_RPCC_SUCCESS, return UROS_ERR_BADPARAM,
+            ("Response code %d, expected %d\n",
+             resp->code, UROS_RPCC_SUCCESS));
+  urosError(resp->httpcode != 200, return UROS_ERR_BADPARAM,
+            ("Response HTTP code %d, expected 200\n", resp->httpcode));
+
+  /* Add to the published services list.*/
+  nodep = urosNew(NULL, UrosListNode);
+  if (nodep == NULL) { return UROS_ERR_NOMEM; }
+  urosListNodeObjectInit(nodep);
+  nodep->datap = (void*)servicep;
+  err = urosListIndexAdd(&stp->pubServiceIndex, &servicep->name, nodep);
+  if (err != UROS_OK) { urosFree(nodep); return err; }
+  urosListAdd(&stp->pubServiceList, nodep);
+  return UROS_OK;
+}
+
+uros_bool_t uros_node_batchcall(uros_node_callkind_t kind, UrosTopic *topicp,
+                                const UrosString *namep, uros_err_t *errp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  uros_node_batchcall_t *callp = NULL;
+  UrosListNode *nodep = NULL;
+  uros_bool_t queued = UROS_FALSE;
+
+  urosAssert(urosStringNotEmpty(namep));
+  urosAssert(errp != NULL);
+
+  urosMutexLock(&stp->masterCallListLock);
+  if (stp->masterCallBatch && topicp != NULL) {
+    /* Pending registrations are not in the registry yet.*/
+    for (nodep = stp->masterCallList.headp; nodep != NULL;
+         nodep = nodep->nextp) {
+      callp = (uros_node_batchcall_t*)nodep->datap;
+      if (callp->kind == kind && urosStringIsSame(&callp->name, namep)) {
+        break;
+      }
+    }
+    callp = NULL;
+    if (nodep != NULL) {
+      urosMutexUnlock(&stp->masterCallListLock);
+      urosError(UROS_TRUE, UROS_NOP,
+                ("[%.*s] already pending registration\n",
+                 UROS_STRARG(namep)));
+      *errp = UROS_ERR_BADPARAM;
+      return UROS_TRUE;
+    }
+  }
+  if (stp->masterCallBatch) {
+    /* Queue the call, or issue it right away if out of memory.*/
+    callp = urosNew(NULL, uros_node_batchcall_t);
+    nodep = urosNew(NULL, UrosListNode);
+    if (callp != NULL && nodep != NULL) {
+      callp->kind = kind;
+      callp->topicp = topicp;
+      callp->name = urosStringClone(namep);
+      if (callp->name.datap != NULL) {
+        urosListNodeObjectInit(nodep);
+        nodep->datap = (void*)callp;
+        urosListAdd(&stp->masterCallList, nodep);
+        queued = UROS_TRUE;
+      }
+    }
+  }
+  urosMutexUnlock(&stp->masterCallListLock);
+  if (!queued) {
+    urosFree(callp);
+    urosFree(nodep);
+  } else {
+    *errp = UROS_OK;
+  }
+  return queued;
+}
+
+void uros_node_batchcall_delete(uros_node_batchcall_t *callp) {
+
+  urosAssert(callp != NULL);
+
+  urosStringClean(&callp->name);
+  urosFree(callp);
+}
+
+#if UROS_NODE_MULTICALL_LENGTH > 0
+
+void uros_node_batchbegin(void) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  urosMutexLock(&stp->masterCallListLock);
+  urosAssert(stp->masterCallList.length == 0);
+  stp->masterCallBatch = UROS_TRUE;
+  urosMutexUnlock(&stp->masterCallListLock);
+}
+
+void uros_node_batchcall_build(uros_node_batchcall_t *callp,
+                               UrosRpcMethodCall *methodp) {
+
+  static const UrosNodeConfig *const cfgp = &urosNode.config;
+
+  const UrosString *argsp[4];
+  unsigned argc, i;
+
+  urosAssert(callp != NULL);
+  urosAssert(methodp != NULL);
+
+  argsp[0] = &cfgp->nodeName;
+  argsp[1] = &callp->name;
+  switch (callp->kind) {
+  case UROS_NODE_CALL_REGPUBLISHER: {
+    methodp->method = urosStringAssignZ("registerPublisher");
+    argsp[2] = &callp->topicp->typep->name;
+    argsp[3] = &cfgp->xmlrpcUri;
+    argc = 4;
+    break;
+  }
+  case UROS_NODE_CALL_REGSUBSCRIBER: {
+    methodp->method = urosStringAssignZ("registerSubscriber");
+    argsp[2] = &callp->topicp->typep->name;
+    argsp[3] = &cfgp->xmlrpcUri;
+    argc = 4;
+    break;
+  }
+  case UROS_NODE_CALL_REGSERVICE: {
+    methodp->method = urosStringAssignZ("registerService");
+    argsp[2] = &cfgp->tcprosUri;
+    argsp[3] = &cfgp->xmlrpcUri;
+    argc = 4;
+    break;
+  }
+  case UROS_NODE_CALL_UNREGPUBLISHER: {
+    methodp->method = urosStringAssignZ("unregisterPublisher");
+    argsp[2] = &cfgp->xmlrpcUri;
+    argc = 3;
+    break;
+  }
+  case UROS_NODE_CALL_UNREGSUBSCRIBER: {
+    methodp->method = urosStringAssignZ("unregisterSubscriber");
+    argsp[2] = &cfgp->xmlrpcUri;
+    argc = 3;
+    break;
+  }
+  case UROS_NODE_CALL_UNREGSERVICE: {
+    methodp->method = urosStringAssignZ("unregisterService");
+    argsp[2] = &cfgp->tcprosUri;
+    argc = 3;
+    break;
+  }
+  default: {
+    urosAssert(0 && "Unknown Master call kind");
+    argc = 2;
+    break;
+  }
+  }
+
+  /* The arguments refer to the node and call strings, without copies.*/
+  urosRpcParamListObjectInit(&methodp->params);
+  for (i = 0; i < argc; ++i) {
+    urosRpcParamNodeObjectInit(&callp->args[i], UROS_RPCP_STRING);
+    callp->args[i].param.value.string = *argsp[i];
+    urosRpcParamListAppendNode(&methodp->params, &callp->args[i]);
+  }
+}
+
+void uros_node_batchcall_end(uros_node_batchcall_t *callp,
+                             UrosRpcResponse *resp) {
+
+  static UrosNode *const np = &urosNode;
+
+  UrosRpcResponse res;
+  uros_err_t err = UROS_OK;
+
+  urosAssert(callp != NULL);
+
+  /* Without a response, issue the call on its own.*/
+  urosRpcResponseObjectInit(&res);
+  switch (callp->kind) {
+  case UROS_NODE_CALL_REGPUBLISHER: {
+    if (resp != NULL) {
+      urosMutexLock(&np->status.pubTopicListLock);
+      err = uros_node_publishtopic_end(callp->topicp, resp);
+      urosMutexUnlock(&np->status.pubTopicListLock);
+    } else {
+      err = urosNodePublishTopicByDesc(callp->topicp);
+    }
+    if (err != UROS_OK) { urosTopicDelete(callp->topicp); }
+    break;
+  }
+  case UROS_NODE_CALL_REGSUBSCRIBER: {
+    if (resp != NULL) {
+      urosMutexLock(&np->status.subTopicListLock);
+      err = uros_node_subscribetopic_end(callp->topicp, resp);
+      urosMutexUnlock(&np->status.subTopicListLock);
+    } else {
+      err = urosNodeSubscribeTopicByDesc(callp->topicp);
+    }
+    if (err != UROS_OK) { urosTopicDelete(callp->topicp); }
+    break;
+  }
+  case UROS_NODE_CALL_REGSERVICE: {
+    if (resp != NULL) {
+      urosMutexLock(&np->status.pubServiceListLock);
+      err = uros_node_publishservice_end(callp->topicp, resp);
+      urosMutexUnlock(&np->status.pubServiceListLock);
+    } else {
+      err = urosNodePublishServiceByDesc(callp->topicp);
+    }
+    if (err != UROS_OK) { urosTopicDelete(callp->topicp); }
+    break;
+  }
+  case UROS_NODE_CALL_UNREGPUBLISHER: {
+    if (resp == NULL) {
+      resp = &res;
+      err = urosRpcCallUnregisterPublisher(&np->config.masterAddr,
+                                           &np->config.nodeName, &callp->name,
+                                           &np->config.xmlrpcUri, resp);
+    }
+    break;
+  }
+  case UROS_NODE_CALL_UNREGSUBSCRIBER: {
+    if (resp == NULL) {
+      resp = &res;
+      err = urosRpcCallUnregisterSubscriber(&np->config.masterAddr,
+                                            &np->config.nodeName, &callp->name,
+                                            &np->config.xmlrpcUri, resp);
+    }
+    break;
+  }
+  case UROS_NODE_CALL_UNREGSERVICE: {
+    if (resp == NULL) {
+      resp = &res;
+      err = urosRpcCallUnregisterService(&np->config.masterAddr,
+                                         &np->config.nodeName, &callp->name,
+                                         &np->config.tcprosUri, resp);
+    }
+    break;
+  }
+  default: {
+    urosAssert(0 && "Unknown Master call kind");
+    break;
+  }
+  }
+  /* Registrations have their codes already checked.*/
+  urosError(err == UROS_OK && callp->topicp == NULL && resp != NULL &&
+            resp->code != UROS_RPCC_SUCCESS, UROS_NOP,
+            ("Response code %d, expected %d, for [%.*s]\n",
+             resp->code, UROS_RPCC_SUCCESS, UROS_STRARG(&callp->name)));
+  urosError(err != UROS_OK, UROS_NOP,
+            ("Error %s while (un)registering [%.*s]\n",
+             urosErrorText(err), UROS_STRARG(&callp->name)));
+  urosRpcResponseClean(&res);
+}
+
+uros_err_t uros_node_batchjob_call(UrosRpcCallJob *jobp) {
+
+  uros_node_batchjob_t *batchp;
+  uros_err_t err;
+
+  urosAssert(jobp != NULL);
+  urosAssert(jobp->argp != NULL);
+
+  batchp = (uros_node_batchjob_t *)jobp->argp;
+  err = urosRpcCallMulticall(&urosNode.config.masterAddr,
+                             batchp->methods, batchp->count);
+  if (err == UROS_ERR_PARSE) {
+    /* No system.multicall support, pipeline the calls instead.*/
+    err = urosRpcCallPipeline(&urosNode.config.masterAddr,
+                              batchp->methods, batchp->count);
+  }
+  return err;
+}
+
+void uros_node_batchend(void) {
+
+  static UrosNode *const np = &urosNode;
+
+  UrosList calls;
+  UrosListNode *nodep, *nextp;
+  uros_node_batchjob_t *jobsp;
+  uros_cnt_t numjobs, j, i;
+  uros_err_t err;
+
+  /* Take the batched calls, in issue order.*/
+  urosMutexLock(&np->status.masterCallListLock);
+  calls = np->status.masterCallList;
+  urosListObjectInit(&np->status.masterCallList);
+  np->status.masterCallBatch = UROS_FALSE;
+  urosMutexUnlock(&np->status.masterCallListLock);
+  for (nodep = calls.headp, calls.headp = NULL; nodep != NULL; nodep = nextp) {
+    nextp = nodep->nextp;
+    nodep->nextp = calls.headp;
+    calls.headp = nodep;
+  }
+  if (calls.headp == NULL) { return; }
+
+  /* Split them into multicalls.*/
+  numjobs = (calls.length + UROS_NODE_MULTICALL_LENGTH - 1) /
+            UROS_NODE_MULTICALL_LENGTH;
+  jobsp = urosArrayNew(NULL, numjobs, uros_node_batchjob_t);
+  if (jobsp == NULL) {
+    /* Issue each call on its own.*/
+    for (nodep = calls.headp; nodep != NULL; nodep = nextp) {
+      nextp = nodep->nextp;
+      uros_node_batchcall_end((uros_node_batchcall_t*)nodep->datap, NULL);
+      urosListNodeDelete(nodep, (uros_delete_f)uros_node_batchcall_delete);
+    }
+    return;
+  }
+  for (j = 0; j < numjobs; ++j) {
+    uros_node_batchjob_t *const batchp = &jobsp[j];
+
+    for (batchp->count = 0;
+         batchp->count < UROS_NODE_MULTICALL_LENGTH && calls.headp != NULL;
+         ++batchp->count) {
+      nodep = calls.headp;
+      calls.headp = nodep->nextp;
+      batchp->callspp[batchp->count] = (uros_node_batchcall_t*)nodep->datap;
+      uros_node_batchcall_build(batchp->callspp[batchp->count],
+                                &batchp->methods[batchp->count]);
+      urosRpcResponseObjectInit(&batchp->methods[batchp->count].response);
+      urosFree(nodep);
+    }
+    urosRpcCallJobObjectInit(&batchp->job, uros_node_batchjob_call, NULL,
+                             batchp);
+  }
+
+  /* Issue all the multicalls back to back, then wait for them in order.*/
+  for (j = 0; j < numjobs; ++j) {
+    urosRpcCallAsync(&jobsp[j].job);
+  }
+  for (j = 0; j < numjobs; ++j) {
+    uros_node_batchjob_t *const batchp = &jobsp[j];
+
+    err = urosRpcCallAsyncWait(&batchp->job);
+    urosError(err != UROS_OK, UROS_NOP,
+              ("Error %s while issuing a multicall to the Master, "
+               "falling back to single calls\n", urosErrorText(err)));
+    for (i = 0; i < batchp->count; ++i) {
+      uros_node_batchcall_end(batchp->callspp[i],
+                              (err == UROS_OK) ? &batchp->methods[i].response
+                                               : NULL);
+      urosRpcResponseClean(&batchp->methods[i].response);
+      uros_node_batchcall_delete(batchp->callspp[i]);
+    }
+    urosRpcCallJobClean(&batchp->job);
+  }
+  urosFree(jobsp);
+}
+
+#endif /* UROS_NODE_MULTICALL_LENGTH > 0 */
+
 void uros_node_registerall(void) {
 
+#if UROS_NODE_MULTICALL_LENGTH > 0
+  /* Batch the registrations issued by the user functions.*/
+  uros_node_batchbegin();
+#endif
+
   /* Register topics.*/
   urosUserPublishTopics();
   urosUserSubscribeTopics();
@@ -202,6 +768,11 @@ void uros_node_registerall(void) {
   /* Register services.*/
   urosUserPublishServices();
 
+#if UROS_NODE_MULTICALL_LENGTH > 0
+  /* Issue the batched registrations.*/
+  uros_node_batchend();
+#endif
+
   /* Register parameters.*/
   urosUserSubscribeParams();
 }
@@ -236,6 +807,11 @@ void uros_node_unregisterall(void) {
   urosUserShutdown(&exitMsg);
   urosStringClean(&exitMsg);
 
+#if UROS_NODE_MULTICALL_LENGTH > 0
+  /* Batch the unregistrations issued by the user functions.*/
+  uros_node_batchbegin();
+#endif
+
   /* Unregister topics.*/
   urosUserUnpublishTopics();
   urosUserUnsubscribeTopics();
@@ -243,10 +819,322 @@ void uros_node_unregisterall(void) {
   /* Unregister services.*/
   urosUserUnpublishServices();
 
+#if UROS_NODE_MULTICALL_LENGTH > 0
+  /* Issue the batched unregistrations.*/
+  uros_node_batchend();
+#endif
+
   /* Unregister parameters.*/
   urosUserUnsubscribeParams();
 }
 
+uros_err_t uros_node_lookupservice_end(const UrosString *namep,
+                                      const UrosRpcResponse *resp,
+                                      UrosAddr *pubaddrp) {
+
+  urosAssert(urosStringNotEmpty(namep));
+  urosAssert(resp != NULL);
+  urosAssert(pubaddrp != NULL);
+#define _ERR    { return UROS_ERR_BADPARAM; }
+
+  /* Check for valid values.*/
+  urosError(resp->httpcode != 200, _ERR,
+            ("The HTTP response code is %lu, expected 200\n",
+             (long unsigned int)resp->httpcode));
+  urosError(resp->code != UROS_RPCC_SUCCESS, _ERR,
+            ("Cannot find a provider for service [%.*s]\n",
+             UROS_STRARG(namep)));
+  urosError(resp->valuep->pclass != UROS_RPCP_STRING, _ERR,
+            ("Response value pclass is %d, expected %d (UROS_RPCP_STRING)\n",
+             (int)resp->valuep->pclass, (int)UROS_RPCP_STRING));
+  urosAssert(urosStringIsValid(&resp->valuep->value.string));
+  urosError(resp->valuep->value.string.length == 0, _ERR,
+            ("Service URI string is empty\n"));
+
+  /* Resolve the service address.*/
+  return urosUriToAddr(&resp->valuep->value.string, pubaddrp);
+#undef _ERR
+}
+
+#if UROS_NODE_SRVCACHE_LENGTH > 0
+
+uros_bool_t uros_node_srvcache_find(const UrosString *namep,
+                                    UrosAddr *pubaddrp,
+                                    uros_bool_t *refreshp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  uros_srvcache_t *entryp;
+  uint32_t now, age;
+  uros_bool_t found = UROS_FALSE;
+
+  urosAssert(urosStringNotEmpty(namep));
+  urosAssert(pubaddrp != NULL);
+  urosAssert(refreshp != NULL);
+
+  *refreshp = UROS_FALSE;
+  now = urosGetTimestampMsec();
+  urosMutexLock(&stp->srvCacheLock);
+  for (entryp = stp->srvCache;
+       entryp < &stp->srvCache[UROS_NODE_SRVCACHE_LENGTH]; ++entryp) {
+    if (0 == urosStringCmp(&entryp->name, namep)) {
+      age = (uint32_t)(now - entryp->stampMsec);
+      if (age < UROS_NODE_SRVCACHE_TTL) {
+        *pubaddrp = entryp->addr;
+        found = UROS_TRUE;
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+        /* Past half its lifetime, look it up again in the background.*/
+        if (age >= UROS_NODE_SRVCACHE_TTL / 2 && !entryp->refreshing) {
+          entryp->refreshing = UROS_TRUE;
+          *refreshp = UROS_TRUE;
+        }
+#endif
+      } else {
+        /* Expired, look it up again.*/
+        urosStringClean(&entryp->name);
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+        entryp->refreshing = UROS_FALSE;
+#endif
+      }
+      break;
+    }
+  }
+  urosMutexUnlock(&stp->srvCacheLock);
+  return found;
+}
+
+void uros_node_srvcache_put(const UrosString *namep,
+                            const UrosAddr *pubaddrp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  uros_srvcache_t *entryp, *victimp = NULL;
+  uint32_t now;
+
+  urosAssert(urosStringNotEmpty(namep));
+  urosAssert(pubaddrp != NULL);
+
+  /* Replace the same service, or a free entry, or the oldest one.*/
+  now = urosGetTimestampMsec();
+  urosMutexLock(&stp->srvCacheLock);
+  for (entryp = stp->srvCache;
+       entryp < &stp->srvCache[UROS_NODE_SRVCACHE_LENGTH]; ++entryp) {
+    if (0 == urosStringCmp(&entryp->name, namep)) {
+      victimp = entryp;
+      break;
+    }
+    if (victimp == NULL || entryp->name.length == 0 ||
+        (victimp->name.length > 0 &&
+         (uint32_t)(now - entryp->stampMsec) >
+         (uint32_t)(now - victimp->stampMsec))) {
+      victimp = entryp;
+    }
+  }
+  if (0 != urosStringCmp(&victimp->name, namep)) {
+    urosStringClean(&victimp->name);
+    victimp->name = urosStringClone(namep);
+  }
+  victimp->addr = *pubaddrp;
+  victimp->stampMsec = now;
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+  victimp->refreshing = UROS_FALSE;
+#endif
+  urosMutexUnlock(&stp->srvCacheLock);
+}
+
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+
+void uros_node_srvcache_refreshed(const UrosString *namep,
+                                  const UrosAddr *pubaddrp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  uros_srvcache_t *entryp;
+
+  urosAssert(urosStringNotEmpty(namep));
+
+  /* Update the entry, unless replaced or forgotten meanwhile.*/
+  urosMutexLock(&stp->srvCacheLock);
+  for (entryp = stp->srvCache;
+       entryp < &stp->srvCache[UROS_NODE_SRVCACHE_LENGTH]; ++entryp) {
+    if (entryp->refreshing && 0 == urosStringCmp(&entryp->name, namep)) {
+      entryp->refreshing = UROS_FALSE;
+      if (pubaddrp != NULL) {
+        entryp->addr = *pubaddrp;
+        entryp->stampMsec = urosGetTimestampMsec();
+      } else {
+        /* The provider is gone, look it up again on the next call.*/
+        urosStringClean(&entryp->name);
+      }
+      break;
+    }
+  }
+  urosMutexUnlock(&stp->srvCacheLock);
+}
+
+uros_err_t uros_node_srvjob_call(UrosRpcCallJob *jobp) {
+
+  static const UrosNodeConfig *const cfgp = &urosNode.config;
+
+  uros_node_srvjob_t *srvjobp;
+
+  urosAssert(jobp != NULL);
+  urosAssert(jobp->argp != NULL);
+
+  srvjobp = (uros_node_srvjob_t *)jobp->argp;
+  return urosRpcCallLookupService(&cfgp->masterAddr, &cfgp->nodeName,
+                                  &srvjobp->name, &jobp->response);
+}
+
+void uros_node_srvjob_done(UrosRpcCallJob *jobp) {
+
+  uros_node_srvjob_t *srvjobp;
+  UrosAddr pubaddr;
+  uros_err_t err;
+
+  urosAssert(jobp != NULL);
+  urosAssert(jobp->argp != NULL);
+
+  srvjobp = (uros_node_srvjob_t *)jobp->argp;
+  err = jobp->err;
+  if (err == UROS_OK) {
+    err = uros_node_lookupservice_end(&srvjobp->name, &jobp->response,
+                                      &pubaddr);
+  }
+  uros_node_srvcache_refreshed(&srvjobp->name,
+                               (err == UROS_OK) ? &pubaddr : NULL);
+  urosRpcCallJobClean(jobp);
+  urosStringClean(&srvjobp->name);
+  urosFree(srvjobp);
+}
+
+void uros_node_srvcache_refresh(const UrosString *namep) {
+
+  uros_node_srvjob_t *srvjobp;
+
+  urosAssert(urosStringNotEmpty(namep));
+
+  /* If out of memory, the entry simply expires.*/
+  srvjobp = urosNew(NULL, uros_node_srvjob_t);
+  if (srvjobp == NULL) { return; }
+  srvjobp->name = urosStringClone(namep);
+  if (srvjobp->name.datap == NULL) { urosFree(srvjobp); return; }
+  urosRpcCallJobObjectInit(&srvjobp->job, uros_node_srvjob_call,
+                           uros_node_srvjob_done, srvjobp);
+  urosRpcCallAsync(&srvjobp->job);
+}
+
+#endif /* UROS_RPCCALL_ASYNC_THREADS > 0 */
+
+#endif /* UROS_NODE_SRVCACHE_LENGTH > 0 */
+
+uros_err_t uros_node_callservice(const UrosTopic *servicep, void *resobjp) {
+
+  UrosAddr pubaddr;
+  uros_err_t err;
+
+  urosAssert(servicep != NULL);
+  urosAssert(resobjp != NULL);
+
+  /* Resolve the service provider.*/
+  err = urosNodeResolveServicePublisher(&servicep->name, &pubaddr);
+  if (err != UROS_OK) { return err; }
+
+  /* Call the client service handler.*/
+  err = urosTcpRosCallService(&pubaddr, servicep, resobjp);
+#if UROS_NODE_SRVCACHE_LENGTH > 0
+  if (err != UROS_OK) {
+    /* The provider may have gone, look it up again next time.*/
+    urosNodeForgetServicePublisher(&servicep->name);
+  }
+#endif
+  return err;
+}
+
+uros_err_t uros_node_pushframe(const UrosString *namep,
+                               UrosTcpRosFrame *framep) {
+
+  static UrosNode *const np = &urosNode;
+
+  const UrosListNode *topicnodep;
+  UrosTopic *topicp;
+  uros_err_t err;
+
+  /* Reference the topic descriptor.*/
+  urosMutexLock(&np->status.pubTopicListLock);
+  topicnodep = urosListIndexFind(&np->status.pubTopicIndex, namep);
+  if (topicnodep != NULL &&
+      ((UrosTopic*)topicnodep->datap)->fanoutp != NULL) {
+    topicp = (UrosTopic*)topicnodep->datap;
+    urosTopicRefInc(topicp);
+  } else {
+    topicp = NULL;
+  }
+  urosMutexUnlock(&np->status.pubTopicListLock);
+  urosError(topicp == NULL,
+            { urosTcpRosFrameRelease(framep); return UROS_ERR_BADPARAM; },
+            ("Topic [%.*s] not published with a fan-out ring\n",
+             UROS_STRARG(namep)));
+
+  /* Push the frame for all the subscribers.*/
+  err = urosTcpRosFanoutPush(topicp->fanoutp, framep, topicp->flags.blocking);
+
+  /* Release the topic descriptor reference.*/
+  urosMutexLock(&np->status.pubTopicListLock);
+  if (0 == urosTopicRefDec(topicp) && topicp->flags.deleted) {
+    urosTopicDelete(topicp);
+  }
+  urosMutexUnlock(&np->status.pubTopicListLock);
+  return err;
+}
+
+uros_err_t uros_node_subscribetopic(const UrosString *namep,
+                                    const UrosString *typep,
+                                    uros_proc_f procf,
+                                    uros_msgproc_f msgprocf,
+                                    uros_tcpframe_f framef,
+                                    uros_topicflags_t flags) {
+
+  static UrosNode *const np = &urosNode;
+
+  UrosTopic *topicp;
+  const UrosMsgType *statictypep;
+  UrosListNode *topicnodep;
+  uros_err_t err;
+
+  /* Get the registered message type.*/
+  statictypep = urosFindStaticMsgType(typep);
+  urosError(statictypep == NULL, return UROS_ERR_BADPARAM,
+            ("Unknown message type [%.*s]\n", UROS_STRARG(typep)));
+
+  /* Check if the topic already exists.*/
+  urosMutexLock(&np->status.subTopicListLock);
+  topicnodep = urosListIndexFind(&np->status.subTopicIndex, namep);
+  urosMutexUnlock(&np->status.subTopicListLock);
+  urosError(topicnodep != NULL, return UROS_ERR_BADPARAM,
+            ("Topic [%.*s] already subscribed\n", UROS_STRARG(namep)));
+
+  /* Create a new topic descriptor.*/
+  topicp = urosNew(NULL, UrosTopic);
+  if (topicp == NULL) { return UROS_ERR_NOMEM; }
+  urosTopicObjectInit(topicp);
+  topicp->name = urosStringIntern(namep);
+  if (topicp->name.datap == NULL) {
+    urosFree(topicp);
+    return UROS_ERR_NOMEM;
+  }
+  topicp->typep = statictypep;
+  topicp->procf = procf;
+  topicp->msgprocf = msgprocf;
+  topicp->framef = framef;
+  topicp->flags = flags;
+
+  /* Subscribe to the topic.*/
+  err = urosNodeSubscribeTopicByDesc(topicp);
+  if (err != UROS_OK) { urosTopicDelete(topicp); }
+  return err;
+}
+
 /*===========================================================================*/
 /* GLOBAL FUNCTIONS                                                          */
 /*===========================================================================*/
@@ -271,6 +1159,9 @@ void uros_node_unregisterall(void) {
 void urosNodeObjectInit(UrosNode *np) {
 
   UrosNodeStatus *stp;
+#if UROS_TCPROS_USE_REACTOR || UROS_RPCCALL_ASYNC_THREADS > 0
+  unsigned i;
+#endif
 
   urosAssert(np != NULL);
 
@@ -285,10 +1176,29 @@ void urosNodeObjectInit(UrosNode *np) {
   urosListObjectInit(&stp->pubTopicList);
   urosListObjectInit(&stp->pubServiceList);
   urosListObjectInit(&stp->subParamList);
+  urosListIndexObjectInit(&stp->subTopicIndex);
+  urosListIndexObjectInit(&stp->pubTopicIndex);
+  urosListIndexObjectInit(&stp->pubServiceIndex);
+  urosListIndexObjectInit(&stp->subParamIndex);
   urosListObjectInit(&stp->subTcpList);
   urosListObjectInit(&stp->pubTcpList);
+  urosListObjectInit(&stp->masterCallList);
+  stp->masterCallBatch = UROS_FALSE;
+  urosListObjectInit(&stp->tcpcliPendingList);
+  stp->tcpcliBusyCnt = 0;
+  stp->persistentCnt = 0;
   stp->xmlrpcListenerId = UROS_NULL_THREADID;
   stp->tcprosListenerId = UROS_NULL_THREADID;
+#if UROS_TCPROS_USE_REACTOR
+  for (i = 0; i < UROS_TCPROS_REACTOR_THREADS; ++i) {
+    stp->tcprosReactorIds[i] = UROS_NULL_THREADID;
+  }
+#endif
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+  for (i = 0; i < UROS_RPCCALL_ASYNC_THREADS; ++i) {
+    stp->rpccallAsyncIds[i] = UROS_NULL_THREADID;
+  }
+#endif
 
   urosMutexObjectInit(&stp->stateLock);
   urosMutexObjectInit(&stp->xmlrpcPidLock);
@@ -298,6 +1208,12 @@ void urosNodeObjectInit(UrosNode *np) {
   urosMutexObjectInit(&stp->subParamListLock);
   urosMutexObjectInit(&stp->subTcpListLock);
   urosMutexObjectInit(&stp->pubTcpListLock);
+  urosMutexObjectInit(&stp->masterCallListLock);
+  urosMutexObjectInit(&stp->tcpcliPendingLock);
+#if UROS_NODE_SRVCACHE_LENGTH > 0
+  memset(stp->srvCache, 0, sizeof(stp->srvCache));
+  urosMutexObjectInit(&stp->srvCacheLock);
+#endif
   stp->exitFlag = UROS_FALSE;
 
   /* Initialize mempools with their description.*/
@@ -335,6 +1251,25 @@ void urosNodeObjectInit(UrosNode *np) {
                            "RpcSlaveSvr",
                            UROS_XMLRPC_SLAVE_PRIO);
 
+#if UROS_TCPROS_USE_REACTOR
+  /* Initialize the TCPROS reactors.*/
+  urosTcpRosReactorObjectInit();
+#endif
+
+  /* Initialize the XMLRPC context and buffer pools.*/
+  urosRpcCallPoolsObjectInit();
+  urosRpcSlavePoolsObjectInit();
+
+#if UROS_RPCCALL_KEEPALIVE_SLOTS > 0
+  /* Initialize the kept-alive XMLRPC connections.*/
+  urosRpcCallKeepAliveObjectInit();
+#endif
+
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+  /* Initialize the asynchronous XMLRPC call queue.*/
+  urosRpcCallAsyncObjectInit();
+#endif
+
   /* The node is initialized and stopped.*/
   urosMutexLock(&stp->stateLock);
   stp->state = UROS_NODE_IDLE;
@@ -434,6 +1369,16 @@ uros_err_t urosNodeThread(void *argp) {
     /* Unregister from the Master*/
     uros_node_unregisterall();
 
+#if UROS_RPCCALL_KEEPALIVE_SLOTS > 0
+    /* Drop kept-alive connections, the remotes may be gone.*/
+    urosRpcCallKeepAliveFlush();
+#endif
+
+#if UROS_NODE_SRVCACHE_LENGTH > 0
+    /* Forget the cached service providers, they may be gone too.*/
+    urosNodeForgetServicePublisher(NULL);
+#endif
+
     urosMutexLock(&stp->stateLock);
     exitFlag = stp->exitFlag;
     if (!exitFlag) {
@@ -496,6 +1441,8 @@ void urosNodeConfigLoadDefaults(UrosNodeConfig *cfgp) {
 /**
  * @brief   Publishes a topic.
  * @details Issues a @p publishTopic() call to the XMLRPC Master.
+ *          Latched topics keep their last published frame, which is sent to
+ *          each new subscriber right after the connection header.
  * @see     urosRpcCallRegisterPublisher()
  * @see     urosNodePublishTopicByDesc()
  * @warning The access to the topic registry is thread-safe, but delays of the
@@ -510,7 +1457,9 @@ void urosNodeConfigLoadDefaults(UrosNodeConfig *cfgp) {
  * @param[in] typep
  *          Pointer to the topic message type name string.
  * @param[in] procf
- *          Topic handler function.
+ *          Topic handler function. If @p NULL, the topic is fed by
+ *          @p urosNodePublish(), through a fan-out ring. Latched topics with
+ *          a handler get their last value from @p urosNodePublish().
  * @param[in] flags
  *          Topic flags.
  * @return
@@ -530,7 +1479,6 @@ uros_err_t urosNodePublishTopic(const UrosString *namep,
 
   urosAssert(urosStringNotEmpty(namep));
   urosAssert(urosStringNotEmpty(typep));
-  urosAssert(procf != NULL);
   urosAssert(!flags.service);
 
   /* Get the registered message type.*/
@@ -540,7 +1488,7 @@ uros_err_t urosNodePublishTopic(const UrosString *namep,
 
   /* Check if the topic already exists.*/
   urosMutexLock(&np->status.pubTopicListLock);
-  topicnodep = urosTopicListFindByName(&np->status.pubTopicList, namep);
+  topicnodep = urosListIndexFind(&np->status.pubTopicIndex, namep);
   urosMutexUnlock(&np->status.pubTopicListLock);
   urosError(topicnodep != NULL, return UROS_ERR_BADPARAM,
             ("Topic [%.*s] already published\n", UROS_STRARG(namep)));
@@ -549,10 +1497,27 @@ uros_err_t urosNodePublishTopic(const UrosString *namep,
   topicp = urosNew(NULL, UrosTopic);
   if (topicp == NULL) { return UROS_ERR_NOMEM; }
   urosTopicObjectInit(topicp);
-  topicp->name = urosStringClone(namep);
+  topicp->name = urosStringIntern(namep);
+  if (topicp->name.datap == NULL) {
+    urosFree(topicp);
+    return UROS_ERR_NOMEM;
+  }
   topicp->typep = statictypep;
   topicp->procf = procf;
   topicp->flags = flags;
+  if (procf == NULL || flags.latching) {
+    /* The ring holds the frames published by urosNodePublish(), and the
+       last one sent to new subscribers of latched topics.*/
+    topicp->fanoutp = urosTcpRosFanoutNew();
+    if (topicp->fanoutp == NULL) {
+      urosTopicDelete(topicp);
+      return UROS_ERR_NOMEM;
+    }
+  }
+  if (procf == NULL) {
+    /* Connections drain the frames published by urosNodePublish().*/
+    topicp->procf = (uros_proc_f)urosTcpRosFanoutDrain;
+  }
 
   /* Publish the topic.*/
   err = urosNodePublishTopicByDesc(topicp);
@@ -577,7 +1542,9 @@ uros_err_t urosNodePublishTopic(const UrosString *namep,
  * @param[in] typep
  *          Pointer to the topic message type name null-terminated string.
  * @param[in] procf
- *          Topic handler function.
+ *          Topic handler function. If @p NULL, the topic is fed by
+ *          @p urosNodePublish(), through a fan-out ring. Latched topics with
+ *          a handler get their last value from @p urosNodePublish().
  * @param[in] flags
  *          Topic flags.
  * @return
@@ -594,7 +1561,6 @@ uros_err_t urosNodePublishTopicSZ(const char *namep,
   urosAssert(namep[0] != 0);
   urosAssert(typep != NULL);
   urosAssert(typep[0] != 0);
-  urosAssert(procf != NULL);
   urosAssert(!flags.service);
 
   namestr = urosStringAssignZ(namep);
@@ -617,6 +1583,9 @@ uros_err_t urosNodePublishTopicSZ(const char *namep,
  *            registry, and is no longer modifiable by the caller function.
  *          - If unsuccessful, the topic descriptor can be deallocated by the
  *            caller function.
+ *          - If the node is batching its Master calls, the registration is
+ *            deferred and the topic descriptor is owned by the node, which
+ *            deallocates it if the registration fails later.
  * @pre     The TCPROS @p service flag must be clear.
  *
  * @param[in] topicp
@@ -630,7 +1599,6 @@ uros_err_t urosNodePublishTopicByDesc(UrosTopic *topicp) {
 
   UrosRpcResponse res;
   uros_err_t err;
-  UrosListNode *nodep;
 
   urosAssert(topicp != NULL);
   urosAssert(urosStringNotEmpty(&topicp->name));
@@ -644,6 +1612,12 @@ uros_err_t urosNodePublishTopicByDesc(UrosTopic *topicp) {
   urosRpcResponseObjectInit(&res);
   urosMutexLock(&np->status.pubTopicListLock);
 
+  /* Defer the registration, if batching Master calls.*/
+  if (uros_node_batchcall(UROS_NODE_CALL_REGPUBLISHER, topicp,
+                          &topicp->name, &err)) {
+    goto _finally;
+  }
+
   /* Master XMLRPC registerPublisher() */
   err = urosRpcCallRegisterPublisher(
     &np->config.masterAddr,
@@ -657,23 +1631,8 @@ uros_err_t urosNodePublishTopicByDesc(UrosTopic *topicp) {
             ("Error %s while registering as publisher of topic [%.*s]\n",
              urosErrorText(err), UROS_STRARG(&topicp->name)));
 
-  /* Check for valid codes.*/
-  urosError(res.code != UROS_RPCC_SUCCESS,
-            { err = UROS_ERR_BADPARAM; goto _finally; },
-            ("Response code %d, expected %d\n",
-             res.code, UROS_RPCC_SUCCESS));
-  urosError(res.httpcode != 200,
-            { err = UROS_ERR_BADPARAM; goto _finally; },
-            ("Response HTTP code %d, expected 200\n", res.httpcode));
-
   /* Add to the published topics list.*/
-  nodep = urosNew(NULL, UrosListNode);
-  if (nodep == NULL) { err = UROS_ERR_NOMEM; goto _finally; }
-  urosListNodeObjectInit(nodep);
-  nodep->datap = (void*)topicp;
-  urosListAdd(&np->status.pubTopicList, nodep);
-
-  err = UROS_OK;
+  err = uros_node_publishtopic_end(topicp, &res);
 _finally:
   /* Cleanup and return.*/
   urosMutexUnlock(&np->status.pubTopicListLock);
@@ -713,7 +1672,7 @@ uros_err_t urosNodeUnpublishTopic(const UrosString *namep) {
 
   /* Find the topic descriptor.*/
   urosMutexLock(&np->status.pubTopicListLock);
-  topicnodep = urosTopicListFindByName(&np->status.pubTopicList, namep);
+  topicnodep = urosListIndexFind(&np->status.pubTopicIndex, namep);
   if (topicnodep == NULL) {
     urosError(topicnodep == NULL,
               { err = UROS_ERR_BADPARAM; goto _finally; },
@@ -721,24 +1680,33 @@ uros_err_t urosNodeUnpublishTopic(const UrosString *namep) {
   }
   topicp = (UrosTopic*)topicnodep->datap;
 
-  /* Unregister the topic on the Master node.*/
-  err = urosRpcCallUnregisterPublisher(
-    &np->config.masterAddr,
-    &np->config.nodeName,
-    namep,
-    &np->config.xmlrpcUri,
-    &res
-  );
-  urosError(err != UROS_OK, UROS_NOP,
-            ("Error %s while unregistering as publisher of topic [%.*s]\n",
-             urosErrorText(err), UROS_STRARG(namep)));
+  /* Unregister the topic on the Master node, unless deferred.*/
+  if (!uros_node_batchcall(UROS_NODE_CALL_UNREGPUBLISHER, NULL, namep,
+                           &err)) {
+    err = urosRpcCallUnregisterPublisher(
+      &np->config.masterAddr,
+      &np->config.nodeName,
+      namep,
+      &np->config.xmlrpcUri,
+      &res
+    );
+    urosError(err != UROS_OK, UROS_NOP,
+              ("Error %s while unregistering as publisher of topic [%.*s]\n",
+               urosErrorText(err), UROS_STRARG(namep)));
+  }
 
   /* Unregister the topic locally.*/
   topicp->flags.deleted = UROS_TRUE;
+  urosListIndexRemove(&np->status.pubTopicIndex, &topicp->name);
   tcprosnodep = urosListRemove(&np->status.pubTopicList, topicnodep);
   urosAssert(tcprosnodep == topicnodep);
 
   if (topicp->refcnt > 0) {
+    /* Stop the fan-out ring, waking up its readers and producers.*/
+    if (topicp->fanoutp != NULL) {
+      urosTcpRosFanoutClose(topicp->fanoutp);
+    }
+
     /* Tell each publishing TCPROS thread to exit.*/
     urosMutexLock(&np->status.pubTcpListLock);
     for (tcprosnodep = np->status.pubTcpList.headp;
@@ -747,9 +1715,7 @@ uros_err_t urosNodeUnpublishTopic(const UrosString *namep) {
 
       UrosTcpRosStatus *tcpstp = (UrosTcpRosStatus*)tcprosnodep->datap;
       if (tcpstp->topicp == topicp && !tcpstp->topicp->flags.service) {
-        urosMutexLock(&tcpstp->threadExitMtx);
-        tcpstp->threadExit = UROS_TRUE;
-        urosMutexUnlock(&tcpstp->threadExitMtx);
+        urosTcpRosStatusIssueExit(tcpstp);
       }
     }
     urosMutexUnlock(&np->status.pubTcpListLock);
@@ -794,6 +1760,165 @@ uros_err_t urosNodeUnpublishTopicSZ(const char *namep) {
   return urosNodeUnpublishTopic(&namestr);
 }
 
+/**
+ * @brief   Publishes a message on a fan-out topic.
+ * @details The message is serialized once into a frame, which is pushed into
+ *          the fan-out ring of the topic. Each subscriber connection sends
+ *          the frame at its own pace, without serializing the message again.
+ *
+ *          On a latched topic with a handler, the frame is only kept as the
+ *          last value, which new subscribers get before the handler runs.
+ * @see     urosTcpRosFanoutPush()
+ *
+ * @pre     The topic was published with a @p NULL handler, or latched, so
+ *          that it has a fan-out ring.
+ *
+ * @param[in] namep
+ *          Pointer to the topic name string.
+ * @param[in] msgp
+ *          Pointer to an initialized message object.
+ * @param[in] lengthf
+ *          Message length function, as generated for the message type.
+ * @param[in] serializef
+ *          Message serialization function, as generated for the message type.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosNodePublish(const UrosString *namep, void *msgp,
+                           uros_msglen_f lengthf, uros_msgser_f serializef) {
+
+  UrosTcpRosFrame *framep;
+
+  urosAssert(urosStringNotEmpty(namep));
+  urosAssert(msgp != NULL);
+  urosAssert(lengthf != NULL);
+  urosAssert(serializef != NULL);
+
+  /* Serialize the message once, and push it for all the subscribers.*/
+  framep = urosTcpRosFrameNew((uint32_t)lengthf(msgp));
+  if (framep == NULL) { return UROS_ERR_NOMEM; }
+  serializef(urosTcpRosFrameData(framep) + sizeof(uint32_t), msgp);
+  return uros_node_pushframe(namep, framep);
+}
+
+/**
+ * @brief   Publishes a message on a fan-out topic.
+ * @see     urosNodePublish()
+ *
+ * @pre     The topic was published with a @p NULL handler, so that it has a
+ *          fan-out ring.
+ *
+ * @param[in] namep
+ *          Pointer to the topic name null-terminated string.
+ * @param[in] msgp
+ *          Pointer to an initialized message object.
+ * @param[in] lengthf
+ *          Message length function, as generated for the message type.
+ * @param[in] serializef
+ *          Message serialization function, as generated for the message type.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosNodePublishSZ(const char *namep, void *msgp,
+                             uros_msglen_f lengthf, uros_msgser_f serializef) {
+
+  UrosString namestr;
+
+  urosAssert(namep != NULL);
+  urosAssert(namep[0] != 0);
+
+  namestr = urosStringAssignZ(namep);
+  return urosNodePublish(&namestr, msgp, lengthf, serializef);
+}
+
+/**
+ * @brief   Publishes a shared message on a fan-out topic.
+ * @details The message object itself is pushed into the fan-out ring of the
+ *          topic. Intra-process subscribers with a message handler get the
+ *          object as is, without any serialization. The message is serialized
+ *          once, and only when the first connection needs its frame.
+ * @see     urosNodePublish()
+ * @see     urosNodeSubscribeTopicShared()
+ *
+ * @pre     The topic was published with a @p NULL handler, so that it has a
+ *          fan-out ring.
+ * @post    The message object is owned by the node, even if unsuccessful. It
+ *          must not be modified anymore, and it is deleted by @p deletef when
+ *          its last reader releases it.
+ *
+ * @param[in] namep
+ *          Pointer to the topic name string.
+ * @param[in] msgp
+ *          Pointer to an initialized message object.
+ * @param[in] lengthf
+ *          Message length function, as generated for the message type.
+ * @param[in] serializef
+ *          Message serialization function, as generated for the message type.
+ * @param[in] deletef
+ *          Message object deleter.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosNodePublishShared(const UrosString *namep, void *msgp,
+                                 uros_msglen_f lengthf,
+                                 uros_msgser_f serializef,
+                                 uros_delete_f deletef) {
+
+  UrosTcpRosFrame *framep;
+
+  urosAssert(urosStringNotEmpty(namep));
+  urosAssert(msgp != NULL);
+  urosAssert(lengthf != NULL);
+  urosAssert(serializef != NULL);
+  urosAssert(deletef != NULL);
+
+  /* The frame owns the message, and serializes it on demand.*/
+  framep = urosTcpRosFrameNew((uint32_t)lengthf(msgp));
+  if (framep == NULL) {
+    deletef(msgp);
+    return UROS_ERR_NOMEM;
+  }
+  framep->msgp = msgp;
+  framep->msgdelf = deletef;
+  framep->serializef = serializef;
+  return uros_node_pushframe(namep, framep);
+}
+
+/**
+ * @brief   Publishes a shared message on a fan-out topic.
+ * @see     urosNodePublishShared()
+ *
+ * @pre     The topic was published with a @p NULL handler, so that it has a
+ *          fan-out ring.
+ * @post    The message object is owned by the node, even if unsuccessful.
+ *
+ * @param[in] namep
+ *          Pointer to the topic name null-terminated string.
+ * @param[in] msgp
+ *          Pointer to an initialized message object.
+ * @param[in] lengthf
+ *          Message length function, as generated for the message type.
+ * @param[in] serializef
+ *          Message serialization function, as generated for the message type.
+ * @param[in] deletef
+ *          Message object deleter.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosNodePublishSharedSZ(const char *namep, void *msgp,
+                                   uros_msglen_f lengthf,
+                                   uros_msgser_f serializef,
+                                   uros_delete_f deletef) {
+
+  UrosString namestr;
+
+  urosAssert(namep != NULL);
+  urosAssert(namep[0] != 0);
+
+  namestr = urosStringAssignZ(namep);
+  return urosNodePublishShared(&namestr, msgp, lengthf, serializef, deletef);
+}
+
 /**
  * @brief   Subscribes to a topic.
  * @details Issues a @p registerSubscriber() call to the XMLRPC Master, and
@@ -826,53 +1951,155 @@ uros_err_t urosNodeSubscribeTopic(const UrosString *namep,
                                   uros_proc_f procf,
                                   uros_topicflags_t flags) {
 
-  static UrosNode *const np = &urosNode;
+  return urosNodeSubscribeTopicShared(namep, typep, procf, NULL, flags);
+}
 
-  UrosTopic *topicp;
-  const UrosMsgType *statictypep;
-  UrosListNode *topicnodep;
-  uros_err_t err;
+/**
+ * @brief   Subscribes to a topic.
+ * @details Issues a @p registerSubscriber() call to the XMLRPC Master, and
+ *          connects to known publishers.
+ * @see     urosNodeSubscribeTopicByDesc()
+ * @see     urosRpcCallRegisterSubscriber()
+ * @see     urosNodeFindNewPublishers()
+ * @see     urosRpcSlaveConnectToPublishers()
+ * @warning The access to the topic registry is thread-safe, but delays of the
+ *          XMLRPC communication will delay also any other threads trying to
+ *          subscribe/unsubscribe to any topics.
+ *
+ * @pre     The topic is not subscribed.
+ * @post    Connects to known publishers listed by a successful response.
+ * @pre     The TCPROS @p service flag must be clear.
+ *
+ * @param[in] namep
+ *          Pointer to the topic name null-terminated string.
+ * @param[in] typep
+ *          Pointer to the topic message type name null-terminated string.
+ * @param[in] procf
+ *          Topic handler function.
+ * @param[in] flags
+ *          Topic flags.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosNodeSubscribeTopicSZ(const char *namep,
+                                    const char *typep,
+                                    uros_proc_f procf,
+                                    uros_topicflags_t flags) {
+
+  UrosString namestr, typestr;
+
+  urosAssert(namep != NULL);
+  urosAssert(namep[0] != 0);
+  urosAssert(typep != NULL);
+  urosAssert(typep[0] != 0);
+  urosAssert(procf != NULL);
+  urosAssert(!flags.service);
+
+  namestr = urosStringAssignZ(namep);
+  typestr = urosStringAssignZ(typep);
+  return urosNodeSubscribeTopic(&namestr, &typestr, procf, flags);
+}
+
+/**
+ * @brief   Subscribes to a topic, sharing the messages of local publishers.
+ * @details Issues a @p registerSubscriber() call to the XMLRPC Master, and
+ *          connects to known publishers. Messages published by this node with
+ *          @p urosNodePublishShared() are handed as objects to the message
+ *          handler, without being serialized or deserialized.
+ * @see     urosNodeSubscribeTopic()
+ * @see     urosNodePublishShared()
+ * @warning The access to the topic registry is thread-safe, but delays of the
+ *          XMLRPC communication will delay also any other threads trying to
+ *          subscribe/unsubscribe to any topics.
+ *
+ * @pre     The topic is not subscribed.
+ * @pre     Local publishers of the topic publish with
+ *          @p urosNodePublishShared(), if @p msgprocf is not @p NULL.
+ * @post    Connects to known publishers listed by a successful response.
+ * @pre     The TCPROS @p service flag must be clear.
+ *
+ * @param[in] namep
+ *          Pointer to the topic name string.
+ * @param[in] typep
+ *          Pointer to the topic message type name string.
+ * @param[in] procf
+ *          Topic handler function, for connections to remote publishers.
+ * @param[in] msgprocf
+ *          Message handler function, for the local publisher. If @p NULL,
+ *          @p procf reads the frames of the local publisher instead.
+ * @param[in] flags
+ *          Topic flags.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosNodeSubscribeTopicShared(const UrosString *namep,
+                                        const UrosString *typep,
+                                        uros_proc_f procf,
+                                        uros_msgproc_f msgprocf,
+                                        uros_topicflags_t flags) {
 
   urosAssert(urosStringNotEmpty(namep));
   urosAssert(urosStringNotEmpty(typep));
   urosAssert(procf != NULL);
   urosAssert(!flags.service);
+  urosAssert(!flags.reactor);
 
-  /* Get the registered message type.*/
-  statictypep = urosFindStaticMsgType(typep);
-  urosError(statictypep == NULL, return UROS_ERR_BADPARAM,
-            ("Unknown message type [%.*s]\n", UROS_STRARG(typep)));
+  return uros_node_subscribetopic(namep, typep, procf, msgprocf, NULL, flags);
+}
 
-  /* Check if the topic already exists.*/
-  urosMutexLock(&np->status.subTopicListLock);
-  topicnodep = urosTopicListFindByName(&np->status.subTopicList, namep);
-  urosMutexUnlock(&np->status.subTopicListLock);
-  urosError(topicnodep != NULL, return UROS_ERR_BADPARAM,
-            ("Topic [%.*s] already subscribed\n", UROS_STRARG(namep)));
+/**
+ * @brief   Subscribes to a topic, sharing the messages of local publishers.
+ * @see     urosNodeSubscribeTopicShared()
+ * @warning The access to the topic registry is thread-safe, but delays of the
+ *          XMLRPC communication will delay also any other threads trying to
+ *          subscribe/unsubscribe to any topics.
+ *
+ * @pre     The topic is not subscribed.
+ * @pre     The TCPROS @p service flag must be clear.
+ *
+ * @param[in] namep
+ *          Pointer to the topic name null-terminated string.
+ * @param[in] typep
+ *          Pointer to the topic message type name null-terminated string.
+ * @param[in] procf
+ *          Topic handler function, for connections to remote publishers.
+ * @param[in] msgprocf
+ *          Message handler function, for the local publisher, or @p NULL.
+ * @param[in] flags
+ *          Topic flags.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosNodeSubscribeTopicSharedSZ(const char *namep,
+                                          const char *typep,
+                                          uros_proc_f procf,
+                                          uros_msgproc_f msgprocf,
+                                          uros_topicflags_t flags) {
 
-  /* Create a new topic descriptor.*/
-  topicp = urosNew(NULL, UrosTopic);
-  if (topicp == NULL) { return UROS_ERR_NOMEM; }
-  urosTopicObjectInit(topicp);
-  topicp->name = urosStringClone(namep);
-  topicp->typep = statictypep;
-  topicp->procf = procf;
-  topicp->flags = flags;
+  UrosString namestr, typestr;
 
-  /* Subscribe to the topic.*/
-  err = urosNodeSubscribeTopicByDesc(topicp);
-  if (err != UROS_OK) { urosTopicDelete(topicp); }
-  return err;
+  urosAssert(namep != NULL);
+  urosAssert(namep[0] != 0);
+  urosAssert(typep != NULL);
+  urosAssert(typep[0] != 0);
+  urosAssert(procf != NULL);
+  urosAssert(!flags.service);
+
+  namestr = urosStringAssignZ(namep);
+  typestr = urosStringAssignZ(typep);
+  return urosNodeSubscribeTopicShared(&namestr, &typestr, procf, msgprocf,
+                                      flags);
 }
 
 /**
- * @brief   Subscribes to a topic.
+ * @brief   Subscribes to a topic, handling its messages frame by frame.
  * @details Issues a @p registerSubscriber() call to the XMLRPC Master, and
- *          connects to known publishers.
- * @see     urosNodeSubscribeTopicByDesc()
- * @see     urosRpcCallRegisterSubscriber()
- * @see     urosNodeFindNewPublishers()
- * @see     urosRpcSlaveConnectToPublishers()
+ *          connects to known publishers. The links are handled by the TCPROS
+ *          reactor threads, if enabled, which call the frame handler for each
+ *          complete message frame. Otherwise, each link calls it from its own
+ *          TCPROS Client thread.
+ * @see     urosNodeSubscribeTopic()
+ * @see     urosTcpRosReactorAttach()
  * @warning The access to the topic registry is thread-safe, but delays of the
  *          XMLRPC communication will delay also any other threads trying to
  *          subscribe/unsubscribe to any topics.
@@ -882,20 +2109,55 @@ uros_err_t urosNodeSubscribeTopic(const UrosString *namep,
  * @pre     The TCPROS @p service flag must be clear.
  *
  * @param[in] namep
+ *          Pointer to the topic name string.
+ * @param[in] typep
+ *          Pointer to the topic message type name string.
+ * @param[in] framef
+ *          Frame handler function. It must never block.
+ * @param[in] flags
+ *          Topic flags. The @p reactor flag is set implicitly.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosNodeSubscribeTopicFrames(const UrosString *namep,
+                                        const UrosString *typep,
+                                        uros_tcpframe_f framef,
+                                        uros_topicflags_t flags) {
+
+  urosAssert(urosStringNotEmpty(namep));
+  urosAssert(urosStringNotEmpty(typep));
+  urosAssert(framef != NULL);
+  urosAssert(!flags.service);
+
+  flags.reactor = UROS_TRUE;
+  return uros_node_subscribetopic(namep, typep, NULL, NULL, framef, flags);
+}
+
+/**
+ * @brief   Subscribes to a topic, handling its messages frame by frame.
+ * @see     urosNodeSubscribeTopicFrames()
+ * @warning The access to the topic registry is thread-safe, but delays of the
+ *          XMLRPC communication will delay also any other threads trying to
+ *          subscribe/unsubscribe to any topics.
+ *
+ * @pre     The topic is not subscribed.
+ * @pre     The TCPROS @p service flag must be clear.
+ *
+ * @param[in] namep
  *          Pointer to the topic name null-terminated string.
  * @param[in] typep
- *          Pointer to the topic message type name null-terminated string.
- * @param[in] procf
- *          Topic handler function.
+ *          Pointer to the topic message type name null-terminated string.
+ * @param[in] framef
+ *          Frame handler function. It must never block.
  * @param[in] flags
- *          Topic flags.
+ *          Topic flags. The @p reactor flag is set implicitly.
  * @return
  *          Error code.
  */
-uros_err_t urosNodeSubscribeTopicSZ(const char *namep,
-                                    const char *typep,
-                                    uros_proc_f procf,
-                                    uros_topicflags_t flags) {
+uros_err_t urosNodeSubscribeTopicFramesSZ(const char *namep,
+                                          const char *typep,
+                                          uros_tcpframe_f framef,
+                                          uros_topicflags_t flags) {
 
   UrosString namestr, typestr;
 
@@ -903,12 +2165,12 @@ uros_err_t urosNodeSubscribeTopicSZ(const char *namep,
   urosAssert(namep[0] != 0);
   urosAssert(typep != NULL);
   urosAssert(typep[0] != 0);
-  urosAssert(procf != NULL);
+  urosAssert(framef != NULL);
   urosAssert(!flags.service);
 
   namestr = urosStringAssignZ(namep);
   typestr = urosStringAssignZ(typep);
-  return urosNodeSubscribeTopic(&namestr, &typestr, procf, flags);
+  return urosNodeSubscribeTopicFrames(&namestr, &typestr, framef, flags);
 }
 
 /**
@@ -929,6 +2191,9 @@ uros_err_t urosNodeSubscribeTopicSZ(const char *namep,
  *            registry, and is no longer modifiable by the caller function.
  *          - If unsuccessful, the topic descriptor can be deallocated by the
  *            caller function.
+ *          - If the node is batching its Master calls, the registration is
+ *            deferred and the topic descriptor is owned by the node, which
+ *            deallocates it if the registration fails later.
  * @post    Connects to known publishers listed by a successful response.
  * @pre     The TCPROS @p service flag must be clear.
  *
@@ -943,21 +2208,25 @@ uros_err_t urosNodeSubscribeTopicByDesc(UrosTopic *topicp) {
 
   UrosRpcResponse res;
   uros_err_t err;
-  UrosList newpubs;
-  UrosListNode *nodep;
 
   urosAssert(topicp != NULL);
   urosAssert(urosStringNotEmpty(&topicp->name));
   urosAssert(topicp->typep != NULL);
   urosAssert(urosStringNotEmpty(&topicp->typep->name));
-  urosAssert(topicp->procf != NULL);
+  urosAssert(topicp->flags.reactor ? topicp->framef != NULL
+                                   : topicp->procf != NULL);
   urosAssert(!topicp->flags.service);
   urosAssert(topicp->refcnt == 0);
 
   urosRpcResponseObjectInit(&res);
-  urosListObjectInit(&newpubs);
   urosMutexLock(&np->status.subTopicListLock);
 
+  /* Defer the registration, if batching Master calls.*/
+  if (uros_node_batchcall(UROS_NODE_CALL_REGSUBSCRIBER, topicp,
+                          &topicp->name, &err)) {
+    goto _finally;
+  }
+
   /* Master XMLRPC registerSubscriber() */
   err = urosRpcCallRegisterSubscriber(
     &np->config.masterAddr,
@@ -971,38 +2240,11 @@ uros_err_t urosNodeSubscribeTopicByDesc(UrosTopic *topicp) {
             ("Cannot register as subscriber of topic [%.*s]\n",
              UROS_STRARG(&topicp->name)));
 
-  /* Check for valid codes.*/
-  urosError(res.code != UROS_RPCC_SUCCESS,
-            { err = UROS_ERR_BADPARAM; goto _finally; },
-            ("Response code %d, expected %d\n",
-             res.code, UROS_RPCC_SUCCESS));
-  urosError(res.httpcode != 200,
-            { err = UROS_ERR_BADPARAM; goto _finally; },
-            ("Response HTTP code %d, expected 200\n", res.httpcode));
-
-  /* Connect to registered publishers.*/
-  err = urosNodeFindNewTopicPublishers(&topicp->name, res.valuep, &newpubs);
-  urosError(err != UROS_OK, goto _finally,
-            ("Error %s while finding new publishers of topic [%.*s]\n",
-             urosErrorText(err), UROS_STRARG(&topicp->name)));
-  urosRpcResponseClean(&res);
-  err = urosRpcSlaveConnectToPublishers(&topicp->name, &newpubs);
-  urosError(err != UROS_OK, goto _finally,
-            ("Error %s while connecting to new publishers of topic [%.*s]\n",
-             urosErrorText(err), UROS_STRARG(&topicp->name)));
-
-  /* Add to the subscribed topics list.*/
-  nodep = urosNew(NULL, UrosListNode);
-  if (nodep == NULL) { err = UROS_ERR_NOMEM; goto _finally; }
-  urosListNodeObjectInit(nodep);
-  nodep->datap = (void*)topicp;
-  urosListAdd(&np->status.subTopicList, nodep);
-
-  err = UROS_OK;
+  /* Connect to registered publishers, and add to the subscribed topics.*/
+  err = uros_node_subscribetopic_end(topicp, &res);
 _finally:
   /* Cleanup and return.*/
   urosMutexUnlock(&np->status.subTopicListLock);
-  urosListClean(&newpubs, (uros_delete_f)urosFree);
   urosRpcResponseClean(&res);
   return err;
 }
@@ -1040,7 +2282,7 @@ uros_err_t urosNodeUnsubscribeTopic(const UrosString *namep) {
 
   /* Find the topic descriptor.*/
   urosMutexLock(&np->status.subTopicListLock);
-  topicnodep = urosTopicListFindByName(&np->status.subTopicList, namep);
+  topicnodep = urosListIndexFind(&np->status.subTopicIndex, namep);
   if (topicnodep == NULL) {
     urosError(topicnodep == NULL,
               { err = UROS_ERR_BADPARAM; goto _finally; },
@@ -1048,20 +2290,24 @@ uros_err_t urosNodeUnsubscribeTopic(const UrosString *namep) {
   }
   topicp = (UrosTopic*)topicnodep->datap;
 
-  /* Unregister the topic on the Master node.*/
-  err = urosRpcCallUnregisterSubscriber(
-    &np->config.masterAddr,
-    &np->config.nodeName,
-    namep,
-    &np->config.xmlrpcUri,
-    &res
-  );
-  urosError(err != UROS_OK, UROS_NOP,
-            ("Error %s while unregistering as subscriber of topic [%.*s]\n",
-             urosErrorText(err), UROS_STRARG(namep)));
+  /* Unregister the topic on the Master node, unless deferred.*/
+  if (!uros_node_batchcall(UROS_NODE_CALL_UNREGSUBSCRIBER, NULL, namep,
+                           &err)) {
+    err = urosRpcCallUnregisterSubscriber(
+      &np->config.masterAddr,
+      &np->config.nodeName,
+      namep,
+      &np->config.xmlrpcUri,
+      &res
+    );
+    urosError(err != UROS_OK, UROS_NOP,
+              ("Error %s while unregistering as subscriber of topic [%.*s]\n",
+               urosErrorText(err), UROS_STRARG(namep)));
+  }
 
   /* Unregister the topic locally.*/
   topicp->flags.deleted = UROS_TRUE;
+  urosListIndexRemove(&np->status.subTopicIndex, &topicp->name);
   tcprosnodep = urosListRemove(&np->status.subTopicList, topicnodep);
   urosAssert(tcprosnodep == topicnodep);
 
@@ -1123,10 +2369,11 @@ uros_err_t urosNodeUnsubscribeTopicSZ(const char *namep) {
 
 /**
  * @brief   Executes a service call.
- * @details Gets the service URI from the Master node. If found, it executes
- *          the service call once, and the result is returned.
+ * @details Gets the service URI from the Master node, unless recently cached.
+ *          If found, it executes the service call once, and the result is
+ *          returned. If the call fails, the cached URI is forgotten.
  * @note    Only a @e single call will be executed. Persistent TCPROS service
- *          connections need custom handlers.
+ *          connections are handled by @p urosNodeServiceClientOpen().
  *
  * @pre     The TCPROS @p service flag must be set, @p persistent clear.
  *
@@ -1152,9 +2399,7 @@ uros_err_t urosNodeCallService(const UrosString *namep,
                                void *resobjp) {
 
   UrosTopic service;
-  UrosAddr pubaddr;
   const UrosMsgType *statictypep;
-  uros_err_t err;
 
   urosAssert(urosStringNotEmpty(namep));
   urosAssert(urosStringNotEmpty(typep));
@@ -1168,25 +2413,22 @@ uros_err_t urosNodeCallService(const UrosString *namep,
   urosError(statictypep == NULL, return UROS_ERR_BADPARAM,
             ("Unknown service type [%.*s]\n", UROS_STRARG(typep)));
 
-  /* Resolve the service provider.*/
-  err = urosNodeResolveServicePublisher(namep, &pubaddr);
-  if (err != UROS_OK) { return err; }
-
   /* Call the client service handler.*/
   urosTopicObjectInit(&service);
   service.name = *namep;
   service.typep = statictypep;
   service.procf = (uros_proc_f)callf;
   service.flags = flags;
-  return urosTcpRosCallService(&pubaddr, &service, resobjp);
+  return uros_node_callservice(&service, resobjp);
 }
 
 /**
  * @brief   Executes a service call.
- * @details Gets the service URI from the Master node. If found, it executes
- *          the service call once, and the result is returned.
+ * @details Gets the service URI from the Master node, unless recently cached.
+ *          If found, it executes the service call once, and the result is
+ *          returned. If the call fails, the cached URI is forgotten.
  * @note    Only a @e single call will be executed. Persistent TCPROS service
- *          connections need custom handlers.
+ *          connections are handled by @p urosNodeServiceClientOpen().
  *
  * @pre     The TCPROS @p service flag must be set, @p persistent clear.
  *
@@ -1212,9 +2454,7 @@ uros_err_t urosNodeCallServiceSZ(const char *namep,
                                  void *resobjp) {
 
   UrosTopic service;
-  UrosAddr pubaddr;
   const UrosMsgType *statictypep;
-  uros_err_t err;
 
   urosAssert(namep != NULL);
   urosAssert(namep[0] != 0);
@@ -1230,25 +2470,22 @@ uros_err_t urosNodeCallServiceSZ(const char *namep,
   urosError(statictypep == NULL, return UROS_ERR_BADPARAM,
             ("Unknown service type [%s]\n", typep));
 
-  /* Resolve the service provider.*/
+  /* Call the client service handler.*/
   urosTopicObjectInit(&service);
   service.name = urosStringAssignZ(namep);
-  err = urosNodeResolveServicePublisher(&service.name, &pubaddr);
-  if (err != UROS_OK) { return err; }
-
-  /* Call the client service handler.*/
   service.typep = statictypep;
   service.procf = (uros_proc_f)callf;
   service.flags = flags;
-  return urosTcpRosCallService(&pubaddr, &service, resobjp);
+  return uros_node_callservice(&service, resobjp);
 }
 
 /**
  * @brief   Executes a service call.
- * @details Gets the service URI from the Master node. If found, it executes
- *          the service call once, and the result is returned.
+ * @details Gets the service URI from the Master node, unless recently cached.
+ *          If found, it executes the service call once, and the result is
+ *          returned. If the call fails, the cached URI is forgotten.
  * @note    Only a @e single call will be executed. Persistent TCPROS service
- *          connections need custom handlers.
+ *          connections are handled by @p urosNodeServiceClientOpen().
  *
  * @pre     @p servicep->procf must address a @p uros_tcpsrvcall_t function.
  * @pre     The TCPROS @p service flag must be set, @p persistent clear.
@@ -1264,24 +2501,154 @@ uros_err_t urosNodeCallServiceSZ(const char *namep,
 uros_err_t urosNodeCallServiceByDesc(const UrosTopic *servicep,
                                      void *resobjp) {
 
+  urosAssert(servicep != NULL);
+  urosAssert(urosStringNotEmpty(&servicep->name));
+  urosAssert(servicep->typep != NULL);
+  urosAssert(urosStringNotEmpty(&servicep->typep->name));
+  urosAssert(servicep->procf != NULL);
+  urosAssert(servicep->flags.service);
+  urosAssert(!servicep->flags.persistent);
+  urosAssert(resobjp != NULL);
+
+  /* Call the client service handler.*/
+  return uros_node_callservice(servicep, resobjp);
+}
+
+/**
+ * @brief   Opens a persistent service client.
+ * @details Gets the service URI from the Master node, unless recently cached,
+ *          and connects to the service provider, asking for a @p persistent
+ *          TCPROS connection. The connection is kept open across the calls
+ *          executed by @p urosNodeServiceClientCall(), saving the connection
+ *          setup and header exchange of each call.
+ * @see     urosNodeServiceClientClose()
+ *
+ * @pre     @p servicep->procf must address a @p uros_tcpsrvcall_t function.
+ * @pre     The TCPROS @p service flag must be set.
+ * @post    If successful, @p clip must be closed with
+ *          @p urosNodeServiceClientClose().
+ *
+ * @param[out] clip
+ *          Pointer to an allocated @p UrosTcpRosSrvClient object.
+ * @param[in] servicep
+ *          Pointer to the service descriptor. It is copied.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosNodeServiceClientOpen(UrosTcpRosSrvClient *clip,
+                                     const UrosTopic *servicep) {
+
   UrosAddr pubaddr;
   uros_err_t err;
 
+  urosAssert(clip != NULL);
   urosAssert(servicep != NULL);
   urosAssert(urosStringNotEmpty(&servicep->name));
   urosAssert(servicep->typep != NULL);
   urosAssert(urosStringNotEmpty(&servicep->typep->name));
   urosAssert(servicep->procf != NULL);
   urosAssert(servicep->flags.service);
-  urosAssert(!servicep->flags.persistent);
+
+  urosTcpRosSrvClientObjectInit(clip, servicep);
+
+  /* Resolve the service provider, and connect to it.*/
+  err = urosNodeResolveServicePublisher(&clip->service.name, &pubaddr);
+  if (err == UROS_OK) {
+    err = urosTcpRosSrvClientConnect(clip, &pubaddr);
+#if UROS_NODE_SRVCACHE_LENGTH > 0
+    if (err != UROS_OK) {
+      urosNodeForgetServicePublisher(&clip->service.name);
+    }
+#endif
+  }
+  if (err != UROS_OK) {
+    urosTcpRosSrvClientClean(clip);
+  }
+  return err;
+}
+
+/**
+ * @brief   Executes a call through a persistent service client.
+ * @details The request is sent over the open connection. If the connection
+ *          was dropped by a previous failed call, the service provider is
+ *          resolved and connected again before the call.
+ *          If the provider closed the open connection meanwhile, so that the
+ *          call fails without any response bytes, the call is retried once
+ *          over a new connection.
+ *
+ * @pre     @p clip was opened by @p urosNodeServiceClientOpen().
+ *
+ * @param[in,out] clip
+ *          Pointer to an open @p UrosTcpRosSrvClient object.
+ * @param[out] resobjp
+ *          Pointer to the allocated response object. The service result will
+ *          be written there only if the call is successful.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosNodeServiceClientCall(UrosTcpRosSrvClient *clip,
+                                     void *resobjp) {
+
+  UrosAddr pubaddr;
+  uros_err_t err;
+  uros_bool_t retry;
+  size_t recvlen;
+
+  urosAssert(clip != NULL);
   urosAssert(resobjp != NULL);
 
-  /* Resolve the service provider.*/
-  err = urosNodeResolveServicePublisher(&servicep->name, &pubaddr);
-  if (err != UROS_OK) { return err; }
+  /* Only an already open connection may have been broken while idle.*/
+  retry = clip->connected;
+  while (UROS_TRUE) {
+    /* Reconnect after a failure.*/
+    if (!clip->connected) {
+      err = urosNodeResolveServicePublisher(&clip->service.name, &pubaddr);
+      if (err != UROS_OK) { return err; }
+      err = urosTcpRosSrvClientConnect(clip, &pubaddr);
+      if (err != UROS_OK) { goto _error; }
+    }
 
-  /* Call the client service handler.*/
-  return urosTcpRosCallService(&pubaddr, servicep, resobjp);
+    /* Call the client service handler.*/
+    recvlen = clip->conn.recvlen;
+    err = urosTcpRosSrvClientCall(clip, resobjp);
+    if (err == UROS_OK) { return UROS_OK; }
+
+    /* Without any response bytes, the request was not served.*/
+    retry = retry && clip->conn.recvlen == recvlen &&
+            (err == UROS_ERR_EOF || err == UROS_ERR_BADCONN);
+    if (!retry) { break; }
+    urosError(UROS_TRUE, UROS_NOP,
+              ("Persistent link to service [%.*s] broken, reconnecting\n",
+               UROS_STRARG(&clip->service.name)));
+    retry = UROS_FALSE;
+#if UROS_NODE_SRVCACHE_LENGTH > 0
+    urosNodeForgetServicePublisher(&clip->service.name);
+#endif
+  }
+
+_error:
+#if UROS_NODE_SRVCACHE_LENGTH > 0
+  /* The provider may have gone, look it up again next time.*/
+  urosNodeForgetServicePublisher(&clip->service.name);
+#endif
+  return err;
+}
+
+/**
+ * @brief   Closes a persistent service client.
+ * @details Closes the connection, and deallocates the client data.
+ *
+ * @pre     @p clip was opened by @p urosNodeServiceClientOpen().
+ * @post    @p clip is invalid.
+ *
+ * @param[in,out] clip
+ *          Pointer to an open @p UrosTcpRosSrvClient object.
+ */
+void urosNodeServiceClientClose(UrosTcpRosSrvClient *clip) {
+
+  urosAssert(clip != NULL);
+
+  urosTcpRosSrvClientClean(clip);
 }
 
 /**
@@ -1331,8 +2698,7 @@ uros_err_t urosNodePublishService(const UrosString *namep,
 
   /* Check if the service already exists.*/
   urosMutexLock(&np->status.pubServiceListLock);
-  servicenodep = urosTopicListFindByName(&np->status.pubServiceList,
-                                         namep);
+  servicenodep = urosListIndexFind(&np->status.pubServiceIndex, namep);
   urosMutexUnlock(&np->status.pubServiceListLock);
   urosError(servicenodep != NULL, return UROS_ERR_BADPARAM,
             ("Service [%.*s] already published\n", UROS_STRARG(namep)));
@@ -1341,7 +2707,11 @@ uros_err_t urosNodePublishService(const UrosString *namep,
   servicep = urosNew(NULL, UrosTopic);
   if (servicep == NULL) { return UROS_ERR_NOMEM; }
   urosTopicObjectInit(servicep);
-  servicep->name = urosStringClone(namep);
+  servicep->name = urosStringIntern(namep);
+  if (servicep->name.datap == NULL) {
+    urosFree(servicep);
+    return UROS_ERR_NOMEM;
+  }
   servicep->typep = statictypep;
   servicep->procf = procf;
   servicep->flags = flags;
@@ -1410,6 +2780,9 @@ uros_err_t urosNodePublishServiceSZ(const char *namep,
  *            function.
  *          - If unsuccessful, the service descriptor can be deallocated by the
  *            caller function.
+ *          - If the node is batching its Master calls, the registration is
+ *            deferred and the service descriptor is owned by the node, which
+ *            deallocates it if the registration fails later.
  *
  * @param[in] servicep
  *          Pointer to the service descriptor to be published and registered.
@@ -1422,7 +2795,6 @@ uros_err_t urosNodePublishServiceByDesc(const UrosTopic *servicep) {
 
   UrosRpcResponse res;
   uros_err_t err;
-  UrosListNode *nodep;
 
   urosAssert(servicep != NULL);
   urosAssert(urosStringNotEmpty(&servicep->name));
@@ -1434,6 +2806,12 @@ uros_err_t urosNodePublishServiceByDesc(const UrosTopic *servicep) {
   urosRpcResponseObjectInit(&res);
   urosMutexLock(&np->status.pubServiceListLock);
 
+  /* Defer the registration, if batching Master calls.*/
+  if (uros_node_batchcall(UROS_NODE_CALL_REGSERVICE, (UrosTopic*)servicep,
+                          &servicep->name, &err)) {
+    goto _finally;
+  }
+
   /* Master XMLRPC registerPublisher() */
   err = urosRpcCallRegisterService(
     &np->config.masterAddr,
@@ -1447,23 +2825,8 @@ uros_err_t urosNodePublishServiceByDesc(const UrosTopic *servicep) {
             ("Cannot register service [%.*s]\n",
              UROS_STRARG(&servicep->name)));
 
-  /* Check for valid codes.*/
-  urosError(res.code != UROS_RPCC_SUCCESS,
-            { err = UROS_ERR_BADPARAM; goto _finally; },
-            ("Response code %d, expected %d\n",
-             res.code, UROS_RPCC_SUCCESS));
-  urosError(res.httpcode != 200,
-            { err = UROS_ERR_BADPARAM; goto _finally; },
-            ("Response HTTP code %d, expected 200\n", res.httpcode));
-
-  /* Add to the published topics list.*/
-  nodep = urosNew(NULL, UrosListNode);
-  if (nodep == NULL) { err = UROS_ERR_NOMEM; goto _finally; }
-  urosListNodeObjectInit(nodep);
-  nodep->datap = (void*)servicep;
-  urosListAdd(&np->status.pubServiceList, nodep);
-
-  err = UROS_OK;
+  /* Add to the published services list.*/
+  err = uros_node_publishservice_end(servicep, &res);
 _finally:
   /* Cleanup and return.*/
   urosMutexUnlock(&np->status.pubServiceListLock);
@@ -1504,27 +2867,31 @@ uros_err_t urosNodeUnpublishService(const UrosString *namep) {
 
   /* Find the service descriptor.*/
   urosMutexLock(&np->status.pubServiceListLock);
-  servicenodep = urosTopicListFindByName(&np->status.pubServiceList,
-                                         namep);
+  servicenodep = urosListIndexFind(&np->status.pubServiceIndex, namep);
   urosError(servicenodep == NULL,
             { err = UROS_ERR_BADPARAM; goto _finally; },
             ("Service [%.*s] not published\n", UROS_STRARG(namep)));
   servicep = (UrosTopic*)servicenodep->datap;
 
-  /* Unregister the service on the Master node.*/
-  err = urosRpcCallUnregisterService(
-    &np->config.masterAddr,
-    &np->config.nodeName,
-    namep,
-    &np->config.tcprosUri,
-    &res
-  );
-  urosError(err != UROS_OK, goto _finally,
-            ("Error %s while unregistering as publisher of service [%.*s]\n",
-             urosErrorText(err), UROS_STRARG(namep)));
+  /* Unregister the service on the Master node, unless deferred.*/
+  if (!uros_node_batchcall(UROS_NODE_CALL_UNREGSERVICE, NULL, namep,
+                           &err)) {
+    err = urosRpcCallUnregisterService(
+      &np->config.masterAddr,
+      &np->config.nodeName,
+      namep,
+      &np->config.tcprosUri,
+      &res
+    );
+    urosError(err != UROS_OK, goto _finally,
+              ("Error %s while unregistering as publisher of service [%.*s]\n",
+               urosErrorText(err), UROS_STRARG(namep)));
+  }
+  err = UROS_OK;
 
   /* Unregister the service locally.*/
   servicep->flags.deleted = UROS_TRUE;
+  urosListIndexRemove(&np->status.pubServiceIndex, &servicep->name);
   tcprosnodep = urosListRemove(&np->status.pubServiceList, servicenodep);
   urosAssert(tcprosnodep == servicenodep);
 
@@ -1616,7 +2983,7 @@ uros_err_t urosNodeSubscribeParam(const UrosString *namep) {
 
   /* Check if the parameter already exists.*/
   urosMutexLock(&np->status.subParamListLock);
-  paramnodep = urosStringListFindByName(&np->status.subParamList, namep);
+  paramnodep = urosListIndexFind(&np->status.subParamIndex, namep);
   urosMutexUnlock(&np->status.subParamListLock);
   urosError(paramnodep != NULL, return UROS_ERR_BADPARAM,
             ("Parameter [%.*s] already subscribed\n", UROS_STRARG(namep)));
@@ -1659,6 +3026,11 @@ uros_err_t urosNodeSubscribeParam(const UrosString *namep) {
   /* Add to the subscribed parameter list.*/
   urosListNodeObjectInit(nodep);
   nodep->datap = (void*)clonednamep;
+  err = urosListIndexAdd(&np->status.subParamIndex, clonednamep, nodep);
+  if (err != UROS_OK) {
+    urosListNodeDelete(nodep, (uros_delete_f)urosStringDelete);
+    goto _finally;
+  }
   urosListAdd(&np->status.subParamList, nodep);
 
   /* Update to the current value.*/
@@ -1732,7 +3104,7 @@ uros_err_t urosNodeUnsubscribeParam(const UrosString *namep) {
   urosMutexLock(&np->status.subParamListLock);
 
   /* Check if the parameter was actually subscribed.*/
-  nodep = urosStringListFindByName(&np->status.subParamList, namep);
+  nodep = urosListIndexFind(&np->status.subParamIndex, namep);
   urosError(nodep == NULL, { err = UROS_ERR_BADPARAM; goto _finally; },
             ("Parameter [%.*s] not found\n", UROS_STRARG(namep)));
 
@@ -1759,6 +3131,8 @@ uros_err_t urosNodeUnsubscribeParam(const UrosString *namep) {
              (long int)res.httpcode));
 
   /* Remove from the subscribed parameter list and delete.*/
+  urosListIndexRemove(&np->status.subParamIndex,
+                      (const UrosString *)nodep->datap);
   nodep = urosListRemove(&np->status.subParamList, nodep);
   urosAssert(nodep != NULL);
   urosListNodeDelete(nodep, (uros_delete_f)urosStringDelete);
@@ -1857,7 +3231,7 @@ uros_err_t urosNodeFindNewTopicPublishers(const UrosString *namep,
       tcpstp = (const UrosTcpRosStatus *)tcpnodep->datap;
       if (tcpstp->topicp->flags.service == UROS_FALSE) {
         urosAssert(tcpstp->topicp != NULL);
-        if (0 == urosStringCmp(&tcpstp->topicp->name, namep)) {
+        if (urosStringIsSame(&tcpstp->topicp->name, namep)) {
           urosAssert(tcpstp->csp != NULL);
           if (tcpstp->csp->remaddr.ip.dword == pubaddr.ip.dword &&
               tcpstp->csp->remaddr.port == pubaddr.port) {
@@ -1894,22 +3268,23 @@ uros_err_t urosNodeFindNewTopicPublishers(const UrosString *namep,
 }
 
 /**
- * @brief   Gets the TCPROS URI of a topic publisher.
- * @details Requests the TCPROS URI of a topic published by a node.
+ * @brief   Requests a topic to its publisher.
+ * @details Issues a @p requestTopic() call to a node, asking for a TCPROS
+ *          connection. The response is checked by
+ *          @p urosNodeParseTopicPublisher().
  *
  * @param[in] apiaddrp
  *          XMLRPC API address of the target node.
  * @param[in] namep
  *          Pointer to the topic name string.
- * @param[out] tcprosaddrp
- *          Pointer to an allocated @p UrosAddr descriptor, which will hold the
- *          TCPROS API address of the requested topic provider.
+ * @param[out] resp
+ *          Pointer to an initialized @p UrosRpcResponse object.
  * @return
  *          Error code.
  */
-uros_err_t urosNodeResolveTopicPublisher(const UrosAddr *apiaddrp,
+uros_err_t urosNodeRequestTopicPublisher(const UrosAddr *apiaddrp,
                                          const UrosString *namep,
-                                         UrosAddr *tcprosaddrp) {
+                                         UrosRpcResponse *resp) {
 
   static const UrosRpcParamNode tcprosnode = {
     { UROS_RPCP_STRING, {{ 6, "TCPROS" }} }, NULL
@@ -1924,50 +3299,68 @@ uros_err_t urosNodeResolveTopicPublisher(const UrosAddr *apiaddrp,
     (UrosRpcParamNode*)&protonode, (UrosRpcParamNode*)&protonode, 1
   };
 
-  uros_err_t err;
-  UrosRpcParamNode *nodep;
-  UrosRpcParam *paramp;
-  UrosRpcResponse res;
-
   urosAssert(apiaddrp != NULL);
   urosAssert(urosStringNotEmpty(namep));
-  urosAssert(tcprosaddrp != NULL);
-#define _ERR    { err = UROS_ERR_BADPARAM; goto _finally; }
+  urosAssert(resp != NULL);
 
-  /* Request the topic to the publisher.*/
-  urosRpcResponseObjectInit(&res);
-  err = urosRpcCallRequestTopic(
+  return urosRpcCallRequestTopic(
     apiaddrp,
     &urosNode.config.nodeName,
     namep,
     &protolist,
-    &res
+    resp
   );
+}
+
+/**
+ * @brief   Gets the TCPROS URI of a topic publisher from its response.
+ * @details Checks the response to a @p requestTopic() call issued by
+ *          @p urosNodeRequestTopicPublisher(), and resolves the TCPROS
+ *          address it holds.
+ *
+ * @param[in] resp
+ *          Pointer to the @p requestTopic() response.
+ * @param[out] tcprosaddrp
+ *          Pointer to an allocated @p UrosAddr descriptor, which will hold the
+ *          TCPROS API address of the requested topic provider.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosNodeParseTopicPublisher(const UrosRpcResponse *resp,
+                                       UrosAddr *tcprosaddrp) {
+
+  static const UrosString tcprosstr = { 6, "TCPROS" };
+
+  uros_err_t err;
+  const UrosRpcParamNode *nodep;
+  const UrosRpcParam *paramp;
+
+  urosAssert(resp != NULL);
+  urosAssert(tcprosaddrp != NULL);
+#define _ERR    { return UROS_ERR_BADPARAM; }
 
   /* Check for valid values.*/
-  if (err != UROS_OK) { goto _finally; }
-  urosError(res.httpcode != 200, _ERR,
+  urosError(resp->httpcode != 200, _ERR,
             ("The HTTP response code is %lu, expected 200\n",
-             (long unsigned int)res.httpcode));
-  if (res.code != UROS_RPCC_SUCCESS) { _ERR }
-  urosError(res.valuep->pclass != UROS_RPCP_ARRAY, _ERR,
+             (long unsigned int)resp->httpcode));
+  if (resp->code != UROS_RPCC_SUCCESS) { _ERR }
+  urosError(resp->valuep->pclass != UROS_RPCP_ARRAY, _ERR,
             ("Response value pclass is %d, expected %d (UROS_RPCP_ARRAY)\n",
-             (int)res.valuep->pclass, (int)UROS_RPCP_ARRAY));
-  urosAssert(res.valuep->value.listp != NULL);
-  urosError(res.valuep->value.listp->length != 3, _ERR,
+             (int)resp->valuep->pclass, (int)UROS_RPCP_ARRAY));
+  urosAssert(resp->valuep->value.listp != NULL);
+  urosError(resp->valuep->value.listp->length != 3, _ERR,
             ("Response value array length %lu, expected 3",
-             (long unsigned int)res.valuep->value.listp->length));
-  nodep = res.valuep->value.listp->headp;
+             (long unsigned int)resp->valuep->value.listp->length));
+  nodep = resp->valuep->value.listp->headp;
 
   /* Check the protocol string.*/
   paramp = &nodep->param; nodep = nodep->nextp;
   urosError(paramp->pclass != UROS_RPCP_STRING, _ERR,
             ("Response value pclass is %d, expected %d (UROS_RPCP_STRING)\n",
              (int)paramp->pclass, (int)UROS_RPCP_STRING));
-  urosError(0 != urosStringCmp(&tcprosnode.param.value.string,
-                               &paramp->value.string), _ERR,
+  urosError(0 != urosStringCmp(&tcprosstr, &paramp->value.string), _ERR,
             ("Response protocol is [%.*s], expected [TCPROS]\n",
-             UROS_STRARG(&tcprosnode.param.value.string)));
+             UROS_STRARG(&paramp->value.string)));
 
   /* Check the node hostname string.*/
   paramp = &nodep->param; nodep = nodep->nextp;
@@ -1975,7 +3368,7 @@ uros_err_t urosNodeResolveTopicPublisher(const UrosAddr *apiaddrp,
             ("Response value pclass is %d, expected %d (UROS_RPCP_STRING)\n",
              (int)paramp->pclass, (int)UROS_RPCP_STRING));
   err = urosHostnameToIp(&paramp->value.string, &tcprosaddrp->ip);
-  urosError(err != UROS_OK, goto _finally,
+  urosError(err != UROS_OK, return err,
             ("Cannot resolve hostname [%.*s]",
              UROS_STRARG(&paramp->value.string)));
 
@@ -1988,18 +3381,55 @@ uros_err_t urosNodeResolveTopicPublisher(const UrosAddr *apiaddrp,
             ("Port number %ld outside range\n",
              (long int)paramp->value.int32));
   tcprosaddrp->port = (uint16_t)paramp->value.int32;
+  return UROS_OK;
+#undef _ERR
+}
 
-  err = UROS_OK;
-_finally:
+/**
+ * @brief   Gets the TCPROS URI of a topic publisher.
+ * @details Requests the TCPROS URI of a topic published by a node.
+ *
+ * @param[in] apiaddrp
+ *          XMLRPC API address of the target node.
+ * @param[in] namep
+ *          Pointer to the topic name string.
+ * @param[out] tcprosaddrp
+ *          Pointer to an allocated @p UrosAddr descriptor, which will hold the
+ *          TCPROS API address of the requested topic provider.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosNodeResolveTopicPublisher(const UrosAddr *apiaddrp,
+                                         const UrosString *namep,
+                                         UrosAddr *tcprosaddrp) {
+
+  uros_err_t err;
+  UrosRpcResponse res;
+
+  urosAssert(apiaddrp != NULL);
+  urosAssert(urosStringNotEmpty(namep));
+  urosAssert(tcprosaddrp != NULL);
+
+  /* Request the topic to the publisher.*/
+  urosRpcResponseObjectInit(&res);
+  err = urosNodeRequestTopicPublisher(apiaddrp, namep, &res);
+  if (err == UROS_OK) {
+    err = urosNodeParseTopicPublisher(&res, tcprosaddrp);
+  }
   urosRpcResponseClean(&res);
   return err;
-#undef _ERR
 }
 
 /**
  * @brief   Gets the TCPROS URI of a service publisher.
  * @details Requests the TCPROS URI of a service published by a node.
  *
+ *          Resolved URIs are cached for @p UROS_NODE_SRVCACHE_TTL
+ *          milliseconds, during which the Master is not asked again. Past
+ *          half that time, a cached URI is still returned, while it is looked
+ *          up again asynchronously.
+ * @see     urosNodeForgetServicePublisher()
+ *
  * @param[in] namep
  *          Pointer to the topic name string.
  * @param[out] pubaddrp
@@ -2015,11 +3445,22 @@ uros_err_t urosNodeResolveServicePublisher(const UrosString *namep,
 
   uros_err_t err;
   UrosRpcResponse res;
-  UrosString *uristrp;
+#if UROS_NODE_SRVCACHE_LENGTH > 0
+  uros_bool_t refresh;
+#endif
 
   urosAssert(urosStringNotEmpty(namep));
   urosAssert(pubaddrp != NULL);
-#define _ERR    { err = UROS_ERR_BADPARAM; goto _finally; }
+
+#if UROS_NODE_SRVCACHE_LENGTH > 0
+  /* Use the cached URI, if still valid.*/
+  if (uros_node_srvcache_find(namep, pubaddrp, &refresh)) {
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+    if (refresh) { uros_node_srvcache_refresh(namep); }
+#endif
+    return UROS_OK;
+  }
+#endif
 
   /* Lookup the service URI.*/
   urosRpcResponseObjectInit(&res);
@@ -2029,31 +3470,45 @@ uros_err_t urosNodeResolveServicePublisher(const UrosString *namep,
     namep,
     &res
   );
-
-  /* Check for valid values.*/
-  if (err != UROS_OK) { goto _finally; }
-  urosError(res.httpcode != 200, _ERR,
-            ("The HTTP response code is %lu, expected 200\n",
-             (long unsigned int)res.httpcode));
-  urosError(res.code != UROS_RPCC_SUCCESS, _ERR,
-            ("Cannot find a provider for service [%.*s]\n",
-             UROS_STRARG(namep)));
-  urosError(res.valuep->pclass != UROS_RPCP_STRING, _ERR,
-            ("Response value pclass is %d, expected %d (UROS_RPCP_STRING)\n",
-             (int)res.valuep->pclass, (int)UROS_RPCP_STRING));
-  uristrp = &res.valuep->value.string;
-  res.valuep->value.string = urosStringAssignZ(NULL);
+  if (err == UROS_OK) {
+    err = uros_node_lookupservice_end(namep, &res, pubaddrp);
+  }
+#if UROS_NODE_SRVCACHE_LENGTH > 0
+  if (err == UROS_OK) {
+    uros_node_srvcache_put(namep, pubaddrp);
+  }
+#endif
   urosRpcResponseClean(&res);
-  urosAssert(urosStringIsValid(uristrp));
-  urosError(uristrp->length == 0, _ERR, ("Service URI string is empty\n"));
+  return err;
+}
 
-  /* Resolve the service address.*/
-  err = urosUriToAddr(uristrp, pubaddrp);
+#if UROS_NODE_SRVCACHE_LENGTH > 0 || defined(__DOXYGEN__)
+/**
+ * @brief   Forgets the cached TCPROS URI of a service publisher.
+ * @details The next resolution of the service will ask the Master again.
+ *
+ * @param[in] namep
+ *          Pointer to the service name string, or @p NULL to forget all the
+ *          cached services.
+ */
+void urosNodeForgetServicePublisher(const UrosString *namep) {
 
-_finally:
-  urosRpcResponseClean(&res);
-  return err;
-#undef _ERR
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  uros_srvcache_t *entryp;
+
+  urosMutexLock(&stp->srvCacheLock);
+  for (entryp = stp->srvCache;
+       entryp < &stp->srvCache[UROS_NODE_SRVCACHE_LENGTH]; ++entryp) {
+    if (namep == NULL || 0 == urosStringCmp(&entryp->name, namep)) {
+      urosStringClean(&entryp->name);
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+      entryp->refreshing = UROS_FALSE;
+#endif
+    }
+  }
+  urosMutexUnlock(&stp->srvCacheLock);
 }
+#endif
 
 /** @} */
@@ -77,16 +77,105 @@ typedef struct uros_rpcpcallctx_t {
     UrosRpcStreamer streamer;   /**< @brief XMLRPC streamer.*/
   } x;                          /**< @brief Parser/Streamer, mutually exclusive.*/
   uros_bool_t       parsing;    /**< @brief Parser/Streamer switch.*/
+  char              *bufp;      /**< @brief Streamer buffer.*/
+  char              *rdbufp;    /**< @brief Parser reading buffer.*/
+  uros_bool_t       reused;     /**< @brief Connection kept alive by a previous call.*/
 } uros_rpcpcallctx_t;
 
+#if UROS_RPCCALL_KEEPALIVE_SLOTS > 0 || defined(__DOXYGEN__)
+/**
+ * @brief   Kept-alive XMLRPC connection slot.
+ */
+typedef struct uros_rpccallslot_t {
+  UrosAddr          addr;       /**< @brief Remote address.*/
+  UrosConn          conn;       /**< @brief Idle connection handle.*/
+  char              *bufp;      /**< @brief Streamer buffer.*/
+  char              *rdbufp;    /**< @brief Parser reading buffer.*/
+  uros_bool_t       idle;       /**< @brief The slot holds an idle connection.*/
+} uros_rpccallslot_t;
+#endif
+
 /** @} */
 
 #define _CHKOKE { if (ctxp->x.err != UROS_OK) { goto _finally; } }
 
+/*===========================================================================*/
+/* LOCAL VARIABLES                                                           */
+/*===========================================================================*/
+
+/** @brief Preallocated XMLRPC call contexts.*/
+static UROS_STACKPOOL(uros_rpccall_ctxchunk, sizeof(uros_rpcpcallctx_t),
+                      UROS_RPCCALL_POOLSIZE);
+
+/** @brief Preallocated XMLRPC streamer buffers.*/
+static UROS_STACKPOOL(uros_rpccall_bufchunk, UROS_MTU_SIZE,
+                      UROS_RPCCALL_POOLSIZE);
+
+/** @brief Preallocated XMLRPC parser reading buffers.*/
+static UROS_STACKPOOL(uros_rpccall_rdbufchunk, UROS_RPCPARSER_RDBUFLEN,
+                      UROS_RPCCALL_POOLSIZE);
+
+/** @brief XMLRPC call context pool.*/
+static UrosMemPool uros_rpccall_ctxpool;
+
+/** @brief XMLRPC streamer buffer pool.*/
+static UrosMemPool uros_rpccall_bufpool;
+
+/** @brief XMLRPC parser reading buffer pool.*/
+static UrosMemPool uros_rpccall_rdbufpool;
+
+#if UROS_RPCCALL_KEEPALIVE_SLOTS > 0 || defined(__DOXYGEN__)
+
+/** @brief Kept-alive XMLRPC connection slots.*/
+static uros_rpccallslot_t uros_rpccall_slots[UROS_RPCCALL_KEEPALIVE_SLOTS];
+
+/** @brief Lock for @p uros_rpccall_slots.*/
+static UrosMutex uros_rpccall_slotlock;
+
+#endif
+
+#if UROS_RPCCALL_ASYNC_THREADS > 0 || defined(__DOXYGEN__)
+
+/** @brief First queued asynchronous call job.*/
+static UrosRpcCallJob *uros_rpccall_jobheadp;
+
+/** @brief Last queued asynchronous call job.*/
+static UrosRpcCallJob *uros_rpccall_jobtailp;
+
+/** @brief Pending worker thread exit requests.*/
+static uros_cnt_t uros_rpccall_jobexitcnt;
+
+/** @brief Lock for the asynchronous call job queue.*/
+static UrosMutex uros_rpccall_joblock;
+
+/** @brief Signaled when a job is queued or completed, broadcast.*/
+static UrosCondVar uros_rpccall_jobcond;
+
+#endif
+
 /*===========================================================================*/
 /* LOCAL FUNCTIONS                                                           */
 /*===========================================================================*/
 
+void *uros_rpccall_poolgrow(size_t size) {
+
+  return urosAlloc(UROS_XMLRPC_HEAP, size);
+}
+
+void uros_rpccall_releasebufs(uros_rpcpcallctx_t *ctxp) {
+
+  urosAssert(ctxp != NULL);
+
+  if (ctxp->bufp != NULL) {
+    urosMemPoolFree(&uros_rpccall_bufpool, ctxp->bufp);
+    ctxp->bufp = NULL;
+  }
+  if (ctxp->rdbufp != NULL) {
+    urosMemPoolFree(&uros_rpccall_rdbufpool, ctxp->rdbufp);
+    ctxp->rdbufp = NULL;
+  }
+}
+
 uros_err_t uros_rpccall_httprequest(UrosRpcStreamer *sp) {
 
   urosAssert(sp != NULL);
@@ -99,7 +188,12 @@ uros_err_t uros_rpccall_httprequest(UrosRpcStreamer *sp) {
   /* Using XML content (XMLRPC).*/
   urosRpcStreamerHttpHeader(sp, "Content-Type", 12, "text/xml", 8); _CHKOK
 
-  /* Content-Length default value (fixed).*/
+#if UROS_RPCCALL_KEEPALIVE_SLOTS > 0
+  /* Ask the remote not to close the connection after the response.*/
+  urosRpcStreamerHttpHeader(sp, "Connection", 10, "keep-alive", 10); _CHKOK
+#endif
+
+  /* Content-Length value, written at the end of the body.*/
   urosRpcStreamerHttpContentLength(sp); _CHKOK
   urosRpcStreamerHttpEnd(sp); _CHKOK
 
@@ -107,76 +201,216 @@ uros_err_t uros_rpccall_httprequest(UrosRpcStreamer *sp) {
 #undef _CHKOK
 }
 
+#if UROS_RPCCALL_KEEPALIVE_SLOTS > 0
+
+uros_bool_t uros_rpccall_takeslot(uros_rpcpcallctx_t *ctxp) {
+
+  uros_rpccallslot_t *slotp;
+  uros_bool_t found = UROS_FALSE;
+
+  urosAssert(ctxp != NULL);
+  urosAssert(ctxp->addrp != NULL);
+
+  /* Take an idle connection to the same remote, if any.*/
+  urosMutexLock(&uros_rpccall_slotlock);
+  for (slotp = uros_rpccall_slots;
+       slotp < &uros_rpccall_slots[UROS_RPCCALL_KEEPALIVE_SLOTS]; ++slotp) {
+    if (slotp->idle &&
+        slotp->addr.ip.dword == ctxp->addrp->ip.dword &&
+        slotp->addr.port == ctxp->addrp->port) {
+      ctxp->conn = slotp->conn;
+      ctxp->bufp = slotp->bufp;
+      ctxp->rdbufp = slotp->rdbufp;
+      slotp->idle = UROS_FALSE;
+      found = UROS_TRUE;
+      break;
+    }
+  }
+  urosMutexUnlock(&uros_rpccall_slotlock);
+  return found;
+}
+
+uros_bool_t uros_rpccall_putslot(uros_rpcpcallctx_t *ctxp) {
+
+  uros_rpccallslot_t *slotp;
+  uros_bool_t found = UROS_FALSE;
+
+  urosAssert(ctxp != NULL);
+  urosAssert(ctxp->addrp != NULL);
+
+  /* Park the connection and its buffers into a free slot, if any.*/
+  urosMutexLock(&uros_rpccall_slotlock);
+  for (slotp = uros_rpccall_slots;
+       slotp < &uros_rpccall_slots[UROS_RPCCALL_KEEPALIVE_SLOTS]; ++slotp) {
+    if (!slotp->idle) {
+      slotp->addr = *ctxp->addrp;
+      slotp->conn = ctxp->conn;
+      slotp->bufp = ctxp->bufp;
+      slotp->rdbufp = ctxp->rdbufp;
+      slotp->idle = UROS_TRUE;
+      found = UROS_TRUE;
+      break;
+    }
+  }
+  urosMutexUnlock(&uros_rpccall_slotlock);
+  return found;
+}
+
+#endif /* UROS_RPCCALL_KEEPALIVE_SLOTS > 0 */
+
+uros_err_t uros_rpccall_drain(UrosRpcParser *pp) {
+
+  size_t received, remaining, len;
+  void *bufp;
+
+  urosAssert(pp != NULL);
+  urosAssert(pp->contentLength < ~0u);
+
+  /* Receive whatever is left of the response body.*/
+  received = pp->total + pp->pending - pp->mark;
+  if (received > pp->contentLength) { return pp->err = UROS_ERR_PARSE; }
+  for (remaining = pp->contentLength - received; remaining > 0;
+       remaining -= len) {
+    len = remaining;
+    pp->err = urosConnRecv(pp->csp, &bufp, &len);
+    if (pp->err != UROS_OK) { return pp->err; }
+  }
+  return pp->err = UROS_OK;
+}
+
+uros_err_t uros_rpccall_connect(uros_rpcpcallctx_t *ctxp) {
+
+  uros_err_t err;
+
+  urosAssert(ctxp != NULL);
+  urosAssert(ctxp->addrp != NULL);
+
+  /* Connect to the target interface.*/
+  urosConnObjectInit(&ctxp->conn);
+  err = urosConnCreate(&ctxp->conn, UROS_PROTO_TCP);
+  if (err != UROS_OK) { return err; }
+  err = urosConnConnect(&ctxp->conn, ctxp->addrp);
+  if (err != UROS_OK) { return err; }
+
+  /* Set timeouts for the spawned connection.*/
+  err = urosConnSetRecvTimeout(&ctxp->conn, UROS_XMLRPC_RECVTIMEOUT);
+  urosAssert(err == UROS_OK);
+  err = urosConnSetSendTimeout(&ctxp->conn, UROS_XMLRPC_SENDTIMEOUT);
+  urosAssert(err == UROS_OK);
+  return UROS_OK;
+}
+
 uros_err_t uros_rpcpcall_buildctx(uros_rpcpcallctx_t *ctxp,
                                   const UrosAddr *addrp) {
 
-  char *bufp;
-
   urosAssert(ctxp != NULL);
   urosAssert(addrp != NULL);
 
   memset(ctxp, 0, sizeof(uros_rpcpcallctx_t));
   ctxp->addrp = addrp;
   ctxp->parsing = UROS_FALSE;
+  ctxp->reused = UROS_FALSE;
 
-  /* Connect to the target interface.*/
-  urosConnObjectInit(&ctxp->conn);
-  ctxp->x.err = urosConnCreate(&ctxp->conn, UROS_PROTO_TCP);
-  if (ctxp->x.err != UROS_OK) { return ctxp->x.err; }
-  ctxp->x.err = urosConnConnect(&ctxp->conn, addrp);
-  if (ctxp->x.err != UROS_OK) { return ctxp->x.err; }
-
-  /* Set timeouts for the spawned connection.*/
-  ctxp->x.err = urosConnSetRecvTimeout(&ctxp->conn, UROS_XMLRPC_RECVTIMEOUT);
-  urosAssert(ctxp->x.err == UROS_OK);
-  ctxp->x.err = urosConnSetSendTimeout(&ctxp->conn, UROS_XMLRPC_SENDTIMEOUT);
-  urosAssert(ctxp->x.err == UROS_OK);
+#if UROS_RPCCALL_KEEPALIVE_SLOTS > 0
+  /* Reuse a kept-alive connection, along with its buffers.*/
+  ctxp->reused = uros_rpccall_takeslot(ctxp);
+#endif
+  if (!ctxp->reused) {
+    ctxp->x.err = uros_rpccall_connect(ctxp);
+    if (ctxp->x.err != UROS_OK) { return ctxp->x.err; }
+    ctxp->bufp = (char*)urosMemPoolAlloc(&uros_rpccall_bufpool);
+    ctxp->rdbufp = (char*)urosMemPoolAlloc(&uros_rpccall_rdbufpool);
+    if (ctxp->bufp == NULL || ctxp->rdbufp == NULL) {
+      return ctxp->x.err = UROS_ERR_NOMEM;
+    }
+  }
 
   /* Initialize the streamer.*/
-  bufp = (char*)urosAlloc(NULL, UROS_MTU_SIZE);
-  if (bufp == NULL) { return ctxp->x.err = UROS_ERR_NOMEM; }
   urosRpcStreamerObjectInit(&ctxp->x.streamer, &ctxp->conn,
-                            bufp, UROS_MTU_SIZE);
+                            ctxp->bufp, UROS_MTU_SIZE);
 
   return ctxp->x.err = UROS_OK;
 }
 
 uros_err_t uros_rpcpcall_cleanctx(uros_rpcpcallctx_t *ctxp) {
 
+  uros_err_t err;
+  uros_bool_t keepalive = UROS_FALSE;
+
   urosAssert(ctxp != NULL);
 
   /* Dispose the current XMLRPC agent.*/
+  err = ctxp->x.err;
   if (ctxp->parsing) {
-    urosRpcParserClean(&ctxp->x.parser, UROS_TRUE);
+#if UROS_RPCCALL_KEEPALIVE_SLOTS > 0
+    /* The connection can be reused only after the whole response.*/
+    keepalive = ctxp->x.parser.keepAlive &&
+                uros_rpccall_drain(&ctxp->x.parser) == UROS_OK;
+#endif
+    urosRpcParserClean(&ctxp->x.parser, UROS_FALSE);
   } else {
-    urosRpcStreamerClean(&ctxp->x.streamer, UROS_TRUE);
+    urosRpcStreamerClean(&ctxp->x.streamer, UROS_FALSE);
   }
 
+#if UROS_RPCCALL_KEEPALIVE_SLOTS > 0
+  /* Keep the connection alive for later calls.*/
+  if (keepalive && uros_rpccall_putslot(ctxp)) { return err; }
+#else
+  (void)keepalive;
+#endif
+
   /* Close the connection.*/
   urosConnClose(&ctxp->conn);
-
-  return ctxp->x.err;
+  uros_rpccall_releasebufs(ctxp);
+  return err;
 }
 
 uros_err_t uros_rpccall_waitresponsestart(uros_rpcpcallctx_t *ctxp) {
 
-  char *rdbufp;
+  size_t reqlen;
+  uros_err_t err;
 
   urosAssert(ctxp != NULL);
 
-  /* Dispose the streamer.*/
-  urosRpcStreamerClean(&ctxp->x.streamer, UROS_TRUE);
+  /* Send the request. It can be sent again only if it fits the connection
+     buffer, which outlives the streamer.*/
+  reqlen = ctxp->x.streamer.total;
+  if (ctxp->x.streamer.bufp != ctxp->bufp ||
+      reqlen != ctxp->x.streamer.buflen - ctxp->x.streamer.free) {
+    reqlen = 0;
+  }
+  err = urosRpcStreamerFlush(&ctxp->x.streamer);
 
-  /* Initialize the parser.*/
-  rdbufp = (char*)urosAlloc(NULL, UROS_RPCPARSER_RDBUFLEN);
-  if (rdbufp == NULL) { return ctxp->x.err = UROS_ERR_NOMEM; }
+  /* Dispose the streamer and initialize the parser.*/
+  urosRpcStreamerClean(&ctxp->x.streamer, UROS_FALSE);
   ctxp->parsing = UROS_TRUE;
   urosRpcParserObjectInit(&ctxp->x.parser, &ctxp->conn,
-                          rdbufp, UROS_RPCPARSER_RDBUFLEN);
+                          ctxp->rdbufp, UROS_RPCPARSER_RDBUFLEN);
 
   /* Wait until some data is read.*/
-  urosRpcParserRefill(&ctxp->x.parser);
-  return ctxp->x.err;
+  if (err == UROS_OK) {
+    err = urosRpcParserRefill(&ctxp->x.parser);
+  }
+
+#if UROS_RPCCALL_KEEPALIVE_SLOTS > 0
+  if ((err == UROS_ERR_EOF || err == UROS_ERR_BADCONN) &&
+      ctxp->reused && reqlen > 0) {
+    /* The remote has dropped the kept-alive connection, send again.*/
+    ctxp->reused = UROS_FALSE;
+    urosConnClose(&ctxp->conn);
+    err = uros_rpccall_connect(ctxp);
+    if (err == UROS_OK) {
+      err = urosConnSend(&ctxp->conn, ctxp->bufp, reqlen);
+    }
+    if (err == UROS_OK) {
+      urosRpcParserClean(&ctxp->x.parser, UROS_FALSE);
+      err = urosRpcParserRefill(&ctxp->x.parser);
+    }
+  }
+#else
+  (void)reqlen;
+#endif
+  return ctxp->x.err = err;
 }
 
 uros_err_t uros_rpccall_methodcall_prologue(UrosRpcStreamer *sp,
@@ -207,9 +441,8 @@ uros_err_t uros_rpccall_methodcall_epilogue(UrosRpcStreamer *sp) {
   urosRpcStreamerXmlTagClose(sp, "methodCall", 10); _CHKOK
   urosRpcStreamerWrite(sp, "\r\n", 2); _CHKOK
 
-  /* Fix the actual Content-Length.*/
-  urosRpcStreamerXmlEndHack(sp); _CHKOK
-  return urosRpcStreamerFlush(sp);
+  /* Write the actual Content-Length, the message is sent later.*/
+  return urosRpcStreamerHttpContentEnd(sp);
 #undef _CHKOK
 }
 
@@ -315,6 +548,130 @@ uros_err_t uros_rpccall_methodresponse(UrosRpcParser *pp,
   return UROS_OK;
 }
 
+uros_err_t uros_rpccall_multicall_entry(UrosRpcStreamer *sp,
+                                        const UrosRpcMethodCall *callp) {
+
+  UrosRpcParam wrapper;
+
+  urosAssert(sp != NULL);
+  urosAssert(callp != NULL);
+  urosAssert(urosStringNotEmpty(&callp->method));
+#define _CHKOK  { if (sp->err != UROS_OK) { return sp->err; } }
+
+  wrapper.pclass = UROS_RPCP_ARRAY;
+  wrapper.value.listp = (UrosRpcParamList*)&callp->params;
+
+  urosRpcStreamerXmlTagOpen(sp, "value", 5); _CHKOK
+  urosRpcStreamerXmlTagOpen(sp, "struct", 6); _CHKOK
+
+  /* methodName member.*/
+  urosRpcStreamerXmlTagOpen(sp, "member", 6); _CHKOK
+  urosRpcStreamerXmlTagOpen(sp, "name", 4); _CHKOK
+  urosRpcStreamerWrite(sp, "methodName", 10); _CHKOK
+  urosRpcStreamerXmlTagClose(sp, "name", 4); _CHKOK
+  urosRpcStreamerXmlTagOpen(sp, "value", 5); _CHKOK
+  urosRpcStreamerWrite(sp, callp->method.datap, callp->method.length); _CHKOK
+  urosRpcStreamerXmlTagClose(sp, "value", 5); _CHKOK
+  urosRpcStreamerXmlTagClose(sp, "member", 6); _CHKOK
+
+  /* params member.*/
+  urosRpcStreamerXmlTagOpen(sp, "member", 6); _CHKOK
+  urosRpcStreamerXmlTagOpen(sp, "name", 4); _CHKOK
+  urosRpcStreamerWrite(sp, "params", 6); _CHKOK
+  urosRpcStreamerXmlTagClose(sp, "name", 4); _CHKOK
+  urosRpcStreamerXmlTagOpen(sp, "value", 5); _CHKOK
+  urosRpcStreamerXmlTagOpen(sp, "array", 5); _CHKOK
+  urosRpcStreamerParamValueArray(sp, &wrapper); _CHKOK
+  urosRpcStreamerXmlTagClose(sp, "array", 5); _CHKOK
+  urosRpcStreamerXmlTagClose(sp, "value", 5); _CHKOK
+  urosRpcStreamerXmlTagClose(sp, "member", 6); _CHKOK
+
+  urosRpcStreamerXmlTagClose(sp, "struct", 6); _CHKOK
+  urosRpcStreamerXmlTagClose(sp, "value", 5); _CHKOK
+
+  return UROS_OK;
+#undef _CHKOK
+}
+
+uros_err_t uros_rpccall_multicall_result(UrosRpcParam *resultp,
+                                         UrosRpcResponse *resp) {
+
+  UrosRpcParamNode *codep, *valuep;
+
+  urosAssert(resultp != NULL);
+  urosAssert(resp != NULL);
+
+  /* A fault struct, or anything but [[code, statusMessage, value]].*/
+  resp->httpcode = 200;
+  resp->code = UROS_RPCC_ERROR;
+  if (resultp->pclass != UROS_RPCP_ARRAY ||
+      resultp->value.listp->length != 1 ||
+      resultp->value.listp->headp->param.pclass != UROS_RPCP_ARRAY ||
+      resultp->value.listp->headp->param.value.listp->length != 3) {
+    return UROS_OK;
+  }
+  codep = resultp->value.listp->headp->param.value.listp->headp;
+  valuep = codep->nextp->nextp;
+  if (codep->param.pclass != UROS_RPCP_INT) { return UROS_OK; }
+
+  /* Move the result value into the response.*/
+  resp->valuep = urosNew(UROS_XMLRPC_HEAP, UrosRpcParam);
+  if (resp->valuep == NULL) { return UROS_ERR_NOMEM; }
+  *resp->valuep = valuep->param;
+  urosRpcParamObjectInit(&valuep->param, UROS_RPCP_INT);
+  resp->code = codep->param.value.int32;
+  return UROS_OK;
+}
+
+uros_err_t uros_rpccall_pipeline_result(UrosRpcParser *pp,
+                                        UrosRpcResponse *resp) {
+
+  uint32_t httpcode;
+
+  urosAssert(pp != NULL);
+  urosAssert(resp != NULL);
+
+  urosRpcParserHttpResponse(pp, &httpcode);
+  if (pp->err != UROS_OK) { return pp->err; }
+  if (httpcode == 200) {
+    urosRpcParserMethodResponse(pp, resp);
+  }
+  if (httpcode != 200 || pp->err == UROS_ERR_PARSE) {
+    /* A fault, which still ends at its Content-Length.*/
+    urosRpcResponseClean(resp);
+    pp->err = UROS_OK;
+  }
+  resp->httpcode = httpcode;    /* Object cleaning workaround.*/
+  return pp->err;
+}
+
+uros_err_t uros_rpccall_nextresponse(UrosRpcParser *pp) {
+
+  size_t received, ahead;
+
+  urosAssert(pp != NULL);
+  urosAssert(pp->contentLength < ~0u);
+
+  /* Skip the rest of the current body, keeping any following data.*/
+  received = pp->total + pp->pending - pp->mark;
+  if (received > pp->contentLength) {
+    ahead = received - pp->contentLength;
+    pp->curp += pp->pending - ahead;
+    pp->pending = ahead;
+  } else {
+    if (uros_rpccall_drain(pp) != UROS_OK) { return pp->err; }
+    pp->pending = 0;
+  }
+
+  /* Start parsing the next response.*/
+  pp->total = 0;
+  pp->mark = 0;
+  pp->contentLength = ~0u;
+  pp->keepAlive = UROS_FALSE;
+  if (pp->pending == 0) { return urosRpcParserRefill(pp); }
+  return pp->err = UROS_OK;
+}
+
 uros_err_t uros_rpccall_registercall(
   const char        *methodp,
   size_t            methdolen,
@@ -337,7 +694,7 @@ uros_err_t uros_rpccall_registercall(
   urosAssert(urosStringNotEmpty(caller_api));
   urosAssert(resp != NULL);
 
-  ctxp = urosNew(NULL, uros_rpcpcallctx_t);
+  ctxp = (uros_rpcpcallctx_t *)urosMemPoolAlloc(&uros_rpccall_ctxpool);
   if (ctxp == NULL) { return UROS_ERR_NOMEM; }
 
   urosRpcResponseObjectInit(resp);
@@ -365,7 +722,7 @@ uros_err_t uros_rpccall_registercall(
 _finally:
   err = ctxp->x.err;
   uros_rpcpcall_cleanctx(ctxp);
-  urosFree(ctxp);
+  urosMemPoolFree(&uros_rpccall_ctxpool, ctxp);
   return err;
 }
 
@@ -389,7 +746,7 @@ uros_err_t uros_rpccall_unregistercall(
   urosAssert(urosStringNotEmpty(api));
   urosAssert(resp != NULL);
 
-  ctxp = urosNew(NULL, uros_rpcpcallctx_t);
+  ctxp = (uros_rpcpcallctx_t *)urosMemPoolAlloc(&uros_rpccall_ctxpool);
   if (ctxp == NULL) { return UROS_ERR_NOMEM; }
 
   urosRpcResponseObjectInit(resp);
@@ -413,7 +770,7 @@ uros_err_t uros_rpccall_unregistercall(
 _finally:
   err = ctxp->x.err;
   uros_rpcpcall_cleanctx(ctxp);
-  urosFree(ctxp);
+  urosMemPoolFree(&uros_rpccall_ctxpool, ctxp);
   return err;
 }
 
@@ -434,7 +791,7 @@ uros_err_t uros_rpccall_simplecall(
   urosAssert(urosStringNotEmpty(caller_id));
   urosAssert(resp != NULL);
 
-  ctxp = urosNew(NULL, uros_rpcpcallctx_t);
+  ctxp = (uros_rpcpcallctx_t *)urosMemPoolAlloc(&uros_rpccall_ctxpool);
   if (ctxp == NULL) { return UROS_ERR_NOMEM; }
 
   urosRpcResponseObjectInit(resp);
@@ -456,7 +813,7 @@ uros_err_t uros_rpccall_simplecall(
 _finally:
   err = ctxp->x.err;
   uros_rpcpcall_cleanctx(ctxp);
-  urosFree(ctxp);
+  urosMemPoolFree(&uros_rpccall_ctxpool, ctxp);
   return err;
 }
 
@@ -478,7 +835,7 @@ uros_err_t uros_rpccall_stringcall(
   urosAssert(urosStringNotEmpty(caller_id));
   urosAssert(resp != NULL);
 
-  ctxp = urosNew(NULL, uros_rpcpcallctx_t);
+  ctxp = (uros_rpcpcallctx_t *)urosMemPoolAlloc(&uros_rpccall_ctxpool);
   if (ctxp == NULL) { return UROS_ERR_NOMEM; }
 
   urosRpcResponseObjectInit(resp);
@@ -501,7 +858,7 @@ uros_err_t uros_rpccall_stringcall(
 _finally:
   err = ctxp->x.err;
   uros_rpcpcall_cleanctx(ctxp);
-  urosFree(ctxp);
+  urosMemPoolFree(&uros_rpccall_ctxpool, ctxp);
   return err;
 }
 
@@ -923,6 +1280,293 @@ void urosRpcResponseClean(UrosRpcResponse *rp) {
 }
 
 /** @} */
+
+/** @name XMLRPC call pools */
+/** @{ */
+
+/**
+ * @brief   Initializes the XMLRPC call context and buffer pools.
+ * @details The pools are loaded with @p UROS_RPCCALL_POOLSIZE preallocated
+ *          blocks each, so that steady XMLRPC traffic does not touch the
+ *          heap.
+ * @note    Should be called once, at node initialization.
+ */
+void urosRpcCallPoolsObjectInit(void) {
+
+  urosMemPoolObjectInit(&uros_rpccall_ctxpool,
+                        UROS_STACKPOOL_BLKSIZE(sizeof(uros_rpcpcallctx_t)),
+                        uros_rpccall_poolgrow);
+  urosMemPoolObjectInit(&uros_rpccall_bufpool,
+                        UROS_STACKPOOL_BLKSIZE(UROS_MTU_SIZE),
+                        uros_rpccall_poolgrow);
+  urosMemPoolObjectInit(&uros_rpccall_rdbufpool,
+                        UROS_STACKPOOL_BLKSIZE(UROS_RPCPARSER_RDBUFLEN),
+                        uros_rpccall_poolgrow);
+
+  urosMemPoolLoadArray(&uros_rpccall_ctxpool, uros_rpccall_ctxchunk,
+                       UROS_RPCCALL_POOLSIZE);
+  urosMemPoolLoadArray(&uros_rpccall_bufpool, uros_rpccall_bufchunk,
+                       UROS_RPCCALL_POOLSIZE);
+  urosMemPoolLoadArray(&uros_rpccall_rdbufpool, uros_rpccall_rdbufchunk,
+                       UROS_RPCCALL_POOLSIZE);
+}
+
+/** @} */
+
+#if UROS_RPCCALL_KEEPALIVE_SLOTS > 0 || defined(__DOXYGEN__)
+
+/** @name XMLRPC keep-alive */
+/** @{ */
+
+/**
+ * @brief   Initializes the kept-alive XMLRPC connection slots.
+ * @note    Should be called once, at node initialization.
+ */
+void urosRpcCallKeepAliveObjectInit(void) {
+
+  memset(uros_rpccall_slots, 0, sizeof(uros_rpccall_slots));
+  urosMutexObjectInit(&uros_rpccall_slotlock);
+}
+
+/**
+ * @brief   Closes all the kept-alive XMLRPC connections.
+ * @details Idle connections are closed and their buffers released.
+ *          Connections currently in use are not affected.
+ */
+void urosRpcCallKeepAliveFlush(void) {
+
+  uros_rpccallslot_t *slotp;
+
+  urosMutexLock(&uros_rpccall_slotlock);
+  for (slotp = uros_rpccall_slots;
+       slotp < &uros_rpccall_slots[UROS_RPCCALL_KEEPALIVE_SLOTS]; ++slotp) {
+    if (slotp->idle) {
+      urosConnClose(&slotp->conn);
+      urosMemPoolFree(&uros_rpccall_bufpool, slotp->bufp);
+      urosMemPoolFree(&uros_rpccall_rdbufpool, slotp->rdbufp);
+      slotp->bufp = NULL;
+      slotp->rdbufp = NULL;
+      slotp->idle = UROS_FALSE;
+    }
+  }
+  urosMutexUnlock(&uros_rpccall_slotlock);
+}
+
+/** @} */
+
+#endif /* UROS_RPCCALL_KEEPALIVE_SLOTS > 0 */
+
+/** @name Asynchronous XMLRPC calls */
+/** @{ */
+
+/**
+ * @brief   Initializes an asynchronous XMLRPC call job.
+ *
+ * @param[in,out] jobp
+ *          Pointer to an allocated @p UrosRpcCallJob object.
+ * @param[in] callf
+ *          Call handler, performing the actual blocking call.
+ * @param[in] donef
+ *          Completion handler, or @p NULL to wait with
+ *          @p urosRpcCallAsyncWait().
+ * @param[in] argp
+ *          User argument, available to the handlers.
+ */
+void urosRpcCallJobObjectInit(UrosRpcCallJob *jobp,
+                              uros_rpccall_f callf,
+                              uros_rpcdone_f donef,
+                              void *argp) {
+
+  urosAssert(jobp != NULL);
+  urosAssert(callf != NULL);
+
+  jobp->nextp = NULL;
+  jobp->callf = callf;
+  jobp->donef = donef;
+  jobp->argp = argp;
+  urosRpcResponseObjectInit(&jobp->response);
+  jobp->err = UROS_OK;
+  jobp->done = UROS_FALSE;
+}
+
+/**
+ * @brief   Cleans an asynchronous XMLRPC call job.
+ * @details Deallocates the job response.
+ *
+ * @pre     The job is not queued.
+ *
+ * @param[in,out] jobp
+ *          Pointer to an initialized @p UrosRpcCallJob object.
+ */
+void urosRpcCallJobClean(UrosRpcCallJob *jobp) {
+
+  urosAssert(jobp != NULL);
+
+  urosRpcResponseClean(&jobp->response);
+}
+
+#if UROS_RPCCALL_ASYNC_THREADS > 0 || defined(__DOXYGEN__)
+
+/**
+ * @brief   Initializes the asynchronous XMLRPC call job queue.
+ * @note    Should be called once, at node initialization.
+ */
+void urosRpcCallAsyncObjectInit(void) {
+
+  uros_rpccall_jobheadp = NULL;
+  uros_rpccall_jobtailp = NULL;
+  uros_rpccall_jobexitcnt = 0;
+  urosMutexObjectInit(&uros_rpccall_joblock);
+  urosCondVarObjectInit(&uros_rpccall_jobcond);
+}
+
+/**
+ * @brief   Asynchronous XMLRPC call worker thread.
+ * @details Executes the queued jobs in order, as long as there are any. When
+ *          the queue is empty, it waits for new jobs, or for an exit request
+ *          issued by @p urosRpcCallAsyncExit().
+ *
+ * @param[in] argp
+ *          Ignored.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosRpcCallAsyncThread(void *argp) {
+
+  UrosRpcCallJob *jobp;
+
+  (void)argp;
+
+  while (UROS_TRUE) {
+    /* Dequeue the next job.*/
+    urosMutexLock(&uros_rpccall_joblock);
+    while (uros_rpccall_jobheadp == NULL && uros_rpccall_jobexitcnt == 0) {
+      urosCondVarWait(&uros_rpccall_jobcond, &uros_rpccall_joblock);
+    }
+    jobp = uros_rpccall_jobheadp;
+    if (jobp == NULL) {
+      /* Exit only when there are no more jobs.*/
+      --uros_rpccall_jobexitcnt;
+      urosMutexUnlock(&uros_rpccall_joblock);
+      return UROS_OK;
+    }
+    uros_rpccall_jobheadp = jobp->nextp;
+    if (uros_rpccall_jobheadp == NULL) {
+      uros_rpccall_jobtailp = NULL;
+    }
+    urosMutexUnlock(&uros_rpccall_joblock);
+
+    /* Execute the blocking call.*/
+    jobp->nextp = NULL;
+    jobp->err = jobp->callf(jobp);
+
+    /* Notify its completion.*/
+    if (jobp->donef != NULL) {
+      jobp->done = UROS_TRUE;
+      jobp->donef(jobp);
+    } else {
+      urosMutexLock(&uros_rpccall_joblock);
+      jobp->done = UROS_TRUE;
+      urosCondVarBroadcast(&uros_rpccall_jobcond);
+      urosMutexUnlock(&uros_rpccall_joblock);
+    }
+  }
+}
+
+/**
+ * @brief   Requests the asynchronous XMLRPC call workers to exit.
+ * @details Each worker thread exits after all the queued jobs are executed.
+ *
+ * @post    The worker threads can be joined.
+ */
+void urosRpcCallAsyncExit(void) {
+
+  urosMutexLock(&uros_rpccall_joblock);
+  uros_rpccall_jobexitcnt += UROS_RPCCALL_ASYNC_THREADS;
+  urosCondVarBroadcast(&uros_rpccall_jobcond);
+  urosMutexUnlock(&uros_rpccall_joblock);
+}
+
+#endif /* UROS_RPCCALL_ASYNC_THREADS > 0 */
+
+/**
+ * @brief   Issues an asynchronous XMLRPC call.
+ * @details The job is queued, and executed by the first available worker
+ *          thread. Jobs are executed concurrently, each worker on its own
+ *          (possibly kept-alive) connection, so that a slow remote does not
+ *          stall the unrelated calls queued behind.
+ *
+ *          On completion, the @p donef handler of the job is called by the
+ *          worker thread. If it is @p NULL, the job can be waited for with
+ *          @p urosRpcCallAsyncWait() instead.
+ * @note    If @p UROS_RPCCALL_ASYNC_THREADS is @p 0, the job is executed
+ *          synchronously, by the calling thread.
+ *
+ * @pre     The node threads are running.
+ * @pre     The job is initialized, and not queued.
+ * @post    The job is owned by the queue until completed.
+ *
+ * @param[in,out] jobp
+ *          Pointer to an initialized @p UrosRpcCallJob object.
+ */
+void urosRpcCallAsync(UrosRpcCallJob *jobp) {
+
+  urosAssert(jobp != NULL);
+  urosAssert(jobp->callf != NULL);
+
+  jobp->nextp = NULL;
+  jobp->err = UROS_OK;
+  jobp->done = UROS_FALSE;
+
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+  urosMutexLock(&uros_rpccall_joblock);
+  if (uros_rpccall_jobtailp != NULL) {
+    uros_rpccall_jobtailp->nextp = jobp;
+  } else {
+    uros_rpccall_jobheadp = jobp;
+  }
+  uros_rpccall_jobtailp = jobp;
+  urosCondVarBroadcast(&uros_rpccall_jobcond);
+  urosMutexUnlock(&uros_rpccall_joblock);
+#else
+  jobp->err = jobp->callf(jobp);
+  jobp->done = UROS_TRUE;
+  if (jobp->donef != NULL) {
+    jobp->donef(jobp);
+  }
+#endif
+}
+
+/**
+ * @brief   Waits for an asynchronous XMLRPC call to complete.
+ *
+ * @pre     The job was issued by @p urosRpcCallAsync(), without a completion
+ *          handler.
+ *
+ * @param[in,out] jobp
+ *          Pointer to the issued @p UrosRpcCallJob object.
+ * @return
+ *          Error code of the call.
+ */
+uros_err_t urosRpcCallAsyncWait(UrosRpcCallJob *jobp) {
+
+  urosAssert(jobp != NULL);
+  urosAssert(jobp->donef == NULL);
+
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+  urosMutexLock(&uros_rpccall_joblock);
+  while (!jobp->done) {
+    urosCondVarWait(&uros_rpccall_jobcond, &uros_rpccall_joblock);
+  }
+  urosMutexUnlock(&uros_rpccall_joblock);
+#else
+  urosAssert(jobp->done);
+#endif
+  return jobp->err;
+}
+
+/** @} */
+
 /** @} */
 
 /** @addtogroup rpc_call_funcs */
@@ -1387,7 +2031,7 @@ uros_err_t urosRpcCallSetParam(
   urosAssert(value != NULL);
   urosAssert(resp != NULL);
 
-  ctxp = urosNew(NULL, uros_rpcpcallctx_t);
+  ctxp = (uros_rpcpcallctx_t *)urosMemPoolAlloc(&uros_rpccall_ctxpool);
   if (ctxp == NULL) { return UROS_ERR_NOMEM; }
 
   urosRpcResponseObjectInit(resp);
@@ -1411,7 +2055,7 @@ uros_err_t urosRpcCallSetParam(
 _finally:
   err = ctxp->x.err;
   uros_rpcpcall_cleanctx(ctxp);
-  urosFree(ctxp);
+  urosMemPoolFree(&uros_rpccall_ctxpool, ctxp);
   return err;
 }
 
@@ -1532,7 +2176,7 @@ uros_err_t urosRpcCallSubscribeParam(
   urosAssert(urosStringNotEmpty(caller_api));
   urosAssert(resp != NULL);
 
-  ctxp = urosNew(NULL, uros_rpcpcallctx_t);
+  ctxp = (uros_rpcpcallctx_t *)urosMemPoolAlloc(&uros_rpccall_ctxpool);
   if (ctxp == NULL) { return UROS_ERR_NOMEM; }
 
   urosRpcResponseObjectInit(resp);
@@ -1553,7 +2197,7 @@ uros_err_t urosRpcCallSubscribeParam(
 _finally:
   err = ctxp->x.err;
   uros_rpcpcall_cleanctx(ctxp);
-  urosFree(ctxp);
+  urosMemPoolFree(&uros_rpccall_ctxpool, ctxp);
   return err;
 }
 
@@ -1894,7 +2538,7 @@ uros_err_t urosRpcCallParamUpdate(
   urosAssert(parameter_value != NULL);
   urosAssert(resp != NULL);
 
-  ctxp = urosNew(NULL, uros_rpcpcallctx_t);
+  ctxp = (uros_rpcpcallctx_t *)urosMemPoolAlloc(&uros_rpccall_ctxpool);
   if (ctxp == NULL) { return UROS_ERR_NOMEM; }
 
   urosRpcResponseObjectInit(resp);
@@ -1915,7 +2559,7 @@ uros_err_t urosRpcCallParamUpdate(
 _finally:
   err = ctxp->x.err;
   uros_rpcpcall_cleanctx(ctxp);
-  urosFree(ctxp);
+  urosMemPoolFree(&uros_rpccall_ctxpool, ctxp);
   return err;
 }
 
@@ -1953,7 +2597,7 @@ uros_err_t urosRpcCallPublisherUpdate(
   urosAssert(publishers != NULL);
   urosAssert(resp != NULL);
 
-  ctxp = urosNew(NULL, uros_rpcpcallctx_t);
+  ctxp = (uros_rpcpcallctx_t *)urosMemPoolAlloc(&uros_rpccall_ctxpool);
   if (ctxp == NULL) { return UROS_ERR_NOMEM; }
 
   urosRpcResponseObjectInit(resp);
@@ -1974,7 +2618,7 @@ uros_err_t urosRpcCallPublisherUpdate(
 _finally:
   err = ctxp->x.err;
   uros_rpcpcall_cleanctx(ctxp);
-  urosFree(ctxp);
+  urosMemPoolFree(&uros_rpccall_ctxpool, ctxp);
   return err;
 }
 
@@ -2020,7 +2664,7 @@ uros_err_t urosRpcCallRequestTopic(
   urosAssert(protocols != NULL);
   urosAssert(resp != NULL);
 
-  ctxp = urosNew(NULL, uros_rpcpcallctx_t);
+  ctxp = (uros_rpcpcallctx_t *)urosMemPoolAlloc(&uros_rpccall_ctxpool);
   if (ctxp == NULL) { return UROS_ERR_NOMEM; }
 
   urosRpcResponseObjectInit(resp);
@@ -2044,7 +2688,194 @@ uros_err_t urosRpcCallRequestTopic(
 _finally:
   err = ctxp->x.err;
   uros_rpcpcall_cleanctx(ctxp);
-  urosFree(ctxp);
+  urosMemPoolFree(&uros_rpccall_ctxpool, ctxp);
+  return err;
+}
+
+/** @} */
+
+/** @name Batched calls */
+/** @{ */
+
+/**
+ * @brief   Issues a batch of method calls at once.
+ * @details The method calls are packed into a single @p system.multicall
+ *          request, and their responses are read from its results array.
+ *          A method which raised a fault gets a @p UROS_RPCC_ERROR response
+ *          code, without a value.
+ *
+ * @pre     Each method call has a valid name and parameter list.
+ * @post    If successful, the @p response of each method call must be
+ *          cleaned by the caller. Otherwise, the responses are left clean.
+ *
+ * @param[in] addrp
+ *          Pointer to the XMLRPC server address.
+ * @param[in,out] callsp
+ *          Array of method calls.
+ * @param[in] count
+ *          Number of method calls.
+ * @return
+ *          Error code.
+ * @retval UROS_ERR_PARSE
+ *          The server replied with a fault, for example because it does not
+ *          support @p system.multicall.
+ */
+uros_err_t urosRpcCallMulticall(
+  const UrosAddr        *addrp,
+  UrosRpcMethodCall     *callsp,
+  uros_cnt_t            count) {
+
+  uros_rpcpcallctx_t *ctxp;
+  UrosRpcParam results;
+  UrosRpcParamNode *nodep;
+  uint32_t httpcode;
+  uros_cnt_t i;
+  uros_err_t err;
+
+  urosAssert(addrp != NULL);
+  urosAssert(callsp != NULL);
+  urosAssert(count > 0);
+
+  for (i = 0; i < count; ++i) {
+    urosRpcResponseObjectInit(&callsp[i].response);
+  }
+  urosRpcParamObjectInit(&results, UROS_RPCP__LENGTH);
+
+  ctxp = (uros_rpcpcallctx_t *)urosMemPoolAlloc(&uros_rpccall_ctxpool);
+  if (ctxp == NULL) { return UROS_ERR_NOMEM; }
+  uros_rpcpcall_buildctx(ctxp, addrp); _CHKOKE
+
+  /* Send the request message, with a single array of call structs.*/
+  uros_rpccall_httprequest(&ctxp->x.streamer); _CHKOKE
+  uros_rpccall_methodcall_prologue(&ctxp->x.streamer,
+                                   "system.multicall", 16); _CHKOKE
+  urosRpcStreamerXmlTagOpen(&ctxp->x.streamer, "param", 5); _CHKOKE
+  urosRpcStreamerXmlTagOpen(&ctxp->x.streamer, "value", 5); _CHKOKE
+  urosRpcStreamerXmlTagOpen(&ctxp->x.streamer, "array", 5); _CHKOKE
+  urosRpcStreamerXmlTagOpen(&ctxp->x.streamer, "data", 4); _CHKOKE
+  for (i = 0; i < count; ++i) {
+    uros_rpccall_multicall_entry(&ctxp->x.streamer, &callsp[i]); _CHKOKE
+  }
+  urosRpcStreamerXmlTagClose(&ctxp->x.streamer, "data", 4); _CHKOKE
+  urosRpcStreamerXmlTagClose(&ctxp->x.streamer, "array", 5); _CHKOKE
+  urosRpcStreamerXmlTagClose(&ctxp->x.streamer, "value", 5); _CHKOKE
+  urosRpcStreamerXmlTagClose(&ctxp->x.streamer, "param", 5); _CHKOKE
+  uros_rpccall_methodcall_epilogue(&ctxp->x.streamer); _CHKOKE
+
+  /* Receive the results array.*/
+  uros_rpccall_waitresponsestart(ctxp); _CHKOKE
+  urosRpcParserHttpResponse(&ctxp->x.parser, &httpcode); _CHKOKE
+  if (httpcode != 200) { ctxp->x.err = UROS_ERR_PARSE; goto _finally; }
+  urosRpcParserMulticallResponse(&ctxp->x.parser, &results); _CHKOKE
+  urosError(results.pclass != UROS_RPCP_ARRAY ||
+            results.value.listp->length != count,
+            { ctxp->x.err = UROS_ERR_BADPARAM; goto _finally; },
+            ("Expected %u multicall results\n", (unsigned)count));
+  for (i = 0, nodep = results.value.listp->headp; i < count;
+       ++i, nodep = nodep->nextp) {
+    ctxp->x.err = uros_rpccall_multicall_result(&nodep->param,
+                                                &callsp[i].response);
+    _CHKOKE
+  }
+
+_finally:
+  err = ctxp->x.err;
+  uros_rpcpcall_cleanctx(ctxp);
+  urosMemPoolFree(&uros_rpccall_ctxpool, ctxp);
+  urosRpcParamClean(&results, UROS_TRUE);
+  if (err != UROS_OK) {
+    for (i = 0; i < count; ++i) {
+      urosRpcResponseClean(&callsp[i].response);
+    }
+  }
+  return err;
+}
+
+/**
+ * @brief   Issues a batch of method calls on a single connection.
+ * @details The method calls are sent as pipelined HTTP requests, without
+ *          waiting for the previous responses, which are then read in order.
+ *          If the server closes the connection after a response (e.g. an
+ *          HTTP/1.0 server), the remaining calls are sent again on a new
+ *          connection, one request at a time.
+ *          A method which raised a fault gets a @p UROS_RPCC_ERROR response
+ *          code, without a value.
+ * @note    Meant for servers which do not support @p system.multicall.
+ * @see     urosRpcCallMulticall()
+ *
+ * @pre     Each method call has a valid name and parameter list.
+ * @post    If successful, the @p response of each method call must be
+ *          cleaned by the caller. Otherwise, the responses are left clean.
+ *
+ * @param[in] addrp
+ *          Pointer to the XMLRPC server address.
+ * @param[in,out] callsp
+ *          Array of method calls.
+ * @param[in] count
+ *          Number of method calls.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosRpcCallPipeline(
+  const UrosAddr        *addrp,
+  UrosRpcMethodCall     *callsp,
+  uros_cnt_t            count) {
+
+  uros_rpcpcallctx_t *ctxp;
+  UrosRpcParamNode *nodep;
+  uros_cnt_t i, done, end;
+  uros_bool_t pipelined = UROS_TRUE;
+  uros_err_t err;
+
+  urosAssert(addrp != NULL);
+  urosAssert(callsp != NULL);
+  urosAssert(count > 0);
+
+  for (i = 0; i < count; ++i) {
+    urosRpcResponseObjectInit(&callsp[i].response);
+  }
+
+  ctxp = (uros_rpcpcallctx_t *)urosMemPoolAlloc(&uros_rpccall_ctxpool);
+  if (ctxp == NULL) { return UROS_ERR_NOMEM; }
+  for (done = 0; done < count;) {
+    uros_rpcpcall_buildctx(ctxp, addrp); _CHKOKE
+
+    /* Send the pending request messages, back to back.*/
+    end = pipelined ? count : done + 1;
+    for (i = done; i < end; ++i) {
+      urosAssert(urosStringNotEmpty(&callsp[i].method));
+      uros_rpccall_httprequest(&ctxp->x.streamer); _CHKOKE
+      uros_rpccall_methodcall_prologue(&ctxp->x.streamer,
+                                       callsp[i].method.datap,
+                                       callsp[i].method.length); _CHKOKE
+      for (nodep = callsp[i].params.headp; nodep != NULL;
+           nodep = nodep->nextp) {
+        uros_rpccall_param(&ctxp->x.streamer, &nodep->param); _CHKOKE
+      }
+      uros_rpccall_methodcall_epilogue(&ctxp->x.streamer); _CHKOKE
+    }
+
+    /* Receive the response messages, while the connection is kept open.*/
+    uros_rpccall_waitresponsestart(ctxp); _CHKOKE
+    while (UROS_TRUE) {
+      uros_rpccall_pipeline_result(&ctxp->x.parser,
+                                   &callsp[done].response); _CHKOKE
+      if (++done == end) { break; }
+      if (!ctxp->x.parser.keepAlive) { pipelined = UROS_FALSE; break; }
+      uros_rpccall_nextresponse(&ctxp->x.parser); _CHKOKE
+    }
+    uros_rpcpcall_cleanctx(ctxp);
+  }
+  urosMemPoolFree(&uros_rpccall_ctxpool, ctxp);
+  return UROS_OK;
+
+_finally:
+  err = ctxp->x.err;
+  uros_rpcpcall_cleanctx(ctxp);
+  urosMemPoolFree(&uros_rpccall_ctxpool, ctxp);
+  for (i = 0; i < count; ++i) {
+    urosRpcResponseClean(&callsp[i].response);
+  }
   return err;
 }
 
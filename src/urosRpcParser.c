@@ -81,66 +81,114 @@ static int uros_strnicmp(const char *s1, const char *s2, size_t n) {
   return 0;
 }
 
+/* Value type tag names, indexed by parameter class.*/
+static const char *const uros_rpcparser_valuetags[UROS_RPCP__LENGTH] = {
+  "int", "boolean", "string", "double", "base64", "struct", "array"
+};
+
+uros_rpcparamclass_t uros_rpcparser_valuetag(const char *tagp, size_t taglen) {
+
+  uros_rpcparamclass_t pclass;
+
+  urosAssert(tagp != NULL);
+
+  /* Tag length and a couple of characters select the only candidate.*/
+  switch (taglen) {
+  case 2: {
+    return (tagp[0] == 'i' && tagp[1] == '4') ? UROS_RPCP_INT
+                                              : UROS_RPCP__LENGTH;
+  }
+  case 3: pclass = UROS_RPCP_INT; break;
+  case 5: pclass = UROS_RPCP_ARRAY; break;
+  case 6: {
+    switch (tagp[0]) {
+    case 'b': pclass = UROS_RPCP_BASE64; break;
+    case 'd': pclass = UROS_RPCP_DOUBLE; break;
+    case 's': {
+      pclass = (tagp[3] == 'i') ? UROS_RPCP_STRING : UROS_RPCP_STRUCT;
+      break;
+    }
+    default: return UROS_RPCP__LENGTH;
+    }
+    break;
+  }
+  case 7: pclass = UROS_RPCP_BOOLEAN; break;
+  default: return UROS_RPCP__LENGTH;
+  }
+  return (memcmp(tagp, uros_rpcparser_valuetags[pclass], taglen) == 0)
+         ? pclass : UROS_RPCP__LENGTH;
+}
+
 uros_err_t uros_rpcparser_parambytag_partial(UrosRpcParser *pp,
                                              UrosRpcParam *paramp) {
 
   char *strp = NULL;
+  char tag[8];
+  size_t taglen;
+  uros_rpcparamclass_t pclass;
 
   urosAssert(pp != NULL);
   urosAssert(paramp != NULL);
 #define _CHKOK   { if (pp->err != UROS_OK) { goto _error; } }
-#define _GOT(tokp, toklen) \
-    (urosRpcParserExpectQuiet(pp, tokp, toklen) == UROS_OK)
 
   /* Assume it is a string by default.*/
   urosRpcParserParamValueString(pp, paramp); _CHKOK
   strp = paramp->value.string.datap;
 
-  /* Check if it is another pclass instead.*/
+  /* Read the tag name once, and check if it is another pclass instead.*/
   urosRpcParserXmlTagBeginNoName(pp); _CHKOK
-  if (_GOT("i", 1)) {
-    if (_GOT("nt>", 3)) {
-      urosFree(strp); strp = NULL;
-      urosRpcParserParamValueInt(pp, paramp); _CHKOK
-      urosRpcParserXmlTagClose(pp, "int", 3); _CHKOK
-    } else if (_GOT("4>", 2)) {
-      urosFree(strp); strp = NULL;
-      urosRpcParserParamValueInt(pp, paramp); _CHKOK
-      urosRpcParserXmlTagClose(pp, "i4", 2); _CHKOK
-    }
-  } else if (_GOT("b", 1)) {
-    if (_GOT("oolean>", 7)) {
-      urosFree(strp); strp = NULL;
-      urosRpcParserParamValueBoolean(pp, paramp); _CHKOK
-      urosRpcParserXmlTagClose(pp, "boolean", 7); _CHKOK
-    } else if (_GOT("ase64>", 6)) {
-      urosFree(strp); strp = NULL;
-      urosRpcParserParamValueBase64(pp, paramp); _CHKOK
-      urosRpcParserXmlTagClose(pp, "base64", 6); _CHKOK
-    }
-  } else if (_GOT("double>", 7)) {
-    urosFree(strp); strp = NULL;
-    urosRpcParserParamValueDouble(pp, paramp); _CHKOK
-    urosRpcParserXmlTagClose(pp, "double", 7); _CHKOK
-  } else if (_GOT("str", 3)) {
-    if (_GOT("ing>", 4)) {
-      urosFree(strp); strp = NULL;
-      urosRpcParserParamValueString(pp, paramp); _CHKOK
-      urosRpcParserXmlTagClose(pp, "string", 6); _CHKOK
-    } else if (_GOT("uct>", 4)) {
-      urosFree(strp); strp = NULL;
-      urosRpcParserParamValueStruct(pp, paramp); _CHKOK
-      urosRpcParserXmlTagClose(pp, "struct", 6); _CHKOK
-    }
-  } else if (_GOT("array>", 6)) {
-    urosFree(strp); strp = NULL;
-    urosRpcParserParamValueArray(pp, paramp); _CHKOK
-    urosRpcParserXmlTagClose(pp, "array", 5); _CHKOK
-  } else if (_GOT("/value>", 7)) {
+  taglen = sizeof(tag);
+  urosRpcParserReadUntil(pp, '>', tag, &taglen); _CHKOK
+  urosRpcParserSkip(pp, 1); _CHKOK
+  if (taglen == 6 && memcmp(tag, "/value", 6) == 0) {
     /* It was a string.*/
     return pp->err = UROS_OK;
   }
-  _CHKOK
+  pclass = uros_rpcparser_valuetag(tag, taglen);
+  urosError(pclass == UROS_RPCP__LENGTH,
+            { pp->err = UROS_ERR_PARSE; goto _error; },
+            ("Unknown value tag [%.*s], remote "UROS_ADDRFMT"\n",
+             (int)taglen, tag, UROS_ADDRARG(&pp->csp->remaddr)));
+  urosFree(strp); strp = NULL;
+
+  switch (pclass) {
+  case UROS_RPCP_INT: {
+    urosRpcParserParamValueInt(pp, paramp); _CHKOK
+    break;
+  }
+  case UROS_RPCP_BOOLEAN: {
+    urosRpcParserParamValueBoolean(pp, paramp); _CHKOK
+    break;
+  }
+  case UROS_RPCP_STRING: {
+    urosRpcParserParamValueString(pp, paramp); _CHKOK
+    break;
+  }
+  case UROS_RPCP_DOUBLE: {
+    urosRpcParserParamValueDouble(pp, paramp); _CHKOK
+    break;
+  }
+  case UROS_RPCP_BASE64: {
+    urosRpcParserParamValueBase64(pp, paramp); _CHKOK
+    break;
+  }
+  case UROS_RPCP_STRUCT: {
+    /* Also parses the closing tag.*/
+    urosRpcParserParamValueStruct(pp, paramp); _CHKOK
+    break;
+  }
+  case UROS_RPCP_ARRAY: {
+    urosRpcParserParamValueArray(pp, paramp); _CHKOK
+    break;
+  }
+  default: {
+    urosAssert(0 && "Unreachable code");
+    break;
+  }
+  }
+  if (pclass != UROS_RPCP_STRUCT) {
+    urosRpcParserXmlTagClose(pp, tag, taglen); _CHKOK
+  }
 
   /* Close tags.*/
   urosRpcParserSkipWs(pp); _CHKOK
@@ -150,7 +198,6 @@ uros_err_t uros_rpcparser_parambytag_partial(UrosRpcParser *pp,
 _error:
   if (strp != NULL) { urosFree(strp); }
   return pp->err;
-#undef _GOT
 #undef _CHKOK
 }
 
@@ -200,6 +247,7 @@ void urosRpcParserObjectInit(UrosRpcParser *pp,
   pp->bufp = NULL;
   pp->buflen = 0;
   pp->contentLength = ~0u;
+  pp->keepAlive = UROS_FALSE;
 }
 
 /**
@@ -232,6 +280,7 @@ void urosRpcParserClean(UrosRpcParser *pp, uros_bool_t freeBuffer) {
   pp->bufp = NULL;
   pp->buflen = 0;
   pp->contentLength = ~0u;
+  pp->keepAlive = UROS_FALSE;
 }
 
 /**
@@ -621,13 +670,83 @@ uros_err_t urosRpcParserLookAheadQuiet(UrosRpcParser *pp, char c) {
  */
 uros_err_t urosRpcParserSkipUntil(UrosRpcParser *pp, char c) {
 
+  const char *foundp;
+  size_t skipped;
+
   urosAssert(pp != NULL);
 
-  /* Fast-forward to the first matching character found.*/
-  while (urosRpcParserLookAheadQuiet(pp, c) == UROS_ERR_PARSE) {
-    ++pp->total; ++pp->curp; --pp->pending;
+  while (UROS_TRUE) {
+    /* Fast-forward to the first matching character found.*/
+    foundp = (const char *)memchr(pp->curp, c, pp->pending);
+    skipped = (foundp != NULL) ? (size_t)(foundp - pp->curp) : pp->pending;
+    pp->curp += skipped;
+    pp->pending -= skipped;
+    pp->total += skipped;
+    if (foundp != NULL) { return pp->err = UROS_OK; }
+
+    /* Fetch the next chunk and check again.*/
+    urosRpcParserRefill(pp);
+    if (pp->err != UROS_OK) { return pp->err; }
   }
-  return pp->err;
+  /* Unreachable code.*/
+  urosAssert(0 && "Unreachable code");
+  return pp->err = UROS_ERR_PARSE;
+}
+
+/**
+ * @brief   Reads a short token up to a character.
+ * @details Copies the incoming characters to a pre-allocated buffer, until
+ *          the look-ahead character matches the reference one. The
+ *          reference character is not consumed.
+ *
+ * @param[in,out] pp
+ *          Pointer to an initialized @p UrosRpcParser object.
+ * @param[in] c
+ *          Reference character.
+ * @param[out] tokp
+ *          Pointer to the pre-allocated token buffer.
+ * @param[in,out] toklenp
+ *          Pointer to the token length. As input, it is the size of the
+ *          token buffer. As output, it is the length of the token read.
+ * @return
+ *          Error code.
+ * @retval UROS_ERR_PARSE
+ *          The token does not fit the buffer.
+ */
+uros_err_t urosRpcParserReadUntil(UrosRpcParser *pp, char c,
+                                  char *tokp, size_t *toklenp) {
+
+  const char *foundp;
+  size_t chunklen, toklen = 0;
+
+  urosAssert(pp != NULL);
+  urosAssert(tokp != NULL);
+  urosAssert(toklenp != NULL);
+
+  while (UROS_TRUE) {
+    foundp = (const char *)memchr(pp->curp, c, pp->pending);
+    chunklen = (foundp != NULL) ? (size_t)(foundp - pp->curp) : pp->pending;
+    if (chunklen > *toklenp - toklen) {
+      *toklenp = toklen;
+      return pp->err = UROS_ERR_PARSE;
+    }
+    memcpy(tokp + toklen, pp->curp, chunklen);
+    toklen += chunklen;
+    pp->curp += chunklen;
+    pp->pending -= chunklen;
+    pp->total += chunklen;
+    if (foundp != NULL) {
+      *toklenp = toklen;
+      return pp->err = UROS_OK;
+    }
+
+    /* Fetch the next chunk and check again.*/
+    urosRpcParserRefill(pp);
+    if (pp->err != UROS_OK) { *toklenp = toklen; return pp->err; }
+  }
+  /* Unreachable code.*/
+  urosAssert(0 && "Unreachable code");
+  return pp->err = UROS_ERR_PARSE;
 }
 
 /**
@@ -691,8 +810,14 @@ uros_err_t urosRpcParserSkipAfter(UrosRpcParser *pp,
   pending = toklen;
   while (UROS_TRUE) {
     /* Fast-forward to the first matching character of the token part.*/
-    while (pp->pending > 0 && pp->curp[0] != curp[0]) {
-      ++pp->total; ++pp->curp; --pp->pending;
+    if (pp->pending > 0 && pp->curp[0] != curp[0]) {
+      const char *foundp = (const char *)memchr(pp->curp, curp[0],
+                                                pp->pending);
+      size_t skipped = (foundp != NULL) ? (size_t)(foundp - pp->curp)
+                                        : pp->pending;
+      pp->curp += skipped;
+      pp->pending -= skipped;
+      pp->total += skipped;
     }
     if (pending <= pp->pending) {
       if (0 == memcmp(pp->curp, curp, pending)) {
@@ -744,16 +869,20 @@ uros_err_t urosRpcParserSkipWs(UrosRpcParser *pp) {
   urosAssert(pp != NULL);
 
   while (UROS_TRUE) {
-    /* Skip all whitespace characters.*/
-    while (pp->pending > 0 &&
-           (pp->curp[0] == ' ' ||
-            pp->curp[0] == '\r' ||
-            pp->curp[0] == '\n' ||
-            pp->curp[0] == '\t' ||
-            pp->curp[0] == '\v')) {
+    const char *curp = pp->curp, *endp = pp->curp + pp->pending;
 
-      ++pp->total; ++pp->curp; --pp->pending;
+    /* Skip all whitespace characters.*/
+    while (curp < endp &&
+           (curp[0] == ' ' ||
+            curp[0] == '\r' ||
+            curp[0] == '\n' ||
+            curp[0] == '\t' ||
+            curp[0] == '\v')) {
+      ++curp;
     }
+    pp->total += (size_t)(curp - pp->curp);
+    pp->pending = (size_t)(endp - curp);
+    pp->curp = (char *)curp;
     if (pp->pending > 0) {
       return pp->err = UROS_OK;
     } else {
@@ -1006,7 +1135,13 @@ uros_err_t urosRpcParserFixStringChars(UrosString *strp) {
 
   urosAssert(urosStringIsValid(strp));
 
-  for (srcp = dstp = strp->datap, pending = strp->length; pending > 0;) {
+  /* Most strings have nothing to fix.*/
+  srcp = (strp->length > 0) ? (char *)memchr(strp->datap, '&', strp->length)
+                            : NULL;
+  if (srcp == NULL) { return UROS_OK; }
+
+  pending = strp->length - (size_t)(srcp - strp->datap);
+  for (dstp = srcp; pending > 0;) {
     if (srcp[0] != '&') {
       *dstp++ = *srcp++; --pending;
     } else if (pending >= 5 &&
@@ -1124,6 +1259,9 @@ uros_err_t urosRpcParserHttpRequest(UrosRpcParser *pp) {
  *          - <tt>Content-Length</tt>, which is used by the parser to receive
  *            the correct number of pending characters,
  *          - <tt>Content-Type</tt>, which must be <tt>text/xml</tt>.
+ *          The <tt>Connection</tt> header, together with the HTTP version,
+ *          tells whether the remote keeps the connection open afterwards
+ *          (see @p UrosRpcParser::keepAlive).
  *          Any other header is simply ignored.
  *
  * @param[in,out] pp
@@ -1136,15 +1274,19 @@ uros_err_t urosRpcParserHttpRequest(UrosRpcParser *pp) {
 uros_err_t urosRpcParserHttpResponse(UrosRpcParser *pp, uint32_t *codep) {
 
   uros_bool_t isxml = UROS_FALSE;
+  uros_bool_t keepalive = UROS_TRUE;
 
   urosAssert(pp != NULL);
   urosAssert(codep != NULL);
 #define _CHKOK  { if (pp->err != UROS_OK) { return pp->err; } }
 
   /* Expect it to be a HTTP 1.(0|1) header.*/
+  pp->keepAlive = UROS_FALSE;
   urosRpcParserExpect(pp, "HTTP/1.", 7); _CHKOK
   if (urosRpcParserExpectQuiet(pp, "1 ", 2) == UROS_ERR_PARSE) {
+    /* HTTP/1.0 closes the connection, unless told otherwise.*/
     urosRpcParserExpect(pp, "0 ", 2); _CHKOK
+    keepalive = UROS_FALSE;
   }
   urosError(pp->err != UROS_OK, return pp->err,
             ("Error %s while expecting a valid HTTP status line, remote "
@@ -1160,6 +1302,7 @@ uros_err_t urosRpcParserHttpResponse(UrosRpcParser *pp, uint32_t *codep) {
     if (pp->err == UROS_OK) {
       if (pp->contentLength < ~0u && isxml) {
         pp->mark = pp->total;
+        pp->keepAlive = keepalive;
         return pp->err = UROS_OK;
       } else {
         /* Some required headers are missing.*/
@@ -1192,6 +1335,15 @@ uros_err_t urosRpcParserHttpResponse(UrosRpcParser *pp, uint32_t *codep) {
       }
     }
 
+    /* Connection header.*/
+    if (urosRpcParserExpectNoCaseQuiet(pp, "Connection: ", 12) == UROS_OK) {
+      if (urosRpcParserExpectNoCaseQuiet(pp, "keep-alive", 10) == UROS_OK) {
+        keepalive = UROS_TRUE;
+      } else if (urosRpcParserExpectNoCaseQuiet(pp, "close", 5) == UROS_OK) {
+        keepalive = UROS_FALSE;
+      }
+    }
+
     /* Skip unhandled headers.*/
     urosRpcParserSkipAfter(pp, "\r\n", 2); _CHKOK
   }
@@ -1572,41 +1724,39 @@ uros_err_t urosRpcParserParamValueBoolean(UrosRpcParser *pp,
 uros_err_t urosRpcParserParamValueString(UrosRpcParser *pp,
                                          UrosRpcParam *paramp) {
 
-  size_t strlen = 0;
-  char *strp = NULL;
+  const char *endp;
+  size_t spanlen, strlen = 0;
+  char *strp = NULL, *newp;
 
   urosAssert(pp != NULL);
   urosAssert(paramp != NULL);
 
   paramp->pclass = UROS_RPCP_STRING;
 
-  /* Do not mess with the memory if a tag (a comment too!) is already there.*/
-  if (urosRpcParserLookAheadQuiet(pp, '<') == UROS_ERR_PARSE) {
-    size_t freelen = pp->rdbuflen;
-    char *curp = pp->rdbufp;
-
-    /* Copy until a '<' is found.*/
-    while (freelen > 0 && urosRpcParserLookAheadQuiet(pp, '<') == UROS_ERR_PARSE) {
-      *curp++ = *pp->curp++;
-      --freelen; ++strlen;
-      ++pp->total; --pp->pending;
+  /* Copy the string spans until a '<' is found, straight from the receive
+     buffer. Usually the whole string is a single span.*/
+  while (UROS_TRUE) {
+    if (pp->pending == 0) {
+      urosRpcParserRefill(pp);
+      if (pp->err != UROS_OK) { break; }
     }
-    if (freelen == 0) {
-      /* String longer than the parser buffer.*/
-      urosError(UROS_ERR_PARSE, UROS_NOP,
-                ("String longer than the parser buffer, remote "
-                 UROS_ADDRFMT"\n", UROS_ADDRARG(&pp->csp->remaddr)));
-      return UROS_ERR_PARSE;
-    }
-
-    /* Copy from the reading buffer.*/
-    if (strlen > 0) {
-      strp = (char*)urosAlloc(NULL, strlen);
-      urosAssert(strp != NULL);
-      memcpy(strp, pp->rdbufp, strlen);
+    endp = (const char *)memchr(pp->curp, '<', pp->pending);
+    spanlen = (endp != NULL) ? (size_t)(endp - pp->curp) : pp->pending;
+    if (spanlen > 0) {
+      newp = (char*)urosAlloc(UROS_XMLRPC_HEAP, strlen + spanlen);
+      if (newp == NULL) { pp->err = UROS_ERR_NOMEM; break; }
+      if (strlen > 0) { memcpy(newp, strp, strlen); }
+      memcpy(newp + strlen, pp->curp, spanlen);
+      urosFree(strp);
+      strp = newp;
+      strlen += spanlen;
+      pp->curp += spanlen;
+      pp->pending -= spanlen;
+      pp->total += spanlen;
     }
+    if (endp != NULL) { break; }
   }
-  urosError(pp->err != UROS_OK, return pp->err,
+  urosError(pp->err != UROS_OK, { urosFree(strp); return pp->err; },
             ("Error %s while scanning for a string value, remote "
              UROS_ADDRFMT"\n",
              urosErrorText(pp->err), UROS_ADDRARG(&pp->csp->remaddr)));
@@ -1644,7 +1794,10 @@ uros_err_t urosRpcParserParamValueDouble(UrosRpcParser *pp,
 
 /**
  * @brief   Parses a @p base64 XMLRPC parameter value.
- * @warning Not implemented.
+ * @details The base64 text ends where a look-ahead <tt>'<'</tt> is found.
+ *          Whitespaces are ignored. The text is decoded span by span,
+ *          straight from the receive buffer, into an allocated binary chunk
+ *          which grows as needed.
  *
  * @param[in,out] pp
  *          Pointer to an initialized @p UrosRpcParser object.
@@ -1656,25 +1809,91 @@ uros_err_t urosRpcParserParamValueDouble(UrosRpcParser *pp,
 uros_err_t urosRpcParserParamValueBase64(UrosRpcParser *pp,
                                          UrosRpcParam *paramp) {
 
+  const char *endp;
+  size_t spanlen, datalen = 0, i;
+  uint8_t *datap = NULL, *newp;
+  uint32_t quad = 0;
+  unsigned numq = 0, numpad = 0;
+  char c;
+
   urosAssert(pp != NULL);
   urosAssert(paramp != NULL);
-#define _CHKOK   { if (pp->err != UROS_OK) { return pp->err; } }
 
   paramp->pclass = UROS_RPCP_BASE64;
-
-  /* TODO: Parse the base64 stream and convert it into a binary form.*/
-  urosRpcParserSkipUntil(pp, '<'); _CHKOK
   urosStringObjectInit(&paramp->value.base64);
-  urosError(UROS_TRUE, UROS_NOP, ("XMLRPC base64 values not supported\n"));
 
-  return pp->err = UROS_OK;
+  /* Decode the base64 spans until a '<' is found. Each span can complete at
+     most (spanlen / 4 + 1) quads, including the carried partial one.*/
+  while (UROS_TRUE) {
+    if (pp->pending == 0) {
+      urosRpcParserRefill(pp);
+      if (pp->err != UROS_OK) { break; }
+    }
+    endp = (const char *)memchr(pp->curp, '<', pp->pending);
+    spanlen = (endp != NULL) ? (size_t)(endp - pp->curp) : pp->pending;
+    if (spanlen > 0) {
+      newp = (uint8_t*)urosAlloc(UROS_XMLRPC_HEAP,
+                                 datalen + (spanlen / 4 + 1) * 3);
+      if (newp == NULL) { pp->err = UROS_ERR_NOMEM; break; }
+      if (datalen > 0) { memcpy(newp, datap, datalen); }
+      urosFree(datap);
+      datap = newp;
+      for (i = 0; i < spanlen; ++i) {
+        c = pp->curp[i];
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n') { continue; }
+        if (c == '=')                   { quad <<= 6; ++numpad; }
+        else if (numpad > 0)            { break; }
+        else if (c >= 'A' && c <= 'Z')  { quad = (quad << 6) | (uint32_t)(c - 'A'); }
+        else if (c >= 'a' && c <= 'z')  { quad = (quad << 6) | (uint32_t)(c - 'a' + 26); }
+        else if (c >= '0' && c <= '9')  { quad = (quad << 6) | (uint32_t)(c - '0' + 52); }
+        else if (c == '+')              { quad = (quad << 6) | 62; }
+        else if (c == '/')              { quad = (quad << 6) | 63; }
+        else                            { break; }
+        if (++numq == 4) {
+          datap[datalen++] = (uint8_t)(quad >> 16);
+          datap[datalen++] = (uint8_t)(quad >> 8);
+          datap[datalen++] = (uint8_t)quad;
+          quad = 0; numq = 0;
+        }
+      }
+      if (i < spanlen) {
+        urosFree(datap);
+        urosError(UROS_ERR_PARSE, UROS_NOP,
+                  ("Invalid base64 character [%c], remote "UROS_ADDRFMT"\n",
+                   c, UROS_ADDRARG(&pp->csp->remaddr)));
+        return pp->err = UROS_ERR_PARSE;
+      }
+      pp->curp += spanlen;
+      pp->pending -= spanlen;
+      pp->total += spanlen;
+    }
+    if (endp != NULL) { break; }
+  }
+  urosError(pp->err != UROS_OK, { urosFree(datap); return pp->err; },
+            ("Error %s while scanning for a base64 value, remote "
+             UROS_ADDRFMT"\n",
+             urosErrorText(pp->err), UROS_ADDRARG(&pp->csp->remaddr)));
+  urosError(numq != 0 || numpad > 2 || numpad > datalen,
+            { urosFree(datap); return pp->err = UROS_ERR_PARSE; },
+            ("Base64 text is not properly padded, remote "UROS_ADDRFMT"\n",
+             UROS_ADDRARG(&pp->csp->remaddr)));
 
-#undef _CHKOK
+  /* Padding characters decoded as trailing zero bytes.*/
+  datalen -= numpad;
+  if (datalen == 0) {
+    urosFree(datap);
+    return pp->err = UROS_OK;
+  }
+  paramp->value.base64.length = datalen;
+  paramp->value.base64.datap = (char*)datap;
+  return pp->err = UROS_OK;
 }
 
 /**
  * @brief   Parses a struct (key-value map) XMLRPC parameter value.
- * @warning Not implemented.
+ * @details The members are parsed up to the closing <tt>\</struct\></tt>
+ *          tag, included. Nested values of any pclass are supported.
+ * @warning The members are not mapped yet, so they are discarded.
  *
  * @param[in,out] pp
  *          Pointer to an initialized @p UrosRpcParser object.
@@ -1686,17 +1905,49 @@ uros_err_t urosRpcParserParamValueBase64(UrosRpcParser *pp,
 uros_err_t urosRpcParserParamValueStruct(UrosRpcParser *pp,
                                          UrosRpcParam *paramp) {
 
+  UrosRpcParam member;
+
   urosAssert(pp != NULL);
   urosAssert(paramp != NULL);
-#define _CHKOK   { if (pp->err != UROS_OK) { return pp->err; } }
+#define _CHKOK   { if (pp->err != UROS_OK) { goto _error; } }
 
   paramp->pclass = UROS_RPCP_STRUCT;
+  urosRpcParamObjectInit(&member, UROS_RPCP__LENGTH);
 
-  /* FIXME: Parse the XMLRPC struct and map it.*/
-
-  urosRpcParserSkipWs(pp); _CHKOK
+  /* Parse the members until the closing tag.*/
+  while (UROS_TRUE) {
+    urosRpcParserSkipWs(pp); _CHKOK
+    if (urosRpcParserExpectQuiet(pp, "<member>", 8) == UROS_ERR_PARSE) {
+      if (urosRpcParserExpectQuiet(pp, "/struct>", 8) == UROS_ERR_PARSE) {
+        urosRpcParserXmlTagClose(pp, "struct", 6); _CHKOK
+      }
+      _CHKOK
+      break;
+    }
+    _CHKOK
+    urosRpcParserSkipWs(pp); _CHKOK
+    urosRpcParserXmlTagOpen(pp, "name", 4); _CHKOK
+    urosRpcParserParamValueString(pp, &member); _CHKOK
+    urosRpcParamClean(&member, UROS_TRUE);
+    urosRpcParamObjectInit(&member, UROS_RPCP__LENGTH);
+    urosRpcParserXmlTagClose(pp, "name", 4); _CHKOK
+    urosRpcParserSkipWs(pp); _CHKOK
+    urosRpcParserParamByTag(pp, &member); _CHKOK
+    urosRpcParamClean(&member, UROS_TRUE);
+    urosRpcParamObjectInit(&member, UROS_RPCP__LENGTH);
+    urosRpcParserSkipWs(pp); _CHKOK
+    urosRpcParserXmlTagClose(pp, "member", 6); _CHKOK
+  }
   return pp->err = UROS_OK;
 
+_error:
+  urosError(UROS_TRUE, UROS_NOP,
+            ("Error %s while scanning for a struct member, "
+             "stream offset %u, pending [%.*s], remote "UROS_ADDRFMT"\n",
+             urosErrorText(pp->err), (unsigned)pp->total,
+             (unsigned)pp->pending, pp->curp,
+             UROS_ADDRARG(&pp->csp->remaddr)));
+  return pp->err;
 #undef _CHKOK
 }
 
@@ -1720,7 +1971,7 @@ uros_err_t urosRpcParserParamValueArray(UrosRpcParser *pp,
 #define _CHKOK   { if (pp->err != UROS_OK) { goto _error; } }
 
   paramp->pclass = UROS_RPCP_ARRAY;
-  paramp->value.listp = urosNew(NULL, UrosRpcParamList);
+  paramp->value.listp = urosNew(UROS_XMLRPC_HEAP, UrosRpcParamList);
   if (paramp->value.listp == NULL) { return pp->err = UROS_ERR_NOMEM; }
   urosRpcParamListObjectInit(paramp->value.listp);
 
@@ -1729,7 +1980,7 @@ uros_err_t urosRpcParserParamValueArray(UrosRpcParser *pp,
   urosRpcParserXmlTagOpen(pp, "data", 4); _CHKOK
   while (UROS_TRUE) {
     UrosRpcParamNode *nodep;
-    nodep = urosNew(NULL, UrosRpcParamNode);
+    nodep = urosNew(UROS_XMLRPC_HEAP, UrosRpcParamNode);
     if (nodep == NULL) { pp->err = UROS_ERR_NOMEM; goto _error; }
     urosRpcParamNodeObjectInit(nodep, UROS_RPCP__LENGTH);
     urosRpcParamListAppendNode(paramp->value.listp, nodep);
@@ -1925,9 +2176,6 @@ uros_err_t urosRpcParserParam(UrosRpcParser *pp,
     urosRpcParserSkipWs(pp); _CHKOK
     urosRpcParserXmlTagOpen(pp, "struct", 6); _CHKOK
     urosRpcParserParamValueStruct(pp, paramp); _CHKOK
-    /* TODO: Add support for structs.*/
-    urosRpcParserSkipAfter(pp, "</struct>", 9); _CHKOK
-    /*urosRpcParserXmlTagClose(pp, "struct", 6); _CHKOK*/
     urosRpcParserSkipWs(pp); _CHKOK
     break;
   }
@@ -1973,7 +2221,7 @@ uros_err_t urosRpcParserMethodResponse(UrosRpcParser *pp,
 #define _CHKOK  { if (pp->err != UROS_OK) { return pp->err; } }
 
   urosRpcResponseObjectInit(resp);
-  resp->valuep = urosNew(NULL, UrosRpcParam);
+  resp->valuep = urosNew(UROS_XMLRPC_HEAP, UrosRpcParam);
   if (resp->valuep == NULL) { return pp->err = UROS_ERR_NOMEM; }
 
   /* Check the XML header.*/
@@ -2041,4 +2289,56 @@ uros_err_t urosRpcParserMethodResponse(UrosRpcParser *pp,
 #undef _CHKOK
 }
 
+/**
+ * @brief   Parses a @p system.multicall response.
+ * @details Reads the XMLRPC response body, made of a single array. Each
+ *          array item is either a single-item array wrapping the
+ *          <tt>[code, statusMessage, value]</tt> result of the related call,
+ *          or a fault struct.
+ * @note    Struct values are not mapped, only their parameter class is set.
+ *
+ * @pre     The HTTP header section has been parsed.
+ *
+ * @param[in,out] pp
+ *          Pointer to an initialized @p UrosRpcParser object.
+ * @param[out] resultsp
+ *          Pointer to the allocated parameter which will hold the results
+ *          array.
+ * @return
+ *          Error code.
+ * @retval UROS_ERR_PARSE
+ *          Not a valid response, or a fault (e.g. multicall not supported).
+ */
+uros_err_t urosRpcParserMulticallResponse(UrosRpcParser *pp,
+                                          UrosRpcParam *resultsp) {
+
+  urosAssert(pp != NULL);
+  urosAssert(resultsp != NULL);
+#define _CHKOK  { if (pp->err != UROS_OK) { return pp->err; } }
+
+  /* Check the XML header.*/
+  urosRpcParserXmlHeader(pp); _CHKOK
+
+  /* Read the results array.*/
+  urosRpcParserSkipWs(pp); _CHKOK
+  urosRpcParserXmlTagOpen(pp, "methodResponse", 14); _CHKOK
+  urosRpcParserSkipWs(pp); _CHKOK
+  urosRpcParserXmlTagOpen(pp, "params", 6); _CHKOK
+  urosRpcParserSkipWs(pp); _CHKOK
+  urosRpcParserXmlTagOpen(pp, "param", 5); _CHKOK
+  urosRpcParserSkipWs(pp); _CHKOK
+  urosRpcParamObjectInit(resultsp, UROS_RPCP__LENGTH);
+  urosRpcParserParamByTag(pp, resultsp); _CHKOK
+  urosRpcParserSkipWs(pp); _CHKOK
+  urosRpcParserXmlTagClose(pp, "param", 5); _CHKOK
+  urosRpcParserSkipWs(pp); _CHKOK
+  urosRpcParserXmlTagClose(pp, "params", 6); _CHKOK
+  urosRpcParserSkipWs(pp); _CHKOK
+  urosRpcParserXmlTagClose(pp, "methodResponse", 14); _CHKOK
+  urosRpcParserSkip(pp, pp->contentLength - (pp->total - pp->mark)); _CHKOK
+
+  return pp->err = UROS_OK;
+#undef _CHKOK
+}
+
 /** @} */
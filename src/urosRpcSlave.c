@@ -45,6 +45,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../include/urosRpcParser.h"
 #include "../include/urosRpcStreamer.h"
 #include "../include/urosNode.h"
+#include "../include/urosUdpRos.h"
 
 #include <string.h>
 
@@ -62,6 +63,34 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define urosError(when, action, msgargs) { if (when) { action; } }
 #endif
 
+/**
+ * @brief   XMLRPC Slave API server endpoints.
+ * @details The parser and the streamer are never used at the same time.
+ */
+typedef union uros_rpcslave_eps_t {
+  uros_err_t      err;                  /**< @brief Last error code.*/
+  UrosRpcParser   parser;               /**< @brief Request parser.*/
+  UrosRpcStreamer streamer;             /**< @brief Response streamer.*/
+} uros_rpcslave_eps_t;
+
+/*===========================================================================*/
+/* LOCAL VARIABLES                                                           */
+/*===========================================================================*/
+
+/** @brief Preallocated XMLRPC Slave API server endpoints.*/
+static UROS_STACKPOOL(uros_rpcslave_epschunk, sizeof(uros_rpcslave_eps_t),
+                      UROS_XMLRPC_SLAVE_POOLSIZE);
+
+/** @brief Preallocated XMLRPC Slave API server buffers.*/
+static UROS_STACKPOOL(uros_rpcslave_bufchunk, UROS_MTU_SIZE,
+                      UROS_XMLRPC_SLAVE_POOLSIZE);
+
+/** @brief XMLRPC Slave API server endpoint pool.*/
+static UrosMemPool uros_rpcslave_epspool;
+
+/** @brief XMLRPC Slave API server buffer pool.*/
+static UrosMemPool uros_rpcslave_bufpool;
+
 /*===========================================================================*/
 /* LOCAL FUNCTIONS                                                           */
 /*===========================================================================*/
@@ -78,7 +107,7 @@ uros_err_t uros_rpcslave_methodresponse_prologue(UrosRpcStreamer *sp) {
   /* Using XML content (XMLRPC).*/
   urosRpcStreamerHttpHeader(sp, "Content-Type", 12, "text/xml", 8); _CHKOK
 
-  /* Content-Length default value (fixed).*/
+  /* Content-Length value, written at the end of the body.*/
   urosRpcStreamerHttpContentLength(sp); _CHKOK
   urosRpcStreamerHttpEnd(sp); _CHKOK
 
@@ -111,8 +140,8 @@ uros_err_t uros_rpcslave_methodresponse_epilogue(UrosRpcStreamer *sp) {
   urosRpcStreamerXmlTagClose(sp, "methodResponse", 14); _CHKOK
   urosRpcStreamerWrite(sp, "\r\n", 2); _CHKOK
 
-  /* Fix the actual Content-Length.*/
-  urosRpcStreamerXmlEndHack(sp); _CHKOK
+  /* Write the actual Content-Length.*/
+  urosRpcStreamerHttpContentEnd(sp); _CHKOK
   return urosRpcStreamerFlush(sp);
 #undef _CHKOK
 }
@@ -180,6 +209,22 @@ uros_err_t uros_rpcslave_value_array_end(UrosRpcStreamer *sp) {
 #undef _CHKOK
 }
 
+uros_err_t uros_rpcslave_value_boolean(UrosRpcStreamer *sp,
+                                       uros_bool_t value) {
+
+  urosAssert(sp != NULL);
+#define _CHKOK   { if (sp->err != UROS_OK) { return sp->err; } }
+
+  urosRpcStreamerXmlTagOpen(sp, "value", 5); _CHKOK
+  urosRpcStreamerXmlTagOpen(sp, "boolean", 7); _CHKOK
+  urosRpcStreamerWrite(sp, value ? "1" : "0", 1); _CHKOK
+  urosRpcStreamerXmlTagClose(sp, "boolean", 7); _CHKOK
+  urosRpcStreamerXmlTagClose(sp, "value", 5); _CHKOK
+
+  return sp->err = UROS_OK;
+#undef _CHKOK
+}
+
 uros_err_t uros_rpcslave_value_string_ip(UrosRpcStreamer *sp, UrosIp ip) {
 
   urosAssert(sp != NULL);
@@ -199,6 +244,80 @@ uros_err_t uros_rpcslave_value_string_ip(UrosRpcStreamer *sp, UrosIp ip) {
 #undef _CHKOK
 }
 
+uros_err_t uros_rpcslave_value_base64(UrosRpcStreamer *sp,
+                                      const UrosString *datap) {
+
+  UrosRpcParam param;
+
+  urosAssert(sp != NULL);
+  urosAssert(datap != NULL);
+#define _CHKOK   { if (sp->err != UROS_OK) { return sp->err; } }
+
+  param.pclass = UROS_RPCP_BASE64;
+  param.value.base64 = *datap;
+  urosRpcStreamerXmlTagOpen(sp, "value", 5); _CHKOK
+  urosRpcStreamerXmlTagOpen(sp, "base64", 6); _CHKOK
+  urosRpcStreamerParamValueBase64(sp, &param); _CHKOK
+  urosRpcStreamerXmlTagClose(sp, "base64", 6); _CHKOK
+  urosRpcStreamerXmlTagClose(sp, "value", 5); _CHKOK
+
+  return sp->err = UROS_OK;
+#undef _CHKOK
+}
+
+uros_err_t uros_rpcslave_udpros_link(const UrosString *topicp,
+                                     const UrosRpcParamList *offerp,
+                                     UrosUdpRosLink *infop,
+                                     UrosString *reshdrp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  UrosUdpRosLink *linkp;
+  const UrosRpcParamNode *nodep;
+  const UrosString *hdrp;
+  UrosString host;
+  UrosAddr subaddr;
+  int32_t dgramsize;
+  uros_err_t err;
+
+  /* ["UDPROS", header, host, port, max_datagram_size] */
+  urosError(offerp->length != 5, return UROS_ERR_BADPARAM,
+            ("UDPROS offer array length %lu, expected 5\n",
+             (long unsigned int)offerp->length));
+  nodep = offerp->headp->nextp;
+  if (nodep->param.pclass != UROS_RPCP_BASE64) { return UROS_ERR_BADPARAM; }
+  hdrp = &nodep->param.value.base64;
+  nodep = nodep->nextp;
+  if (nodep->param.pclass != UROS_RPCP_STRING) { return UROS_ERR_BADPARAM; }
+  host = nodep->param.value.string;
+  nodep = nodep->nextp;
+  if (nodep->param.pclass != UROS_RPCP_INT) { return UROS_ERR_BADPARAM; }
+  subaddr.port = (uint16_t)nodep->param.value.int32;
+  nodep = nodep->nextp;
+  if (nodep->param.pclass != UROS_RPCP_INT) { return UROS_ERR_BADPARAM; }
+  dgramsize = nodep->param.value.int32;
+  if (dgramsize <= UROS_UDPROS_HDRLEN) { return UROS_ERR_BADPARAM; }
+  err = urosHostnameToIp(&host, &subaddr.ip);
+  if (err != UROS_OK) { return err; }
+
+  /* Create the link, and let a TCPROS Server worker handle it.*/
+  err = urosUdpRosPublisherLink(topicp, hdrp, &subaddr, (size_t)dgramsize,
+                                &linkp, reshdrp);
+  if (err != UROS_OK) { return err; }
+  /* The worker may close the link at any time, copy its info first.*/
+  infop->conn.locaddr = linkp->conn.locaddr;
+  infop->connId = linkp->connId;
+  infop->dgramSize = linkp->dgramSize;
+  err = urosThreadPoolStartWorker(&stp->tcpsvrThdPool,
+                                  (void*)&linkp->conn);
+  urosError(err != UROS_OK,
+            { urosStringClean(reshdrp);
+              urosUdpRosLinkDelete(linkp); },
+            ("Error %s while starting the UDPROS link to "UROS_ADDRFMT"\n",
+             urosErrorText(err), UROS_ADDRARG(&subaddr)));
+  return err;
+}
+
 uros_err_t uros_rpcslave_process_publisherupdate(const UrosString *topic,
                                                  const UrosRpcParam *publishers) {
 
@@ -215,7 +334,7 @@ uros_err_t uros_rpcslave_process_publisherupdate(const UrosString *topic,
 
   /* Check if the topic is actually subscribed.*/
   urosMutexLock(&stp->subTopicListLock);
-  topicnodep = urosTopicListFindByName(&stp->subTopicList, topic);
+  topicnodep = urosListIndexFind(&stp->subTopicIndex, topic);
   urosMutexUnlock(&stp->subTopicListLock);
   urosError(topicnodep == NULL, return UROS_ERR_BADPARAM,
             ("Topic [%.*s] not found\n", UROS_STRARG(topic)));
@@ -232,52 +351,77 @@ uros_err_t uros_rpcslave_process_publisherupdate(const UrosString *topic,
   return UROS_OK;
 }
 
+/* Method names, indexed by method id.*/
+static const char *const uros_rpcslave_methodnames[UROS_RPCSM__LENGTH] = {
+  "getBusInfo",
+  "getBusStats",
+  "getMasterUri",
+  "getPid",
+  "getPublications",
+  "getSubscriptions",
+  "paramUpdate",
+  "publisherUpdate",
+  "requestTopic",
+  "shutdown"
+};
+
+uros_rpcslave_methodid_t uros_rpcslave_methodbyname(const char *namep,
+                                                    size_t namelen) {
+
+  uros_rpcslave_methodid_t methodid;
+
+  urosAssert(namep != NULL);
+
+  /* Name length and first character select the only candidate.*/
+  switch (namelen) {
+  case 6:  methodid = UROS_RPCSM_GET_PID; break;
+  case 8:  methodid = UROS_RPCSM_SHUTDOWN; break;
+  case 10: methodid = UROS_RPCSM_GET_BUS_INFO; break;
+  case 11: {
+    methodid = (namep[0] == 'g') ? UROS_RPCSM_GET_BUS_STATS
+                                 : UROS_RPCSM_PARAM_UPDATE;
+    break;
+  }
+  case 12: {
+    methodid = (namep[0] == 'g') ? UROS_RPCSM_GET_MASTER_URI
+                                 : UROS_RPCSM_REQUEST_TOPIC;
+    break;
+  }
+  case 15: {
+    methodid = (namep[0] == 'g') ? UROS_RPCSM_GET_PUBLICATIONS
+                                 : UROS_RPCSM_PUBLISHER_UPDATE;
+    break;
+  }
+  case 16: methodid = UROS_RPCSM_GET_SUBSCRIPTIONS; break;
+  default: return UROS_RPCSM__LENGTH;
+  }
+  return (memcmp(namep, uros_rpcslave_methodnames[methodid], namelen) == 0)
+         ? methodid : UROS_RPCSM__LENGTH;
+}
+
 uros_err_t uros_rpcslave_xmlmethodname(UrosRpcParser *pp,
                                        uros_rpcslave_methodid_t *methodp) {
 
+  char name[24];
+  size_t namelen;
+
   urosAssert(pp != NULL);
   urosAssert(methodp != NULL);
-#define _GOT(tokp, toklen) \
-    (urosRpcParserExpectQuiet(pp, tokp, toklen) == UROS_OK)
-
-  urosRpcParserXmlTagOpen(pp, "methodName", 10);
-  if (pp->err != UROS_OK) { return pp->err; }
-
-  if (_GOT("get", 3)) {
-    if (_GOT("Bus", 3)) {
-      if (_GOT("Info", 4)) {
-        *methodp = UROS_RPCSM_GET_BUS_INFO;
-      } else if (_GOT("Status", 6)) {
-        *methodp = UROS_RPCSM_GET_BUS_STATS;
-      }
-    } else if (_GOT("MasterUri", 9)) {
-      *methodp = UROS_RPCSM_GET_MASTER_URI;
-    } else if (_GOT("P", 1)) {
-      if (_GOT("id", 2)) {
-        *methodp = UROS_RPCSM_GET_PID;
-      } else if (_GOT("ublications", 12)) {
-        *methodp = UROS_RPCSM_GET_PUBLICATIONS;
-      }
-    } else if (_GOT("Subscriptions", 13)) {
-      *methodp = UROS_RPCSM_GET_SUBSCRIPTIONS;
-    }
-  } else if (_GOT("p", 1)) {
-    if (_GOT("aramUpdate", 10)) {
-      *methodp = UROS_RPCSM_PARAM_UPDATE;
-    } else if (_GOT("ublisherUpdate", 14)) {
-      *methodp = UROS_RPCSM_PUBLISHER_UPDATE;
-    }
-  } else if (_GOT("requestTopic", 12)) {
-    *methodp = UROS_RPCSM_REQUEST_TOPIC;
-  } else if (_GOT("shutdown", 8)) {
-    *methodp = UROS_RPCSM_SHUTDOWN;
-  }
+#define _CHKOK   { if (pp->err != UROS_OK) { return pp->err; } }
 
-  if (pp->err == UROS_OK) {
-    urosRpcParserXmlTagClose(pp, "methodName", 10);
-  }
-  return pp->err;
-#undef _GOT
+  urosRpcParserXmlTagOpen(pp, "methodName", 10); _CHKOK
+
+  /* Read the method name once, then dispatch it.*/
+  namelen = sizeof(name);
+  urosRpcParserReadUntil(pp, '<', name, &namelen); _CHKOK
+  *methodp = uros_rpcslave_methodbyname(name, namelen);
+  urosError(*methodp == UROS_RPCSM__LENGTH, return pp->err = UROS_ERR_PARSE,
+            ("Unknown method [%.*s], remote "UROS_ADDRFMT"\n",
+             (int)namelen, name, UROS_ADDRARG(&pp->csp->remaddr)));
+
+  urosRpcParserXmlTagClose(pp, "methodName", 10); _CHKOK
+  return pp->err = UROS_OK;
+#undef _CHKOK
 }
 
 uros_err_t uros_rpcslave_receive_parambyclass(UrosRpcParser *pp,
@@ -314,7 +458,7 @@ uros_err_t uros_rpcslave_receive_params(UrosRpcParser *pp,
   urosRpcParserSkipWs(pp); _CHKOK
 
   /* str caller_id always as first parameter.*/
-  str1 = urosNew(NULL, UrosRpcParamNode);
+  str1 = urosNew(UROS_XMLRPC_HEAP, UrosRpcParamNode);
   if (str1 == NULL) { return UROS_ERR_NOMEM; }
   urosRpcParamNodeObjectInit(str1, UROS_RPCP_STRING);
   urosRpcParamListAppendNode(parlistp, str1);
@@ -331,8 +475,8 @@ uros_err_t uros_rpcslave_receive_params(UrosRpcParser *pp,
     break;
   }
   case UROS_RPCSM_PARAM_UPDATE: {
-    UrosRpcParamNode *str2 = urosNew(NULL, UrosRpcParamNode);
-    UrosRpcParamNode *any3 = urosNew(NULL, UrosRpcParamNode);
+    UrosRpcParamNode *str2 = urosNew(UROS_XMLRPC_HEAP, UrosRpcParamNode);
+    UrosRpcParamNode *any3 = urosNew(UROS_XMLRPC_HEAP, UrosRpcParamNode);
     if (str2 == NULL || any3 == NULL) {
       urosFree(str2); urosFree(any3);
       pp->err = UROS_ERR_NOMEM; goto _error;
@@ -355,8 +499,8 @@ uros_err_t uros_rpcslave_receive_params(UrosRpcParser *pp,
   }
   case UROS_RPCSM_PUBLISHER_UPDATE:
   case UROS_RPCSM_REQUEST_TOPIC: {
-    UrosRpcParamNode *str2 = urosNew(NULL, UrosRpcParamNode);
-    UrosRpcParamNode *array3 = urosNew(NULL, UrosRpcParamNode);
+    UrosRpcParamNode *str2 = urosNew(UROS_XMLRPC_HEAP, UrosRpcParamNode);
+    UrosRpcParamNode *array3 = urosNew(UROS_XMLRPC_HEAP, UrosRpcParamNode);
     if (str2 == NULL || array3 == NULL) {
       urosFree(str2); urosFree(array3);
       pp->err = UROS_ERR_NOMEM; goto _error;
@@ -373,7 +517,7 @@ uros_err_t uros_rpcslave_receive_params(UrosRpcParser *pp,
     break;
   }
   case UROS_RPCSM_SHUTDOWN: {
-    UrosRpcParamNode *str2 = urosNew(NULL, UrosRpcParamNode);
+    UrosRpcParamNode *str2 = urosNew(UROS_XMLRPC_HEAP, UrosRpcParamNode);
     if (str2 == NULL) { pp->err = UROS_ERR_NOMEM; goto _error; }
     urosRpcParamNodeObjectInit(str2, UROS_RPCP_STRING);
     urosRpcParamListAppendNode(parlistp, str2);
@@ -423,9 +567,123 @@ uros_err_t uros_rpcslave_xmlmethodcall(UrosRpcParser *pp,
 #undef _CHKOK
 }
 
+uros_err_t uros_rpcslave_businfo_list(UrosRpcStreamer *sp,
+                                      const UrosList *tcplistp,
+                                      const char *dirp) {
+
+  const UrosListNode *curp;
+  const UrosTcpRosStatus *tcpstp;
+
+  urosAssert(sp != NULL);
+  urosAssert(tcplistp != NULL);
+  urosAssert(dirp != NULL);
+#define _CHKOK   { if (sp->err != UROS_OK) { return sp->err; } }
+
+  for (curp = tcplistp->headp; curp != NULL; curp = curp->nextp) {
+    tcpstp = (const UrosTcpRosStatus *)curp->datap;
+    if (tcpstp->topicp == NULL || tcpstp->topicp->flags.service) {
+      continue;
+    }
+
+    /* [int connectionId, str destinationId, str direction, str transport,
+        str topic, bool connected] */
+    uros_rpcslave_value_array_begin(sp); _CHKOK
+    uros_rpcslave_value_int(sp, (int32_t)tcpstp->connId); _CHKOK
+    uros_rpcslave_value_string(sp, tcpstp->callerId.datap,
+                               tcpstp->callerId.length); _CHKOK
+    uros_rpcslave_value_string(sp, dirp, 1); _CHKOK
+    if (tcpstp->udplinkp != NULL) {
+      uros_rpcslave_value_string(sp, "UDPROS", 6); _CHKOK
+    } else if (tcpstp->localTopicp != NULL) {
+      uros_rpcslave_value_string(sp, "INTRAPROCESS", 12); _CHKOK
+    } else {
+      uros_rpcslave_value_string(sp, "TCPROS", 6); _CHKOK
+    }
+    uros_rpcslave_value_string(sp, tcpstp->topicp->name.datap,
+                               tcpstp->topicp->name.length); _CHKOK
+    uros_rpcslave_value_boolean(sp, UROS_TRUE); _CHKOK
+    uros_rpcslave_value_array_end(sp); _CHKOK
+  }
+  return sp->err = UROS_OK;
+#undef _CHKOK
+}
+
+uros_err_t uros_rpcslave_busstats_list(UrosRpcStreamer *sp,
+                                       const UrosList *tcplistp,
+                                       uros_bool_t publishing) {
+
+  const UrosListNode *curp, *nodep;
+  const UrosTcpRosStatus *tcpstp;
+  const UrosTopic *topicp;
+  uint32_t nummsgs;
+
+  urosAssert(sp != NULL);
+  urosAssert(tcplistp != NULL);
+#define _CHKOK   { if (sp->err != UROS_OK) { return sp->err; } }
+
+  /* Group the connections by topic, at the first connection of each one.*/
+  for (curp = tcplistp->headp; curp != NULL; curp = curp->nextp) {
+    topicp = ((const UrosTcpRosStatus *)curp->datap)->topicp;
+    if (topicp == NULL || topicp->flags.service) { continue; }
+    for (nodep = tcplistp->headp; nodep != curp; nodep = nodep->nextp) {
+      if (((const UrosTcpRosStatus *)nodep->datap)->topicp == topicp) {
+        break;
+      }
+    }
+    if (nodep != curp) { continue; }
+
+    /* Publishers: [str topicName, int messageDataSent, pubConnectionData]
+       Subscribers: [str topicName, subConnectionData] */
+    uros_rpcslave_value_array_begin(sp); _CHKOK
+    uros_rpcslave_value_string(sp, topicp->name.datap,
+                               topicp->name.length); _CHKOK
+    if (publishing) {
+      nummsgs = 0;
+      for (nodep = curp; nodep != NULL; nodep = nodep->nextp) {
+        tcpstp = (const UrosTcpRosStatus *)nodep->datap;
+        if (tcpstp->topicp == topicp) {
+          nummsgs += tcpstp->numMsgs;
+        }
+      }
+      uros_rpcslave_value_int(sp, (int32_t)nummsgs); _CHKOK
+    }
+
+    /* Publishers: [int connectionId, int bytesSent, int numSentMessages,
+                    bool connected]
+       Subscribers: [int connectionId, int bytesReceived, int dropEstimate,
+                     bool connected] */
+    uros_rpcslave_value_array_begin(sp); _CHKOK
+    for (nodep = curp; nodep != NULL; nodep = nodep->nextp) {
+      tcpstp = (const UrosTcpRosStatus *)nodep->datap;
+      if (tcpstp->topicp != topicp) { continue; }
+      uros_rpcslave_value_array_begin(sp); _CHKOK
+      uros_rpcslave_value_int(sp, (int32_t)tcpstp->connId); _CHKOK
+      if (publishing) {
+        uros_rpcslave_value_int(
+          sp, (int32_t)urosTcpRosStatusConn(tcpstp)->sentlen); _CHKOK
+        uros_rpcslave_value_int(sp, (int32_t)tcpstp->numMsgs); _CHKOK
+      } else {
+        uros_rpcslave_value_int(
+          sp, (int32_t)urosTcpRosStatusConn(tcpstp)->recvlen); _CHKOK
+        uros_rpcslave_value_int(
+          sp, (tcpstp->udplinkp != NULL)
+              ? (int32_t)tcpstp->udplinkp->numDropped : -1); _CHKOK
+      }
+      uros_rpcslave_value_boolean(sp, UROS_TRUE); _CHKOK
+      uros_rpcslave_value_array_end(sp); _CHKOK
+    }
+    uros_rpcslave_value_array_end(sp); _CHKOK
+    uros_rpcslave_value_array_end(sp); _CHKOK
+  }
+  return sp->err = UROS_OK;
+#undef _CHKOK
+}
+
 uros_err_t uros_rpcslave_method_getbusinfo(UrosRpcStreamer *sp,
                                            UrosRpcParamList *parlistp) {
 
+  static UrosNodeStatus *const stp = &urosNode.status;
+
   (void)parlistp;
 
   urosAssert(sp != NULL);
@@ -441,9 +699,16 @@ uros_err_t uros_rpcslave_method_getbusinfo(UrosRpcStreamer *sp,
   /* str statusMessage */
   uros_rpcslave_value_string(sp, NULL, 0); _CHKOK
 
-  /* FIXME: Fake empty response: [] because stats are too
-   * cumbersome to be tracked.*/
+  /* [businfo*] */
   uros_rpcslave_value_array_begin(sp); _CHKOK
+  urosMutexLock(&stp->pubTcpListLock);
+  uros_rpcslave_businfo_list(sp, &stp->pubTcpList, "o");
+  urosMutexUnlock(&stp->pubTcpListLock);
+  _CHKOK
+  urosMutexLock(&stp->subTcpListLock);
+  uros_rpcslave_businfo_list(sp, &stp->subTcpList, "i");
+  urosMutexUnlock(&stp->subTcpListLock);
+  _CHKOK
   uros_rpcslave_value_array_end(sp); _CHKOK
 
   uros_rpcslave_methodresponse_epilogue(sp); _CHKOK
@@ -454,6 +719,8 @@ uros_err_t uros_rpcslave_method_getbusinfo(UrosRpcStreamer *sp,
 uros_err_t uros_rpcslave_method_getbusstats(UrosRpcStreamer *sp,
                                             UrosRpcParamList *parlistp) {
 
+  static UrosNodeStatus *const stp = &urosNode.status;
+
   (void)parlistp;
 
   urosAssert(sp != NULL);
@@ -469,13 +736,22 @@ uros_err_t uros_rpcslave_method_getbusstats(UrosRpcStreamer *sp,
   /* str statusMessage */
   uros_rpcslave_value_string(sp, NULL, 0); _CHKOK
 
-  /* FIXME: Fake empty response: [[], [], []] because stats are too
-   * cumbersome to be tracked.*/
+  /* [publishStats, subscribeStats, serviceStats] */
   uros_rpcslave_value_array_begin(sp); _CHKOK
   uros_rpcslave_value_array_begin(sp); _CHKOK
+  urosMutexLock(&stp->pubTcpListLock);
+  uros_rpcslave_busstats_list(sp, &stp->pubTcpList, UROS_TRUE);
+  urosMutexUnlock(&stp->pubTcpListLock);
+  _CHKOK
   uros_rpcslave_value_array_end(sp); _CHKOK
   uros_rpcslave_value_array_begin(sp); _CHKOK
+  urosMutexLock(&stp->subTcpListLock);
+  uros_rpcslave_busstats_list(sp, &stp->subTcpList, UROS_FALSE);
+  urosMutexUnlock(&stp->subTcpListLock);
+  _CHKOK
   uros_rpcslave_value_array_end(sp); _CHKOK
+
+  /* Service statistics are not defined by the ROS API yet.*/
   uros_rpcslave_value_array_begin(sp); _CHKOK
   uros_rpcslave_value_array_end(sp); _CHKOK
   uros_rpcslave_value_array_end(sp); _CHKOK
@@ -776,16 +1052,19 @@ uros_err_t uros_rpcslave_method_requesttopic(UrosRpcStreamer *sp,
   static const UrosNodeConfig *const cfgp = &urosNode.config;
   static UrosNodeStatus *const stp = &urosNode.status;
   static const UrosString tcprosstr = { 6, "TCPROS" };
+  static const UrosString udprosstr = { 6, "UDPROS" };
 
   const UrosRpcParamNode *paramnodep;
   const UrosRpcParam *caller_id, *topic, *protocols;
   const UrosRpcParamList *protolistp;
   UrosListNode *topicnodep;
-  uros_bool_t tcpros = UROS_FALSE;
+  uros_bool_t tcpros = UROS_FALSE, udpros = UROS_FALSE;
+  UrosUdpRosLink udpinfo;
+  UrosString udphdr;
 
   urosAssert(sp != NULL);
   urosAssert(parlistp != NULL);
-#define _CHKOK   { if (sp->err != UROS_OK) { return sp->err; } }
+#define _CHKOK   { if (sp->err != UROS_OK) { goto _finally; } }
 
   /* Get parameters and check.*/
   paramnodep = parlistp->headp;
@@ -816,7 +1095,7 @@ uros_err_t uros_rpcslave_method_requesttopic(UrosRpcStreamer *sp,
 
   /* Check if the topic is actually published.*/
   urosMutexLock(&stp->pubTopicListLock);
-  topicnodep = urosTopicListFindByName(&stp->pubTopicList, &topic->value.string);
+  topicnodep = urosListIndexFind(&stp->pubTopicIndex, &topic->value.string);
   urosMutexUnlock(&stp->pubTopicListLock);
   urosError(topicnodep == NULL, return UROS_ERR_BADPARAM,
             ("Topic [%.*s] not found\n", UROS_STRARG(&topic->value.string)));
@@ -848,9 +1127,18 @@ uros_err_t uros_rpcslave_method_requesttopic(UrosRpcStreamer *sp,
       /* "TCPROS" found.*/
       tcpros = UROS_TRUE; break;
     }
+    if (0 == urosStringCmp(namestrp, &udprosstr)) {
+      /* "UDPROS" found, fall back to the next protocols if unusable.*/
+      if (UROS_OK == uros_rpcslave_udpros_link(&topic->value.string,
+                                               childlistp, &udpinfo,
+                                               &udphdr)) {
+        udpros = UROS_TRUE; break;
+      }
+    }
   }
-  urosError(tcpros == UROS_FALSE, UROS_NOP,
-            ("Caller [%.*s] does not support TCPROS for topic [%.*s]\n",
+  urosError(tcpros == UROS_FALSE && udpros == UROS_FALSE, UROS_NOP,
+            ("Caller [%.*s] offered no supported protocol for topic "
+             "[%.*s]\n",
              UROS_STRARG(&caller_id->value.string),
              UROS_STRARG(&topic->value.string)));
 
@@ -868,16 +1156,25 @@ uros_err_t uros_rpcslave_method_requesttopic(UrosRpcStreamer *sp,
   if (tcpros) {
     /* ["TCPROS", node_ip, node_port] */
     uros_rpcslave_value_string(sp, "TCPROS", 6); _CHKOK
-    uros_rpcslave_value_string_ip(sp, cfgp->tcprosAddr.ip);
-    if (sp->err != UROS_OK) {
-      return sp->err;
-    }
+    uros_rpcslave_value_string_ip(sp, cfgp->tcprosAddr.ip); _CHKOK
     uros_rpcslave_value_int(sp, (int32_t)cfgp->tcprosAddr.port);
+  } else if (udpros) {
+    /* ["UDPROS", node_ip, node_port, connection_id, max_datagram_size,
+        header] */
+    uros_rpcslave_value_string(sp, "UDPROS", 6); _CHKOK
+    uros_rpcslave_value_string_ip(sp, cfgp->tcprosAddr.ip); _CHKOK
+    uros_rpcslave_value_int(sp, (int32_t)udpinfo.conn.locaddr.port); _CHKOK
+    uros_rpcslave_value_int(sp, (int32_t)udpinfo.connId); _CHKOK
+    uros_rpcslave_value_int(sp, (int32_t)udpinfo.dgramSize); _CHKOK
+    uros_rpcslave_value_base64(sp, &udphdr); _CHKOK
   }
   uros_rpcslave_value_array_end(sp); _CHKOK
 
   uros_rpcslave_methodresponse_epilogue(sp); _CHKOK
-  return sp->err = UROS_OK;
+  sp->err = UROS_OK;
+_finally:
+  if (udpros) { urosStringClean(&udphdr); }
+  return sp->err;
 #undef _CHKOK
 }
 
@@ -933,11 +1230,42 @@ uros_err_t uros_rpcslave_method_shutdown(UrosRpcStreamer *sp,
 /** @addtogroup rpc_slave_funcs */
 /** @{ */
 
+/**
+ * @brief   Initializes the XMLRPC Slave API server pools.
+ * @details Each XMLRPC Slave API server thread takes its endpoints and its
+ *          buffer from these pools, which hold one block per thread of the
+ *          XMLRPC Slave API thread pool.
+ * @note    Should be called once, at node initialization.
+ */
+void urosRpcSlavePoolsObjectInit(void) {
+
+  urosMemPoolObjectInit(&uros_rpcslave_epspool,
+                        UROS_STACKPOOL_BLKSIZE(sizeof(uros_rpcslave_eps_t)),
+                        NULL);
+  urosMemPoolObjectInit(&uros_rpcslave_bufpool,
+                        UROS_STACKPOOL_BLKSIZE(UROS_MTU_SIZE),
+                        NULL);
+
+  urosMemPoolLoadArray(&uros_rpcslave_epspool, uros_rpcslave_epschunk,
+                       UROS_XMLRPC_SLAVE_POOLSIZE);
+  urosMemPoolLoadArray(&uros_rpcslave_bufpool, uros_rpcslave_bufchunk,
+                       UROS_XMLRPC_SLAVE_POOLSIZE);
+}
+
 /**
  * @brief   Connects to a list of publishers.
  * @details Given the topic name and a list of publishers, tries to connect to
  *          all of them.
  *
+ *          The connections are queued as pending, and as many idle TCPROS
+ *          Client worker threads are started, each resolving and connecting
+ *          to its publisher concurrently. Connections exceeding the idle
+ *          workers are kept pending, and are handled by the first workers
+ *          which finish their job. The @p requestTopic() calls of pending
+ *          remote publishers are issued in advance, back to back, by the
+ *          asynchronous XMLRPC call threads. This function never waits for a
+ *          worker to become free.
+ *
  * @pre     There are no duplicates inside the publishers list.
  * @pre     The publishers exist.
  *
@@ -948,40 +1276,82 @@ uros_err_t uros_rpcslave_method_shutdown(UrosRpcStreamer *sp,
  *          Pointer to a valid list of publisher URIs.
  * @return
  *          Error code.
+ * @retval UROS_ERR_NOMEM
+ *          Not enough memory, or too many pending connections. The
+ *          connections queued so far are started anyway.
  */
 uros_err_t urosRpcSlaveConnectToPublishers(const UrosString *namep,
                                            const UrosList *addrlstp) {
 
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+  static const UrosNodeConfig *const cfgp = &urosNode.config;
+#endif
   static UrosNodeStatus *const stp = &urosNode.status;
   static const uros_topicflags_t flags = {
-    UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE
+    UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE,
+    UROS_FALSE, UROS_FALSE, UROS_FALSE
   };
 
   const UrosListNode *nodep;
+  uros_cnt_t numstarts = 0;
+  uros_err_t err = UROS_OK;
 
   urosAssert(urosStringNotEmpty(namep));
   urosAssert(addrlstp != NULL);
 
-  /* Connect to each publisher.*/
+  /* Queue a pending connection to each publisher.*/
   for (nodep = addrlstp->headp; nodep != NULL; nodep = nodep->nextp) {
-    uros_err_t err;
     uros_tcpcliargs_t *argsp;
+    UrosListNode *pendp;
+    uros_bool_t full;
 
     argsp = urosNew(NULL, uros_tcpcliargs_t);
-    if (argsp == NULL) { return UROS_ERR_NOMEM; }
-    argsp->topicName = urosStringClone(namep);
+    if (argsp == NULL) { err = UROS_ERR_NOMEM; break; }
+    pendp = urosNew(NULL, UrosListNode);
+    if (pendp == NULL) { urosFree(argsp); err = UROS_ERR_NOMEM; break; }
+    argsp->topicName = urosStringIntern(namep);
+    if (argsp->topicName.datap == NULL) {
+      urosFree(argsp); urosFree(pendp); err = UROS_ERR_NOMEM; break;
+    }
     argsp->topicFlags = flags;
     argsp->remoteAddr = *(const UrosAddr *)nodep->datap;
+    argsp->requested = UROS_FALSE;
+    urosListNodeObjectInit(pendp);
+    pendp->datap = (void*)argsp;
+
+    /* Wake an idle TCPROS Client worker thread up, if any.*/
+    urosMutexLock(&stp->tcpcliPendingLock);
+    full = (stp->tcpcliPendingList.length >= UROS_TCPROS_CLIENT_PENDING);
+    if (!full) {
+      /* Workers take from the head, serve publishers in arrival order.*/
+      urosListAppend(&stp->tcpcliPendingList, pendp);
+      if (stp->tcpcliBusyCnt < stp->tcpcliThdPool.size) {
+        ++stp->tcpcliBusyCnt;
+        ++numstarts;
+#if UROS_RPCCALL_ASYNC_THREADS > 0
+      } else if (argsp->remoteAddr.ip.dword != cfgp->xmlrpcAddr.ip.dword ||
+                 argsp->remoteAddr.port != cfgp->xmlrpcAddr.port) {
+        /* Request the topic while waiting for a worker.*/
+        urosTopicSubParamsRequest(argsp);
+#endif
+      }
+    }
+    urosMutexUnlock(&stp->tcpcliPendingLock);
+    urosError(full,
+              { urosListNodeDelete(pendp,
+                                   (uros_delete_f)urosTopicSubParamsDelete);
+                err = UROS_ERR_NOMEM; break; },
+              ("Too many pending connections, dropping publisher "
+               UROS_ADDRFMT" of topic [%.*s]\n",
+               UROS_ADDRARG((const UrosAddr *)nodep->datap),
+               UROS_STRARG(namep)));
+  }
 
-    /* Start the TCPROS Client thread.*/
-    err = urosThreadPoolStartWorker(&stp->tcpcliThdPool, (void*)argsp);
-
-    /* Check if anything went wrong.*/
-    urosError(err != UROS_OK, urosTopicSubParamsDelete(argsp),
-              ("Error %s while connecting to publisher of topic [%.*s]",
-               urosErrorText(err), UROS_STRARG(namep)));
+  /* The selected workers are idle, or about to be, so this is quick.*/
+  while (numstarts-- > 0) {
+    urosThreadPoolStartWorker(&stp->tcpcliThdPool, NULL);
   }
-  return UROS_OK;
+  return err;
 }
 
 /**
@@ -1113,26 +1483,32 @@ uros_err_t urosRpcSlaveListenerThread(void *data) {
  */
 uros_err_t urosRpcSlaveServerThread(UrosConn *csp) {
 
-  union eps {
-    uros_err_t      err;
-    UrosRpcParser   parser;
-    UrosRpcStreamer streamer;
-  } *x;
+  uros_rpcslave_eps_t *x;
   UrosRpcParamList parlist;
   uros_rpcslave_methodid_t methodid = UROS_RPCSM__LENGTH;
+  uros_bool_t streaming = UROS_FALSE;
   char *bufp;
   uros_err_t err;
 
   urosAssert(csp != NULL);
 #define _CHKOK  { if (x->err != UROS_OK) { goto _finally; } }
 
-  x = urosNew(NULL, union eps);
-  if (x == NULL) { return UROS_ERR_NOMEM; }
+  x = (uros_rpcslave_eps_t *)urosMemPoolAlloc(&uros_rpcslave_epspool);
+  if (x == NULL) {
+    urosConnClose(csp);
+    urosFree(csp);
+    return UROS_ERR_NOMEM;
+  }
   urosRpcParamListObjectInit(&parlist);
 
-  /* Create the buffer.*/
-  bufp = (char*)urosAlloc(NULL, UROS_MTU_SIZE);
-  if (bufp == NULL) { return UROS_ERR_NOMEM; }
+  /* Take the buffer.*/
+  bufp = (char*)urosMemPoolAlloc(&uros_rpcslave_bufpool);
+  if (bufp == NULL) {
+    urosMemPoolFree(&uros_rpcslave_epspool, x);
+    urosConnClose(csp);
+    urosFree(csp);
+    return UROS_ERR_NOMEM;
+  }
 
   /* Initialize the parser object.*/
   urosRpcParserObjectInit(&x->parser, csp, bufp, UROS_MTU_SIZE);
@@ -1153,6 +1529,7 @@ uros_err_t urosRpcSlaveServerThread(UrosConn *csp) {
 
   /* Initialize the streamer object.*/
   urosRpcStreamerObjectInit(&x->streamer, csp, bufp, UROS_MTU_SIZE);
+  streaming = UROS_TRUE;
 
   /* Reply to the method call.*/
   switch(methodid) {
@@ -1191,15 +1568,19 @@ uros_err_t urosRpcSlaveServerThread(UrosConn *csp) {
   /* Finalize any output messages.*/
   urosRpcStreamerFlush(&x->streamer); _CHKOK
 
-  /* Dispose the streamer object.*/
-  urosRpcStreamerClean(&x->streamer, UROS_FALSE);
-
 _finally:
-  /* Free any allocated objects.*/
+  /* Dispose the streamer object, along with any enlarged buffer.*/
+  if (streaming) {
+    err = x->err;
+    urosRpcStreamerClean(&x->streamer, UROS_FALSE);
+    x->err = err;
+  }
+
+  /* Free any allocated objects, and recycle the pooled ones.*/
   urosRpcParamListClean(&parlist, UROS_TRUE);
-  urosFree(bufp);
+  urosMemPoolFree(&uros_rpcslave_bufpool, bufp);
   err = x->err;
-  urosFree(x);
+  urosMemPoolFree(&uros_rpcslave_epspool, x);
 
   /* Gentle connection close.*/
   urosConnClose(csp);
@@ -59,6 +59,33 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define urosError(when, action, msgargs) { if (when) { action; } }
 #endif
 
+/*===========================================================================*/
+/* LOCAL FUNCTIONS                                                           */
+/*===========================================================================*/
+
+uros_err_t uros_rpcstreamer_grow(UrosRpcStreamer *sp, size_t minlen) {
+
+  size_t used, newlen;
+  char *newbufp;
+
+  urosAssert(sp != NULL);
+  urosAssert(minlen > sp->buflen);
+
+  /* Double the buffer, keeping the whole message inside it.*/
+  used = sp->buflen - sp->free;
+  newlen = sp->buflen << 1;
+  if (newlen < minlen) { newlen = minlen; }
+  newbufp = (char*)urosAlloc(UROS_XMLRPC_HEAP, newlen);
+  if (newbufp == NULL) { return sp->err = UROS_ERR_NOMEM; }
+  memcpy(newbufp, sp->bufp, used);
+  if (sp->bufp != sp->basebufp) { urosFree(sp->bufp); }
+  sp->bufp = newbufp;
+  sp->buflen = newlen;
+  sp->curp = newbufp + used;
+  sp->free = newlen - used;
+  return sp->err = UROS_OK;
+}
+
 /*===========================================================================*/
 /* GLOBAL FUNCTIONS                                                          */
 /*===========================================================================*/
@@ -96,6 +123,8 @@ void urosRpcStreamerObjectInit(UrosRpcStreamer *sp,
   sp->err = UROS_OK;
   sp->bufp = bufp,
   sp->buflen = buflen;
+  sp->basebufp = bufp;
+  sp->basebuflen = buflen;
   sp->curp = bufp;
   sp->free = buflen;
   sp->total = 0;
@@ -104,8 +133,10 @@ void urosRpcStreamerObjectInit(UrosRpcStreamer *sp,
 
 /**
  * @brief   Cleans a @p UrosRpcStreamer object.
- * @details Resets the state of its internal fields. If needed, the buffer is
- *          deallocated. Does not unlink from the assigned connection.
+ * @details Resets the state of its internal fields. A buffer enlarged to hold
+ *          a whole message is deallocated, restoring the assigned one. If
+ *          needed, the assigned buffer is deallocated too. Does not unlink
+ *          from the assigned connection.
  *
  * @param[in,out] sp
  *          Pointer to an initialized @p UrosRpcStreamer object.
@@ -116,11 +147,20 @@ void urosRpcStreamerClean(UrosRpcStreamer *sp, uros_bool_t freeBuffer) {
 
   urosAssert(sp != NULL);
 
+  /* Restore the assigned buffer.*/
+  if (sp->bufp != sp->basebufp) {
+    urosFree(sp->bufp);
+    sp->bufp = sp->basebufp;
+    sp->buflen = sp->basebuflen;
+  }
+
   if (freeBuffer) {
     /* Free the buffer.*/
     urosFree(sp->bufp);
     sp->bufp = NULL;
     sp->buflen = 0;
+    sp->basebufp = NULL;
+    sp->basebuflen = 0;
   }
 
   /* Initialize fields.*/
@@ -166,6 +206,9 @@ uros_err_t urosRpcStreamerFlush(UrosRpcStreamer *sp) {
  * @details The data chunk is written to the write buffer. Every time it
  *          becomes full, buffered data is flushed. The write counter is
  *          incremented by the chunk length.
+ *          While a <tt>Content-Length</tt> is pending, the buffer is enlarged
+ *          instead, so that the whole message is held until its end.
+ * @see     urosRpcStreamerHttpContentLength()
  *
  * @param[in,out] sp
  *          Pointer to an initialized @p UrosRpcStreamer object.
@@ -186,6 +229,11 @@ uros_err_t urosRpcStreamerWrite(UrosRpcStreamer *sp,
   if (chunklen == 0) {
     return sp->err = UROS_OK;
   }
+  if (sp->mark > 0 && chunklen > sp->free) {
+    /* Hold the message until its Content-Length is known.*/
+    uros_rpcstreamer_grow(sp, sp->buflen - sp->free + chunklen);
+    if (sp->err != UROS_OK) { return sp->err; }
+  }
   while (UROS_TRUE) {
     if (chunklen <= sp->free) {
       /* Chunk completely fits inside the buffer.*/
@@ -414,11 +462,12 @@ uros_err_t urosRpcStreamerHttpEnd(UrosRpcStreamer *sp) {
 }
 
 /**
- * @brief   Writes a hacked <tt>Content-Length</tt> HTTP header.
- * @details Writes the <tt>Content-Length</tt> header, with the value of
- *          @p UROS_RPCSTREAMER_FIXLEN.
- * @see     UROS_RPCSTREAMER_FIXLEN
- * @see     urosRpcStreamerXmlEndHack()
+ * @brief   Begins a <tt>Content-Length</tt> HTTP header.
+ * @details Writes the <tt>Content-Length</tt> header, leaving its value
+ *          pending. The message is then held inside the write buffer, which
+ *          is enlarged as needed, until the value is written by
+ *          @p urosRpcStreamerHttpContentEnd().
+ * @see     urosRpcStreamerHttpContentEnd()
  *
  * @pre     The <tt>Content-Length</tt> HTTP header is the last header.
  *
@@ -432,10 +481,10 @@ uros_err_t urosRpcStreamerHttpContentLength(UrosRpcStreamer *sp) {
   urosAssert(sp != NULL);
 #define _CHKOK   { if (sp->err != UROS_OK) { return sp->err; } }
 
-  /* Fixed Content-Length hack.*/
+  /* The value is inserted at the mark when the body ends. Previous messages
+     may still be buffered, so the mark is an offset inside the buffer.*/
   urosRpcStreamerWrite(sp, "Content-Length: ", 16); _CHKOK
-  sp->mark = sp->total;
-  urosRpcStreamerUint32(sp, UROS_RPCSTREAMER_FIXLEN); _CHKOK
+  sp->mark = sp->buflen - sp->free;
   urosRpcStreamerWrite(sp, "\r\n",  2); _CHKOK
 
   return sp->err = UROS_OK;
@@ -443,67 +492,45 @@ uros_err_t urosRpcStreamerHttpContentLength(UrosRpcStreamer *sp) {
 }
 
 /**
- * @brief   Hacks the XMLRPC message length.
- * @details This function is called to end a XMLRPC message. It behaves in two
- *          ways, depending on the status of the write buffer.
- *          - If the write buffer of the @p UrosRpcStream was flushed since the
- *            beginning of the message, then a sequence of LF (<tt>'\\n'</tt>)
- *            is appended to match the @p UROS_RPCSTREAMER_FIXLEN body length.
- *          - If the write buffer was not flushed, then it is possible to
- *            overwrite the <tt>Content-Length</tt>. It is adjusted so that
- *            it matches the current body length.
- * @see     UROS_RPCSTREAMER_FIXLEN
+ * @brief   Ends the body of an HTTP message.
+ * @details Inserts the exact body length as the pending
+ *          <tt>Content-Length</tt> value. The whole message is then ready to
+ *          be flushed.
  * @see     urosRpcStreamerHttpContentLength()
  *
- * @pre     No XMLRPC message can exceed @p UROS_RPCSTREAMER_FIXLEN.
+ * @pre     The <tt>Content-Length</tt> value is pending.
  *
  * @param[in,out] sp
  *          Pointer to an initialized @p UrosRpcStreamer object.
  * @return
  *          Error code.
  */
-uros_err_t urosRpcStreamerXmlEndHack(UrosRpcStreamer *sp) {
+uros_err_t urosRpcStreamerHttpContentEnd(UrosRpcStreamer *sp) {
 
-  size_t bodylen;
-  const size_t fixlen = strlen(UROS_STRINGIFY2(UROS_RPCSTREAMER_FIXLEN));
+  char *ptr;
+  size_t used, bodylen, numlen, temp;
 
   urosAssert(sp != NULL);
-  urosAssert(sp->total <= UROS_RPCSTREAMER_FIXLEN);
-
-  bodylen = sp->total - (sp->mark + fixlen + (2 + 2));
-  if (sp->total <= sp->buflen) {
-    /* The Content-Length field is still inside the buffer, fix it.*/
-    char *ptr = &sp->bufp[sp->mark];
-    size_t numlen, oldlen, temp, added;
-
-    /* Match the length with the initial whitespace.*/
-    for (temp = bodylen, numlen = 1; temp >= 10; ++numlen, temp /= 10) {}
-    oldlen = numlen;
-    do {
-      added = fixlen - numlen;
-      for (temp = bodylen + added, numlen = 1; temp >= 10; ++numlen, temp /= 10) {}
-    } while (oldlen < numlen);
-    bodylen += added;
-
-    /* Write the actual body length, including HTTP header end and <?xml
-     * beginning.*/
-    urosAssert(numlen <= fixlen);
-    ptr += numlen;
-    memcpy(ptr, "\r\n\r\n<?xml         ", 9 + added);
-    do { *--ptr = (char)(bodylen % 10 + '0'); } while (bodylen /= 10);
-  } else {
-    /* Write trailing spaces up to the fixed length.*/
-    size_t remaining = sp->total - (sp->mark + 4 +   /* 4 are for "\r\n\r\n" */
-                       strlen(UROS_STRINGIFY2(UROS_RPCSTREAMER_FIXLEN)));
-    while (remaining < 16) {
-      urosRpcStreamerWrite(sp, "\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n", 16);
-      remaining -= 16;
-      if (sp->err != UROS_OK) { return sp->err; }
-    }
-    urosRpcStreamerWrite(sp, "\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n",
-                         remaining);
+  urosAssert(sp->mark > 0);
+
+  /* The body follows the "\r\n\r\n" after the pending value.*/
+  used = sp->buflen - sp->free;
+  bodylen = used - (sp->mark + 4);
+  for (temp = bodylen, numlen = 1; temp >= 10; ++numlen, temp /= 10) {}
+  if (numlen > sp->free) {
+    uros_rpcstreamer_grow(sp, sp->buflen + numlen);
     if (sp->err != UROS_OK) { return sp->err; }
   }
+
+  /* Make room for the value, and write it.*/
+  ptr = &sp->bufp[sp->mark];
+  memmove(ptr + numlen, ptr, used - sp->mark);
+  ptr += numlen;
+  do { *--ptr = (char)(bodylen % 10 + '0'); } while (bodylen /= 10);
+  sp->total += numlen;
+  sp->curp += numlen;
+  sp->free -= numlen;
+  sp->mark = 0;
   return sp->err = UROS_OK;
 }
 
@@ -796,7 +823,8 @@ uros_err_t urosRpcStreamerParamValueDouble(UrosRpcStreamer *sp,
 
 /**
  * @brief   Writes the value of a <tt>\<base64\></tt> XMLRPC parameter.
- * @warning Not implemented.
+ * @details The binary chunk is encoded into base64 text, with padding and
+ *          without line breaks. Encoded text is written in small blocks.
  *
  * @param[in,out] sp
  *          Pointer to an initialized @è UrosRpcStreamer object.
@@ -809,14 +837,41 @@ uros_err_t urosRpcStreamerParamValueDouble(UrosRpcStreamer *sp,
 uros_err_t urosRpcStreamerParamValueBase64(UrosRpcStreamer *sp,
                                            const UrosRpcParam *paramp) {
 
-  (void)paramp;
+  static const char b64chars[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  const uint8_t *curp;
+  size_t left, buflen;
+  uint32_t triple;
+  char buf[64];
 
   urosAssert(sp != NULL);
   urosAssert(paramp->pclass == UROS_RPCP_BASE64);
 #define _CHKOK   { if (sp->err != UROS_OK) { return sp->err; } }
 
-  /* TODO: Stream a binary chunk into base64 text.*/
-  urosError(UROS_TRUE, UROS_NOP, ("XMLRPC base64 values not supported\n"));
+  curp = (const uint8_t *)paramp->value.base64.datap;
+  left = paramp->value.base64.length;
+  urosAssert(!(left > 0 && curp == NULL));
+  buflen = 0;
+  while (left > 0) {
+    /* Encode the next (possibly partial) 3-byte group.*/
+    triple = (uint32_t)curp[0] << 16;
+    if (left > 1) { triple |= (uint32_t)curp[1] << 8; }
+    if (left > 2) { triple |= (uint32_t)curp[2]; }
+    buf[buflen++] = b64chars[(triple >> 18) & 0x3F];
+    buf[buflen++] = b64chars[(triple >> 12) & 0x3F];
+    buf[buflen++] = (left > 1) ? b64chars[(triple >> 6) & 0x3F] : '=';
+    buf[buflen++] = (left > 2) ? b64chars[triple & 0x3F] : '=';
+    if (left <= 3) { break; }
+    curp += 3; left -= 3;
+
+    if (buflen == sizeof(buf)) {
+      urosRpcStreamerWrite(sp, buf, buflen); _CHKOK
+      buflen = 0;
+    }
+  }
+  if (buflen > 0) {
+    urosRpcStreamerWrite(sp, buf, buflen); _CHKOK
+  }
 
   return sp->err = UROS_OK;
 #undef _CHKOK
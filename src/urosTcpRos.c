@@ -42,7 +42,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../include/urosBase.h"
 #include "../include/urosUser.h"
 #include "../include/urosTcpRos.h"
+#include "../include/urosUdpRos.h"
 #include "../include/urosNode.h"
+#include "../include/lld/uros_lld_reactor.h"
 
 #include <string.h>
 
@@ -60,6 +62,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define urosError(when, action, msgargs) { if (when) { action; } }
 #endif
 
+/** @brief Maximum number of chunks of a TCPROS handshake header.*/
+#define UROS_TCPROS_HDRCHUNKS   32
+
+/** @brief Maximum number of fields of a TCPROS handshake header.*/
+#define UROS_TCPROS_HDRFIELDS   8
+
 /*===========================================================================*/
 /* LOCAL VARIABLES                                                           */
 /*===========================================================================*/
@@ -87,14 +95,33 @@ static const UrosTopic dummytopic = {
   { 0, NULL },
   &dummytype,
   NULL,
-  { UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE },
+  NULL,
+  NULL,
+  { UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE, UROS_FALSE,
+    UROS_FALSE, UROS_FALSE, UROS_FALSE },
+  NULL,
   0
 };
 
+/** @brief Last TCPROS connection ID, protected by the node state lock.*/
+static uint32_t uros_tcpros_lastconnid = 0;
+
 /*===========================================================================*/
 /* LOCAL FUNCTIONS                                                           */
 /*===========================================================================*/
 
+uint32_t uros_tcpros_newconnid(void) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  uint32_t connid;
+
+  urosMutexLock(&stp->stateLock);
+  connid = ++uros_tcpros_lastconnid;
+  urosMutexUnlock(&stp->stateLock);
+  return connid;
+}
+
 uros_err_t uros_tcpserver_processtopicheader(UrosTcpRosStatus *tcpstp) {
 
   static UrosNodeStatus *const stp = &urosNode.status;
@@ -112,8 +139,7 @@ uros_err_t uros_tcpserver_processtopicheader(UrosTcpRosStatus *tcpstp) {
   tcpstp->topicp = NULL;
 
   /* Check if the topic is actually published.*/
-  topicnodep = urosTopicListFindByName(&stp->pubTopicList,
-                                       &topicp->name);
+  topicnodep = urosListIndexFind(&stp->pubTopicIndex, &topicp->name);
   if (topicnodep != NULL) {
     urosTopicRefInc((UrosTopic*)topicnodep->datap);
   }
@@ -125,12 +151,12 @@ uros_err_t uros_tcpserver_processtopicheader(UrosTcpRosStatus *tcpstp) {
 
   /* Check whether the client is probing the type.*/
   if (0 != urosStringCmp(&topicp->typep->name, &asteriskstr)) {
-    urosError(0 != urosStringCmp(&topicp->typep->name, &reftypep->name),
+    urosError(!urosStringIsSame(&topicp->typep->name, &reftypep->name),
               { tcpstp->err = UROS_ERR_BADPARAM; goto _finally; },
               ("Found type [%.*s], expected [%.*s]\n",
                UROS_STRARG(&topicp->typep->name),
                UROS_STRARG(&reftypep->name)));
-    urosError(0 != urosStringCmp(&topicp->typep->md5str, &reftypep->md5str),
+    urosError(!urosStringIsSame(&topicp->typep->md5str, &reftypep->md5str),
               { tcpstp->err = UROS_ERR_BADPARAM; goto _finally; },
               ("Found MD5 [%.*s], expected [%.*s]\n",
                UROS_STRARG(&topicp->typep->md5str),
@@ -143,6 +169,7 @@ uros_err_t uros_tcpserver_processtopicheader(UrosTcpRosStatus *tcpstp) {
   if (tcpnodep == NULL) { tcpstp->err = UROS_ERR_NOMEM; goto _finally; }
   tcpnodep->datap = tcpstp;
   tcpnodep->nextp = NULL;
+  tcpstp->connId = uros_tcpros_newconnid();
   urosMutexLock(&stp->pubTcpListLock);
   urosListAdd(&stp->pubTcpList, tcpnodep);
   urosMutexUnlock(&stp->pubTcpListLock);
@@ -174,8 +201,7 @@ uros_err_t uros_tcpserver_processserviceheader(UrosTcpRosStatus *tcpstp) {
   tcpstp->topicp = NULL;
 
   /* Check if the topic is actually published.*/
-  servicenodep = urosTopicListFindByName(&stp->pubServiceList,
-                                         &servicep->name);
+  servicenodep = urosListIndexFind(&stp->pubServiceIndex, &servicep->name);
   if (servicenodep != NULL) {
     urosTopicRefInc((UrosTopic*)servicenodep->datap);
   }
@@ -185,7 +211,7 @@ uros_err_t uros_tcpserver_processserviceheader(UrosTcpRosStatus *tcpstp) {
             ("Service [%.*s] not found\n", UROS_STRARG(&servicep->name)));
   reftypep = ((const UrosTopic *)servicenodep->datap)->typep;
   if (servicep->typep->name.length > 0) {
-    urosError(0 != urosStringCmp(&servicep->typep->name, &reftypep->name),
+    urosError(!urosStringIsSame(&servicep->typep->name, &reftypep->name),
               { tcpstp->err = UROS_ERR_BADPARAM; goto _finally; },
               ("Found type [%.*s], expected [%.*s]\n",
                UROS_STRARG(&servicep->typep->name),
@@ -193,7 +219,8 @@ uros_err_t uros_tcpserver_processserviceheader(UrosTcpRosStatus *tcpstp) {
   }
   if (servicep->typep->md5str.length > 1 &&
       servicep->typep->md5str.datap[0] != '*') {
-    urosError(0 != urosStringCmp(&servicep->typep->md5str, &reftypep->md5str),
+    urosError(!urosStringIsSame(&servicep->typep->md5str,
+                                &reftypep->md5str),
               { tcpstp->err = UROS_ERR_BADPARAM; goto _finally; },
               ("Found MD5 [%.*s], expected [%.*s]\n",
                UROS_STRARG(&servicep->typep->md5str),
@@ -206,6 +233,7 @@ uros_err_t uros_tcpserver_processserviceheader(UrosTcpRosStatus *tcpstp) {
   if (tcpnodep == NULL) { tcpstp->err = UROS_ERR_NOMEM; goto _finally; }
   tcpnodep->datap = tcpstp;
   tcpnodep->nextp = NULL;
+  tcpstp->connId = uros_tcpros_newconnid();
   urosMutexLock(&stp->pubTcpListLock);
   urosListAdd(&stp->pubTcpList, tcpnodep);
   urosMutexUnlock(&stp->pubTcpListLock);
@@ -219,233 +247,1112 @@ _finally:
   return tcpstp->err;
 }
 
-uros_err_t uros_tcpcli_topicsubscription(const UrosString *namep,
-                                         const UrosAddr *pubaddrp) {
+void uros_tcpserver_linkremove(UrosTcpRosStatus *tcpstp) {
 
   static UrosNodeStatus *const stp = &urosNode.status;
 
-  uros_err_t err;
-  UrosConn conn;
-  UrosTcpRosStatus tcpst;
-  UrosListNode *topicnodep;
+  UrosListNode *tcpnodep;
 
-  urosAssert(urosStringNotEmpty(namep));
-  urosAssert(pubaddrp != NULL);
-#define _CHKOK  { if (err != UROS_OK) { goto _error; } }
+  urosAssert(tcpstp != NULL);
 
-  /* Get topic features.*/
-  urosTcpRosStatusObjectInit(&tcpst, &conn);
-  urosMutexLock(&stp->subTopicListLock);
-  topicnodep = urosTopicListFindByName(&stp->subTopicList,
-                                       namep);
-  if (topicnodep != NULL) {
-    tcpst.topicp = (UrosTopic*)topicnodep->datap;
-    urosTopicRefInc(tcpst.topicp);
+  /* Remove this connection from the active publisher connections list.*/
+  urosMutexLock(&stp->pubTcpListLock);
+  for (tcpnodep = stp->pubTcpList.headp;
+       tcpnodep != NULL;
+       tcpnodep = tcpnodep->nextp) {
+    if (tcpnodep->datap == (void*)tcpstp) {
+      urosListRemove(&stp->pubTcpList, tcpnodep);
+      break;
+    }
   }
-  urosMutexUnlock(&stp->subTopicListLock);
-  urosError(topicnodep == NULL, return UROS_ERR_BADPARAM,
-            ("Topic [%.*s] not found\n", UROS_STRARG(namep)));
-
-  /* Connect to the publisher.*/
-  urosConnObjectInit(&conn);
-  urosConnCreate(&conn, UROS_PROTO_TCP);
-  err = urosConnConnect(&conn, pubaddrp);
-  urosError(err != UROS_OK, goto _error,
-            ("Error %s while connecting to "UROS_ADDRFMT"\n",
-             urosErrorText(err), UROS_ADDRARG(pubaddrp)));
-
-  /* Set timeouts for the spawned connection.*/
-  err = urosConnSetRecvTimeout(&conn, UROS_TCPROS_RECVTIMEOUT);
-  urosAssert(err == UROS_OK);
-  err = urosConnSetSendTimeout(&conn, UROS_TCPROS_SENDTIMEOUT);
-  urosAssert(err == UROS_OK);
-
-  /* Send the TCPROS conenction header.*/
-  err = urosTcpRosSendHeader(&tcpst, UROS_TRUE); _CHKOK
+  urosMutexUnlock(&stp->pubTcpListLock);
+  urosListNodeDelete(tcpnodep, NULL);
+}
 
-  /* Receive the TCPROS connection header.*/
-  err = urosTcpRosRecvHeader(&tcpst, UROS_FALSE, UROS_FALSE); _CHKOK
+void uros_tcpcli_linkadd(UrosTcpRosStatus *tcpstp) {
 
-  /* Handle the incoming published stream, if not probing.*/
-  tcpst.err = UROS_OK;
-  urosAssert(tcpst.topicp->procf != NULL);
-  if (!tcpst.topicp->flags.probe) {
-    err = tcpst.topicp->procf(&tcpst);
-  }
+  static UrosNodeStatus *const stp = &urosNode.status;
 
-  /* Release the topic/service descriptor reference.*/
-  urosTcpRosTopicSubscriberDone(&tcpst);
+  UrosListNode *tcpnodep;
 
-  urosError(err != UROS_OK, goto _error,
-            ("Topic [%.*s] client handler returned %s\n",
-             UROS_STRARG(namep), urosErrorText(err)));
-  return urosConnClose(&conn);
+  urosAssert(tcpstp != NULL);
 
-_error:
-  urosConnClose(&conn);
-  return err;
-#undef _CHKOK
+  /* Add this connection to the active subscriber connections list.*/
+  tcpnodep = urosNew(NULL, UrosListNode);
+  if (tcpnodep == NULL) { return; }
+  urosListNodeObjectInit(tcpnodep);
+  tcpnodep->datap = tcpstp;
+  tcpstp->connId = uros_tcpros_newconnid();
+  urosMutexLock(&stp->subTcpListLock);
+  urosListAdd(&stp->subTcpList, tcpnodep);
+  urosMutexUnlock(&stp->subTcpListLock);
 }
 
-/*===========================================================================*/
-/* GLOBAL FUNCTIONS                                                          */
-/*===========================================================================*/
+void uros_tcpcli_linkremove(UrosTcpRosStatus *tcpstp) {
 
-/** @addtogroup tcpros_funcs */
-/** @{ */
+  static UrosNodeStatus *const stp = &urosNode.status;
 
-/**
- * @brief   Deletes topic subscription parameters.
- * @details Deallocates the memory chunk of the string data, and the object
- *          itself.
- * @see     urosFree()
- *
- * @pre     The parameters must have been allocated with @p urosAlloc().
- * @pre     The parameter data must have been allocated with @p urosAlloc().
- * @post    @p parp points to an invalid address.
- *
- * @param[in] parp
- *          Pointer to an allocated @p uros_tcpcliargs_t object.
- */
-void urosTopicSubParamsDelete(uros_tcpcliargs_t *parp) {
+  UrosListNode *tcpnodep;
 
-  if (parp != NULL) {
-    urosStringClean(&parp->topicName);
-    urosFree(parp);
+  urosAssert(tcpstp != NULL);
+
+  /* Remove this connection from the active subscriber connections list.*/
+  urosMutexLock(&stp->subTcpListLock);
+  for (tcpnodep = stp->subTcpList.headp;
+       tcpnodep != NULL;
+       tcpnodep = tcpnodep->nextp) {
+    if (tcpnodep->datap == (void*)tcpstp) {
+      urosListRemove(&stp->subTcpList, tcpnodep);
+      break;
+    }
   }
+  urosMutexUnlock(&stp->subTcpListLock);
+  urosListNodeDelete(tcpnodep, NULL);
 }
 
-/**
- * @brief   Initializes a TCPROS status record.
- *
- * @pre     The record is not initialized.
- * @post    The record is initialized.
- *
- * @param[in,out] tcpstp
- *          Pointer to an allocated @p UrosTcpRosStatus object.
- * @param[in] csp
- *          Pointer to an allocated connection.
- */
-void urosTcpRosStatusObjectInit(UrosTcpRosStatus *tcpstp, UrosConn *csp) {
+uros_cnt_t uros_tcpros_headerchunks(const UrosTcpRosStatus *tcpstp,
+                                    uros_bool_t isrequest,
+                                    UrosIoVec *iov, uint8_t *lengths) {
+
+  uint32_t hdrlen = 0;
+  const UrosString *calleridstrp, *namestrp, *typestrp, *md5strp;
+  uint8_t *lengthp = lengths;
+  uros_cnt_t count = 0;
 
   urosAssert(tcpstp != NULL);
-  urosAssert(csp != NULL);
+  urosAssert(tcpstp->topicp != NULL);
+  urosAssert(tcpstp->topicp->typep != NULL);
 
-  memset(tcpstp, 0, sizeof(UrosTcpRosStatus));
-  tcpstp->csp = csp;
+#define _CHUNK(chunkp, chunklen) { \
+  urosAssert(count < UROS_TCPROS_HDRCHUNKS); \
+  iov[count].bufp = (chunkp); \
+  iov[count].buflen = (chunklen); \
+  ++count; }
 
-  /* Initialize the thread exit request mutex.*/
-  urosMutexObjectInit(&tcpstp->threadExitMtx);
+#define _LENGTH(value) { \
+  urosAssert(lengthp < lengths + UROS_TCPROS_HDRFIELDS * sizeof(uint32_t)); \
+  hdrlen = (uint32_t)(value); \
+  _CHUNK(lengthp, sizeof(uint32_t)); \
+  lengthp = urosTcpRosPutRaw(lengthp, hdrlen); }
 
-  tcpstp->err = UROS_OK;
-}
+#define _FIELDSTRING(namep, valuep) { \
+  urosAssert(urosStringNotEmpty(namep)); \
+  urosAssert(valuep != NULL); \
+  _LENGTH((namep)->length + 1 + (valuep)->length); \
+  _CHUNK((namep)->datap, (namep)->length); \
+  _CHUNK("=", 1); \
+  _CHUNK((valuep)->datap, (valuep)->length); }
 
-/**
- * @brief   Cleans a TCPROS status record.
- * @details Invalidates the private members. Optionally, deallocates their data.
- *
- * @pre     The record is initialized.
- * @post    @p tcpstp points to an uninitialized @p UrosTcpRosStatus object.
- * @post    If desidred so, private members are deallocated. They must have
- *          been allocated with @p urosAlloc().
- *
- * @param[in,out] tcpstp
- *          Pointer to an initialized @p UrosTcpRosStatus object.
- * @param[in] deep
- *          Performs deallocation of private members.
- */
-void urosTcpRosStatusClean(UrosTcpRosStatus *tcpstp, uros_bool_t deep) {
+#define _FIELDBOOL(namep, value) { \
+  urosAssert(urosStringNotEmpty(namep)); \
+  _LENGTH((namep)->length + 2); \
+  _CHUNK((namep)->datap, (namep)->length); \
+  _CHUNK((value) ? "=1" : "=0", 2); }
 
-  urosAssert(tcpstp != NULL);
+  calleridstrp = &urosNode.config.nodeName;
+  typestrp = &tcpstp->topicp->typep->name;
+  md5strp = &tcpstp->topicp->typep->md5str;
 
-  if (deep) {
-    urosFree(tcpstp->csp);
-    urosStringClean(&tcpstp->callerId);
-    urosStringClean(&tcpstp->errstr);
+  hdrlen += (uint32_t)(5 + calleridfield.length + calleridstrp->length);
+  hdrlen += (uint32_t)(5 + md5field.length + md5strp->length);
+  hdrlen += (uint32_t)(5 + typefield.length + typestrp->length);
+  if (tcpstp->topicp->flags.service) {
+    hdrlen += (uint32_t)(12 + reqtypefield.length + typestrp->length);
+    hdrlen += (uint32_t)(13 + restypefield.length + typestrp->length);
+  }
+  if (isrequest) {
+    namestrp = &tcpstp->topicp->name;
+    if (tcpstp->topicp->flags.service) {
+      hdrlen += (uint32_t)(5 + servicefield.length + namestrp->length);
+      hdrlen += (uint32_t)(6 + persistentfield.length);
+    } else {
+      hdrlen += (uint32_t)(5 + topicfield.length + namestrp->length);
+      hdrlen += (uint32_t)(6 + tcpnodelayfield.length);
+    }
+  } else {
+    namestrp = NULL;
+    if (!tcpstp->topicp->flags.service) {
+      hdrlen += (uint32_t)(6 + latchingfield.length);
+    }
   }
-  memset(tcpstp, 0, sizeof(UrosTcpRosStatus));
-}
 
-/**
- * @brief   Deallocates a TCPROS status record.
- * @details Invalidates the private members. Optionally, deallocates their data.
- *
- * @pre     The record is initialized.
- * @post    @p tcpstp points to an invalid address.
- * @post    If desidred so, private members are deallocated. They must have
- *          been allocated with @p urosAlloc().
- *
- * @param[in,out] tcpstp
- *          Pointer to an initialized @p UrosTcpRosStatus object.
- * @param[in] deep
- *          Performs deallocation of private members.
- */
-void urosTcpRosStatusDelete(UrosTcpRosStatus *tcpstp, uros_bool_t deep) {
+  /* uint32 header_length */
+  _LENGTH(hdrlen);
 
-  if (tcpstp != NULL) {
-    urosTcpRosStatusClean(tcpstp, deep);
-    urosFree(tcpstp);
+  /* uint32 field_length, callerid={str} */
+  _FIELDSTRING(&calleridfield, calleridstrp);
+
+  if (isrequest) {
+    if (tcpstp->topicp->flags.service) {
+      /* uint32 field_length, service={str} */
+      _FIELDSTRING(&servicefield, namestrp);
+    } else {
+      /* uint32 field_length, topic={str} */
+      _FIELDSTRING(&topicfield, namestrp);
+    }
   }
-}
 
-/**
- * @brief   Raises the exit flag.
- * @details Sets the @p exitFlag to @p true, so that the user handler will exit
- *          the loop and therefore the TCPROS worker thread can exit.
- *
- * @param[in,out] tcpstp
- *          Pointer to an initialized @p UrosTcpRosStatus object.
- */
-void urosTcpRosStatusIssueExit(UrosTcpRosStatus *tcpstp) {
+  /* uint32 field_length, md5sum={str} */
+  _FIELDSTRING(&md5field, md5strp);
 
-  urosAssert(tcpstp != NULL);
+  if (tcpstp->topicp->flags.service) {
+    /* uint32 field_length, request_type={str} */
+    _LENGTH(8 + reqtypefield.length + typestrp->length);
+    _CHUNK(reqtypefield.datap, reqtypefield.length);
+    _CHUNK("=", 1);
+    _CHUNK(typestrp->datap, typestrp->length);
+    _CHUNK("Request", 7);
 
-  urosMutexLock(&tcpstp->threadExitMtx);
-  tcpstp->threadExit = UROS_TRUE;
-  urosMutexUnlock(&tcpstp->threadExitMtx);
+    /* uint32 field_length, response_type={str} */
+    _LENGTH(9 + restypefield.length + typestrp->length);
+    _CHUNK(restypefield.datap, restypefield.length);
+    _CHUNK("=", 1);
+    _CHUNK(typestrp->datap, typestrp->length);
+    _CHUNK("Response", 8);
+  }
+
+  /* uint32 field_length, type={str} */
+  _FIELDSTRING(&typefield, typestrp);
+
+  if (isrequest) {
+    if (tcpstp->topicp->flags.service) {
+      /* uint32 field_length, persistent=(0|1) */
+      _FIELDBOOL(&persistentfield, tcpstp->topicp->flags.persistent);
+    } else {
+      /* uint32 field_length, tcp_nodelay=(0|1) */
+      _FIELDBOOL(&tcpnodelayfield, tcpstp->topicp->flags.noDelay);
+    }
+  } else {
+    if (!tcpstp->topicp->flags.service) {
+      /* uint32 field_length, latching=(0|1) */
+      _FIELDBOOL(&latchingfield, tcpstp->topicp->flags.latching);
+    }
+  }
+
+  return count;
+#undef _CHUNK
+#undef _LENGTH
+#undef _FIELDSTRING
+#undef _FIELDBOOL
 }
 
-/**
- * @brief   Checks if the exit flag is raised.
- *
- * @param[in] tcpstp
- *          Pointer to an initialized @p UrosTcpRosStatus object.
- * @return
- *          Exit flag status.
- */
-uros_bool_t urosTcpRosStatusCheckExit(UrosTcpRosStatus *tcpstp) {
+void uros_tcpframe_serialize(UrosTcpRosFrame *framep) {
 
-  uros_bool_t flag;
+  /* Serialize the shared message, once for all the connections.*/
+  if (framep->serializef != NULL) {
+    framep->serializef(urosTcpRosFrameData(framep) + sizeof(uint32_t),
+                       framep->msgp);
+    framep->serializef = NULL;
+  }
+}
 
-  urosAssert(tcpstp != NULL);
+static UrosTcpRosFrame *uros_tcpfanout_next(UrosTcpRosFanout *fop,
+                                            UrosTcpRosStatus *tcpstp) {
 
-  urosMutexLock(&tcpstp->threadExitMtx);
-  flag = tcpstp->threadExit;
-  urosMutexUnlock(&tcpstp->threadExitMtx);
-  return flag;
+  UrosTcpRosFrame *framep;
+
+  /* Skip the frames which were already replaced.*/
+  if (fop->headSeq - tcpstp->fanoutSeq > UROS_TCPROS_FANOUT_LENGTH) {
+    fop->numDropped += fop->headSeq - tcpstp->fanoutSeq -
+                       UROS_TCPROS_FANOUT_LENGTH;
+    tcpstp->fanoutSeq = fop->headSeq - UROS_TCPROS_FANOUT_LENGTH;
+  }
+  framep = fop->frames[tcpstp->fanoutSeq % UROS_TCPROS_FANOUT_LENGTH];
+  ++framep->refcnt;
+  uros_tcpframe_serialize(framep);
+  return framep;
 }
 
-/**
- * @brief   Initializes a TCPROS array descriptor.
- * @details The array is initialized as empty.
- *
- * @pre     The array is not initialized.
- * @post    The array is empty.
- *
- * @param[in,out] arrayp
- *          Pointer to an allocated @p UrosTcpRosArray object.
- */
-void urosTcpRosArrayObjectInit(UrosTcpRosArray *arrayp) {
+static void uros_tcpfanout_notify(UrosTcpRosFanout *fop) {
 
-  urosAssert(arrayp != NULL);
+#if UROS_TCPROS_USE_REACTOR
+  const UrosListNode *nodep;
+  UrosTcpRosStatus *tcpstp;
 
-  arrayp->length = 0;
-  arrayp->entriesp = NULL;
+  /* Reactor readers do not wait on the ring, poll them for writing.*/
+  for (nodep = fop->readerList.headp; nodep != NULL; nodep = nodep->nextp) {
+    tcpstp = (UrosTcpRosStatus*)nodep->datap;
+    if (tcpstp->reactorp != NULL) {
+      uros_lld_reactor_wantsend(tcpstp, UROS_TRUE);
+    }
+  }
+#else
+  (void)fop;
+#endif
 }
 
-/**
- * @brief   Cleans a TCPROS array.
- * @details Invalidates the private members, and deallocates their data.
+static uros_err_t uros_tcpfanout_send(UrosTcpRosStatus *tcpstp,
+                                      const UrosTcpRosFrame *framep) {
+
+  size_t start;
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(framep != NULL);
+
+  start = tcpstp->csp->sentlen;
+  while (urosTcpRosSend(tcpstp, urosTcpRosFrameData(framep),
+                        framep->length) != UROS_OK) {
+    if (tcpstp->err != UROS_ERR_TIMEOUT ||
+        tcpstp->csp->sentlen != start ||
+        urosTcpRosStatusCheckExit(tcpstp)) {
+      return tcpstp->err;
+    }
+  }
+  ++tcpstp->numMsgs;
+  return tcpstp->err;
+}
+
+static uint32_t uros_tcpfanout_maxlag(const UrosTcpRosFanout *fop) {
+
+  const UrosListNode *nodep;
+  uint32_t lag, maxlag = 0;
+
+  for (nodep = fop->readerList.headp; nodep != NULL; nodep = nodep->nextp) {
+    lag = fop->headSeq - ((const UrosTcpRosStatus*)nodep->datap)->fanoutSeq;
+    if (lag > maxlag) { maxlag = lag; }
+  }
+  return maxlag;
+}
+
+void uros_tcplocal_release(UrosTcpRosStatus *tcpstp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  UrosTcpRosFanout *fop = tcpstp->localTopicp->fanoutp;
+  UrosListNode *readernodep;
+
+  /* Unregister the reader, releasing its current frame.*/
+  urosMutexLock(&fop->lock);
+  if (tcpstp->localFramep != NULL) {
+    urosTcpRosFrameRelease(tcpstp->localFramep);
+    tcpstp->localFramep = NULL;
+  }
+  for (readernodep = fop->readerList.headp;
+       readernodep != NULL;
+       readernodep = readernodep->nextp) {
+    if (readernodep->datap == (void*)tcpstp) {
+      urosListRemove(&fop->readerList, readernodep);
+      break;
+    }
+  }
+  urosCondVarBroadcast(&fop->drainedCond);
+  urosMutexUnlock(&fop->lock);
+  urosListNodeDelete(readernodep, NULL);
+
+  /* Release the published topic.*/
+  urosMutexLock(&stp->pubTopicListLock);
+  if (0 == urosTopicRefDec(tcpstp->localTopicp) &&
+      tcpstp->localTopicp->flags.deleted) {
+    urosTopicDelete(tcpstp->localTopicp);
+  }
+  urosMutexUnlock(&stp->pubTopicListLock);
+  tcpstp->localTopicp = NULL;
+}
+
+uros_err_t uros_tcplocal_attach(UrosTcpRosStatus *tcpstp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  UrosTopic *pubtopicp = NULL;
+  const UrosListNode *topicnodep;
+  UrosListNode *readernodep;
+  UrosTcpRosFanout *fop;
+
+  /* Only topics fed by urosNodePublish*() share their frames.*/
+  urosMutexLock(&stp->pubTopicListLock);
+  topicnodep = urosListIndexFind(&stp->pubTopicIndex, &tcpstp->topicp->name);
+  if (topicnodep != NULL) {
+    pubtopicp = (UrosTopic*)topicnodep->datap;
+    if (pubtopicp->procf == (uros_proc_f)urosTcpRosFanoutDrain &&
+        pubtopicp->typep == tcpstp->topicp->typep) {
+      urosTopicRefInc(pubtopicp);
+    } else {
+      pubtopicp = NULL;
+    }
+  }
+  urosMutexUnlock(&stp->pubTopicListLock);
+  if (pubtopicp == NULL) { return UROS_ERR_NOTIMPL; }
+
+  readernodep = urosNew(NULL, UrosListNode);
+  if (readernodep == NULL) {
+    urosMutexLock(&stp->pubTopicListLock);
+    urosTopicRefDec(pubtopicp);
+    urosMutexUnlock(&stp->pubTopicListLock);
+    return UROS_ERR_NOMEM;
+  }
+  urosListNodeObjectInit(readernodep);
+  readernodep->datap = tcpstp;
+
+  /* Register as a reader, starting from the latched frame, if any.*/
+  fop = pubtopicp->fanoutp;
+  urosMutexLock(&fop->lock);
+  tcpstp->fanoutSeq = fop->headSeq;
+  if (pubtopicp->flags.latching && fop->headSeq > 0) {
+    --tcpstp->fanoutSeq;
+  }
+  urosListAdd(&fop->readerList, readernodep);
+  urosMutexUnlock(&fop->lock);
+  tcpstp->localTopicp = pubtopicp;
+  tcpstp->localFramep = NULL;
+  tcpstp->localOffset = 0;
+  return UROS_OK;
+}
+
+uros_err_t uros_tcplocal_next(UrosTcpRosStatus *tcpstp,
+                              uros_bool_t serialize) {
+
+  UrosTcpRosFanout *fop = tcpstp->localTopicp->fanoutp;
+
+  urosMutexLock(&fop->lock);
+  if (tcpstp->localFramep != NULL) {
+    /* Done with the current frame.*/
+    urosTcpRosFrameRelease(tcpstp->localFramep);
+    tcpstp->localFramep = NULL;
+    ++tcpstp->fanoutSeq;
+    urosCondVarBroadcast(&fop->drainedCond);
+  }
+  while (tcpstp->fanoutSeq == fop->headSeq && !fop->closed &&
+         !urosTcpRosStatusCheckExit(tcpstp)) {
+    urosCondVarWait(&fop->pushedCond, &fop->lock);
+  }
+  if (fop->closed || urosTcpRosStatusCheckExit(tcpstp)) {
+    urosMutexUnlock(&fop->lock);
+    return tcpstp->err = UROS_ERR_EOF;
+  }
+
+  /* Skip the frames which were already replaced.*/
+  if (fop->headSeq - tcpstp->fanoutSeq > UROS_TCPROS_FANOUT_LENGTH) {
+    fop->numDropped += fop->headSeq - tcpstp->fanoutSeq -
+                       UROS_TCPROS_FANOUT_LENGTH;
+    tcpstp->fanoutSeq = fop->headSeq - UROS_TCPROS_FANOUT_LENGTH;
+  }
+  tcpstp->localFramep = fop->frames[tcpstp->fanoutSeq %
+                                    UROS_TCPROS_FANOUT_LENGTH];
+  ++tcpstp->localFramep->refcnt;
+  if (serialize) {
+    uros_tcpframe_serialize(tcpstp->localFramep);
+  }
+  tcpstp->localOffset = 0;
+  urosMutexUnlock(&fop->lock);
+  return tcpstp->err = UROS_OK;
+}
+
+uros_err_t uros_tcplocal_recv(UrosTcpRosStatus *tcpstp,
+                              void **bufpp, size_t *buflenp) {
+
+  size_t pending;
+
+  /* Read the shared frames in place.*/
+  if (tcpstp->localFramep == NULL ||
+      tcpstp->localOffset >= tcpstp->localFramep->length) {
+    if (uros_tcplocal_next(tcpstp, UROS_TRUE) != UROS_OK) {
+      return tcpstp->err;
+    }
+  }
+  pending = tcpstp->localFramep->length - tcpstp->localOffset;
+  if (*buflenp > pending) { *buflenp = pending; }
+  *bufpp = urosTcpRosFrameData(tcpstp->localFramep) + tcpstp->localOffset;
+  tcpstp->localOffset += *buflenp;
+  tcpstp->csp->recvlen += *buflenp;
+  return UROS_OK;
+}
+
+uros_err_t uros_tcplocal_frames(UrosTcpRosStatus *tcpstp) {
+
+  const uint8_t *datap;
+
+  /* Hand each shared frame to the frame handler, as a reactor would do.*/
+  while (uros_tcplocal_next(tcpstp, UROS_TRUE) == UROS_OK) {
+    datap = urosTcpRosFrameData(tcpstp->localFramep);
+    tcpstp->localOffset = tcpstp->localFramep->length;
+    tcpstp->csp->recvlen += tcpstp->localFramep->length;
+    if (urosTcpRosReactorFrame(tcpstp, datap + sizeof(uint32_t),
+                               tcpstp->localFramep->length -
+                               sizeof(uint32_t)) != UROS_OK) {
+      return tcpstp->err;
+    }
+  }
+  return (tcpstp->err == UROS_ERR_EOF) ? UROS_OK : tcpstp->err;
+}
+
+uros_err_t uros_tcplocal_msgs(UrosTcpRosStatus *tcpstp) {
+
+  UrosTcpRosFrame *framep;
+
+  /* Hand each shared message object to the message handler, as is.*/
+  while (uros_tcplocal_next(tcpstp, UROS_FALSE) == UROS_OK) {
+    framep = tcpstp->localFramep;
+    urosError(framep->msgp == NULL, return tcpstp->err = UROS_ERR_BADPARAM,
+              ("Topic [%.*s] message not published as a shared object\n",
+               UROS_STRARG(&tcpstp->topicp->name)));
+    tcpstp->localOffset = framep->length;
+    tcpstp->csp->recvlen += framep->length;
+    ++tcpstp->numMsgs;
+    tcpstp->err = tcpstp->topicp->msgprocf(tcpstp, framep->msgp);
+    if (tcpstp->err != UROS_OK) { return tcpstp->err; }
+  }
+  return (tcpstp->err == UROS_ERR_EOF) ? UROS_OK : tcpstp->err;
+}
+
+uros_err_t uros_tcpros_recvchunk(UrosTcpRosStatus *tcpstp,
+                                 void **bufpp, size_t *buflenp) {
+
+  /* UDPROS links read from the reassembled frame.*/
+  if (tcpstp->udplinkp != NULL) {
+    return urosUdpRosRecv(tcpstp, bufpp, buflenp);
+  }
+  /* Intra-process links read from the frames shared by the publisher.*/
+  if (tcpstp->localTopicp != NULL) {
+    return uros_tcplocal_recv(tcpstp, bufpp, buflenp);
+  }
+  return urosConnRecv(tcpstp->csp, bufpp, buflenp);
+}
+
+uros_err_t uros_tcpcli_udpframes(UrosTcpRosStatus *tcpstp) {
+
+  uint32_t length;
+
+  /* Reactor links cannot be polled as streams, handle frames here.*/
+  while (!urosTcpRosStatusCheckExit(tcpstp)) {
+    if (urosTcpRosRecvRaw(tcpstp, length) != UROS_OK) {
+      if (tcpstp->err == UROS_ERR_TIMEOUT) { continue; }
+      break;
+    }
+    if (urosTcpRosFrameRecv(tcpstp, length) != UROS_OK) { break; }
+    if (urosTcpRosReactorFrame(tcpstp, tcpstp->recvframep,
+                               (size_t)length) != UROS_OK) { break; }
+  }
+  return (tcpstp->err == UROS_ERR_TIMEOUT) ? UROS_OK : tcpstp->err;
+}
+
+uros_err_t uros_tcpcli_localsubscription(const UrosString *namep) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  uros_err_t err;
+  UrosConn *csp;
+  UrosTcpRosStatus *tcpstp;
+  UrosListNode *topicnodep;
+
+  urosAssert(urosStringNotEmpty(namep));
+
+  /* The connection is never created, it only accounts received bytes.*/
+  csp = urosNew(NULL, UrosConn);
+  if (csp == NULL) { return UROS_ERR_NOMEM; }
+  tcpstp = urosNew(NULL, UrosTcpRosStatus);
+  if (tcpstp == NULL) { urosFree(csp); return UROS_ERR_NOMEM; }
+  urosConnObjectInit(csp);
+  urosTcpRosStatusObjectInit(tcpstp, csp);
+
+  /* Get topic features.*/
+  urosMutexLock(&stp->subTopicListLock);
+  topicnodep = urosListIndexFind(&stp->subTopicIndex, namep);
+  if (topicnodep != NULL) {
+    tcpstp->topicp = (UrosTopic*)topicnodep->datap;
+    urosTopicRefInc(tcpstp->topicp);
+  }
+  urosMutexUnlock(&stp->subTopicListLock);
+  urosError(topicnodep == NULL,
+            { urosTcpRosStatusDelete(tcpstp, UROS_TRUE);
+              return UROS_ERR_BADPARAM; },
+            ("Topic [%.*s] not found\n", UROS_STRARG(namep)));
+
+  /* Read the frames pushed by the local publisher.*/
+  err = uros_tcplocal_attach(tcpstp);
+  if (err != UROS_OK) {
+    urosTcpRosTopicSubscriberDone(tcpstp);
+    urosTcpRosStatusDelete(tcpstp, UROS_TRUE);
+    return err;
+  }
+  tcpstp->callerId = urosStringIntern(&urosNode.config.nodeName);
+
+  urosAssert(tcpstp->topicp->flags.reactor ? tcpstp->topicp->framef != NULL
+                                           : tcpstp->topicp->procf != NULL);
+  if (!tcpstp->topicp->flags.probe) {
+    uros_tcpcli_linkadd(tcpstp);
+    if (tcpstp->topicp->msgprocf != NULL) {
+      err = uros_tcplocal_msgs(tcpstp);
+    } else if (tcpstp->topicp->flags.reactor) {
+      err = uros_tcplocal_frames(tcpstp);
+    } else {
+      err = tcpstp->topicp->procf(tcpstp);
+    }
+    uros_tcpcli_linkremove(tcpstp);
+  }
+
+  /* Release the topic references.*/
+  uros_tcplocal_release(tcpstp);
+  urosTcpRosTopicSubscriberDone(tcpstp);
+  urosError(err != UROS_OK, UROS_NOP,
+            ("Topic [%.*s] local handler returned %s\n",
+             UROS_STRARG(namep), urosErrorText(err)));
+  urosTcpRosStatusDelete(tcpstp, UROS_TRUE);
+  return err;
+}
+
+uros_err_t uros_tcpcli_topicsubscription(const UrosString *namep,
+                                         const UrosAddr *addrp,
+                                         uros_bool_t udp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  uros_err_t err;
+  UrosConn *csp;
+  UrosUdpRosLink *linkp = NULL;
+  UrosTcpRosStatus *tcpstp;
+  UrosListNode *topicnodep;
+
+  urosAssert(urosStringNotEmpty(namep));
+  urosAssert(addrp != NULL);
+#define _CHKOK  { if (err != UROS_OK) { goto _error; } }
+
+  if (udp) {
+    linkp = urosNew(NULL, UrosUdpRosLink);
+    if (linkp == NULL) { return UROS_ERR_NOMEM; }
+    urosUdpRosLinkObjectInit(linkp);
+    csp = &linkp->conn;
+  } else {
+    csp = urosNew(NULL, UrosConn);
+    if (csp == NULL) { return UROS_ERR_NOMEM; }
+  }
+  tcpstp = urosNew(NULL, UrosTcpRosStatus);
+  if (tcpstp == NULL) { urosFree(csp); return UROS_ERR_NOMEM; }
+
+  /* Get topic features.*/
+  urosTcpRosStatusObjectInit(tcpstp, csp);
+  tcpstp->udplinkp = linkp;
+  urosMutexLock(&stp->subTopicListLock);
+  topicnodep = urosListIndexFind(&stp->subTopicIndex, namep);
+  if (topicnodep != NULL) {
+    tcpstp->topicp = (UrosTopic*)topicnodep->datap;
+    urosTopicRefInc(tcpstp->topicp);
+  }
+  urosMutexUnlock(&stp->subTopicListLock);
+  urosError(topicnodep == NULL,
+            { urosTcpRosStatusDelete(tcpstp, UROS_TRUE);
+              return UROS_ERR_BADPARAM; },
+            ("Topic [%.*s] not found\n", UROS_STRARG(namep)));
+
+  if (udp) {
+    /* Negotiate the UDPROS link with the publisher API.*/
+    err = urosUdpRosConnect(tcpstp, addrp);
+    if (err != UROS_OK) {
+      urosTcpRosTopicSubscriberDone(tcpstp);
+      goto _error;
+    }
+  } else {
+    /* Connect to the publisher.*/
+    urosConnObjectInit(csp);
+    urosConnCreate(csp, UROS_PROTO_TCP);
+    err = urosConnConnect(csp, addrp);
+    urosError(err != UROS_OK, goto _error,
+              ("Error %s while connecting to "UROS_ADDRFMT"\n",
+               urosErrorText(err), UROS_ADDRARG(addrp)));
+
+    /* Set timeouts for the spawned connection.*/
+    err = urosConnSetRecvTimeout(csp, UROS_TCPROS_RECVTIMEOUT);
+    urosAssert(err == UROS_OK);
+    err = urosConnSetSendTimeout(csp, UROS_TCPROS_SENDTIMEOUT);
+    urosAssert(err == UROS_OK);
+
+    /* Send the TCPROS conenction header.*/
+    err = urosTcpRosSendHeader(tcpstp, UROS_TRUE); _CHKOK
+
+    /* Receive the TCPROS connection header.*/
+    err = urosTcpRosRecvHeader(tcpstp, UROS_FALSE, UROS_FALSE); _CHKOK
+  }
+
+  /* Just probing, release the topic reference.*/
+  tcpstp->err = UROS_OK;
+  urosAssert(tcpstp->topicp->flags.reactor ? tcpstp->topicp->framef != NULL
+                                           : tcpstp->topicp->procf != NULL);
+  if (tcpstp->topicp->flags.probe) {
+    urosTcpRosTopicSubscriberDone(tcpstp);
+    goto _finally;
+  }
+  uros_tcpcli_linkadd(tcpstp);
+
+  if (tcpstp->topicp->flags.reactor) {
+#if UROS_TCPROS_USE_REACTOR
+    /* Let a reactor thread handle the incoming frames.*/
+    if (!udp) {
+      err = urosTcpRosReactorAttach(tcpstp);
+      if (err == UROS_OK) { return UROS_OK; }
+      uros_tcpcli_linkremove(tcpstp);
+      urosTcpRosTopicSubscriberDone(tcpstp);
+      goto _error;
+    }
+#endif
+    err = uros_tcpcli_udpframes(tcpstp);
+  } else {
+    /* Handle the incoming published stream.*/
+    err = tcpstp->topicp->procf(tcpstp);
+  }
+
+  /* Release the topic/service descriptor reference.*/
+  uros_tcpcli_linkremove(tcpstp);
+  urosTcpRosTopicSubscriberDone(tcpstp);
+
+  urosError(err != UROS_OK, goto _error,
+            ("Topic [%.*s] client handler returned %s\n",
+             UROS_STRARG(namep), urosErrorText(err)));
+_finally:
+  err = urosConnClose(csp);
+  urosTcpRosStatusDelete(tcpstp, UROS_TRUE);
+  return err;
+
+_error:
+  urosConnClose(csp);
+  urosTcpRosStatusDelete(tcpstp, UROS_TRUE);
+  return err;
+#undef _CHKOK
+}
+
+uros_err_t uros_tcpcli_requesttopic(UrosRpcCallJob *jobp) {
+
+  const uros_tcpcliargs_t *argsp;
+
+  urosAssert(jobp != NULL);
+  urosAssert(jobp->argp != NULL);
+
+  argsp = (const uros_tcpcliargs_t *)jobp->argp;
+  return urosNodeRequestTopicPublisher(&argsp->remoteAddr, &argsp->topicName,
+                                       &jobp->response);
+}
+
+uros_err_t uros_tcpcli_publisher(uros_tcpcliargs_t *argsp) {
+
+  static const UrosNodeConfig *const cfgp = &urosNode.config;
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  uros_err_t err;
+  UrosAddr pubaddr;
+  const UrosListNode *topicnodep;
+
+  urosAssert(argsp != NULL);
+  urosAssert(urosStringNotEmpty(&argsp->topicName));
+  urosAssert(!argsp->topicFlags.service);
+
+  /* Read the shared frames directly, if published by this node.*/
+  if (argsp->remoteAddr.ip.dword == cfgp->xmlrpcAddr.ip.dword &&
+      argsp->remoteAddr.port == cfgp->xmlrpcAddr.port) {
+    err = uros_tcpcli_localsubscription(&argsp->topicName);
+    if (err != UROS_ERR_NOTIMPL) { goto _finally; }
+  }
+
+  /* Negotiate a UDPROS link, if preferred by the subscribed topic.*/
+  urosMutexLock(&stp->subTopicListLock);
+  topicnodep = urosListIndexFind(&stp->subTopicIndex, &argsp->topicName);
+  if (topicnodep != NULL) {
+    argsp->topicFlags.udp = ((const UrosTopic *)topicnodep->datap)->flags.udp;
+  }
+  urosMutexUnlock(&stp->subTopicListLock);
+  if (argsp->topicFlags.udp) {
+    err = uros_tcpcli_topicsubscription(&argsp->topicName,
+                                        &argsp->remoteAddr, UROS_TRUE);
+    if (err != UROS_ERR_NOTIMPL) { goto _finally; }
+  }
+
+  /* Resolve the publisher address, unless already requested.*/
+  if (argsp->requested) {
+    err = urosRpcCallAsyncWait(&argsp->requestJob);
+    if (err == UROS_OK) {
+      err = urosNodeParseTopicPublisher(&argsp->requestJob.response, &pubaddr);
+    }
+  } else {
+    err = urosNodeResolveTopicPublisher(&argsp->remoteAddr,
+                                        &argsp->topicName,
+                                        &pubaddr);
+  }
+  if (err != UROS_OK) { goto _finally; }
+
+  /* Start a new TCPROS topic subscripion.*/
+  err = uros_tcpcli_topicsubscription(&argsp->topicName, &pubaddr,
+                                      UROS_FALSE);
+
+_finally:
+  urosTopicSubParamsDelete(argsp);
+  return err;
+}
+
+/*===========================================================================*/
+/* GLOBAL FUNCTIONS                                                          */
+/*===========================================================================*/
+
+/** @addtogroup tcpros_funcs */
+/** @{ */
+
+/**
+ * @brief   Deletes topic subscription parameters.
+ * @details Deallocates the memory chunk of the string data, and the object
+ *          itself.
+ * @see     urosFree()
+ *
+ * @pre     The parameters must have been allocated with @p urosAlloc().
+ * @pre     The parameter data must have been allocated with @p urosAlloc().
+ * @post    @p parp points to an invalid address.
+ *
+ * @param[in] parp
+ *          Pointer to an allocated @p uros_tcpcliargs_t object.
+ */
+void urosTopicSubParamsDelete(uros_tcpcliargs_t *parp) {
+
+  if (parp != NULL) {
+    if (parp->requested) {
+      /* The job cannot be dequeued, wait for it.*/
+      urosRpcCallAsyncWait(&parp->requestJob);
+      urosRpcCallJobClean(&parp->requestJob);
+    }
+    urosStringRelease(&parp->topicName);
+    urosFree(parp);
+  }
+}
+
+/**
+ * @brief   Requests the topic of subscription parameters in advance.
+ * @details The @p requestTopic() call to the publisher is issued
+ *          asynchronously, so that it runs while the parameters wait for a
+ *          TCPROS Client worker thread. The worker then only waits for its
+ *          response.
+ * @see     urosRpcCallAsync()
+ *
+ * @pre     The parameters are not requested yet.
+ * @post    The parameters own the issued job, until deleted.
+ *
+ * @param[in,out] parp
+ *          Pointer to an allocated @p uros_tcpcliargs_t object.
+ */
+void urosTopicSubParamsRequest(uros_tcpcliargs_t *parp) {
+
+  urosAssert(parp != NULL);
+  urosAssert(!parp->requested);
+
+  urosRpcCallJobObjectInit(&parp->requestJob, uros_tcpcli_requesttopic, NULL,
+                           parp);
+  parp->requested = UROS_TRUE;
+  urosRpcCallAsync(&parp->requestJob);
+}
+
+/**
+ * @brief   Initializes a message arena.
+ * @details The arena is empty, and its memory chunk is allocated lazily by
+ *          the first reset after some allocations.
+ *
+ * @pre     The arena is not initialized.
+ * @post    The arena is initialized.
+ *
+ * @param[in,out] arenap
+ *          Pointer to an allocated @p UrosTcpRosArena object.
+ */
+void urosTcpRosArenaObjectInit(UrosTcpRosArena *arenap) {
+
+  urosAssert(arenap != NULL);
+
+  memset(arenap, 0, sizeof(UrosTcpRosArena));
+}
+
+/**
+ * @brief   Cleans a message arena.
+ * @details Deallocates the arena memory chunk and its overflow chunks.
+ *
+ * @pre     The arena is initialized.
+ * @post    @p arenap points to an uninitialized @p UrosTcpRosArena object.
+ * @post    Any memory allocated from the arena is invalid.
+ *
+ * @param[in,out] arenap
+ *          Pointer to an initialized @p UrosTcpRosArena object.
+ */
+void urosTcpRosArenaClean(UrosTcpRosArena *arenap) {
+
+  void *chunkp;
+
+  urosAssert(arenap != NULL);
+
+  while (arenap->overflowp != NULL) {
+    chunkp = arenap->overflowp;
+    arenap->overflowp = *(void **)chunkp;
+    urosFree(chunkp);
+  }
+  urosFree(arenap->basep);
+  memset(arenap, 0, sizeof(UrosTcpRosArena));
+}
+
+/**
+ * @brief   Resets a message arena.
+ * @details Releases all the memory allocated from the arena, at once.
+ *          If some allocations did not fit the arena memory chunk since the
+ *          last reset, the chunk is reallocated to hold all of them, so that
+ *          a steady stream of similar messages is served by bumping only.
+ *
+ * @pre     The arena is initialized.
+ * @post    Any memory allocated from the arena is invalid.
+ *
+ * @param[in,out] arenap
+ *          Pointer to an initialized @p UrosTcpRosArena object.
+ */
+void urosTcpRosArenaReset(UrosTcpRosArena *arenap) {
+
+  urosAssert(arenap != NULL);
+
+  if (arenap->overflowp != NULL) {
+    size_t peak = arenap->peak;
+
+    /* Grow the arena chunk, so that it can hold the peak usage.*/
+    urosTcpRosArenaClean(arenap);
+    arenap->basep = (uint8_t *)urosAlloc(UROS_MSG_HEAP, peak);
+    if (arenap->basep != NULL) {
+      arenap->size = peak;
+    }
+  }
+  arenap->used = 0;
+  arenap->peak = 0;
+}
+
+/**
+ * @brief   Allocates memory from a message arena.
+ * @details The memory chunk is bumped from the arena if it fits, otherwise it
+ *          is allocated on the heap and linked to the arena, until the next
+ *          reset. Allocated chunks are aligned to
+ *          @p UROS_TCPROS_ARENA_ALIGN bytes, and cannot be freed one by one.
+ *
+ * @pre     The arena is initialized, if not @p NULL.
+ *
+ * @param[in,out] arenap
+ *          Pointer to an initialized @p UrosTcpRosArena object, or @p NULL
+ *          to allocate with @p urosAlloc().
+ * @param[in] size
+ *          Size of the memory chunk, in bytes.
+ * @return
+ *          Pointer to the allocated memory chunk.
+ * @retval NULL
+ *          Not enough free memory.
+ */
+void *urosTcpRosArenaAlloc(UrosTcpRosArena *arenap, size_t size) {
+
+  const size_t mask = (size_t)UROS_TCPROS_ARENA_ALIGN - 1;
+  const size_t hdrlen = (sizeof(void *) + mask) & ~mask;
+  uint8_t *chunkp;
+
+  if (arenap == NULL) {
+    return urosAlloc(UROS_MSG_HEAP, size);
+  }
+
+  /* Round up to the arena alignment.*/
+  size = (size > 0) ? ((size + mask) & ~mask) : (mask + 1);
+  arenap->peak += size;
+  if (size <= arenap->size - arenap->used) {
+    chunkp = arenap->basep + arenap->used;
+    arenap->used += size;
+    return chunkp;
+  }
+
+  /* The arena is full, link an overflow chunk.*/
+  chunkp = (uint8_t *)urosAlloc(UROS_MSG_HEAP, hdrlen + size);
+  if (chunkp == NULL) { return NULL; }
+  *(void **)chunkp = arenap->overflowp;
+  arenap->overflowp = chunkp;
+  return chunkp + hdrlen;
+}
+
+/**
+ * @brief   Allocates an array from a message arena.
+ * @details Same as @p urosTcpRosArenaAlloc(), but the array size is checked
+ *          against overflow, as the number of entries may come from the
+ *          wire.
+ *
+ * @pre     The arena is initialized, if not @p NULL.
+ *
+ * @param[in,out] arenap
+ *          Pointer to an initialized @p UrosTcpRosArena object, or @p NULL
+ *          to allocate with @p urosAlloc().
+ * @param[in] n
+ *          Number of array entries.
+ * @param[in] size
+ *          Size of each array entry, in bytes.
+ * @return
+ *          Pointer to the allocated array.
+ * @retval NULL
+ *          Not enough free memory, or the array size overflows.
+ */
+void *urosTcpRosArenaArrayAlloc(UrosTcpRosArena *arenap,
+                                size_t n, size_t size) {
+
+  if (size > 0 && n > (size_t)-1 / size) {
+    return NULL;
+  }
+  return urosTcpRosArenaAlloc(arenap, n * size);
+}
+
+/**
+ * @brief   Initializes a TCPROS status record.
+ *
+ * @pre     The record is not initialized.
+ * @post    The record is initialized.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to an allocated @p UrosTcpRosStatus object.
+ * @param[in] csp
+ *          Pointer to an allocated connection.
+ */
+void urosTcpRosStatusObjectInit(UrosTcpRosStatus *tcpstp, UrosConn *csp) {
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(csp != NULL);
+
+  memset(tcpstp, 0, sizeof(UrosTcpRosStatus));
+  tcpstp->csp = csp;
+
+  /* Initialize the thread exit request mutex.*/
+  urosMutexObjectInit(&tcpstp->threadExitMtx);
+
+  tcpstp->err = UROS_OK;
+}
+
+/**
+ * @brief   Cleans a TCPROS status record.
+ * @details Invalidates the private members. Optionally, deallocates their data.
+ *
+ * @pre     The record is initialized.
+ * @post    @p tcpstp points to an uninitialized @p UrosTcpRosStatus object.
+ * @post    If desidred so, private members are deallocated. They must have
+ *          been allocated with @p urosAlloc().
+ * @post    The frame buffers and the message arena are always deallocated.
+ * @post    The interned caller ID is always released.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to an initialized @p UrosTcpRosStatus object.
+ * @param[in] deep
+ *          Performs deallocation of private members.
+ */
+void urosTcpRosStatusClean(UrosTcpRosStatus *tcpstp, uros_bool_t deep) {
+
+  urosAssert(tcpstp != NULL);
+
+  if (tcpstp->udplinkp != NULL) {
+    urosUdpRosLinkClean(tcpstp->udplinkp);
+  }
+  if (deep) {
+    urosFree(tcpstp->csp);
+    urosStringClean(&tcpstp->errstr);
+  }
+  urosStringRelease(&tcpstp->callerId);
+  urosFree(tcpstp->sendframep);
+  urosFree(tcpstp->recvframep);
+  urosTcpRosArenaClean(&tcpstp->arena);
+  memset(tcpstp, 0, sizeof(UrosTcpRosStatus));
+}
+
+/**
+ * @brief   Deallocates a TCPROS status record.
+ * @details Invalidates the private members. Optionally, deallocates their data.
+ *
+ * @pre     The record is initialized.
+ * @post    @p tcpstp points to an invalid address.
+ * @post    If desidred so, private members are deallocated. They must have
+ *          been allocated with @p urosAlloc().
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to an initialized @p UrosTcpRosStatus object.
+ * @param[in] deep
+ *          Performs deallocation of private members.
+ */
+void urosTcpRosStatusDelete(UrosTcpRosStatus *tcpstp, uros_bool_t deep) {
+
+  if (tcpstp != NULL) {
+    urosTcpRosStatusClean(tcpstp, deep);
+    urosFree(tcpstp);
+  }
+}
+
+/**
+ * @brief   Raises the exit flag.
+ * @details Sets the @p exitFlag to @p true, so that the user handler will exit
+ *          the loop and therefore the TCPROS worker thread can exit.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to an initialized @p UrosTcpRosStatus object.
+ */
+void urosTcpRosStatusIssueExit(UrosTcpRosStatus *tcpstp) {
+
+  urosAssert(tcpstp != NULL);
+
+  urosMutexLock(&tcpstp->threadExitMtx);
+  tcpstp->threadExit = UROS_TRUE;
+  urosMutexUnlock(&tcpstp->threadExitMtx);
+
+  /* Wake up the handler, if it is waiting for fan-out frames.*/
+  if (tcpstp->topicp != NULL && tcpstp->topicp->fanoutp != NULL) {
+    urosTcpRosFanoutWakeup(tcpstp->topicp->fanoutp);
+  }
+  if (tcpstp->localTopicp != NULL) {
+    urosTcpRosFanoutWakeup(tcpstp->localTopicp->fanoutp);
+  }
+}
+
+/**
+ * @brief   Checks if the exit flag is raised.
+ *
+ * @param[in] tcpstp
+ *          Pointer to an initialized @p UrosTcpRosStatus object.
+ * @return
+ *          Exit flag status.
+ */
+uros_bool_t urosTcpRosStatusCheckExit(UrosTcpRosStatus *tcpstp) {
+
+  uros_bool_t flag;
+
+  urosAssert(tcpstp != NULL);
+
+  urosMutexLock(&tcpstp->threadExitMtx);
+  flag = tcpstp->threadExit;
+  urosMutexUnlock(&tcpstp->threadExitMtx);
+  return flag;
+}
+
+/**
+ * @brief   Connection carrying the message data.
+ * @details UDPROS links carry the data over their datagram connection, while
+ *          the TCPROS stream is only used for the connection header.
+ *          Its @p recvlen and @p sentlen counters are updated by the
+ *          connection thread only, so they can be sampled without locking,
+ *          e.g. to generate bus statistics.
+ *
+ * @param[in] tcpstp
+ *          Pointer to an initialized @p UrosTcpRosStatus object.
+ * @return
+ *          Pointer to the data connection.
+ */
+const UrosConn *urosTcpRosStatusConn(const UrosTcpRosStatus *tcpstp) {
+
+  urosAssert(tcpstp != NULL);
+
+  if (tcpstp->udplinkp != NULL) {
+    return &tcpstp->udplinkp->conn;
+  }
+  return tcpstp->csp;
+}
+
+/**
+ * @brief   Initializes a TCPROS array descriptor.
+ * @details The array is initialized as empty.
+ *
+ * @pre     The array is not initialized.
+ * @post    The array is empty.
+ *
+ * @param[in,out] arrayp
+ *          Pointer to an allocated @p UrosTcpRosArray object.
+ */
+void urosTcpRosArrayObjectInit(UrosTcpRosArray *arrayp) {
+
+  urosAssert(arrayp != NULL);
+
+  arrayp->length = 0;
+  arrayp->entriesp = NULL;
+}
+
+/**
+ * @brief   Cleans a TCPROS array.
+ * @details Invalidates the private members, and deallocates their data.
  *
  * @pre     The array is initialized.
  * @post    @p arrayp points to an empty array descriptor.
@@ -503,11 +1410,11 @@ uros_err_t urosTcpRosSkip(UrosTcpRosStatus *tcpstp, size_t length) {
   void *bufp;
 
   urosAssert(tcpstp != NULL);
-  urosAssert(urosConnIsValid(tcpstp->csp));
+  urosAssert(tcpstp->localTopicp != NULL || urosConnIsValid(tcpstp->csp));
 
   while (length > 0) {
     size_t nb = length;
-    tcpstp->err = urosConnRecv(tcpstp->csp, &bufp, &nb);
+    tcpstp->err = uros_tcpros_recvchunk(tcpstp, &bufp, &nb);
     urosError(tcpstp->err != UROS_OK, return tcpstp->err,
               ("Error %s while skipping %u bytes from the current position\n",
                urosErrorText(tcpstp->err), (unsigned)length));
@@ -538,14 +1445,14 @@ uros_err_t urosTcpRosExpect(UrosTcpRosStatus *tcpstp,
   size_t pending, nb;
 
   urosAssert(tcpstp != NULL);
-  urosAssert(urosConnIsValid(tcpstp->csp));
+  urosAssert(tcpstp->localTopicp != NULL || urosConnIsValid(tcpstp->csp));
   urosAssert(!(toklen > 0) || tokp != NULL);
 
   curp = (uint8_t*)tokp;
   pending = toklen;
   while (pending > 0) {
     nb = pending;
-    tcpstp->err = urosConnRecv(tcpstp->csp, (void**)&bufp, &nb);
+    tcpstp->err = uros_tcpros_recvchunk(tcpstp, (void**)&bufp, &nb);
     urosError(tcpstp->err != UROS_OK, return tcpstp->err,
               ("Error %s while receiving %u bytes after [%.*s]\n",
                urosErrorText(tcpstp->err), (unsigned)nb,
@@ -584,14 +1491,14 @@ uros_err_t urosTcpRosRecv(UrosTcpRosStatus *tcpstp,
   size_t pending;
 
   urosAssert(tcpstp != NULL);
-  urosAssert(urosConnIsValid(tcpstp->csp));
+  urosAssert(tcpstp->localTopicp != NULL || urosConnIsValid(tcpstp->csp));
   urosAssert(!(buflen > 0) || bufp != NULL);
 
   curp = (uint8_t*)bufp;
   pending = buflen;
   while (pending > 0) {
     size_t nb = pending;
-    tcpstp->err = urosConnRecv(tcpstp->csp, (void**)&recvp, &nb);
+    tcpstp->err = uros_tcpros_recvchunk(tcpstp, (void**)&recvp, &nb);
     if (tcpstp->err != UROS_OK) {
       if (tcpstp->err == UROS_ERR_EOF && nb < pending) {
         urosError(tcpstp->err == UROS_ERR_EOF && nb < pending,
@@ -635,14 +1542,14 @@ uros_err_t urosTcpRosRecvRev(UrosTcpRosStatus *tcpstp,
   size_t pending;
 
   urosAssert(tcpstp != NULL);
-  urosAssert(urosConnIsValid(tcpstp->csp));
+  urosAssert(tcpstp->localTopicp != NULL || urosConnIsValid(tcpstp->csp));
   urosAssert(!(buflen > 0) || bufp != NULL);
 
   curp = (uint8_t*)bufp + buflen;
   pending = buflen;
   while (pending > 0) {
     size_t nb = pending;
-    tcpstp->err = urosConnRecv(tcpstp->csp, (void**)&recvp, &nb);
+    tcpstp->err = uros_tcpros_recvchunk(tcpstp, (void**)&recvp, &nb);
     if (tcpstp->err != UROS_OK) {
       if (tcpstp->err == UROS_ERR_EOF && nb < pending) {
         urosError(tcpstp->err == UROS_ERR_EOF && nb < pending,
@@ -693,7 +1600,7 @@ uros_err_t urosTcpRosRecvString(UrosTcpRosStatus *tcpstp,
   /* Read the string data.*/
   if (length > 0) {
     strp->length = (size_t)length;
-    strp->datap = (char*)urosAlloc(NULL, strp->length);
+    strp->datap = (char*)urosAlloc(UROS_MSG_HEAP, strp->length);
     if (strp->datap == NULL) {
       strp->length = 0;
       return tcpstp->err = UROS_ERR_NOMEM;
@@ -710,6 +1617,8 @@ uros_err_t urosTcpRosRecvString(UrosTcpRosStatus *tcpstp,
 
 /**
  * @brief   Writes some data to the outgoing TCPROS stream.
+ * @note    On UDPROS links, @p bufp must hold whole frames, which are
+ *          fragmented into datagrams.
  *
  * @param[in,out] tcpstp
  *          Pointer to a TCPROS status with a working connection.
@@ -728,7 +1637,12 @@ uros_err_t urosTcpRosSend(UrosTcpRosStatus *tcpstp,
   urosAssert(!(buflen > 0) || bufp != NULL);
 
   if (buflen > 0) {
-    tcpstp->err = urosConnSend(tcpstp->csp, bufp, buflen);
+    if (tcpstp->udplinkp != NULL) {
+      /* UDPROS links fragment whole frames into datagrams.*/
+      tcpstp->err = urosUdpRosSendFrame(tcpstp, bufp, buflen);
+    } else {
+      tcpstp->err = urosConnSend(tcpstp->csp, bufp, buflen);
+    }
     urosError(tcpstp->err != UROS_OK && tcpstp->err != UROS_ERR_TIMEOUT,
               return tcpstp->err,
               ("Error %s while sending [%.*s]\n",
@@ -738,6 +1652,40 @@ uros_err_t urosTcpRosSend(UrosTcpRosStatus *tcpstp,
   return tcpstp->err = UROS_OK;
 }
 
+/**
+ * @brief   Writes a sequence of data chunks to the outgoing TCPROS stream.
+ * @details The chunks are written in order, without being copied into a
+ *          staging buffer. Useful to prepend a length prefix or some fixed
+ *          fields to a large payload.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status with a working connection.
+ * @param[in] iovp
+ *          Pointer to the array of chunks to be written.
+ * @param[in] count
+ *          Number of chunks. Can be @p 0.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosSendV(UrosTcpRosStatus *tcpstp,
+                           const UrosIoVec *iovp, uros_cnt_t count) {
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(tcpstp->udplinkp == NULL);
+  urosAssert(tcpstp->csp != NULL);
+  urosAssert(!(count > 0) || iovp != NULL);
+
+  if (count > 0) {
+    tcpstp->err = urosConnSendV(tcpstp->csp, iovp, count);
+    urosError(tcpstp->err != UROS_OK && tcpstp->err != UROS_ERR_TIMEOUT,
+              return tcpstp->err,
+              ("Error %s while sending %u chunks\n",
+               urosErrorText(tcpstp->err), (unsigned)count));
+    if (tcpstp->err == UROS_ERR_TIMEOUT) { return UROS_ERR_TIMEOUT; }
+  }
+  return tcpstp->err = UROS_OK;
+}
+
 /**
  * @brief   Writes some data to the outgoing TCPROS stream.
  * @details Data is written in a reversed (per-byte) fashion.
@@ -822,68 +1770,469 @@ uros_err_t urosTcpRosSendStringSZ(UrosTcpRosStatus *tcpstp,
   urosTcpRosSendRaw(tcpstp, size);
   if (tcpstp->err != UROS_OK) { return tcpstp->err; }
 
-  /* Write the string data.*/
-  urosTcpRosSend(tcpstp, strp, (size_t)size);
-  if (tcpstp->err != UROS_OK) { return tcpstp->err; }
+  /* Write the string data.*/
+  urosTcpRosSend(tcpstp, strp, (size_t)size);
+  if (tcpstp->err != UROS_OK) { return tcpstp->err; }
+
+  return UROS_OK;
+}
+
+/**
+ * @brief   Sends the error string
+ * @details The error string is <tt>tcpstp->errstr</tt>.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to an initialized @p UrosTcpRosStatus object.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosSendError(UrosTcpRosStatus *tcpstp) {
+
+  uint32_t hdrlen = 0;
+  const UrosString *errstrp, *typestrp, *md5strp;
+
+  urosAssert(tcpstp != NULL);
+#define _CHKOK  { if (tcpstp->err != UROS_OK) { return tcpstp->err; } }
+
+#define _FIELDSTRING(tcpstp, namep, valuep) { \
+  urosAssert(urosStringNotEmpty(namep)); \
+  urosAssert(valuep != NULL); \
+  hdrlen = (uint32_t)((namep)->length + 1 + (valuep)->length); \
+  urosTcpRosSendRaw(tcpstp, hdrlen); _CHKOK \
+  urosTcpRosSend(tcpstp, (namep)->datap, (namep)->length); _CHKOK \
+  urosTcpRosSend(tcpstp, "=", 1); _CHKOK \
+  urosTcpRosSend(tcpstp, (valuep)->datap, (valuep)->length); _CHKOK }
+
+  if (tcpstp->topicp == NULL) {
+    typestrp = &dummytype.name;
+    md5strp = &dummytype.md5str;
+    (void)dummytopic;
+  } else {
+    typestrp = &tcpstp->topicp->typep->name;
+    md5strp = &tcpstp->topicp->typep->md5str;
+  }
+  errstrp = &tcpstp->errstr;
+
+  hdrlen += (uint32_t)(1 + errfield.length + errstrp->length);
+  hdrlen += (uint32_t)(1 + typefield.length + typestrp->length);
+  hdrlen += (uint32_t)(1 + md5field.length + md5strp->length);
+
+  /* uint32 header_length */
+  urosTcpRosSendRaw(tcpstp, hdrlen); _CHKOK
+
+  /* uint32 field_length, error={str} */
+  _FIELDSTRING(tcpstp, &errfield, errstrp);
+
+  /* uint32 field_length, type={str} */
+  _FIELDSTRING(tcpstp, &typefield, typestrp);
+
+  /* uint32 field_length, md5sum={str} */
+  _FIELDSTRING(tcpstp, &md5field, md5strp);
+
+  return tcpstp->err = UROS_OK;
+#undef _CHKOK
+#undef _FIELDSTRING
+}
+
+/**
+ * @brief   Writes some data to a serialization buffer.
+ * @details Data is written in a reversed (per-byte) fashion.
+ *
+ * @param[in] bufp
+ *          Pointer to the serialization buffer.
+ * @param[in] valuep
+ *          Pointer to the data to be written.
+ * @param[in] length
+ *          Length of the data to be written, in bytes. Can be @p 0.
+ * @return
+ *          Pointer to the first byte after the written data.
+ */
+uint8_t *urosTcpRosPutRev(uint8_t *bufp, const void *valuep, size_t length) {
+
+  const uint8_t *curp;
+
+  urosAssert(bufp != NULL);
+  urosAssert(!(length > 0) || valuep != NULL);
+
+  for (curp = (const uint8_t *)valuep + length; length > 0; --length) {
+    *bufp++ = *--curp;
+  }
+  return bufp;
+}
+
+/**
+ * @brief   Writes a string to a serialization buffer.
+ *
+ * @param[in] bufp
+ *          Pointer to the serialization buffer.
+ * @param[in] strp
+ *          Pointer to a valid @p UrosString object to be written.
+ * @return
+ *          Pointer to the first byte after the written string.
+ */
+uint8_t *urosTcpRosPutString(uint8_t *bufp, const UrosString *strp) {
+
+  uint32_t size;
+
+  urosAssert(bufp != NULL);
+  urosAssert(urosStringIsValid(strp));
+
+  size = (uint32_t)strp->length;
+  bufp = urosTcpRosPutRaw(bufp, size);
+  return urosTcpRosPut(bufp, strp->datap, strp->length);
+}
+
+/**
+ * @brief   Prepares the outgoing frame buffer.
+ * @details The frame buffer of @p tcpstp is enlarged if it cannot hold the
+ *          message length prefix plus @p msglen bytes of message contents.
+ *          The length prefix is written at the beginning of the frame.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to an initialized @p UrosTcpRosStatus object.
+ * @param[in] msglen
+ *          Length of the message contents, in bytes.
+ * @return
+ *          Pointer to the beginning of the message contents inside the frame
+ *          buffer, or @p NULL if the buffer could not be allocated.
+ */
+uint8_t *urosTcpRosFrameBegin(UrosTcpRosStatus *tcpstp, uint32_t msglen) {
+
+  size_t framelen = sizeof(uint32_t) + (size_t)msglen;
+
+  urosAssert(tcpstp != NULL);
+
+  if (tcpstp->sendframesize < framelen) {
+    urosFree(tcpstp->sendframep);
+    tcpstp->sendframesize = 0;
+    tcpstp->sendframep = (uint8_t *)urosAlloc(UROS_TCPROS_HEAP, framelen);
+    if (tcpstp->sendframep == NULL) {
+      tcpstp->err = UROS_ERR_NOMEM;
+      return NULL;
+    }
+    tcpstp->sendframesize = framelen;
+  }
+  return urosTcpRosPutRaw(tcpstp->sendframep, msglen);
+}
+
+/**
+ * @brief   Sends the outgoing frame buffer.
+ * @details The message length prefix and the message contents are written to
+ *          the outgoing TCPROS stream with a single call.
+ * @note    The frame is not kept for latched topics, their last value is set
+ *          once per message by @p urosNodePublish().
+ *
+ * @pre     The frame was prepared by @p urosTcpRosFrameBegin() with the same
+ *          message length, and the message contents were serialized.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status with a working connection.
+ * @param[in] msglen
+ *          Length of the message contents, in bytes.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosFrameSend(UrosTcpRosStatus *tcpstp, uint32_t msglen) {
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(tcpstp->sendframep != NULL);
+  urosAssert(tcpstp->sendframesize >= sizeof(uint32_t) + (size_t)msglen);
+
+  urosTcpRosSend(tcpstp, tcpstp->sendframep,
+                 sizeof(uint32_t) + (size_t)msglen);
+  if (tcpstp->err != UROS_OK) { return tcpstp->err; }
+  ++tcpstp->numMsgs;
+  return UROS_OK;
+}
+
+/**
+ * @brief   Prepares a gathered outgoing frame.
+ * @details The frame buffer is prepared by @p urosTcpRosFrameBegin(), so
+ *          that it can hold the whole frame even if nothing is gathered.
+ *          Payloads are always copied on UDPROS links, which fragment whole
+ *          frames into datagrams.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to an initialized @p UrosTcpRosStatus object.
+ * @param[out] gp
+ *          Pointer to the gathered frame descriptor.
+ * @param[in] msglen
+ *          Length of the message contents, in bytes.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosGatherBegin(UrosTcpRosStatus *tcpstp,
+                                 UrosTcpRosGather *gp, uint32_t msglen) {
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(gp != NULL);
+
+  gp->bufp = urosTcpRosFrameBegin(tcpstp, msglen);
+  if (gp->bufp == NULL) { return tcpstp->err; }
+  gp->stagedp = tcpstp->sendframep;
+  gp->count = 0;
+  gp->maxcount = (tcpstp->udplinkp != NULL) ? 0 : UROS_TCPROS_GATHER_LENGTH;
+  return tcpstp->err = UROS_OK;
+}
+
+/**
+ * @brief   Appends a payload to a gathered frame.
+ * @details Payloads of at least @p UROS_TCPROS_GATHER_MINLEN bytes are
+ *          referenced as a chunk of their own, while there are enough free
+ *          chunks. Otherwise, they are copied into the frame buffer.
+ * @warning A referenced payload must not be modified or deallocated until the
+ *          frame is sent.
+ *
+ * @param[in,out] gp
+ *          Pointer to an initialized @p UrosTcpRosGather object.
+ * @param[in] datap
+ *          Pointer to the payload.
+ * @param[in] length
+ *          Payload length, in bytes. Can be @p 0.
+ */
+void urosTcpRosGather(UrosTcpRosGather *gp,
+                      const void *datap, size_t length) {
+
+  urosAssert(gp != NULL);
+  urosAssert(!(length > 0) || datap != NULL);
+
+  /* Keep a chunk for the copied contents that may follow.*/
+  if (length < UROS_TCPROS_GATHER_MINLEN || gp->count + 3 > gp->maxcount) {
+    gp->bufp = urosTcpRosPut(gp->bufp, datap, length);
+    return;
+  }
+  if (gp->bufp > gp->stagedp) {
+    gp->chunks[gp->count].bufp = gp->stagedp;
+    gp->chunks[gp->count].buflen = (size_t)(gp->bufp - gp->stagedp);
+    ++gp->count;
+    gp->stagedp = gp->bufp;
+  }
+  gp->chunks[gp->count].bufp = datap;
+  gp->chunks[gp->count].buflen = length;
+  ++gp->count;
+}
+
+/**
+ * @brief   Appends a string to a gathered frame.
+ * @details The string length prefix is copied, and its characters are
+ *          appended by @p urosTcpRosGather().
+ *
+ * @param[in,out] gp
+ *          Pointer to an initialized @p UrosTcpRosGather object.
+ * @param[in] strp
+ *          Pointer to a valid @p UrosString object.
+ */
+void urosTcpRosGatherString(UrosTcpRosGather *gp, const UrosString *strp) {
+
+  uint32_t size;
+
+  urosAssert(gp != NULL);
+  urosAssert(urosStringIsValid(strp));
+
+  size = (uint32_t)strp->length;
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, size);
+  urosTcpRosGather(gp, strp->datap, strp->length);
+}
+
+/**
+ * @brief   Sends a gathered frame.
+ * @details The chunks are written with a single call. A frame made of a single
+ *          copied chunk is sent like @p urosTcpRosFrameSend() does.
+ *          It can be called again with the same frame after a timeout.
+ *
+ * @pre     The frame was prepared by @p urosTcpRosGatherBegin(), and the
+ *          message contents were appended.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status with a working connection.
+ * @param[in,out] gp
+ *          Pointer to the gathered frame descriptor.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosGatherSend(UrosTcpRosStatus *tcpstp,
+                                UrosTcpRosGather *gp) {
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(gp != NULL);
+  urosAssert(gp->bufp <= tcpstp->sendframep + tcpstp->sendframesize);
+
+  /* Close the pending copied chunk.*/
+  if (gp->bufp > gp->stagedp) {
+    urosAssert(gp->count < UROS_TCPROS_GATHER_LENGTH);
+    gp->chunks[gp->count].bufp = gp->stagedp;
+    gp->chunks[gp->count].buflen = (size_t)(gp->bufp - gp->stagedp);
+    ++gp->count;
+    gp->stagedp = gp->bufp;
+  }
+
+  if (gp->count == 1) {
+    urosTcpRosSend(tcpstp, gp->chunks[0].bufp, gp->chunks[0].buflen);
+  } else {
+    urosTcpRosSendV(tcpstp, gp->chunks, gp->count);
+  }
+  if (tcpstp->err != UROS_OK) { return tcpstp->err; }
+  ++tcpstp->numMsgs;
+  return UROS_OK;
+}
+
+/**
+ * @brief   Reads some data from a deserialization buffer.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the deserialization buffer pointer. It is advanced by
+ *          @p length bytes if successful.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[out] valuep
+ *          Pointer to the read data.
+ * @param[in] length
+ *          Length of the data to be read, in bytes. Can be @p 0.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosGet(const uint8_t **bufpp, size_t *buflenp,
+                         void *valuep, size_t length) {
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(!(length > 0) || valuep != NULL);
+
+  urosError(length > *buflenp, return UROS_ERR_PARSE,
+            ("Cannot read %u bytes, only %u left\n",
+             (unsigned)length, (unsigned)*buflenp));
+  if (length > 0) {
+    memcpy(valuep, *bufpp, length);
+    *bufpp += length;
+    *buflenp -= length;
+  }
+  return UROS_OK;
+}
+
+/**
+ * @brief   Reads some data from a deserialization buffer.
+ * @details Data is read in a reversed (per-byte) fashion.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the deserialization buffer pointer. It is advanced by
+ *          @p length bytes if successful.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[out] valuep
+ *          Pointer to the read data.
+ * @param[in] length
+ *          Length of the data to be read, in bytes. Can be @p 0.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosGetRev(const uint8_t **bufpp, size_t *buflenp,
+                            void *valuep, size_t length) {
+
+  uint8_t *curp;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(!(length > 0) || valuep != NULL);
+
+  urosError(length > *buflenp, return UROS_ERR_PARSE,
+            ("Cannot read %u bytes, only %u left\n",
+             (unsigned)length, (unsigned)*buflenp));
+  *buflenp -= length;
+  for (curp = (uint8_t *)valuep + length; length > 0; --length) {
+    *--curp = *(*bufpp)++;
+  }
+  return UROS_OK;
+}
+
+/**
+ * @brief   Reads a string from a deserialization buffer.
+ * @details The string data is copied to a new chunk, allocated with
+ *          @p urosTcpRosArenaAlloc().
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the deserialization buffer pointer. It is advanced past
+ *          the string if successful.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena, or @p NULL to allocate the string
+ *          data with @p urosAlloc().
+ * @param[out] strp
+ *          Pointer to an allocated @p UrosString object to be read.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosGetString(const uint8_t **bufpp, size_t *buflenp,
+                               UrosTcpRosArena *arenap,
+                               UrosString *strp) {
+
+  uint32_t length;
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(strp != NULL);
+
+  /* Initialize the string.*/
+  urosStringObjectInit(strp);
+
+  /* Read the string length, and check it against the available data.*/
+  err = urosTcpRosGetRaw(bufpp, buflenp, length);
+  if (err != UROS_OK) { return err; }
+  urosError((size_t)length > *buflenp, return UROS_ERR_PARSE,
+            ("String length %u exceeds the %u bytes left\n",
+             (unsigned)length, (unsigned)*buflenp));
 
+  /* Read the string data.*/
+  if (length > 0) {
+    strp->datap = (char*)urosTcpRosArenaAlloc(arenap, (size_t)length);
+    if (strp->datap == NULL) { return UROS_ERR_NOMEM; }
+    strp->length = (size_t)length;
+    memcpy(strp->datap, *bufpp, strp->length);
+    *bufpp += strp->length;
+    *buflenp -= strp->length;
+  }
   return UROS_OK;
 }
 
 /**
- * @brief   Sends the error string
- * @details The error string is <tt>tcpstp->errstr</tt>.
+ * @brief   Receives a whole message frame.
+ * @details The frame buffer of @p tcpstp is enlarged if it cannot hold
+ *          @p msglen bytes, and the message contents are received into it.
+ *
+ * @pre     The message length prefix was already received.
  *
  * @param[in,out] tcpstp
- *          Pointer to an initialized @p UrosTcpRosStatus object.
+ *          Pointer to a TCPROS status with a working connection.
+ * @param[in] msglen
+ *          Length of the message contents, in bytes.
  * @return
  *          Error code.
+ * @retval UROS_ERR_BADPARAM
+ *          @p msglen exceeds @p UROS_TCPROS_MAXMSGLEN.
  */
-uros_err_t urosTcpRosSendError(UrosTcpRosStatus *tcpstp) {
-
-  uint32_t hdrlen = 0;
-  const UrosString *errstrp, *typestrp, *md5strp;
+uros_err_t urosTcpRosFrameRecv(UrosTcpRosStatus *tcpstp, uint32_t msglen) {
 
   urosAssert(tcpstp != NULL);
-#define _CHKOK  { if (tcpstp->err != UROS_OK) { return tcpstp->err; } }
 
-#define _FIELDSTRING(tcpstp, namep, valuep) { \
-  urosAssert(urosStringNotEmpty(namep)); \
-  urosAssert(valuep != NULL); \
-  hdrlen = (uint32_t)((namep)->length + 1 + (valuep)->length); \
-  urosTcpRosSendRaw(tcpstp, hdrlen); _CHKOK \
-  urosTcpRosSend(tcpstp, (namep)->datap, (namep)->length); _CHKOK \
-  urosTcpRosSend(tcpstp, "=", 1); _CHKOK \
-  urosTcpRosSend(tcpstp, (valuep)->datap, (valuep)->length); _CHKOK }
+  urosError(msglen > UROS_TCPROS_MAXMSGLEN,
+            return tcpstp->err = UROS_ERR_BADPARAM,
+            ("Message length %lu exceeds the maximum %lu\n",
+             (unsigned long)msglen, (unsigned long)UROS_TCPROS_MAXMSGLEN));
 
-  if (tcpstp->topicp == NULL) {
-    typestrp = &dummytype.name;
-    md5strp = &dummytype.md5str;
-    (void)dummytopic;
-  } else {
-    typestrp = &tcpstp->topicp->typep->name;
-    md5strp = &tcpstp->topicp->typep->md5str;
+  if (tcpstp->recvframesize < (size_t)msglen) {
+    urosFree(tcpstp->recvframep);
+    tcpstp->recvframesize = 0;
+    tcpstp->recvframep = (uint8_t *)urosAlloc(UROS_TCPROS_HEAP, (size_t)msglen);
+    if (tcpstp->recvframep == NULL) {
+      return tcpstp->err = UROS_ERR_NOMEM;
+    }
+    tcpstp->recvframesize = (size_t)msglen;
   }
-  errstrp = &tcpstp->errstr;
-
-  hdrlen += (uint32_t)(1 + errfield.length + errstrp->length);
-  hdrlen += (uint32_t)(1 + typefield.length + typestrp->length);
-  hdrlen += (uint32_t)(1 + md5field.length + md5strp->length);
-
-  /* uint32 header_length */
-  urosTcpRosSendRaw(tcpstp, hdrlen); _CHKOK
-
-  /* uint32 field_length, error={str} */
-  _FIELDSTRING(tcpstp, &errfield, errstrp);
-
-  /* uint32 field_length, type={str} */
-  _FIELDSTRING(tcpstp, &typefield, typestrp);
-
-  /* uint32 field_length, md5sum={str} */
-  _FIELDSTRING(tcpstp, &md5field, md5strp);
-
-  return tcpstp->err = UROS_OK;
-#undef _CHKOK
-#undef _FIELDSTRING
+  if (urosTcpRosRecv(tcpstp, tcpstp->recvframep, (size_t)msglen) == UROS_OK) {
+    ++tcpstp->numMsgs;
+  }
+  return tcpstp->err;
 }
 
 /**
@@ -904,115 +2253,62 @@ uros_err_t urosTcpRosSendError(UrosTcpRosStatus *tcpstp) {
 uros_err_t urosTcpRosSendHeader(UrosTcpRosStatus *tcpstp,
                                 uros_bool_t isrequest) {
 
-  uint32_t hdrlen = 0;
-  const UrosString *calleridstrp, *namestrp, *typestrp, *md5strp;
+  UrosIoVec iov[UROS_TCPROS_HDRCHUNKS];
+  uint8_t lengths[UROS_TCPROS_HDRFIELDS * sizeof(uint32_t)];
+  uros_cnt_t count;
 
   urosAssert(tcpstp != NULL);
-  urosAssert(tcpstp->topicp != NULL);
-  urosAssert(tcpstp->topicp->typep != NULL);
-#define _CHKOK  { if (tcpstp->err != UROS_OK) { return tcpstp->err; } }
 
-#define _FIELDSTRING(tcpstp, namep, valuep) { \
-  urosAssert(urosStringNotEmpty(namep)); \
-  urosAssert(valuep != NULL); \
-  hdrlen = (uint32_t)((namep)->length + 1 + (valuep)->length); \
-  urosTcpRosSendRaw(tcpstp, hdrlen); _CHKOK \
-  urosTcpRosSend(tcpstp, (namep)->datap, (namep)->length); _CHKOK \
-  urosTcpRosSend(tcpstp, "=", 1); _CHKOK \
-  urosTcpRosSend(tcpstp, (valuep)->datap, (valuep)->length); _CHKOK }
-
-#define _FIELDBOOL(tcpstp, namep, value) { \
-  urosAssert(urosStringNotEmpty(namep)); \
-  hdrlen = (uint32_t)((namep)->length + 2); \
-  urosTcpRosSendRaw(tcpstp, hdrlen); _CHKOK \
-  urosTcpRosSend(tcpstp, (namep)->datap, (namep)->length); _CHKOK \
-  urosTcpRosSend(tcpstp, (value) ? "=1" : "=0", 2); _CHKOK }
-
-  calleridstrp = &urosNode.config.nodeName;
-  typestrp = &tcpstp->topicp->typep->name;
-  md5strp = &tcpstp->topicp->typep->md5str;
+  /* Send the whole header at once.*/
+  count = uros_tcpros_headerchunks(tcpstp, isrequest, iov, lengths);
+  return urosTcpRosSendV(tcpstp, iov, count);
+}
 
-  hdrlen += (uint32_t)(5 + calleridfield.length + calleridstrp->length);
-  hdrlen += (uint32_t)(5 + md5field.length + md5strp->length);
-  hdrlen += (uint32_t)(5 + typefield.length + typestrp->length);
-  if (isrequest) {
-    namestrp = &tcpstp->topicp->name;
-    if (tcpstp->topicp->flags.service) {
-      hdrlen += (uint32_t)(5 + servicefield.length + namestrp->length);
-      hdrlen += (uint32_t)(6 + persistentfield.length);
-    } else {
-      hdrlen += (uint32_t)(5 + topicfield.length + namestrp->length);
-      hdrlen += (uint32_t)(6 + tcpnodelayfield.length);
-    }
-  } else {
-    namestrp = NULL;
-    if (tcpstp->topicp->flags.service) {
-      hdrlen += (uint32_t)(12 + reqtypefield.length + typestrp->length);
-      hdrlen += (uint32_t)(13 + restypefield.length + typestrp->length);
-    } else {
-      hdrlen += (uint32_t)(6 + latchingfield.length);
-    }
-  }
+/**
+ * @brief   Packs a TCPROS handshake header.
+ * @details Generates the same header fields as @p urosTcpRosSendHeader(),
+ *          into a newly allocated buffer, without the leading header length.
+ *          Used to exchange the header through XMLRPC, as done by UDPROS.
+ *
+ * @param[in] tcpstp
+ *          Pointer to a TCPROS status referencing a topic.
+ * @param[in] isrequest
+ *          Tells if packing a request handshake header, otherwise a response
+ *          one will be generated.
+ * @param[out] hdrp
+ *          Pointer to the packed header string, allocated with
+ *          @p urosAlloc().
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosPackHeader(const UrosTcpRosStatus *tcpstp,
+                                uros_bool_t isrequest,
+                                UrosString *hdrp) {
 
-  /* uint32 header_length */
-  urosTcpRosSendRaw(tcpstp, hdrlen); _CHKOK
+  UrosIoVec iov[UROS_TCPROS_HDRCHUNKS];
+  uint8_t lengths[UROS_TCPROS_HDRFIELDS * sizeof(uint32_t)];
+  uros_cnt_t count, i;
+  char *curp;
 
-  /* uint32 field_length, callerid={str} */
-  _FIELDSTRING(tcpstp, &calleridfield, calleridstrp);
+  urosAssert(tcpstp != NULL);
+  urosAssert(hdrp != NULL);
 
-  if (isrequest) {
-    if (tcpstp->topicp->flags.service) {
-      /* uint32 field_length, service={str} */
-      _FIELDSTRING(tcpstp, &servicefield, namestrp);
-    } else {
-      /* uint32 field_length, topic={str} */
-      _FIELDSTRING(tcpstp, &topicfield, namestrp);
-    }
+  /* Skip the header length chunk.*/
+  count = uros_tcpros_headerchunks(tcpstp, isrequest, iov, lengths);
+  hdrp->length = 0;
+  for (i = 1; i < count; ++i) {
+    hdrp->length += iov[i].buflen;
   }
-
-  /* uint32 field_length, md5sum={str} */
-  _FIELDSTRING(tcpstp, &md5field, md5strp);
-
-  if (tcpstp->topicp->flags.service) {
-    /* uint32 field_length, request_type={str} */
-    hdrlen = 8 + reqtypefield.length + typestrp->length;
-    urosTcpRosSendRaw(tcpstp, hdrlen); _CHKOK
-    urosTcpRosSend(tcpstp, reqtypefield.datap, reqtypefield.length); _CHKOK
-    urosTcpRosSend(tcpstp, "=", 1); _CHKOK
-    urosTcpRosSend(tcpstp, typestrp->datap, typestrp->length); _CHKOK
-    urosTcpRosSend(tcpstp, "Request", 7); _CHKOK
-
-    /* uint32 field_length, response_type={str} */
-    hdrlen = 9 + restypefield.length + typestrp->length;
-    urosTcpRosSendRaw(tcpstp, hdrlen); _CHKOK
-    urosTcpRosSend(tcpstp, restypefield.datap, restypefield.length); _CHKOK
-    urosTcpRosSend(tcpstp, "=", 1); _CHKOK
-    urosTcpRosSend(tcpstp, typestrp->datap, typestrp->length); _CHKOK
-    urosTcpRosSend(tcpstp, "Response", 8); _CHKOK
+  hdrp->datap = (char*)urosAlloc(UROS_TCPROS_HEAP, hdrp->length);
+  if (hdrp->datap == NULL) {
+    hdrp->length = 0;
+    return UROS_ERR_NOMEM;
   }
-
-  /* uint32 field_length, type={str} */
-  _FIELDSTRING(tcpstp, &typefield, typestrp);
-
-  if (isrequest) {
-    if (tcpstp->topicp->flags.service) {
-      /* uint32 field_length, persistent=(0|1) */
-      _FIELDBOOL(tcpstp, &persistentfield, tcpstp->topicp->flags.persistent);
-    } else {
-      /* uint32 field_length, tcp_nodelay=(0|1) */
-      _FIELDBOOL(tcpstp, &tcpnodelayfield, tcpstp->topicp->flags.noDelay);
-    }
-  } else {
-    if (!tcpstp->topicp->flags.service) {
-      /* uint32 field_length, latching=(0|1) */
-      _FIELDBOOL(tcpstp, &latchingfield, tcpstp->topicp->flags.latching);
-    }
+  for (curp = hdrp->datap, i = 1; i < count; ++i) {
+    memcpy(curp, iov[i].bufp, iov[i].buflen);
+    curp += iov[i].buflen;
   }
-
-  return tcpstp->err = UROS_OK;
-#undef _CHKOK
-#undef _FIELDSTRING
-#undef _FIELDBOOL
+  return UROS_OK;
 }
 
 /**
@@ -1086,6 +2382,7 @@ uros_err_t urosTcpRosRecvHeader(UrosTcpRosStatus *tcpstp,
   /* Get each header field.*/
   for (remlen = hdrlen; remlen > 0; remlen -= fieldlen) {
     UrosString *strp = NULL;
+    uros_bool_t intern = UROS_TRUE;
 
     /* Get the field length and check for size consistency.*/
     urosError(remlen < 4, _ERRPARSE,
@@ -1107,6 +2404,7 @@ uros_err_t urosTcpRosRecvHeader(UrosTcpRosStatus *tcpstp,
     } else if (_GOT("error=", 6)) {
       /* error={str} */
       strp = &tcpstp->errstr;
+      intern = UROS_FALSE;
       vallen -= 6;
     } else if (_GOT("latching=", 9)) {
       if (isrequest) { _ERRPARSE }
@@ -1138,6 +2436,7 @@ uros_err_t urosTcpRosRecvHeader(UrosTcpRosStatus *tcpstp,
       vallen -= 19;
 #if UROS_TCPROS_USE_MSGDEF
       strp = &typep->desc;
+      intern = UROS_FALSE;
 #else
       urosTcpRosSkip(tcpstp, vallen);
       continue;
@@ -1235,11 +2534,20 @@ uros_err_t urosTcpRosRecvHeader(UrosTcpRosStatus *tcpstp,
 
     /* Allocate and read the value.*/
     if (vallen > 0) {
-      valp = (char*)urosAlloc(NULL, vallen);
+      valp = (char*)urosAlloc(UROS_TCPROS_HEAP, vallen);
       if (valp == NULL) { tcpstp->err = UROS_ERR_NOMEM; goto _error; }
       strp->length = vallen;
       strp->datap = valp;
       urosTcpRosRecv(tcpstp, valp, vallen); _CHKOK
+      if (intern) {
+        /* Names and checksums are shared with the local descriptors.*/
+        *strp = urosStringInternN(valp, vallen);
+        urosFree(valp);
+        if (strp->datap == NULL) {
+          strp->length = 0;
+          tcpstp->err = UROS_ERR_NOMEM; goto _error;
+        }
+      }
     } else {
       strp->length = 0;
       strp->datap = NULL;
@@ -1290,6 +2598,7 @@ uros_err_t urosTcpRosCallService(const UrosAddr *pubaddrp,
 
   UrosConn conn;
   UrosTcpRosStatus tcpst;
+  uros_err_t err;
 
   urosAssert(pubaddrp != NULL);
   urosAssert(servicep != NULL);
@@ -1305,6 +2614,7 @@ uros_err_t urosTcpRosCallService(const UrosAddr *pubaddrp,
   /* Connect to the remote service host.*/
   urosConnObjectInit(&conn);
   urosTcpRosStatusObjectInit(&tcpst, &conn);
+  tcpst.topicp = (UrosTopic*)servicep;
   tcpst.err = urosConnCreate(&conn, UROS_PROTO_TCP); _CHKOK
   tcpst.err = urosConnConnect(&conn, pubaddrp); _CHKOK
 
@@ -1314,11 +2624,167 @@ uros_err_t urosTcpRosCallService(const UrosAddr *pubaddrp,
 
   /* Call the service handler.*/
   tcpst.err = ((uros_tcpsrvcall_t)servicep->procf)(&tcpst, resobjp); _CHKOK
+  urosTcpRosStatusClean(&tcpst, UROS_FALSE);
   return urosConnClose(&conn);
 
 _error:
+  err = tcpst.err;
+  urosTcpRosStatusClean(&tcpst, UROS_FALSE);
   urosConnClose(&conn);
-  return tcpst.err;
+  return err;
+#undef _CHKOK
+}
+
+/**
+ * @brief   Initializes a persistent TCPROS service client.
+ * @details The client is not connected yet.
+ * @see     urosTcpRosSrvClientConnect()
+ *
+ * @pre     @p servicep->procf must address a @p uros_tcpsrvcall_t function.
+ * @pre     The TCPROS @p service flag must be set.
+ *
+ * @param[in,out] clip
+ *          Pointer to an allocated @p UrosTcpRosSrvClient object.
+ * @param[in] servicep
+ *          Pointer to the service descriptor. Its name is copied.
+ */
+void urosTcpRosSrvClientObjectInit(UrosTcpRosSrvClient *clip,
+                                   const UrosTopic *servicep) {
+
+  urosAssert(clip != NULL);
+  urosAssert(servicep != NULL);
+  urosAssert(urosStringNotEmpty(&servicep->name));
+  urosAssert(servicep->typep != NULL);
+  urosAssert(servicep->procf != NULL);
+  urosAssert(servicep->flags.service);
+
+  urosTopicObjectInit(&clip->service);
+  clip->service.name = urosStringIntern(&servicep->name);
+  urosAssert(clip->service.name.datap != NULL);
+  clip->service.typep = servicep->typep;
+  clip->service.procf = servicep->procf;
+  clip->service.flags = servicep->flags;
+  clip->service.flags.persistent = UROS_TRUE;
+  urosConnObjectInit(&clip->conn);
+  urosTcpRosStatusObjectInit(&clip->tcpst, &clip->conn);
+  clip->connected = UROS_FALSE;
+}
+
+/**
+ * @brief   Cleans a persistent TCPROS service client.
+ * @details Closes the connection, if open, and deallocates the client data.
+ *
+ * @param[in,out] clip
+ *          Pointer to an initialized @p UrosTcpRosSrvClient object.
+ */
+void urosTcpRosSrvClientClean(UrosTcpRosSrvClient *clip) {
+
+  urosAssert(clip != NULL);
+
+  urosTcpRosSrvClientDisconnect(clip);
+  urosStringRelease(&clip->service.name);
+}
+
+/**
+ * @brief   Connects a persistent TCPROS service client.
+ * @details Connects to the service provider, and exchanges the connection
+ *          headers, asking for a @p persistent connection.
+ *
+ * @pre     The client is not connected.
+ * @post    If successful, the client is connected.
+ *
+ * @param[in,out] clip
+ *          Pointer to an initialized @p UrosTcpRosSrvClient object.
+ * @param[in] pubaddrp
+ *          Pointer to the service provider address.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosSrvClientConnect(UrosTcpRosSrvClient *clip,
+                                      const UrosAddr *pubaddrp) {
+
+  UrosTcpRosStatus *tcpstp;
+  uros_err_t err;
+
+  urosAssert(clip != NULL);
+  urosAssert(!clip->connected);
+  urosAssert(pubaddrp != NULL);
+#define _CHKOK  { if (tcpstp->err != UROS_OK) { goto _error; } }
+
+  /* Connect to the remote service host.*/
+  tcpstp = &clip->tcpst;
+  urosTcpRosStatusObjectInit(tcpstp, &clip->conn);
+  tcpstp->topicp = &clip->service;
+  tcpstp->err = urosConnCreate(&clip->conn, UROS_PROTO_TCP); _CHKOK
+  tcpstp->err = urosConnConnect(&clip->conn, pubaddrp); _CHKOK
+  tcpstp->err = urosConnSetTcpNoDelay(&clip->conn, UROS_TRUE); _CHKOK
+
+  /* Send the TCPROS connection header, and its response.*/
+  urosTcpRosSendHeader(tcpstp, UROS_TRUE); _CHKOK
+  urosTcpRosRecvHeader(tcpstp, UROS_FALSE, UROS_FALSE); _CHKOK
+  clip->connected = UROS_TRUE;
+  return UROS_OK;
+
+_error:
+  err = tcpstp->err;
+  urosTcpRosStatusClean(tcpstp, UROS_FALSE);
+  urosConnClose(&clip->conn);
+  return err;
+#undef _CHKOK
+}
+
+/**
+ * @brief   Disconnects a persistent TCPROS service client.
+ * @details The client can be connected again later.
+ *
+ * @post    The client is not connected.
+ *
+ * @param[in,out] clip
+ *          Pointer to an initialized @p UrosTcpRosSrvClient object.
+ */
+void urosTcpRosSrvClientDisconnect(UrosTcpRosSrvClient *clip) {
+
+  urosAssert(clip != NULL);
+
+  if (clip->connected) {
+    urosTcpRosStatusClean(&clip->tcpst, UROS_FALSE);
+    urosConnClose(&clip->conn);
+    clip->connected = UROS_FALSE;
+  }
+}
+
+/**
+ * @brief   Executes a call through a persistent TCPROS service client.
+ * @details The request is sent over the open connection, without connecting
+ *          and exchanging the connection headers again. If the call fails,
+ *          the client is disconnected, because the stream may be left in an
+ *          inconsistent state.
+ *
+ * @pre     The client is connected.
+ *
+ * @param[in,out] clip
+ *          Pointer to a connected @p UrosTcpRosSrvClient object.
+ * @param[out] resobjp
+ *          Pointer to the allocated response object. The service result will
+ *          be written there only if the call is successful.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosSrvClientCall(UrosTcpRosSrvClient *clip, void *resobjp) {
+
+  uros_err_t err;
+
+  urosAssert(clip != NULL);
+  urosAssert(clip->connected);
+  urosAssert(resobjp != NULL);
+
+  /* Call the service handler.*/
+  clip->tcpst.err = UROS_OK;
+  err = ((uros_tcpsrvcall_t)clip->service.procf)(&clip->tcpst, resobjp);
+  if (err != UROS_OK) {
+    urosTcpRosSrvClientDisconnect(clip);
+  }
+  return err;
 }
 
 /**
@@ -1424,8 +2890,8 @@ uros_err_t urosTcpRosListenerThread(void *data) {
  *
  * @pre     The provided connection was accepted by the TCPROS Listener.
  * @pre     The connection was alloacted with @p urosAlloc().
- * @post    The connection is closed and deallocated, and @p csp points to an
- *          invalid address.
+ * @post    The connection is closed and deallocated, or handed to a reactor
+ *          thread, and @p csp points to an invalid address.
  *
  * @param[in] csp
  *          Pointer to the incoming connection.
@@ -1439,22 +2905,36 @@ uros_err_t urosTcpRosServerThread(UrosConn *csp) {
   UrosTcpRosStatus *tcpstp;
   uros_err_t err;
   uros_proc_f handler = NULL;
+  uros_bool_t persistent = UROS_FALSE;
+  size_t recvlen;
 
   urosAssert(csp != NULL);
 
   tcpstp = urosNew(NULL, UrosTcpRosStatus);
   if (tcpstp == NULL) { return UROS_ERR_NOMEM; }
   urosTcpRosStatusObjectInit(tcpstp, csp);
+  if (csp->protocol == UROS_PROTO_UDP) {
+    /* UDPROS link, its connection header was loaded by requestTopic().*/
+    tcpstp->udplinkp = (UrosUdpRosLink*)csp;
+  }
 
   /* Receive the connection header.*/
   err = urosTcpRosRecvHeader(tcpstp, UROS_TRUE, UROS_TRUE);
   if (err != UROS_OK) {
     /* Send the error message.*/
-    tcpstp->errstr = urosStringCloneZ(urosErrorText(err));
-    urosTcpRosSendError(tcpstp);
-    urosStringClean(&tcpstp->errstr);
+    if (tcpstp->udplinkp == NULL) {
+      tcpstp->errstr = urosStringCloneZ(urosErrorText(err));
+      urosTcpRosSendError(tcpstp);
+      urosStringClean(&tcpstp->errstr);
+    }
     goto _finally;
   }
+  urosError(tcpstp->udplinkp != NULL && tcpstp->topicp->flags.service,
+            { urosMsgTypeDelete((UrosMsgType*)tcpstp->topicp->typep);
+              urosTopicDelete(tcpstp->topicp);
+              tcpstp->topicp = NULL;
+              err = UROS_ERR_BADPARAM; goto _finally; },
+            ("Services are not supported by UDPROS\n"));
 
   /* Process the received header, to link to the actual topic/service.*/
   if (tcpstp->topicp->flags.service) {
@@ -1463,6 +2943,12 @@ uros_err_t urosTcpRosServerThread(UrosConn *csp) {
     err = uros_tcpserver_processserviceheader(tcpstp);
     if (err == UROS_OK) {
       handler = tcpstp->topicp->procf;
+      /* Persistent links hold this thread, leave some to the others.*/
+      if (tcpstp->remoteFlags.persistent &&
+          stp->persistentCnt < UROS_TCPROS_MAXPERSISTENT) {
+        ++stp->persistentCnt;
+        persistent = UROS_TRUE;
+      }
     }
     urosMutexUnlock(&stp->pubServiceListLock);
   } else {
@@ -1476,21 +2962,63 @@ uros_err_t urosTcpRosServerThread(UrosConn *csp) {
   }
   if (err != UROS_OK) {
     /* Send an error message.*/
-    tcpstp->errstr = urosStringCloneZ(urosErrorText(err));
-    urosTcpRosSendError(tcpstp);
+    if (tcpstp->udplinkp == NULL) {
+      tcpstp->errstr = urosStringCloneZ(urosErrorText(err));
+      urosTcpRosSendError(tcpstp);
+    }
     goto _finally;
   }
 
-  /* Send the response header.*/
-  err = urosTcpRosSendHeader(tcpstp, UROS_FALSE);
-  if (err != UROS_OK) { goto _finally; }
+  /* Send the response header, UDPROS sent it back through XMLRPC.*/
+  if (tcpstp->udplinkp == NULL) {
+    err = urosTcpRosSendHeader(tcpstp, UROS_FALSE);
+    if (err != UROS_OK) { goto _release; }
+  }
+
+  /* Send the last value of a latched topic.*/
+  if (!tcpstp->topicp->flags.service && tcpstp->topicp->flags.latching &&
+      tcpstp->topicp->fanoutp != NULL) {
+    err = urosTcpRosSendLatched(tcpstp);
+    if (err != UROS_OK) { goto _release; }
+  }
+
+#if UROS_TCPROS_USE_REACTOR
+  /* Let a reactor thread drain the fan-out ring of TCPROS links.*/
+  if (handler == (uros_proc_f)urosTcpRosFanoutDrain &&
+      tcpstp->udplinkp == NULL) {
+    err = urosTcpRosReactorAttachDrain(tcpstp);
+    if (err == UROS_OK) { return UROS_OK; }
+  }
+#endif
 
   /* Call the connection handler.*/
   tcpstp->err = UROS_OK;
   urosAssert(handler != NULL);
   err = handler(tcpstp);
 
-  /* Release the topic/service descriptor reference.*/
+  /* Serve further requests of a persistent service client, which may stay
+     idle for longer than the receive timeout.*/
+  if (err == UROS_OK && persistent) {
+    /* Small request/response exchanges, do not wait for delayed ACKs.*/
+    urosConnSetTcpNoDelay(csp, UROS_TRUE);
+    while (err == UROS_OK && !urosTcpRosStatusCheckExit(tcpstp)) {
+      tcpstp->err = UROS_OK;
+      recvlen = csp->recvlen;
+      err = handler(tcpstp);
+      if (err == UROS_ERR_TIMEOUT && csp->recvlen == recvlen) {
+        err = UROS_OK;
+      }
+    }
+  }
+
+_release:
+  /* Release the persistent link slot and the topic/service reference.*/
+  if (persistent) {
+    urosMutexLock(&stp->pubServiceListLock);
+    --stp->persistentCnt;
+    urosMutexUnlock(&stp->pubServiceListLock);
+  }
+  uros_tcpserver_linkremove(tcpstp);
   if (tcpstp->topicp->flags.service) {
     urosTcpRosServiceDone(tcpstp);
   } else {
@@ -1513,37 +3041,56 @@ _finally:
  *          for processing by the user-defined routine inside the related
  *          descriptor.
  *
+ *          If the publisher is this very node, and the topic is fed by
+ *          @p urosNodePublish(), the handler reads the shared frames of its
+ *          fan-out ring directly, without any sockets. Messages published by
+ *          @p urosNodePublishShared() go to the message handler, if any, as
+ *          objects.
+ *
+ *          When done, the thread goes on with the publisher connections
+ *          left pending by @p urosRpcSlaveConnectToPublishers(), until there
+ *          are no more.
+ *
  * @pre     The thread arguments addressed by @p argsp are allocated with
  *          @p urosAlloc().
  * @post    The thread arguments are deallocated, and @p argsp points to an
  *          invalid address.
  *
  * @param[in] argsp
- *          Pointer to the TCPROS Client worker thread arguments.
+ *          Pointer to the TCPROS Client worker thread arguments, or @p NULL
+ *          to handle only the pending publisher connections.
  * @return
  *          Error code.
  */
 uros_err_t urosTcpRosClientThread(uros_tcpcliargs_t *argsp) {
 
-  uros_err_t err;
-  UrosAddr pubaddr;
-
-  urosAssert(argsp != NULL);
-  urosAssert(urosStringNotEmpty(&argsp->topicName));
-  urosAssert(!argsp->topicFlags.service);
-
-  /* Resolve the publisher address.*/
-  err = urosNodeResolveTopicPublisher(&argsp->remoteAddr,
-                                      &argsp->topicName,
-                                      &pubaddr);
-  if (err != UROS_OK) { goto _finally; }
+  static UrosNodeStatus *const stp = &urosNode.status;
 
-  /* Start a new TCPROS topic subscripion.*/
-  err = uros_tcpcli_topicsubscription(&argsp->topicName, &pubaddr);
+  uros_err_t err = UROS_OK;
+  UrosListNode *pendp;
+  uros_bool_t exitFlag;
 
-_finally:
-  urosTopicSubParamsDelete(argsp);
-  return err;
+  while (UROS_TRUE) {
+    if (argsp != NULL) {
+      err = uros_tcpcli_publisher(argsp);
+    }
+
+    /* Take the next pending publisher connection, if any.*/
+    urosMutexLock(&stp->stateLock);
+    exitFlag = stp->exitFlag;
+    urosMutexUnlock(&stp->stateLock);
+    urosMutexLock(&stp->tcpcliPendingLock);
+    pendp = exitFlag ? NULL : stp->tcpcliPendingList.headp;
+    if (pendp == NULL) {
+      --stp->tcpcliBusyCnt;
+      urosMutexUnlock(&stp->tcpcliPendingLock);
+      return err;
+    }
+    urosListRemove(&stp->tcpcliPendingList, pendp);
+    urosMutexUnlock(&stp->tcpcliPendingLock);
+    argsp = (uros_tcpcliargs_t *)pendp->datap;
+    urosListNodeDelete(pendp, NULL);
+  }
 }
 
 /**
@@ -1644,4 +3191,634 @@ void urosTcpRosServiceDone(UrosTcpRosStatus *tcpstp) {
   urosMutexUnlock(&stp->pubServiceListLock);
 }
 
+#if UROS_TCPROS_USE_REACTOR || defined(__DOXYGEN__)
+
+/**
+ * @brief   Initializes the TCPROS reactors.
+ * @note    Should be called once, at node initialization.
+ */
+void urosTcpRosReactorObjectInit(void) {
+
+  uros_err_t err;
+  (void)err;
+
+  err = uros_lld_reactor_init();
+  urosAssert(err == UROS_OK);
+}
+
+/**
+ * @brief   TCPROS reactor thread.
+ * @details This thread multiplexes the TCPROS links attached to its reactor,
+ *          calling the frame handler of their topic for each complete
+ *          incoming frame, until the node is asked to exit.
+ * @see     urosTcpRosReactorAttach()
+ *
+ * @post    All the links of the reactor are detached.
+ *
+ * @param[in] argp
+ *          Reactor index, casted to a pointer.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosReactorThread(void *argp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  unsigned index = (unsigned)(size_t)argp;
+  uros_bool_t exitFlag;
+  uros_err_t err;
+
+  urosAssert(index < UROS_TCPROS_REACTOR_THREADS);
+
+  do {
+    err = uros_lld_reactor_poll(index, UROS_TCPROS_RECVTIMEOUT);
+    urosError(err != UROS_OK, break,
+              ("Error %s while polling reactor #%u\n",
+               urosErrorText(err), index));
+    urosMutexLock(&stp->stateLock);
+    exitFlag = stp->exitFlag;
+    urosMutexUnlock(&stp->stateLock);
+  } while (!exitFlag);
+
+  uros_lld_reactor_detachall(index);
+  return err;
+}
+
+/**
+ * @brief   Attaches a subscribed TCPROS link to a reactor thread.
+ * @details From now on, the link is handled by a reactor thread, which calls
+ *          the frame handler of the topic for each complete incoming frame.
+ *          The link is detached, closed and deallocated when the remote
+ *          closes it, the frame handler fails, or its exit is requested.
+ *
+ * @pre     The TCPROS handshake was completed.
+ * @pre     The topic has the @p reactor flag set, and a @p framef handler.
+ * @pre     @p tcpstp and its connection were allocated with @p urosAlloc().
+ * @post    If successful, @p tcpstp is owned by the reactor, and the caller
+ *          must not access it anymore.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status with a working connection.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosReactorAttach(UrosTcpRosStatus *tcpstp) {
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(tcpstp->topicp != NULL);
+  urosAssert(tcpstp->topicp->flags.reactor);
+
+  return uros_lld_reactor_attach(tcpstp, UROS_FALSE);
+}
+
+/**
+ * @brief   Attaches a published TCPROS link to a reactor thread.
+ * @details The link is registered as a reader of the fan-out ring of its
+ *          topic, as done by @p urosTcpRosFanoutDrain(). From now on, a
+ *          reactor thread sends the pushed frames whenever the socket has
+ *          room, without blocking on slow subscribers.
+ *          The link is detached, closed and deallocated when the remote
+ *          closes it, the ring is closed, or its exit is requested.
+ *
+ * @pre     The TCPROS handshake was completed.
+ * @pre     The topic is published with a fan-out ring.
+ * @pre     @p tcpstp and its connection were allocated with @p urosAlloc().
+ * @post    If successful, @p tcpstp is owned by the reactor, and the caller
+ *          must not access it anymore.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status with a working connection.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosReactorAttachDrain(UrosTcpRosStatus *tcpstp) {
+
+  UrosTcpRosFanout *fop;
+  UrosListNode *readernodep;
+  uros_err_t err;
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(tcpstp->topicp != NULL);
+  urosAssert(tcpstp->topicp->fanoutp != NULL);
+
+  fop = tcpstp->topicp->fanoutp;
+  readernodep = urosNew(NULL, UrosListNode);
+  if (readernodep == NULL) { return UROS_ERR_NOMEM; }
+  urosListNodeObjectInit(readernodep);
+  readernodep->datap = tcpstp;
+
+  /* Register as a reader, as urosTcpRosFanoutDrain() does. The ring is held
+     until the reactor owns the link, so that pushes always notify it.*/
+  urosMutexLock(&fop->lock);
+  if (!tcpstp->topicp->flags.latching) {
+    tcpstp->fanoutSeq = fop->headSeq;
+  }
+  urosListAdd(&fop->readerList, readernodep);
+  err = uros_lld_reactor_attach(tcpstp, UROS_TRUE);
+  if (err != UROS_OK) {
+    urosListRemove(&fop->readerList, readernodep);
+    urosMutexUnlock(&fop->lock);
+    urosListNodeDelete(readernodep, NULL);
+    return err;
+  }
+  urosMutexUnlock(&fop->lock);
+  return UROS_OK;
+}
+
+#endif /* UROS_TCPROS_USE_REACTOR || defined(__DOXYGEN__) */
+
+/**
+ * @brief   Handles a frame received by a reactor thread.
+ * @details Calls the frame handler of the topic referenced by the link.
+ *
+ * @pre     Called by a reactor thread.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status handled by a reactor.
+ * @param[in] framep
+ *          Pointer to the message frame body, without the length prefix.
+ * @param[in] framelen
+ *          Length of the message frame body, in bytes.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosReactorFrame(UrosTcpRosStatus *tcpstp,
+                                  const uint8_t *framep, size_t framelen) {
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(tcpstp->topicp != NULL);
+  urosAssert(tcpstp->topicp->framef != NULL);
+  urosAssert(!(framelen > 0) || (framep != NULL));
+
+  ++tcpstp->numMsgs;
+  tcpstp->err = tcpstp->topicp->framef(tcpstp, framep, framelen);
+  return tcpstp->err;
+}
+
+/**
+ * @brief   Fetches the next frame to be sent by a reactor drain link.
+ * @details References the next frame of the fan-out ring of the topic, if
+ *          any. If the link has sent all the pushed frames, the reactor
+ *          stops polling it for writing, until the next push.
+ *
+ * @pre     Called by a reactor thread, for a link attached by
+ *          @p urosTcpRosReactorAttachDrain().
+ * @post    The frame must be released by @p urosTcpRosReactorRelease().
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status handled by a reactor.
+ * @param[out] framepp
+ *          Pointer to the fetched frame, or @p NULL if there are none.
+ * @return
+ *          Error code.
+ * @retval UROS_ERR_EOF
+ *          The ring was closed, or the exit of the link was requested.
+ */
+uros_err_t urosTcpRosReactorNext(UrosTcpRosStatus *tcpstp,
+                                 UrosTcpRosFrame **framepp) {
+
+  UrosTcpRosFanout *fop;
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(tcpstp->topicp != NULL);
+  urosAssert(tcpstp->topicp->fanoutp != NULL);
+  urosAssert(framepp != NULL);
+
+  fop = tcpstp->topicp->fanoutp;
+  *framepp = NULL;
+  tcpstp->err = UROS_OK;
+  urosMutexLock(&fop->lock);
+  if (fop->closed || urosTcpRosStatusCheckExit(tcpstp)) {
+    tcpstp->err = UROS_ERR_EOF;
+  } else if (tcpstp->fanoutSeq == fop->headSeq) {
+#if UROS_TCPROS_USE_REACTOR
+    uros_lld_reactor_wantsend(tcpstp, UROS_FALSE);
+#endif
+  } else {
+    *framepp = uros_tcpfanout_next(fop, tcpstp);
+  }
+  urosMutexUnlock(&fop->lock);
+  return tcpstp->err;
+}
+
+/**
+ * @brief   Releases a frame fetched by a reactor drain link.
+ * @details If the frame was sent, the link moves to the next one, and
+ *          blocked producers are woken up.
+ *
+ * @pre     Called by a reactor thread, for a frame fetched by
+ *          @p urosTcpRosReactorNext().
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status handled by a reactor.
+ * @param[in] framep
+ *          Pointer to the fetched frame.
+ * @param[in] sent
+ *          The whole frame was sent.
+ */
+void urosTcpRosReactorRelease(UrosTcpRosStatus *tcpstp,
+                              UrosTcpRosFrame *framep, uros_bool_t sent) {
+
+  UrosTcpRosFanout *fop;
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(tcpstp->topicp != NULL);
+  urosAssert(tcpstp->topicp->fanoutp != NULL);
+  urosAssert(framep != NULL);
+
+  fop = tcpstp->topicp->fanoutp;
+  urosMutexLock(&fop->lock);
+  urosTcpRosFrameRelease(framep);
+  if (sent) {
+    ++tcpstp->numMsgs;
+    ++tcpstp->fanoutSeq;
+    urosCondVarBroadcast(&fop->drainedCond);
+  }
+  urosMutexUnlock(&fop->lock);
+}
+
+/**
+ * @brief   Notifies that a reactor has detached a TCPROS link.
+ * @details Unlinks the connection from the node, and from the fan-out ring of
+ *          drain links, releases its topic reference, then closes and
+ *          deallocates the link.
+ *
+ * @pre     Called by a reactor thread, after the link was detached.
+ * @post    @p tcpstp points to an invalid address.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status handled by a reactor.
+ */
+void urosTcpRosReactorDone(UrosTcpRosStatus *tcpstp) {
+
+  UrosTcpRosFanout *fop;
+  UrosListNode *readernodep;
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(tcpstp->topicp != NULL);
+
+  if (tcpstp->topicp->procf == (uros_proc_f)urosTcpRosFanoutDrain) {
+    /* Unregister the reader of a drain link.*/
+    fop = tcpstp->topicp->fanoutp;
+    urosMutexLock(&fop->lock);
+    for (readernodep = fop->readerList.headp;
+         readernodep->datap != (void*)tcpstp;
+         readernodep = readernodep->nextp) {}
+    urosListRemove(&fop->readerList, readernodep);
+    urosCondVarBroadcast(&fop->drainedCond);
+    urosMutexUnlock(&fop->lock);
+    urosListNodeDelete(readernodep, NULL);
+    uros_tcpserver_linkremove(tcpstp);
+    urosTcpRosTopicPublisherDone(tcpstp);
+  } else {
+    uros_tcpcli_linkremove(tcpstp);
+    urosTcpRosTopicSubscriberDone(tcpstp);
+  }
+  urosConnClose(tcpstp->csp);
+  urosTcpRosStatusDelete(tcpstp, UROS_TRUE);
+}
+
+/**
+ * @brief   Allocates a shared TCPROS message frame.
+ * @details The frame is allocated with enough room for the length prefix and
+ *          the message body. The length prefix is already written.
+ *
+ * @post    The frame has a single reference, owned by the caller.
+ *
+ * @param[in] msglen
+ *          Length of the message body, in bytes.
+ * @return
+ *          Pointer to the allocated frame, or @p NULL.
+ */
+UrosTcpRosFrame *urosTcpRosFrameNew(uint32_t msglen) {
+
+  UrosTcpRosFrame *framep;
+
+  framep = (UrosTcpRosFrame*)urosAlloc(UROS_TCPROS_HEAP,
+                                       sizeof(UrosTcpRosFrame) +
+                                       sizeof(uint32_t) + msglen);
+  if (framep == NULL) { return NULL; }
+  framep->refcnt = 1;
+  framep->length = sizeof(uint32_t) + msglen;
+  framep->msgp = NULL;
+  framep->msgdelf = NULL;
+  framep->serializef = NULL;
+  (void)urosTcpRosPutRaw(urosTcpRosFrameData(framep), msglen);
+  return framep;
+}
+
+/**
+ * @brief   Releases a reference to a shared TCPROS message frame.
+ * @details The frame is deallocated along with its message object, if any,
+ *          when its last reference is released.
+ * @note    Shared frames are released while holding the lock of their ring.
+ *
+ * @param[in,out] framep
+ *          Pointer to a frame allocated by @p urosTcpRosFrameNew().
+ */
+void urosTcpRosFrameRelease(UrosTcpRosFrame *framep) {
+
+  urosAssert(framep != NULL);
+  urosAssert(framep->refcnt > 0);
+
+  if (--framep->refcnt == 0) {
+    if (framep->msgp != NULL) {
+      framep->msgdelf(framep->msgp);
+    }
+    urosFree(framep);
+  }
+}
+
+/**
+ * @brief   Initializes a TCPROS fan-out ring.
+ * @details The ring is initialized as empty and open.
+ *
+ * @param[in,out] fop
+ *          Pointer to an allocated @p UrosTcpRosFanout object.
+ */
+void urosTcpRosFanoutObjectInit(UrosTcpRosFanout *fop) {
+
+  urosAssert(fop != NULL);
+
+  memset(fop->frames, 0, sizeof(fop->frames));
+  fop->headSeq = 0;
+  urosListObjectInit(&fop->readerList);
+  fop->numDropped = 0;
+  fop->closed = UROS_FALSE;
+  urosMutexObjectInit(&fop->lock);
+  urosCondVarObjectInit(&fop->pushedCond);
+  urosCondVarObjectInit(&fop->drainedCond);
+}
+
+/**
+ * @brief   Cleans a TCPROS fan-out ring.
+ * @details Releases the frames held by the ring.
+ *
+ * @pre     No connections are draining the ring.
+ *
+ * @param[in,out] fop
+ *          Pointer to an initialized @p UrosTcpRosFanout object.
+ */
+void urosTcpRosFanoutClean(UrosTcpRosFanout *fop) {
+
+  unsigned i;
+
+  urosAssert(fop != NULL);
+  urosAssert(fop->readerList.length == 0);
+
+  for (i = 0; i < UROS_TCPROS_FANOUT_LENGTH; ++i) {
+    if (fop->frames[i] != NULL) {
+      urosTcpRosFrameRelease(fop->frames[i]);
+      fop->frames[i] = NULL;
+    }
+  }
+  urosCondVarClean(&fop->drainedCond);
+  urosCondVarClean(&fop->pushedCond);
+  urosMutexClean(&fop->lock);
+}
+
+/**
+ * @brief   Allocates a TCPROS fan-out ring.
+ *
+ * @return
+ *          Pointer to the initialized ring, or @p NULL.
+ */
+UrosTcpRosFanout *urosTcpRosFanoutNew(void) {
+
+  UrosTcpRosFanout *fop;
+
+  fop = urosNew(NULL, UrosTcpRosFanout);
+  if (fop != NULL) {
+    urosTcpRosFanoutObjectInit(fop);
+  }
+  return fop;
+}
+
+/**
+ * @brief   Deallocates a TCPROS fan-out ring.
+ *
+ * @pre     No connections are draining the ring.
+ * @post    @p fop points to an invalid address.
+ *
+ * @param[in] fop
+ *          Pointer to an initialized @p UrosTcpRosFanout object, or @p NULL.
+ */
+void urosTcpRosFanoutDelete(UrosTcpRosFanout *fop) {
+
+  if (fop != NULL) {
+    urosTcpRosFanoutClean(fop);
+    urosFree(fop);
+  }
+}
+
+/**
+ * @brief   Pushes a frame into a TCPROS fan-out ring.
+ * @details The frame becomes the newest of the ring, replacing the oldest
+ *          one. Each draining connection will send it once, so that the
+ *          message is serialized only once for all the subscribers.
+ *
+ *          Connections lagging behind by more than the ring length skip the
+ *          oldest frames. If @p blocking, the caller waits until the slowest
+ *          connection has room for the new frame instead.
+ *
+ * @post    The caller reference to the frame is taken by the ring, even if
+ *          unsuccessful.
+ *
+ * @param[in,out] fop
+ *          Pointer to an initialized @p UrosTcpRosFanout object.
+ * @param[in] framep
+ *          Pointer to a frame allocated by @p urosTcpRosFrameNew().
+ * @param[in] blocking
+ *          Waits for slow connections, instead of making them skip frames.
+ * @return
+ *          Error code.
+ * @retval UROS_ERR_NOCONN
+ *          The ring was closed.
+ */
+uros_err_t urosTcpRosFanoutPush(UrosTcpRosFanout *fop,
+                                UrosTcpRosFrame *framep,
+                                uros_bool_t blocking) {
+
+  UrosTcpRosFrame **slotpp;
+
+  urosAssert(fop != NULL);
+  urosAssert(framep != NULL);
+  urosAssert(framep->refcnt == 1);
+
+  urosMutexLock(&fop->lock);
+  if (blocking) {
+    while (!fop->closed &&
+           uros_tcpfanout_maxlag(fop) >= UROS_TCPROS_FANOUT_LENGTH) {
+      urosCondVarWait(&fop->drainedCond, &fop->lock);
+    }
+  }
+  if (fop->closed) {
+    urosMutexUnlock(&fop->lock);
+    urosTcpRosFrameRelease(framep);
+    return UROS_ERR_NOCONN;
+  }
+
+  /* Replace the oldest frame.*/
+  slotpp = &fop->frames[fop->headSeq % UROS_TCPROS_FANOUT_LENGTH];
+  if (*slotpp != NULL) {
+    urosTcpRosFrameRelease(*slotpp);
+  }
+  *slotpp = framep;
+  ++fop->headSeq;
+  urosCondVarBroadcast(&fop->pushedCond);
+  uros_tcpfanout_notify(fop);
+  urosMutexUnlock(&fop->lock);
+  return UROS_OK;
+}
+
+/**
+ * @brief   Closes a TCPROS fan-out ring.
+ * @details No more frames can be pushed. Draining connections and blocked
+ *          producers are woken up, and they return.
+ *
+ * @param[in,out] fop
+ *          Pointer to an initialized @p UrosTcpRosFanout object.
+ */
+void urosTcpRosFanoutClose(UrosTcpRosFanout *fop) {
+
+  urosAssert(fop != NULL);
+
+  urosMutexLock(&fop->lock);
+  fop->closed = UROS_TRUE;
+  urosCondVarBroadcast(&fop->pushedCond);
+  urosCondVarBroadcast(&fop->drainedCond);
+  uros_tcpfanout_notify(fop);
+  urosMutexUnlock(&fop->lock);
+}
+
+/**
+ * @brief   Wakes up the connections draining a TCPROS fan-out ring.
+ * @details Lets them check their exit flag.
+ *
+ * @param[in,out] fop
+ *          Pointer to an initialized @p UrosTcpRosFanout object.
+ */
+void urosTcpRosFanoutWakeup(UrosTcpRosFanout *fop) {
+
+  urosAssert(fop != NULL);
+
+  urosMutexLock(&fop->lock);
+  urosCondVarBroadcast(&fop->pushedCond);
+  uros_tcpfanout_notify(fop);
+  urosMutexUnlock(&fop->lock);
+}
+
+/**
+ * @brief   Sends the latched frame of a topic.
+ * @details Sends the last frame published on the topic, if any, so that a
+ *          new subscriber does not have to wait for the next message.
+ *          Frames published later are sent by @p urosTcpRosFanoutDrain().
+ *
+ * @pre     The TCPROS handshake was completed.
+ * @pre     The topic is latched, and it has a fan-out ring.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status with a working connection.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosSendLatched(UrosTcpRosStatus *tcpstp) {
+
+  UrosTcpRosFanout *fop;
+  UrosTcpRosFrame *framep;
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(tcpstp->topicp != NULL);
+  urosAssert(tcpstp->topicp->flags.latching);
+  urosAssert(tcpstp->topicp->fanoutp != NULL);
+
+  /* Reference the newest frame.*/
+  fop = tcpstp->topicp->fanoutp;
+  urosMutexLock(&fop->lock);
+  tcpstp->fanoutSeq = fop->headSeq;
+  framep = fop->frames[(fop->headSeq - 1) % UROS_TCPROS_FANOUT_LENGTH];
+  if (framep != NULL) {
+    ++framep->refcnt;
+    uros_tcpframe_serialize(framep);
+  }
+  urosMutexUnlock(&fop->lock);
+  if (framep == NULL) { return tcpstp->err = UROS_OK; }
+
+  /* Send the frame without holding the ring.*/
+  uros_tcpfanout_send(tcpstp, framep);
+
+  urosMutexLock(&fop->lock);
+  urosTcpRosFrameRelease(framep);
+  urosMutexUnlock(&fop->lock);
+  return tcpstp->err;
+}
+
+/**
+ * @brief   TCPROS fan-out topic handler.
+ * @details Sends the frames pushed into the fan-out ring of the topic, from
+ *          the first one pushed after the connection was established (or
+ *          after the latched frame, for latched topics), until the ring is
+ *          closed or the exit of the connection is requested.
+ *          Each frame is sent as is, without serializing the message again.
+ * @note    Used as the handler of the topics published with a fan-out ring.
+ * @note    TCPROS links are drained by a reactor thread instead, if enabled.
+ * @see     urosTcpRosReactorAttachDrain()
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status with a working connection.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosTcpRosFanoutDrain(UrosTcpRosStatus *tcpstp) {
+
+  UrosTcpRosFanout *fop;
+  UrosListNode *readernodep;
+  UrosTcpRosFrame *framep;
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(tcpstp->topicp != NULL);
+  urosAssert(tcpstp->topicp->fanoutp != NULL);
+
+  fop = tcpstp->topicp->fanoutp;
+  readernodep = urosNew(NULL, UrosListNode);
+  if (readernodep == NULL) { return tcpstp->err = UROS_ERR_NOMEM; }
+  urosListNodeObjectInit(readernodep);
+  readernodep->datap = tcpstp;
+
+  /* Register as a reader, waiting for the next frame. Latched topics go on
+     from the frame sent by urosTcpRosSendLatched().*/
+  urosMutexLock(&fop->lock);
+  if (!tcpstp->topicp->flags.latching) {
+    tcpstp->fanoutSeq = fop->headSeq;
+  }
+  urosListAdd(&fop->readerList, readernodep);
+
+  tcpstp->err = UROS_OK;
+  for (;;) {
+    while (tcpstp->fanoutSeq == fop->headSeq && !fop->closed &&
+           !urosTcpRosStatusCheckExit(tcpstp)) {
+      urosCondVarWait(&fop->pushedCond, &fop->lock);
+    }
+    if (fop->closed || urosTcpRosStatusCheckExit(tcpstp)) { break; }
+    framep = uros_tcpfanout_next(fop, tcpstp);
+    urosMutexUnlock(&fop->lock);
+
+    /* Send the frame without holding the ring.*/
+    uros_tcpfanout_send(tcpstp, framep);
+
+    urosMutexLock(&fop->lock);
+    urosTcpRosFrameRelease(framep);
+    if (tcpstp->err != UROS_OK) { break; }
+    ++tcpstp->fanoutSeq;
+    urosCondVarBroadcast(&fop->drainedCond);
+  }
+
+  /* Unregister the reader.*/
+  urosListRemove(&fop->readerList, readernodep);
+  urosCondVarBroadcast(&fop->drainedCond);
+  urosMutexUnlock(&fop->lock);
+  urosListNodeDelete(readernodep, NULL);
+  return tcpstp->err;
+}
+
 /** @} */
@@ -0,0 +1,642 @@
+/*
+Copyright (c) 2012-2013, Politecnico di Milano. All rights reserved.
+
+Andrea Zoppi <texzk@email.it>
+Martino Migliavacca <martino.migliavacca@gmail.com>
+
+http://airlab.elet.polimi.it/
+http://www.openrobots.com/
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file    urosUdpRos.c
+ * @author  Andrea Zoppi <texzk@email.it>
+ *
+ * @brief   UDPROS features of the middleware.
+ */
+
+/*===========================================================================*/
+/* HEADER FILES                                                              */
+/*===========================================================================*/
+
+#include "../include/urosBase.h"
+#include "../include/urosUser.h"
+#include "../include/urosUdpRos.h"
+#include "../include/urosNode.h"
+#include "../include/urosRpcCall.h"
+
+#include <string.h>
+
+/*===========================================================================*/
+/* LOCAL TYPES & MACROS                                                      */
+/*===========================================================================*/
+
+#if UROS_UDPROS_C_USE_ASSERT == UROS_FALSE && !defined(__DOXYGEN__)
+#undef urosAssert
+#define urosAssert(expr)
+#endif
+
+#if UROS_UDPROS_C_USE_ERROR_MSG == UROS_FALSE && !defined(__DOXYGEN__)
+#undef urosError
+#define urosError(when, action, msgargs) { if (when) { action; } }
+#endif
+
+/*===========================================================================*/
+/* LOCAL VARIABLES                                                           */
+/*===========================================================================*/
+
+static const UrosString udprosstr = { 6, "UDPROS" };
+
+/** @brief Last UDPROS connection ID, protected by the published topics lock.*/
+static uint32_t uros_udpros_lastconnid = 0;
+
+/*===========================================================================*/
+/* LOCAL FUNCTIONS                                                           */
+/*===========================================================================*/
+
+size_t uros_udpros_iptostr(char *bufp, UrosIp ip) {
+
+  uint8_t fields[4];
+  char *curp = bufp;
+  unsigned i, value;
+
+  fields[0] = ip.fields.field1;
+  fields[1] = ip.fields.field2;
+  fields[2] = ip.fields.field3;
+  fields[3] = ip.fields.field4;
+  for (i = 0; i < 4; ++i) {
+    value = fields[i];
+    if (value >= 100) { *curp++ = (char)('0' + value / 100); }
+    if (value >= 10) { *curp++ = (char)('0' + (value / 10) % 10); }
+    *curp++ = (char)('0' + value % 10);
+    if (i < 3) { *curp++ = '.'; }
+  }
+  return (size_t)(curp - bufp);
+}
+
+uros_err_t uros_udpros_reserve(UrosUdpRosLink *linkp, size_t length) {
+
+  if (linkp->msgsize < length) {
+    urosFree(linkp->msgp);
+    linkp->msgsize = 0;
+    linkp->msgp = (uint8_t*)urosAlloc(UROS_TCPROS_HEAP, length);
+    if (linkp->msgp == NULL) { return UROS_ERR_NOMEM; }
+    linkp->msgsize = length;
+  }
+  return UROS_OK;
+}
+
+void uros_udpros_drop(UrosUdpRosLink *linkp) {
+
+  if (linkp->nextBlock > 0) {
+    ++linkp->numDropped;
+  }
+  linkp->nextBlock = 0;
+  linkp->msglen = 0;
+  linkp->msgfill = 0;
+  linkp->msgoff = 0;
+}
+
+uros_err_t uros_udpros_recvdgram(UrosUdpRosLink *linkp) {
+
+  const uint8_t *bufp;
+  size_t buflen;
+  uint32_t connid, framelen;
+  uint16_t block;
+  uint8_t opcode, msgid;
+  uros_err_t err;
+
+  /* Receive the next datagram.*/
+  buflen = linkp->dgramSize;
+  err = urosConnRecvFrom(&linkp->conn, (void**)&bufp, &buflen, NULL);
+  if (err != UROS_OK) { return err; }
+
+  /* Decode the datagram header, ignoring foreign datagrams.*/
+  if (buflen < UROS_UDPROS_HDRLEN) { return UROS_OK; }
+  urosTcpRosGetRaw(&bufp, &buflen, connid);
+  urosTcpRosGetRaw(&bufp, &buflen, opcode);
+  urosTcpRosGetRaw(&bufp, &buflen, msgid);
+  urosTcpRosGetRaw(&bufp, &buflen, block);
+  if (connid != linkp->connId) { return UROS_OK; }
+
+  switch (opcode) {
+  case UROS_UDPROS_OP_DATA0: {
+    /* First block, with the frame length prefix.*/
+    uros_udpros_drop(linkp);
+    if (block == 0 || buflen < sizeof(uint32_t)) { return UROS_OK; }
+    {
+      const uint8_t *lenp = bufp;
+      size_t lenlen = buflen;
+      urosTcpRosGetRaw(&lenp, &lenlen, framelen);
+    }
+    urosError(framelen > UROS_TCPROS_MAXMSGLEN,
+              { ++linkp->numDropped; return UROS_OK; },
+              ("Message length %lu exceeds the maximum %lu, dropped\n",
+               (unsigned long)framelen,
+               (unsigned long)UROS_TCPROS_MAXMSGLEN));
+    if ((size_t)framelen + sizeof(uint32_t) < buflen) { return UROS_OK; }
+    err = uros_udpros_reserve(linkp, (size_t)framelen + sizeof(uint32_t));
+    if (err != UROS_OK) { return err; }
+    memcpy(linkp->msgp, bufp, buflen);
+    linkp->recvMsgId = msgid;
+    linkp->numBlocks = block;
+    linkp->nextBlock = 1;
+    linkp->msglen = (size_t)framelen + sizeof(uint32_t);
+    linkp->msgfill = buflen;
+    break;
+  }
+  case UROS_UDPROS_OP_DATAN: {
+    /* Further block, which must be the next one of the current message.*/
+    if (linkp->nextBlock == 0) { return UROS_OK; }
+    if (msgid != linkp->recvMsgId || block != linkp->nextBlock ||
+        buflen > linkp->msglen - linkp->msgfill) {
+      uros_udpros_drop(linkp);
+      return UROS_OK;
+    }
+    memcpy(linkp->msgp + linkp->msgfill, bufp, buflen);
+    linkp->msgfill += buflen;
+    ++linkp->nextBlock;
+    break;
+  }
+  case UROS_UDPROS_OP_PING: {
+    return UROS_OK;
+  }
+  case UROS_UDPROS_OP_ERR: {
+    uros_udpros_drop(linkp);
+    return UROS_ERR_EOF;
+  }
+  default: {
+    return UROS_OK;
+  }
+  }
+
+  /* Check if the message is complete.*/
+  if (linkp->nextBlock == linkp->numBlocks) {
+    if (linkp->msgfill == linkp->msglen) {
+      linkp->nextBlock = 0;
+      linkp->msgoff = 0;
+    } else {
+      uros_udpros_drop(linkp);
+    }
+  }
+  return UROS_OK;
+}
+
+/*===========================================================================*/
+/* GLOBAL FUNCTIONS                                                          */
+/*===========================================================================*/
+
+/** @addtogroup udpros_funcs */
+/** @{ */
+
+/**
+ * @brief   Initializes a UDPROS link.
+ * @details The connection is initialized, but not created. No frames are
+ *          pending.
+ *
+ * @param[in,out] linkp
+ *          Pointer to an allocated @p UrosUdpRosLink object.
+ */
+void urosUdpRosLinkObjectInit(UrosUdpRosLink *linkp) {
+
+  urosAssert(linkp != NULL);
+
+  memset(linkp, 0, sizeof(UrosUdpRosLink));
+  urosConnObjectInit(&linkp->conn);
+  linkp->dgramSize = UROS_UDPROS_DGRAMSIZE;
+}
+
+/**
+ * @brief   Cleans a UDPROS link.
+ * @details Deallocates the incoming frame buffer. The connection is left
+ *          untouched.
+ *
+ * @param[in,out] linkp
+ *          Pointer to an initialized @p UrosUdpRosLink object.
+ */
+void urosUdpRosLinkClean(UrosUdpRosLink *linkp) {
+
+  urosAssert(linkp != NULL);
+
+  urosFree(linkp->msgp);
+  linkp->msgp = NULL;
+  linkp->msgsize = 0;
+  linkp->msglen = 0;
+  linkp->msgfill = 0;
+  linkp->msgoff = 0;
+  linkp->nextBlock = 0;
+}
+
+/**
+ * @brief   Deallocates a UDPROS link.
+ * @details Closes the connection, cleans the link, and deallocates it.
+ *
+ * @pre     The link was allocated with @p urosAlloc().
+ * @post    @p linkp points to an invalid address.
+ *
+ * @param[in] linkp
+ *          Pointer to an initialized @p UrosUdpRosLink object, or @p NULL.
+ */
+void urosUdpRosLinkDelete(UrosUdpRosLink *linkp) {
+
+  if (linkp != NULL) {
+    if (urosConnIsValid(&linkp->conn)) {
+      urosConnClose(&linkp->conn);
+    }
+    urosUdpRosLinkClean(linkp);
+    urosFree(linkp);
+  }
+}
+
+/**
+ * @brief   Loads a handshake header as the pending incoming frame.
+ * @details The header exchanged through XMLRPC is prefixed with its length,
+ *          so that it can be read by @p urosTcpRosRecvHeader() as if it were
+ *          received from a TCPROS stream.
+ *
+ * @param[in,out] linkp
+ *          Pointer to an initialized @p UrosUdpRosLink object.
+ * @param[in] bufp
+ *          Pointer to the header fields.
+ * @param[in] buflen
+ *          Length of the header fields, in bytes.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosUdpRosLinkLoad(UrosUdpRosLink *linkp,
+                              const void *bufp, size_t buflen) {
+
+  uint32_t length = (uint32_t)buflen;
+  uros_err_t err;
+
+  urosAssert(linkp != NULL);
+  urosAssert(!(buflen > 0) || (bufp != NULL));
+
+  err = uros_udpros_reserve(linkp, sizeof(uint32_t) + buflen);
+  if (err != UROS_OK) { return err; }
+  memcpy(urosTcpRosPutRaw(linkp->msgp, length), bufp, buflen);
+  linkp->nextBlock = 0;
+  linkp->msglen = sizeof(uint32_t) + buflen;
+  linkp->msgfill = linkp->msglen;
+  linkp->msgoff = 0;
+  return UROS_OK;
+}
+
+/**
+ * @brief   Sends a whole frame through a UDPROS link.
+ * @details The frame is split into blocks, each one sent as a datagram of at
+ *          most the negotiated size, prefixed by the UDPROS datagram header.
+ *          Blocks are sent with scatter/gather calls, without being copied.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status handling a UDPROS link.
+ * @param[in] bufp
+ *          Pointer to the frame, starting with its length prefix.
+ * @param[in] buflen
+ *          Length of the frame, in bytes.
+ * @return
+ *          Error code.
+ */
+uros_err_t urosUdpRosSendFrame(UrosTcpRosStatus *tcpstp,
+                               const void *bufp, size_t buflen) {
+
+  UrosUdpRosLink *linkp;
+  UrosIoVec iov[2];
+  uint8_t hdr[UROS_UDPROS_HDRLEN], *hdrp;
+  size_t blocklen, numblocks, i;
+  uint16_t block;
+  uint8_t opcode;
+  uros_err_t err;
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(tcpstp->udplinkp != NULL);
+  urosAssert(!(buflen > 0) || (bufp != NULL));
+
+  linkp = tcpstp->udplinkp;
+  urosAssert(linkp->dgramSize > UROS_UDPROS_HDRLEN);
+  blocklen = linkp->dgramSize - UROS_UDPROS_HDRLEN;
+  numblocks = (buflen + blocklen - 1) / blocklen;
+  urosError(numblocks > 0xFFFF, return UROS_ERR_BADPARAM,
+            ("Frame of %u bytes too long for %u blocks of %u bytes\n",
+             (unsigned)buflen, 0xFFFFu, (unsigned)blocklen));
+
+  iov[0].bufp = hdr;
+  iov[0].buflen = UROS_UDPROS_HDRLEN;
+  for (i = 0; i < numblocks; ++i) {
+    /* The first block tells the number of blocks.*/
+    opcode = (i == 0) ? UROS_UDPROS_OP_DATA0 : UROS_UDPROS_OP_DATAN;
+    block = (uint16_t)((i == 0) ? numblocks : i);
+    hdrp = urosTcpRosPutRaw(hdr, linkp->connId);
+    hdrp = urosTcpRosPutRaw(hdrp, opcode);
+    hdrp = urosTcpRosPutRaw(hdrp, linkp->sendMsgId);
+    (void)urosTcpRosPutRaw(hdrp, block);
+
+    iov[1].bufp = (const uint8_t *)bufp + i * blocklen;
+    iov[1].buflen = (i + 1 < numblocks) ? blocklen : buflen - i * blocklen;
+    err = urosConnSendV(&linkp->conn, iov, 2);
+    if (err != UROS_OK) { return err; }
+  }
+  ++linkp->sendMsgId;
+  return UROS_OK;
+}
+
+/**
+ * @brief   Receives some data from a UDPROS link.
+ * @details Returns data of the pending incoming frame. When no data is
+ *          pending, datagrams are received and reassembled until a whole
+ *          frame is available. Messages with missing blocks are dropped.
+ * @note    Works like @p urosConnRecv() for TCPROS streams.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status handling a UDPROS link.
+ * @param[out] bufpp
+ *          Indirect pointer to the received data buffer.
+ * @param[in,out] buflenp
+ *          Pointer to the buffer length in bytes, with the following meaning:
+ *          - At call, it indicates the maximum length of the received data.
+ *          - At return, it is the actual length of the received data.
+ * @return
+ *          Error code.
+ * @retval UROS_ERR_TIMEOUT
+ *          No whole frames were received in time. Received blocks of
+ *          incomplete messages are not accounted as received data.
+ */
+uros_err_t urosUdpRosRecv(UrosTcpRosStatus *tcpstp,
+                          void **bufpp, size_t *buflenp) {
+
+  UrosUdpRosLink *linkp;
+  size_t start, pending;
+  uros_err_t err;
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(tcpstp->udplinkp != NULL);
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+
+  linkp = tcpstp->udplinkp;
+  start = linkp->conn.recvlen;
+  while (linkp->nextBlock > 0 || linkp->msgoff >= linkp->msglen) {
+    err = uros_udpros_recvdgram(linkp);
+    if (err == UROS_ERR_TIMEOUT) {
+      /* Blocks are sent back to back, the missing ones are lost.*/
+      uros_udpros_drop(linkp);
+      linkp->conn.recvlen = start;
+    }
+    if (err != UROS_OK) { return err; }
+  }
+
+  pending = linkp->msglen - linkp->msgoff;
+  if (*buflenp > pending) { *buflenp = pending; }
+  *bufpp = linkp->msgp + linkp->msgoff;
+  linkp->msgoff += *buflenp;
+  return UROS_OK;
+}
+
+/**
+ * @brief   Creates a publisher UDPROS link.
+ * @details Called by @p requestTopic() when the subscriber chooses UDPROS.
+ *          A datagram connection is created towards the subscriber, and the
+ *          subscriber header is loaded, to be processed by the TCPROS Server
+ *          worker which will handle the link.
+ *
+ * @post    If successful, the link must be handed to the TCPROS Server
+ *          thread pool, or deleted with @p urosUdpRosLinkDelete().
+ *
+ * @param[in] namep
+ *          Pointer to the published topic name.
+ * @param[in] hdrp
+ *          Pointer to the subscriber header fields.
+ * @param[in] subaddrp
+ *          Pointer to the subscriber datagram address.
+ * @param[in] dgramsize
+ *          Maximum datagram size accepted by the subscriber.
+ * @param[out] linkpp
+ *          Pointer to the allocated link.
+ * @param[out] reshdrp
+ *          Pointer to the publisher header fields, allocated with
+ *          @p urosAlloc().
+ * @return
+ *          Error code.
+ */
+uros_err_t urosUdpRosPublisherLink(const UrosString *namep,
+                                   const UrosString *hdrp,
+                                   const UrosAddr *subaddrp,
+                                   size_t dgramsize,
+                                   UrosUdpRosLink **linkpp,
+                                   UrosString *reshdrp) {
+
+  static UrosNodeStatus *const stp = &urosNode.status;
+
+  UrosUdpRosLink *linkp;
+  UrosTcpRosStatus tcpst;
+  const UrosListNode *topicnodep;
+  UrosAddr locaddr;
+  uros_err_t err;
+
+  urosAssert(urosStringNotEmpty(namep));
+  urosAssert(hdrp != NULL);
+  urosAssert(subaddrp != NULL);
+  urosAssert(linkpp != NULL);
+  urosAssert(reshdrp != NULL);
+#define _CHKOK  { if (err != UROS_OK) { goto _error; } }
+
+  urosError(dgramsize <= UROS_UDPROS_HDRLEN, return UROS_ERR_BADPARAM,
+            ("Datagram size %u too small\n", (unsigned)dgramsize));
+  linkp = urosNew(NULL, UrosUdpRosLink);
+  if (linkp == NULL) { return UROS_ERR_NOMEM; }
+  urosUdpRosLinkObjectInit(linkp);
+  if (dgramsize < linkp->dgramSize) { linkp->dgramSize = dgramsize; }
+  urosStringObjectInit(reshdrp);
+
+  /* Create the datagram connection towards the subscriber.*/
+  locaddr.ip.dword = UROS_ANY_IP;
+  locaddr.port = UROS_ANY_PORT;
+  err = urosConnCreate(&linkp->conn, UROS_PROTO_UDP); _CHKOK
+  err = urosConnBind(&linkp->conn, &locaddr); _CHKOK
+  err = urosConnConnect(&linkp->conn, subaddrp); _CHKOK
+  err = urosConnSetSendTimeout(&linkp->conn, UROS_TCPROS_SENDTIMEOUT); _CHKOK
+
+  /* The subscriber header is processed by the TCPROS Server worker.*/
+  err = urosUdpRosLinkLoad(linkp, hdrp->datap, hdrp->length); _CHKOK
+
+  /* Generate the publisher header.*/
+  urosMutexLock(&stp->pubTopicListLock);
+  topicnodep = urosListIndexFind(&stp->pubTopicIndex, namep);
+  if (topicnodep != NULL) {
+    urosTcpRosStatusObjectInit(&tcpst, &linkp->conn);
+    tcpst.topicp = (UrosTopic*)topicnodep->datap;
+    err = urosTcpRosPackHeader(&tcpst, UROS_FALSE, reshdrp);
+    urosTcpRosStatusClean(&tcpst, UROS_FALSE);
+    linkp->connId = ++uros_udpros_lastconnid;
+  } else {
+    err = UROS_ERR_BADPARAM;
+  }
+  urosMutexUnlock(&stp->pubTopicListLock);
+  urosError(topicnodep == NULL, goto _error,
+            ("Topic [%.*s] not found\n", UROS_STRARG(namep)));
+  _CHKOK
+
+  *linkpp = linkp;
+  return UROS_OK;
+
+_error:
+  urosStringClean(reshdrp);
+  urosUdpRosLinkDelete(linkp);
+  return err;
+#undef _CHKOK
+}
+
+/**
+ * @brief   Negotiates a subscriber UDPROS link.
+ * @details A datagram connection is bound, and offered to the publisher with
+ *          a @p requestTopic() call. The publisher header is read back as
+ *          if it were received from a TCPROS stream.
+ *
+ * @pre     @p tcpstp references the subscribed topic, and handles an
+ *          initialized UDPROS link.
+ *
+ * @param[in,out] tcpstp
+ *          Pointer to a TCPROS status handling a UDPROS link.
+ * @param[in] apiaddrp
+ *          Pointer to the XMLRPC API address of the publisher.
+ * @return
+ *          Error code.
+ * @retval UROS_ERR_NOTIMPL
+ *          The publisher does not support UDPROS.
+ */
+uros_err_t urosUdpRosConnect(UrosTcpRosStatus *tcpstp,
+                             const UrosAddr *apiaddrp) {
+
+  static const UrosNodeConfig *const cfgp = &urosNode.config;
+
+  UrosUdpRosLink *linkp;
+  UrosRpcParamNode udpnodes[5];
+  UrosRpcParamList udplist, protolist;
+  UrosRpcParamNode protonode;
+  UrosRpcResponse res;
+  const UrosRpcParamNode *nodep;
+  UrosString reqhdr;
+  UrosAddr locaddr;
+  char ipstr[16];
+  unsigned i;
+  uros_err_t err;
+
+  urosAssert(tcpstp != NULL);
+  urosAssert(tcpstp->topicp != NULL);
+  urosAssert(tcpstp->udplinkp != NULL);
+  urosAssert(apiaddrp != NULL);
+#define _ERR    { err = UROS_ERR_BADPARAM; goto _finally; }
+#define _CHKOK  { if (err != UROS_OK) { goto _finally; } }
+#define _EXPECT(pc) \
+  urosError(nodep->param.pclass != (pc), _ERR, \
+            ("Response value pclass is %d, expected %d (" #pc ")\n", \
+             (int)nodep->param.pclass, (int)(pc)));
+
+  linkp = tcpstp->udplinkp;
+  urosStringObjectInit(&reqhdr);
+  urosRpcResponseObjectInit(&res);
+
+  /* Bind the datagram connection.*/
+  locaddr.ip.dword = UROS_ANY_IP;
+  locaddr.port = UROS_ANY_PORT;
+  err = urosConnCreate(&linkp->conn, UROS_PROTO_UDP); _CHKOK
+  err = urosConnBind(&linkp->conn, &locaddr); _CHKOK
+  err = urosConnSetRecvTimeout(&linkp->conn, UROS_TCPROS_RECVTIMEOUT); _CHKOK
+  err = urosTcpRosPackHeader(tcpstp, UROS_TRUE, &reqhdr); _CHKOK
+
+  /* ["UDPROS", header, host, port, max_datagram_size] */
+  for (i = 0; i < 5; ++i) {
+    urosRpcParamNodeObjectInit(&udpnodes[i], UROS_RPCP_STRING);
+    udpnodes[i].nextp = (i < 4) ? &udpnodes[i + 1] : NULL;
+  }
+  udpnodes[0].param.value.string = udprosstr;
+  udpnodes[1].param.pclass = UROS_RPCP_BASE64;
+  udpnodes[1].param.value.base64 = reqhdr;
+  udpnodes[2].param.value.string.datap = ipstr;
+  udpnodes[2].param.value.string.length =
+    uros_udpros_iptostr(ipstr, cfgp->tcprosAddr.ip);
+  udpnodes[3].param.pclass = UROS_RPCP_INT;
+  udpnodes[3].param.value.int32 = (int32_t)linkp->conn.locaddr.port;
+  udpnodes[4].param.pclass = UROS_RPCP_INT;
+  udpnodes[4].param.value.int32 = (int32_t)linkp->dgramSize;
+  udplist.headp = &udpnodes[0];
+  udplist.tailp = &udpnodes[4];
+  udplist.length = 5;
+  urosRpcParamNodeObjectInit(&protonode, UROS_RPCP_ARRAY);
+  protonode.param.value.listp = &udplist;
+  protolist.headp = &protonode;
+  protolist.tailp = &protonode;
+  protolist.length = 1;
+
+  /* Request the topic to the publisher.*/
+  err = urosRpcCallRequestTopic(apiaddrp, &cfgp->nodeName,
+                                &tcpstp->topicp->name, &protolist, &res);
+  _CHKOK
+  urosError(res.httpcode != 200, _ERR,
+            ("The HTTP response code is %lu, expected 200\n",
+             (long unsigned int)res.httpcode));
+  if (res.code != UROS_RPCC_SUCCESS) { _ERR }
+  urosError(res.valuep->pclass != UROS_RPCP_ARRAY, _ERR,
+            ("Response value pclass is %d, expected %d (UROS_RPCP_ARRAY)\n",
+             (int)res.valuep->pclass, (int)UROS_RPCP_ARRAY));
+  urosAssert(res.valuep->value.listp != NULL);
+  nodep = res.valuep->value.listp->headp;
+
+  /* ["UDPROS", host, port, connection_id, max_datagram_size, header] */
+  if (res.valuep->value.listp->length == 0 ||
+      nodep->param.pclass != UROS_RPCP_STRING ||
+      0 != urosStringCmp(&nodep->param.value.string, &udprosstr)) {
+    err = UROS_ERR_NOTIMPL; goto _finally;
+  }
+  urosError(res.valuep->value.listp->length != 6, _ERR,
+            ("Response value array length %lu, expected 6\n",
+             (long unsigned int)res.valuep->value.listp->length));
+  nodep = nodep->nextp; _EXPECT(UROS_RPCP_STRING)
+  nodep = nodep->nextp; _EXPECT(UROS_RPCP_INT)
+  nodep = nodep->nextp; _EXPECT(UROS_RPCP_INT)
+  linkp->connId = (uint32_t)nodep->param.value.int32;
+  nodep = nodep->nextp; _EXPECT(UROS_RPCP_INT)
+  urosError(nodep->param.value.int32 <= UROS_UDPROS_HDRLEN, _ERR,
+            ("Datagram size %ld too small\n",
+             (long int)nodep->param.value.int32));
+  if ((size_t)nodep->param.value.int32 < linkp->dgramSize) {
+    linkp->dgramSize = (size_t)nodep->param.value.int32;
+  }
+  nodep = nodep->nextp; _EXPECT(UROS_RPCP_BASE64)
+
+  /* Check the publisher header.*/
+  err = urosUdpRosLinkLoad(linkp, nodep->param.value.base64.datap,
+                           nodep->param.value.base64.length); _CHKOK
+  err = urosTcpRosRecvHeader(tcpstp, UROS_FALSE, UROS_FALSE); _CHKOK
+  urosUdpRosLinkClean(linkp);
+
+_finally:
+  urosRpcResponseClean(&res);
+  urosStringClean(&reqhdr);
+  return err;
+#undef _ERR
+#undef _CHKOK
+#undef _EXPECT
+}
+
+/** @} */
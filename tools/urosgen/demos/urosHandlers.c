@@ -76,8 +76,8 @@ uros_err_t pub_tpc__output(UrosTcpRosStatus *tcpstp) {
     urosThreadSleepSec(1); continue; /* TODO: Remove this dummy line.*/
 
     /* Send the message.*/
-    UROS_MSG_SEND_LENGTH(msgp, msg__stereo_msgs__DisparityImage);
-    UROS_MSG_SEND_BODY(msgp, msg__stereo_msgs__DisparityImage);
+    UROS_MSG_FRAME_LENGTH(msgp, msg__stereo_msgs__DisparityImage);
+    UROS_MSG_SEND_FRAME(msgp, msg__stereo_msgs__DisparityImage);
 
     /* Dispose the contents of the message.*/
     clean_msg__stereo_msgs__DisparityImage(msgp);
@@ -116,8 +116,8 @@ uros_err_t pub_tpc__rosout(UrosTcpRosStatus *tcpstp) {
     urosThreadSleepSec(1); continue; /* TODO: Remove this dummy line.*/
 
     /* Send the message.*/
-    UROS_MSG_SEND_LENGTH(msgp, msg__rosgraph_msgs__Log);
-    UROS_MSG_SEND_BODY(msgp, msg__rosgraph_msgs__Log);
+    UROS_MSG_FRAME_LENGTH(msgp, msg__rosgraph_msgs__Log);
+    UROS_MSG_SEND_FRAME(msgp, msg__rosgraph_msgs__Log);
 
     /* Dispose the contents of the message.*/
     clean_msg__rosgraph_msgs__Log(msgp);
@@ -147,34 +147,33 @@ _finally:
 /** @{ */
 
 /**
- * @brief   TCPROS <tt>/constants</tt> subscribed topic handler.
+ * @brief   TCPROS <tt>/constants</tt> subscribed topic frame handler.
  *
  * @param[in,out] tcpstp
  *          Pointer to a working @p UrosTcpRosStatus object.
+ * @param[in] framep
+ *          Pointer to the message frame body.
+ * @param[in] framelen
+ *          Length of the message frame body, in bytes.
  * @return
  *          Error code.
  */
-uros_err_t sub_tpc__constants(UrosTcpRosStatus *tcpstp) {
+uros_err_t sub_frm__constants(UrosTcpRosStatus *tcpstp,
+                              const uint8_t *framep, size_t framelen) {
 
-  /* Message allocation and initialization.*/
-  UROS_TPC_INIT_H(msg__bond__Constants);
+  /* Message initialization.*/
+  UROS_FRM_INIT_S(msg__bond__Constants);
 
-  /* Subscribed messages loop.*/
-  while (!urosTcpRosStatusCheckExit(tcpstp)) {
-    /* Receive the next message.*/
-    UROS_MSG_RECV_LENGTH();
-    UROS_MSG_RECV_BODY(msgp, msg__bond__Constants);
+  /* Decode the received frame.*/
+  UROS_MSG_DECODE_FRAME(&msg, msg__bond__Constants);
 
-    /* TODO: Process the received message.*/
+  /* TODO: Process the received message, without blocking.*/
 
-    /* Dispose the contents of the message.*/
-    clean_msg__bond__Constants(msgp);
-  }
   tcpstp->err = UROS_OK;
 
 _finally:
-  /* Message deinitialization and deallocation.*/
-  UROS_TPC_UNINIT_H(msg__bond__Constants);
+  /* Message deinitialization.*/
+  UROS_TPC_UNINIT_ARENA_S();
   return tcpstp->err;
 }
 
@@ -186,34 +185,33 @@ _finally:
 /** @{ */
 
 /**
- * @brief   TCPROS <tt>/input</tt> subscribed topic handler.
+ * @brief   TCPROS <tt>/input</tt> subscribed topic frame handler.
  *
  * @param[in,out] tcpstp
  *          Pointer to a working @p UrosTcpRosStatus object.
+ * @param[in] framep
+ *          Pointer to the message frame body.
+ * @param[in] framelen
+ *          Length of the message frame body, in bytes.
  * @return
  *          Error code.
  */
-uros_err_t sub_tpc__input(UrosTcpRosStatus *tcpstp) {
+uros_err_t sub_frm__input(UrosTcpRosStatus *tcpstp,
+                          const uint8_t *framep, size_t framelen) {
 
-  /* Message allocation and initialization.*/
-  UROS_TPC_INIT_H(msg__stereo_msgs__DisparityImage);
+  /* Message initialization.*/
+  UROS_FRM_INIT_S(msg__stereo_msgs__DisparityImage);
 
-  /* Subscribed messages loop.*/
-  while (!urosTcpRosStatusCheckExit(tcpstp)) {
-    /* Receive the next message.*/
-    UROS_MSG_RECV_LENGTH();
-    UROS_MSG_RECV_BODY(msgp, msg__stereo_msgs__DisparityImage);
+  /* Decode the received frame.*/
+  UROS_MSG_DECODE_FRAME(&msg, msg__stereo_msgs__DisparityImage);
 
-    /* TODO: Process the received message.*/
+  /* TODO: Process the received message, without blocking.*/
 
-    /* Dispose the contents of the message.*/
-    clean_msg__stereo_msgs__DisparityImage(msgp);
-  }
   tcpstp->err = UROS_OK;
 
 _finally:
-  /* Message deinitialization and deallocation.*/
-  UROS_TPC_UNINIT_H(msg__stereo_msgs__DisparityImage);
+  /* Message deinitialization.*/
+  UROS_TPC_UNINIT_ARENA_S();
   return tcpstp->err;
 }
 
@@ -225,34 +223,33 @@ _finally:
 /** @{ */
 
 /**
- * @brief   TCPROS <tt>/rosin</tt> subscribed topic handler.
+ * @brief   TCPROS <tt>/rosin</tt> subscribed topic frame handler.
  *
  * @param[in,out] tcpstp
  *          Pointer to a working @p UrosTcpRosStatus object.
+ * @param[in] framep
+ *          Pointer to the message frame body.
+ * @param[in] framelen
+ *          Length of the message frame body, in bytes.
  * @return
  *          Error code.
  */
-uros_err_t sub_tpc__rosin(UrosTcpRosStatus *tcpstp) {
+uros_err_t sub_frm__rosin(UrosTcpRosStatus *tcpstp,
+                          const uint8_t *framep, size_t framelen) {
 
-  /* Message allocation and initialization.*/
-  UROS_TPC_INIT_H(msg__rosgraph_msgs__Log);
+  /* Message initialization.*/
+  UROS_FRM_INIT_S(msg__rosgraph_msgs__Log);
 
-  /* Subscribed messages loop.*/
-  while (!urosTcpRosStatusCheckExit(tcpstp)) {
-    /* Receive the next message.*/
-    UROS_MSG_RECV_LENGTH();
-    UROS_MSG_RECV_BODY(msgp, msg__rosgraph_msgs__Log);
+  /* Decode the received frame.*/
+  UROS_MSG_DECODE_FRAME(&msg, msg__rosgraph_msgs__Log);
 
-    /* TODO: Process the received message.*/
+  /* TODO: Process the received message, without blocking.*/
 
-    /* Dispose the contents of the message.*/
-    clean_msg__rosgraph_msgs__Log(msgp);
-  }
   tcpstp->err = UROS_OK;
 
 _finally:
-  /* Message deinitialization and deallocation.*/
-  UROS_TPC_UNINIT_H(msg__rosgraph_msgs__Log);
+  /* Message deinitialization.*/
+  UROS_TPC_UNINIT_ARENA_S();
   return tcpstp->err;
 }
 
@@ -304,8 +301,8 @@ uros_err_t pub_srv__reconfigure(UrosTcpRosStatus *tcpstp) {
 
     /* Send the response message.*/
     UROS_SRV_SEND_OKBYTE_ERRSTR();
-    UROS_MSG_SEND_LENGTH(&outmsg, out_srv__dynamic_reconfigure__Reconfigure);
-    UROS_MSG_SEND_BODY(&outmsg, out_srv__dynamic_reconfigure__Reconfigure);
+    UROS_MSG_FRAME_LENGTH(&outmsg, out_srv__dynamic_reconfigure__Reconfigure);
+    UROS_MSG_SEND_FRAME(&outmsg, out_srv__dynamic_reconfigure__Reconfigure);
 
     /* Dispose the contents of the response message.*/
     clean_out_srv__dynamic_reconfigure__Reconfigure(&outmsg);
@@ -360,8 +357,8 @@ uros_err_t call_srv__reconfigure(
                     out_srv__dynamic_reconfigure__Reconfigure);
 
   /* Send the request message.*/
-  UROS_MSG_SEND_LENGTH(inmsgp, in_srv__dynamic_reconfigure__Reconfigure);
-  UROS_MSG_SEND_BODY(inmsgp, in_srv__dynamic_reconfigure__Reconfigure);
+  UROS_MSG_FRAME_LENGTH(inmsgp, in_srv__dynamic_reconfigure__Reconfigure);
+  UROS_MSG_SEND_FRAME(inmsgp, in_srv__dynamic_reconfigure__Reconfigure);
 
   /* TODO: Dispose the contents of the request message.*/
 
@@ -433,26 +430,26 @@ void urosHandlersUnpublishTopics(void) {
 void urosHandlersSubscribeTopics(void) {
 
   /* /constants */
-  urosNodeSubscribeTopicSZ(
+  urosNodeSubscribeTopicFramesSZ(
     "/constants",
     "bond/Constants",
-    (uros_proc_f)sub_tpc__constants,
+    sub_frm__constants,
     uros_nulltopicflags
   );
 
   /* /input */
-  urosNodeSubscribeTopicSZ(
+  urosNodeSubscribeTopicFramesSZ(
     "/input",
     "stereo_msgs/DisparityImage",
-    (uros_proc_f)sub_tpc__input,
+    sub_frm__input,
     uros_nulltopicflags
   );
 
   /* /rosin */
-  urosNodeSubscribeTopicSZ(
+  urosNodeSubscribeTopicFramesSZ(
     "/rosin",
     "rosgraph_msgs/Log",
-    (uros_proc_f)sub_tpc__rosin,
+    sub_frm__rosin,
     uros_nulltopicflags
   );
 }
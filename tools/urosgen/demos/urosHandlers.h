@@ -66,15 +66,18 @@ uros_err_t pub_tpc__rosout(UrosTcpRosStatus *tcpstp);
 
 /*~~~ SUBSCRIBED TOPIC: /constants ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-uros_err_t sub_tpc__constants(UrosTcpRosStatus *tcpstp);
+uros_err_t sub_frm__constants(UrosTcpRosStatus *tcpstp,
+                              const uint8_t *framep, size_t framelen);
 
 /*~~~ SUBSCRIBED TOPIC: /input ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-uros_err_t sub_tpc__input(UrosTcpRosStatus *tcpstp);
+uros_err_t sub_frm__input(UrosTcpRosStatus *tcpstp,
+                          const uint8_t *framep, size_t framelen);
 
 /*~~~ SUBSCRIBED TOPIC: /rosin ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-uros_err_t sub_tpc__rosin(UrosTcpRosStatus *tcpstp);
+uros_err_t sub_frm__rosin(UrosTcpRosStatus *tcpstp,
+                          const uint8_t *framep, size_t framelen);
 
 /*============================================================================*/
 /* PUBLISHED SERVICE PROTOTYPES                                               */
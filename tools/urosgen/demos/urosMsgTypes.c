@@ -192,6 +192,92 @@ uros_err_t send_msg__dynamic_reconfigure__IntParameter(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/IntParameter</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__dynamic_reconfigure__IntParameter()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__IntParameter</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__dynamic_reconfigure__IntParameter(
+  uint8_t *bufp,
+  struct msg__dynamic_reconfigure__IntParameter *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutString(bufp, &objp->name);
+  bufp = urosTcpRosPutRaw(bufp, objp->value);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/IntParameter</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__dynamic_reconfigure__IntParameter()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__IntParameter</code> object.
+ */
+void serializev_msg__dynamic_reconfigure__IntParameter(
+  UrosTcpRosGather *gp,
+  struct msg__dynamic_reconfigure__IntParameter *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  urosTcpRosGatherString(gp, &objp->name);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->value);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>dynamic_reconfigure/IntParameter</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__IntParameter</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__dynamic_reconfigure__IntParameter(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__dynamic_reconfigure__IntParameter *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->name); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->value); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__dynamic_reconfigure__IntParameter(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ MESSAGE: dynamic_reconfigure/GroupState ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -313,6 +399,98 @@ uros_err_t send_msg__dynamic_reconfigure__GroupState(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/GroupState</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__dynamic_reconfigure__GroupState()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__GroupState</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__dynamic_reconfigure__GroupState(
+  uint8_t *bufp,
+  struct msg__dynamic_reconfigure__GroupState *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutString(bufp, &objp->name);
+  bufp = urosTcpRosPutRaw(bufp, objp->state);
+  bufp = urosTcpRosPutRaw(bufp, objp->id);
+  bufp = urosTcpRosPutRaw(bufp, objp->parent);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/GroupState</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__dynamic_reconfigure__GroupState()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__GroupState</code> object.
+ */
+void serializev_msg__dynamic_reconfigure__GroupState(
+  UrosTcpRosGather *gp,
+  struct msg__dynamic_reconfigure__GroupState *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  urosTcpRosGatherString(gp, &objp->name);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->state);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->id);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->parent);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>dynamic_reconfigure/GroupState</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__GroupState</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__dynamic_reconfigure__GroupState(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__dynamic_reconfigure__GroupState *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->name); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->state); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->id); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->parent); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__dynamic_reconfigure__GroupState(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ MESSAGE: dynamic_reconfigure/BoolParameter ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -428,6 +606,92 @@ uros_err_t send_msg__dynamic_reconfigure__BoolParameter(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/BoolParameter</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__dynamic_reconfigure__BoolParameter()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__BoolParameter</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__dynamic_reconfigure__BoolParameter(
+  uint8_t *bufp,
+  struct msg__dynamic_reconfigure__BoolParameter *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutString(bufp, &objp->name);
+  bufp = urosTcpRosPutRaw(bufp, objp->value);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/BoolParameter</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__dynamic_reconfigure__BoolParameter()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__BoolParameter</code> object.
+ */
+void serializev_msg__dynamic_reconfigure__BoolParameter(
+  UrosTcpRosGather *gp,
+  struct msg__dynamic_reconfigure__BoolParameter *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  urosTcpRosGatherString(gp, &objp->name);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->value);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>dynamic_reconfigure/BoolParameter</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__BoolParameter</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__dynamic_reconfigure__BoolParameter(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__dynamic_reconfigure__BoolParameter *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->name); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->value); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__dynamic_reconfigure__BoolParameter(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ MESSAGE: dynamic_reconfigure/DoubleParameter ~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -543,6 +807,92 @@ uros_err_t send_msg__dynamic_reconfigure__DoubleParameter(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/DoubleParameter</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__dynamic_reconfigure__DoubleParameter()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__DoubleParameter</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__dynamic_reconfigure__DoubleParameter(
+  uint8_t *bufp,
+  struct msg__dynamic_reconfigure__DoubleParameter *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutString(bufp, &objp->name);
+  bufp = urosTcpRosPutRaw(bufp, objp->value);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/DoubleParameter</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__dynamic_reconfigure__DoubleParameter()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__DoubleParameter</code> object.
+ */
+void serializev_msg__dynamic_reconfigure__DoubleParameter(
+  UrosTcpRosGather *gp,
+  struct msg__dynamic_reconfigure__DoubleParameter *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  urosTcpRosGatherString(gp, &objp->name);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->value);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>dynamic_reconfigure/DoubleParameter</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__DoubleParameter</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__dynamic_reconfigure__DoubleParameter(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__dynamic_reconfigure__DoubleParameter *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->name); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->value); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__dynamic_reconfigure__DoubleParameter(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ MESSAGE: dynamic_reconfigure/StrParameter ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -660,6 +1010,92 @@ uros_err_t send_msg__dynamic_reconfigure__StrParameter(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/StrParameter</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__dynamic_reconfigure__StrParameter()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__StrParameter</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__dynamic_reconfigure__StrParameter(
+  uint8_t *bufp,
+  struct msg__dynamic_reconfigure__StrParameter *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutString(bufp, &objp->name);
+  bufp = urosTcpRosPutString(bufp, &objp->value);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/StrParameter</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__dynamic_reconfigure__StrParameter()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__StrParameter</code> object.
+ */
+void serializev_msg__dynamic_reconfigure__StrParameter(
+  UrosTcpRosGather *gp,
+  struct msg__dynamic_reconfigure__StrParameter *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  urosTcpRosGatherString(gp, &objp->name);
+  urosTcpRosGatherString(gp, &objp->value);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>dynamic_reconfigure/StrParameter</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__StrParameter</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__dynamic_reconfigure__StrParameter(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__dynamic_reconfigure__StrParameter *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->name); _CHKOK
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->value); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__dynamic_reconfigure__StrParameter(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ MESSAGE: sensor_msgs/RegionOfInterest ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -785,6 +1221,101 @@ uros_err_t send_msg__sensor_msgs__RegionOfInterest(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>sensor_msgs/RegionOfInterest</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__sensor_msgs__RegionOfInterest()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__sensor_msgs__RegionOfInterest</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__sensor_msgs__RegionOfInterest(
+  uint8_t *bufp,
+  struct msg__sensor_msgs__RegionOfInterest *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutRaw(bufp, objp->x_offset);
+  bufp = urosTcpRosPutRaw(bufp, objp->y_offset);
+  bufp = urosTcpRosPutRaw(bufp, objp->height);
+  bufp = urosTcpRosPutRaw(bufp, objp->width);
+  bufp = urosTcpRosPutRaw(bufp, objp->do_rectify);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>sensor_msgs/RegionOfInterest</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__sensor_msgs__RegionOfInterest()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__sensor_msgs__RegionOfInterest</code> object.
+ */
+void serializev_msg__sensor_msgs__RegionOfInterest(
+  UrosTcpRosGather *gp,
+  struct msg__sensor_msgs__RegionOfInterest *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->x_offset);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->y_offset);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->height);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->width);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->do_rectify);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>sensor_msgs/RegionOfInterest</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__sensor_msgs__RegionOfInterest</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__sensor_msgs__RegionOfInterest(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__sensor_msgs__RegionOfInterest *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->x_offset); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->y_offset); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->height); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->width); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->do_rectify); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__sensor_msgs__RegionOfInterest(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ MESSAGE: std_msgs/Header ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -903,6 +1434,95 @@ uros_err_t send_msg__std_msgs__Header(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>std_msgs/Header</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__std_msgs__Header()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__std_msgs__Header</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__std_msgs__Header(
+  uint8_t *bufp,
+  struct msg__std_msgs__Header *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutRaw(bufp, objp->seq);
+  bufp = urosTcpRosPutRaw(bufp, objp->stamp);
+  bufp = urosTcpRosPutString(bufp, &objp->frame_id);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>std_msgs/Header</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__std_msgs__Header()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__std_msgs__Header</code> object.
+ */
+void serializev_msg__std_msgs__Header(
+  UrosTcpRosGather *gp,
+  struct msg__std_msgs__Header *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->seq);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->stamp);
+  urosTcpRosGatherString(gp, &objp->frame_id);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>std_msgs/Header</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__std_msgs__Header</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__std_msgs__Header(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__std_msgs__Header *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->seq); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->stamp); _CHKOK
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->frame_id); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__std_msgs__Header(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ MESSAGE: dynamic_reconfigure/Config ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -1126,16 +1746,211 @@ uros_err_t send_msg__dynamic_reconfigure__Config(
   for (i = 0; i < objp->strs.length; ++i) {
     send_msg__dynamic_reconfigure__StrParameter(tcpstp, &objp->strs.entriesp[i]); _CHKOK
   }
-  urosTcpRosSendRaw(tcpstp, objp->doubles.length); _CHKOK
-  for (i = 0; i < objp->doubles.length; ++i) {
-    send_msg__dynamic_reconfigure__DoubleParameter(tcpstp, &objp->doubles.entriesp[i]); _CHKOK
+  urosTcpRosSendRaw(tcpstp, objp->doubles.length); _CHKOK
+  for (i = 0; i < objp->doubles.length; ++i) {
+    send_msg__dynamic_reconfigure__DoubleParameter(tcpstp, &objp->doubles.entriesp[i]); _CHKOK
+  }
+  urosTcpRosSendRaw(tcpstp, objp->groups.length); _CHKOK
+  for (i = 0; i < objp->groups.length; ++i) {
+    send_msg__dynamic_reconfigure__GroupState(tcpstp, &objp->groups.entriesp[i]); _CHKOK
+  }
+
+  return tcpstp->err = UROS_OK;
+#undef _CHKOK
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/Config</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__dynamic_reconfigure__Config()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__Config</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__dynamic_reconfigure__Config(
+  uint8_t *bufp,
+  struct msg__dynamic_reconfigure__Config *objp
+) {
+  uint32_t i;
+
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = urosTcpRosPutRaw(bufp, objp->bools.length);
+  for (i = 0; i < objp->bools.length; ++i) {
+    bufp = serialize_msg__dynamic_reconfigure__BoolParameter(bufp, &objp->bools.entriesp[i]);
+  }
+  bufp = urosTcpRosPutRaw(bufp, objp->ints.length);
+  for (i = 0; i < objp->ints.length; ++i) {
+    bufp = serialize_msg__dynamic_reconfigure__IntParameter(bufp, &objp->ints.entriesp[i]);
+  }
+  bufp = urosTcpRosPutRaw(bufp, objp->strs.length);
+  for (i = 0; i < objp->strs.length; ++i) {
+    bufp = serialize_msg__dynamic_reconfigure__StrParameter(bufp, &objp->strs.entriesp[i]);
+  }
+  bufp = urosTcpRosPutRaw(bufp, objp->doubles.length);
+  for (i = 0; i < objp->doubles.length; ++i) {
+    bufp = serialize_msg__dynamic_reconfigure__DoubleParameter(bufp, &objp->doubles.entriesp[i]);
+  }
+  bufp = urosTcpRosPutRaw(bufp, objp->groups.length);
+  for (i = 0; i < objp->groups.length; ++i) {
+    bufp = serialize_msg__dynamic_reconfigure__GroupState(bufp, &objp->groups.entriesp[i]);
+  }
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/Config</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__dynamic_reconfigure__Config()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__Config</code> object.
+ */
+void serializev_msg__dynamic_reconfigure__Config(
+  UrosTcpRosGather *gp,
+  struct msg__dynamic_reconfigure__Config *objp
+) {
+  uint32_t i;
+
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->bools.length);
+  for (i = 0; i < objp->bools.length; ++i) {
+    serializev_msg__dynamic_reconfigure__BoolParameter(gp, &objp->bools.entriesp[i]);
+  }
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->ints.length);
+  for (i = 0; i < objp->ints.length; ++i) {
+    serializev_msg__dynamic_reconfigure__IntParameter(gp, &objp->ints.entriesp[i]);
+  }
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->strs.length);
+  for (i = 0; i < objp->strs.length; ++i) {
+    serializev_msg__dynamic_reconfigure__StrParameter(gp, &objp->strs.entriesp[i]);
+  }
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->doubles.length);
+  for (i = 0; i < objp->doubles.length; ++i) {
+    serializev_msg__dynamic_reconfigure__DoubleParameter(gp, &objp->doubles.entriesp[i]);
+  }
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->groups.length);
+  for (i = 0; i < objp->groups.length; ++i) {
+    serializev_msg__dynamic_reconfigure__GroupState(gp, &objp->groups.entriesp[i]);
+  }
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>dynamic_reconfigure/Config</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__dynamic_reconfigure__Config</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__dynamic_reconfigure__Config(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__dynamic_reconfigure__Config *objp
+) {
+  uros_err_t err;
+  uint32_t i;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  urosTcpRosArrayObjectInit((UrosTcpRosArray *)&objp->bools);
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->bools.length); _CHKOK
+  if (objp->bools.length > *buflenp / 5U) {
+    objp->bools.length = 0; err = UROS_ERR_PARSE; goto _error;
+  }
+  objp->bools.entriesp = urosTcpRosArenaArrayNew(arenap, objp->bools.length,
+                                                 struct msg__dynamic_reconfigure__BoolParameter);
+  if (objp->bools.entriesp == NULL) {
+    objp->bools.length = 0; err = UROS_ERR_NOMEM; goto _error;
+  }
+  memset(objp->bools.entriesp, 0, (size_t)objp->bools.length * sizeof(struct msg__dynamic_reconfigure__BoolParameter));
+  for (i = 0; i < objp->bools.length; ++i) {
+    err = deserialize_msg__dynamic_reconfigure__BoolParameter(bufpp, buflenp, arenap, &objp->bools.entriesp[i]); _CHKOK
+  }
+  urosTcpRosArrayObjectInit((UrosTcpRosArray *)&objp->ints);
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->ints.length); _CHKOK
+  if (objp->ints.length > *buflenp / 8U) {
+    objp->ints.length = 0; err = UROS_ERR_PARSE; goto _error;
+  }
+  objp->ints.entriesp = urosTcpRosArenaArrayNew(arenap, objp->ints.length,
+                                                struct msg__dynamic_reconfigure__IntParameter);
+  if (objp->ints.entriesp == NULL) {
+    objp->ints.length = 0; err = UROS_ERR_NOMEM; goto _error;
+  }
+  memset(objp->ints.entriesp, 0, (size_t)objp->ints.length * sizeof(struct msg__dynamic_reconfigure__IntParameter));
+  for (i = 0; i < objp->ints.length; ++i) {
+    err = deserialize_msg__dynamic_reconfigure__IntParameter(bufpp, buflenp, arenap, &objp->ints.entriesp[i]); _CHKOK
+  }
+  urosTcpRosArrayObjectInit((UrosTcpRosArray *)&objp->strs);
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->strs.length); _CHKOK
+  if (objp->strs.length > *buflenp / 8U) {
+    objp->strs.length = 0; err = UROS_ERR_PARSE; goto _error;
+  }
+  objp->strs.entriesp = urosTcpRosArenaArrayNew(arenap, objp->strs.length,
+                                                struct msg__dynamic_reconfigure__StrParameter);
+  if (objp->strs.entriesp == NULL) {
+    objp->strs.length = 0; err = UROS_ERR_NOMEM; goto _error;
+  }
+  memset(objp->strs.entriesp, 0, (size_t)objp->strs.length * sizeof(struct msg__dynamic_reconfigure__StrParameter));
+  for (i = 0; i < objp->strs.length; ++i) {
+    err = deserialize_msg__dynamic_reconfigure__StrParameter(bufpp, buflenp, arenap, &objp->strs.entriesp[i]); _CHKOK
+  }
+  urosTcpRosArrayObjectInit((UrosTcpRosArray *)&objp->doubles);
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->doubles.length); _CHKOK
+  if (objp->doubles.length > *buflenp / 12U) {
+    objp->doubles.length = 0; err = UROS_ERR_PARSE; goto _error;
+  }
+  objp->doubles.entriesp = urosTcpRosArenaArrayNew(arenap, objp->doubles.length,
+                                                   struct msg__dynamic_reconfigure__DoubleParameter);
+  if (objp->doubles.entriesp == NULL) {
+    objp->doubles.length = 0; err = UROS_ERR_NOMEM; goto _error;
+  }
+  memset(objp->doubles.entriesp, 0, (size_t)objp->doubles.length * sizeof(struct msg__dynamic_reconfigure__DoubleParameter));
+  for (i = 0; i < objp->doubles.length; ++i) {
+    err = deserialize_msg__dynamic_reconfigure__DoubleParameter(bufpp, buflenp, arenap, &objp->doubles.entriesp[i]); _CHKOK
+  }
+  urosTcpRosArrayObjectInit((UrosTcpRosArray *)&objp->groups);
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->groups.length); _CHKOK
+  if (objp->groups.length > *buflenp / 13U) {
+    objp->groups.length = 0; err = UROS_ERR_PARSE; goto _error;
+  }
+  objp->groups.entriesp = urosTcpRosArenaArrayNew(arenap, objp->groups.length,
+                                                  struct msg__dynamic_reconfigure__GroupState);
+  if (objp->groups.entriesp == NULL) {
+    objp->groups.length = 0; err = UROS_ERR_NOMEM; goto _error;
   }
-  urosTcpRosSendRaw(tcpstp, objp->groups.length); _CHKOK
+  memset(objp->groups.entriesp, 0, (size_t)objp->groups.length * sizeof(struct msg__dynamic_reconfigure__GroupState));
   for (i = 0; i < objp->groups.length; ++i) {
-    send_msg__dynamic_reconfigure__GroupState(tcpstp, &objp->groups.entriesp[i]); _CHKOK
+    err = deserialize_msg__dynamic_reconfigure__GroupState(bufpp, buflenp, arenap, &objp->groups.entriesp[i]); _CHKOK
   }
 
-  return tcpstp->err = UROS_OK;
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__dynamic_reconfigure__Config(objp); }
+  return err;
 #undef _CHKOK
 }
 
@@ -1311,6 +2126,134 @@ uros_err_t send_msg__rosgraph_msgs__Log(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>rosgraph_msgs/Log</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__rosgraph_msgs__Log()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__rosgraph_msgs__Log</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__rosgraph_msgs__Log(
+  uint8_t *bufp,
+  struct msg__rosgraph_msgs__Log *objp
+) {
+  uint32_t i;
+
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = serialize_msg__std_msgs__Header(bufp, &objp->header);
+  bufp = urosTcpRosPutRaw(bufp, objp->level);
+  bufp = urosTcpRosPutString(bufp, &objp->name);
+  bufp = urosTcpRosPutString(bufp, &objp->msg);
+  bufp = urosTcpRosPutString(bufp, &objp->file);
+  bufp = urosTcpRosPutString(bufp, &objp->function);
+  bufp = urosTcpRosPutRaw(bufp, objp->line);
+  bufp = urosTcpRosPutRaw(bufp, objp->topics.length);
+  for (i = 0; i < objp->topics.length; ++i) {
+    bufp = urosTcpRosPutString(bufp, &objp->topics.entriesp[i]);
+  }
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>rosgraph_msgs/Log</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__rosgraph_msgs__Log()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__rosgraph_msgs__Log</code> object.
+ */
+void serializev_msg__rosgraph_msgs__Log(
+  UrosTcpRosGather *gp,
+  struct msg__rosgraph_msgs__Log *objp
+) {
+  uint32_t i;
+
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  serializev_msg__std_msgs__Header(gp, &objp->header);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->level);
+  urosTcpRosGatherString(gp, &objp->name);
+  urosTcpRosGatherString(gp, &objp->msg);
+  urosTcpRosGatherString(gp, &objp->file);
+  urosTcpRosGatherString(gp, &objp->function);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->line);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->topics.length);
+  for (i = 0; i < objp->topics.length; ++i) {
+    urosTcpRosGatherString(gp, &objp->topics.entriesp[i]);
+  }
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>rosgraph_msgs/Log</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__rosgraph_msgs__Log</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__rosgraph_msgs__Log(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__rosgraph_msgs__Log *objp
+) {
+  uros_err_t err;
+  uint32_t i;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = deserialize_msg__std_msgs__Header(bufpp, buflenp, arenap, &objp->header); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->level); _CHKOK
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->name); _CHKOK
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->msg); _CHKOK
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->file); _CHKOK
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->function); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->line); _CHKOK
+  urosTcpRosArrayObjectInit((UrosTcpRosArray *)&objp->topics);
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->topics.length); _CHKOK
+  if (objp->topics.length > *buflenp / sizeof(uint32_t)) {
+    objp->topics.length = 0; err = UROS_ERR_PARSE; goto _error;
+  }
+  objp->topics.entriesp = urosTcpRosArenaArrayNew(arenap, objp->topics.length,
+                                                  UrosString);
+  if (objp->topics.entriesp == NULL) {
+    objp->topics.length = 0; err = UROS_ERR_NOMEM; goto _error;
+  }
+  memset(objp->topics.entriesp, 0, (size_t)objp->topics.length * sizeof(UrosString));
+  for (i = 0; i < objp->topics.length; ++i) {
+    err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->topics.entriesp[i]); _CHKOK
+  }
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__rosgraph_msgs__Log(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ MESSAGE: sensor_msgs/Image ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -1454,6 +2397,122 @@ uros_err_t send_msg__sensor_msgs__Image(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>sensor_msgs/Image</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__sensor_msgs__Image()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__sensor_msgs__Image</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__sensor_msgs__Image(
+  uint8_t *bufp,
+  struct msg__sensor_msgs__Image *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = serialize_msg__std_msgs__Header(bufp, &objp->header);
+  bufp = urosTcpRosPutRaw(bufp, objp->height);
+  bufp = urosTcpRosPutRaw(bufp, objp->width);
+  bufp = urosTcpRosPutString(bufp, &objp->encoding);
+  bufp = urosTcpRosPutRaw(bufp, objp->is_bigendian);
+  bufp = urosTcpRosPutRaw(bufp, objp->step);
+  bufp = urosTcpRosPutRaw(bufp, objp->data.length);
+  bufp = urosTcpRosPut(bufp, objp->data.entriesp,
+                      (size_t)objp->data.length * sizeof(uint8_t));
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>sensor_msgs/Image</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__sensor_msgs__Image()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__sensor_msgs__Image</code> object.
+ */
+void serializev_msg__sensor_msgs__Image(
+  UrosTcpRosGather *gp,
+  struct msg__sensor_msgs__Image *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  serializev_msg__std_msgs__Header(gp, &objp->header);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->height);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->width);
+  urosTcpRosGatherString(gp, &objp->encoding);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->is_bigendian);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->step);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->data.length);
+  urosTcpRosGather(gp, objp->data.entriesp,
+                   (size_t)objp->data.length * sizeof(uint8_t));
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>sensor_msgs/Image</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__sensor_msgs__Image</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__sensor_msgs__Image(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__sensor_msgs__Image *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = deserialize_msg__std_msgs__Header(bufpp, buflenp, arenap, &objp->header); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->height); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->width); _CHKOK
+  err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->encoding); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->is_bigendian); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->step); _CHKOK
+  urosTcpRosArrayObjectInit((UrosTcpRosArray *)&objp->data);
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->data.length); _CHKOK
+  if (objp->data.length > *buflenp / sizeof(uint8_t)) {
+    objp->data.length = 0; err = UROS_ERR_PARSE; goto _error;
+  }
+  objp->data.entriesp = urosTcpRosArenaArrayNew(arenap, objp->data.length,
+                                                uint8_t);
+  if (objp->data.entriesp == NULL) {
+    objp->data.length = 0; err = UROS_ERR_NOMEM; goto _error;
+  }
+  err = urosTcpRosGet(bufpp, buflenp, objp->data.entriesp,
+                      (size_t)objp->data.length * sizeof(uint8_t)); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__sensor_msgs__Image(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ MESSAGE: stereo_msgs/DisparityImage ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -1591,6 +2650,110 @@ uros_err_t send_msg__stereo_msgs__DisparityImage(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>stereo_msgs/DisparityImage</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__stereo_msgs__DisparityImage()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__stereo_msgs__DisparityImage</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__stereo_msgs__DisparityImage(
+  uint8_t *bufp,
+  struct msg__stereo_msgs__DisparityImage *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = serialize_msg__std_msgs__Header(bufp, &objp->header);
+  bufp = serialize_msg__sensor_msgs__Image(bufp, &objp->image);
+  bufp = urosTcpRosPutRaw(bufp, objp->f);
+  bufp = urosTcpRosPutRaw(bufp, objp->T);
+  bufp = serialize_msg__sensor_msgs__RegionOfInterest(bufp, &objp->valid_window);
+  bufp = urosTcpRosPutRaw(bufp, objp->min_disparity);
+  bufp = urosTcpRosPutRaw(bufp, objp->max_disparity);
+  bufp = urosTcpRosPutRaw(bufp, objp->delta_d);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>stereo_msgs/DisparityImage</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__stereo_msgs__DisparityImage()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__stereo_msgs__DisparityImage</code> object.
+ */
+void serializev_msg__stereo_msgs__DisparityImage(
+  UrosTcpRosGather *gp,
+  struct msg__stereo_msgs__DisparityImage *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  serializev_msg__std_msgs__Header(gp, &objp->header);
+  serializev_msg__sensor_msgs__Image(gp, &objp->image);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->f);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->T);
+  serializev_msg__sensor_msgs__RegionOfInterest(gp, &objp->valid_window);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->min_disparity);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->max_disparity);
+  gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->delta_d);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>stereo_msgs/DisparityImage</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__stereo_msgs__DisparityImage</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__stereo_msgs__DisparityImage(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__stereo_msgs__DisparityImage *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = deserialize_msg__std_msgs__Header(bufpp, buflenp, arenap, &objp->header); _CHKOK
+  err = deserialize_msg__sensor_msgs__Image(bufpp, buflenp, arenap, &objp->image); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->f); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->T); _CHKOK
+  err = deserialize_msg__sensor_msgs__RegionOfInterest(bufpp, buflenp, arenap, &objp->valid_window); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->min_disparity); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->max_disparity); _CHKOK
+  err = urosTcpRosGetRaw(bufpp, buflenp, objp->delta_d); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_msg__stereo_msgs__DisparityImage(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /*~~~ MESSAGE: bond/Constants ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -1696,6 +2859,87 @@ uros_err_t send_msg__bond__Constants(
   return tcpstp->err = UROS_OK;
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>bond/Constants</tt> message.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_msg__bond__Constants()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__bond__Constants</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_msg__bond__Constants(
+  uint8_t *bufp,
+  struct msg__bond__Constants *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to serialize.*/
+  (void)objp;
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>bond/Constants</tt> message into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_msg__bond__Constants()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct msg__bond__Constants</code> object.
+ */
+void serializev_msg__bond__Constants(
+  UrosTcpRosGather *gp,
+  struct msg__bond__Constants *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to serialize.*/
+  (void)gp;
+  (void)objp;
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>bond/Constants</tt> message.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct msg__bond__Constants</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_msg__bond__Constants(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__bond__Constants *objp
+) {
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+
+  /* Nothing to deserialize.*/
+  (void)bufpp;
+  (void)buflenp;
+  (void)arenap;
+  (void)objp;
+  return UROS_OK;
+}
+
 /** @} */
 
 /** @} */
@@ -1869,6 +3113,172 @@ uros_err_t send_out_srv__dynamic_reconfigure__Reconfigure(
 #undef _CHKOK
 }
 
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/Reconfigure</tt> service request.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_in_srv__dynamic_reconfigure__Reconfigure()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct in_srv__dynamic_reconfigure__Reconfigure</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_in_srv__dynamic_reconfigure__Reconfigure(
+  uint8_t *bufp,
+  struct in_srv__dynamic_reconfigure__Reconfigure *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = serialize_msg__dynamic_reconfigure__Config(bufp, &objp->config);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/Reconfigure</tt> service response.
+ * @details The contents are written to a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream.
+ *
+ * @param[out] bufp
+ *          Pointer to a buffer of at least <code>length_out_srv__dynamic_reconfigure__Reconfigure()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct out_srv__dynamic_reconfigure__Reconfigure</code> object.
+ * @return
+ *          Pointer to the first byte after the serialized contents.
+ */
+uint8_t *serialize_out_srv__dynamic_reconfigure__Reconfigure(
+  uint8_t *bufp,
+  struct out_srv__dynamic_reconfigure__Reconfigure *objp
+) {
+  urosAssert(bufp != NULL);
+  urosAssert(objp != NULL);
+
+  bufp = serialize_msg__dynamic_reconfigure__Config(bufp, &objp->config);
+
+  return bufp;
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/Reconfigure</tt> service request into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_in_srv__dynamic_reconfigure__Reconfigure()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct in_srv__dynamic_reconfigure__Reconfigure</code> object.
+ */
+void serializev_in_srv__dynamic_reconfigure__Reconfigure(
+  UrosTcpRosGather *gp,
+  struct in_srv__dynamic_reconfigure__Reconfigure *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  serializev_msg__dynamic_reconfigure__Config(gp, &objp->config);
+}
+
+/**
+ * @brief   Serializes a TCPROS <tt>dynamic_reconfigure/Reconfigure</tt> service response into a gathered frame.
+ * @details Large variable-length fields are referenced, not copied.
+ *
+ * @param[in,out] gp
+ *          Pointer to a gathered frame with room for <code>length_out_srv__dynamic_reconfigure__Reconfigure()</code> bytes.
+ * @param[in] objp
+ *          Pointer to an initialized <code>struct out_srv__dynamic_reconfigure__Reconfigure</code> object.
+ */
+void serializev_out_srv__dynamic_reconfigure__Reconfigure(
+  UrosTcpRosGather *gp,
+  struct out_srv__dynamic_reconfigure__Reconfigure *objp
+) {
+  urosAssert(gp != NULL);
+  urosAssert(objp != NULL);
+
+  serializev_msg__dynamic_reconfigure__Config(gp, &objp->config);
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>dynamic_reconfigure/Reconfigure</tt> service request.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct in_srv__dynamic_reconfigure__Reconfigure</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_in_srv__dynamic_reconfigure__Reconfigure(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct in_srv__dynamic_reconfigure__Reconfigure *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = deserialize_msg__dynamic_reconfigure__Config(bufpp, buflenp, arenap, &objp->config); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_in_srv__dynamic_reconfigure__Reconfigure(objp); }
+  return err;
+#undef _CHKOK
+}
+
+/**
+ * @brief   Deserializes a TCPROS <tt>dynamic_reconfigure/Reconfigure</tt> service response.
+ * @details The contents are decoded from a contiguous buffer, with the same
+ *          layout they have on the TCPROS stream. Decoding never reads
+ *          beyond the remaining buffer length.
+ *
+ * @param[in,out] bufpp
+ *          Pointer to the buffer pointer, advanced past the decoded contents.
+ * @param[in,out] buflenp
+ *          Pointer to the remaining buffer length, in bytes.
+ * @param[in,out] arenap
+ *          Pointer to the message arena of the contents, or @p NULL to
+ *          allocate them with @p urosAlloc().
+ * @param[out] objp
+ *          Pointer to an initialized <code>struct out_srv__dynamic_reconfigure__Reconfigure</code> object.
+ * @return
+ *          Error code.
+ */
+uros_err_t deserialize_out_srv__dynamic_reconfigure__Reconfigure(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct out_srv__dynamic_reconfigure__Reconfigure *objp
+) {
+  uros_err_t err;
+
+  urosAssert(bufpp != NULL);
+  urosAssert(buflenp != NULL);
+  urosAssert(objp != NULL);
+#define _CHKOK { if (err != UROS_OK) { goto _error; } }
+
+  err = deserialize_msg__dynamic_reconfigure__Config(bufpp, buflenp, arenap, &objp->config); _CHKOK
+
+  return UROS_OK;
+_error:
+  if (arenap == NULL) { clean_out_srv__dynamic_reconfigure__Reconfigure(objp); }
+  return err;
+#undef _CHKOK
+}
+
 /** @} */
 
 /** @} */
@@ -432,6 +432,20 @@ uros_err_t send_msg__dynamic_reconfigure__IntParameter(
   UrosTcpRosStatus *tcpstp,
   struct msg__dynamic_reconfigure__IntParameter *objp
 );
+uint8_t *serialize_msg__dynamic_reconfigure__IntParameter(
+  uint8_t *bufp,
+  struct msg__dynamic_reconfigure__IntParameter *objp
+);
+void serializev_msg__dynamic_reconfigure__IntParameter(
+  UrosTcpRosGather *gp,
+  struct msg__dynamic_reconfigure__IntParameter *objp
+);
+uros_err_t deserialize_msg__dynamic_reconfigure__IntParameter(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__dynamic_reconfigure__IntParameter *objp
+);
 
 /*~~~ MESSAGE: dynamic_reconfigure/GroupState ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -452,6 +466,20 @@ uros_err_t send_msg__dynamic_reconfigure__GroupState(
   UrosTcpRosStatus *tcpstp,
   struct msg__dynamic_reconfigure__GroupState *objp
 );
+uint8_t *serialize_msg__dynamic_reconfigure__GroupState(
+  uint8_t *bufp,
+  struct msg__dynamic_reconfigure__GroupState *objp
+);
+void serializev_msg__dynamic_reconfigure__GroupState(
+  UrosTcpRosGather *gp,
+  struct msg__dynamic_reconfigure__GroupState *objp
+);
+uros_err_t deserialize_msg__dynamic_reconfigure__GroupState(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__dynamic_reconfigure__GroupState *objp
+);
 
 /*~~~ MESSAGE: dynamic_reconfigure/BoolParameter ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -472,6 +500,20 @@ uros_err_t send_msg__dynamic_reconfigure__BoolParameter(
   UrosTcpRosStatus *tcpstp,
   struct msg__dynamic_reconfigure__BoolParameter *objp
 );
+uint8_t *serialize_msg__dynamic_reconfigure__BoolParameter(
+  uint8_t *bufp,
+  struct msg__dynamic_reconfigure__BoolParameter *objp
+);
+void serializev_msg__dynamic_reconfigure__BoolParameter(
+  UrosTcpRosGather *gp,
+  struct msg__dynamic_reconfigure__BoolParameter *objp
+);
+uros_err_t deserialize_msg__dynamic_reconfigure__BoolParameter(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__dynamic_reconfigure__BoolParameter *objp
+);
 
 /*~~~ MESSAGE: dynamic_reconfigure/DoubleParameter ~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -492,6 +534,20 @@ uros_err_t send_msg__dynamic_reconfigure__DoubleParameter(
   UrosTcpRosStatus *tcpstp,
   struct msg__dynamic_reconfigure__DoubleParameter *objp
 );
+uint8_t *serialize_msg__dynamic_reconfigure__DoubleParameter(
+  uint8_t *bufp,
+  struct msg__dynamic_reconfigure__DoubleParameter *objp
+);
+void serializev_msg__dynamic_reconfigure__DoubleParameter(
+  UrosTcpRosGather *gp,
+  struct msg__dynamic_reconfigure__DoubleParameter *objp
+);
+uros_err_t deserialize_msg__dynamic_reconfigure__DoubleParameter(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__dynamic_reconfigure__DoubleParameter *objp
+);
 
 /*~~~ MESSAGE: dynamic_reconfigure/StrParameter ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -512,6 +568,20 @@ uros_err_t send_msg__dynamic_reconfigure__StrParameter(
   UrosTcpRosStatus *tcpstp,
   struct msg__dynamic_reconfigure__StrParameter *objp
 );
+uint8_t *serialize_msg__dynamic_reconfigure__StrParameter(
+  uint8_t *bufp,
+  struct msg__dynamic_reconfigure__StrParameter *objp
+);
+void serializev_msg__dynamic_reconfigure__StrParameter(
+  UrosTcpRosGather *gp,
+  struct msg__dynamic_reconfigure__StrParameter *objp
+);
+uros_err_t deserialize_msg__dynamic_reconfigure__StrParameter(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__dynamic_reconfigure__StrParameter *objp
+);
 
 /*~~~ MESSAGE: sensor_msgs/RegionOfInterest ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -532,6 +602,20 @@ uros_err_t send_msg__sensor_msgs__RegionOfInterest(
   UrosTcpRosStatus *tcpstp,
   struct msg__sensor_msgs__RegionOfInterest *objp
 );
+uint8_t *serialize_msg__sensor_msgs__RegionOfInterest(
+  uint8_t *bufp,
+  struct msg__sensor_msgs__RegionOfInterest *objp
+);
+void serializev_msg__sensor_msgs__RegionOfInterest(
+  UrosTcpRosGather *gp,
+  struct msg__sensor_msgs__RegionOfInterest *objp
+);
+uros_err_t deserialize_msg__sensor_msgs__RegionOfInterest(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__sensor_msgs__RegionOfInterest *objp
+);
 
 /*~~~ MESSAGE: std_msgs/Header ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -552,6 +636,20 @@ uros_err_t send_msg__std_msgs__Header(
   UrosTcpRosStatus *tcpstp,
   struct msg__std_msgs__Header *objp
 );
+uint8_t *serialize_msg__std_msgs__Header(
+  uint8_t *bufp,
+  struct msg__std_msgs__Header *objp
+);
+void serializev_msg__std_msgs__Header(
+  UrosTcpRosGather *gp,
+  struct msg__std_msgs__Header *objp
+);
+uros_err_t deserialize_msg__std_msgs__Header(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__std_msgs__Header *objp
+);
 
 /*~~~ MESSAGE: dynamic_reconfigure/Config ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -572,6 +670,20 @@ uros_err_t send_msg__dynamic_reconfigure__Config(
   UrosTcpRosStatus *tcpstp,
   struct msg__dynamic_reconfigure__Config *objp
 );
+uint8_t *serialize_msg__dynamic_reconfigure__Config(
+  uint8_t *bufp,
+  struct msg__dynamic_reconfigure__Config *objp
+);
+void serializev_msg__dynamic_reconfigure__Config(
+  UrosTcpRosGather *gp,
+  struct msg__dynamic_reconfigure__Config *objp
+);
+uros_err_t deserialize_msg__dynamic_reconfigure__Config(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__dynamic_reconfigure__Config *objp
+);
 
 /*~~~ MESSAGE: rosgraph_msgs/Log ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -592,6 +704,20 @@ uros_err_t send_msg__rosgraph_msgs__Log(
   UrosTcpRosStatus *tcpstp,
   struct msg__rosgraph_msgs__Log *objp
 );
+uint8_t *serialize_msg__rosgraph_msgs__Log(
+  uint8_t *bufp,
+  struct msg__rosgraph_msgs__Log *objp
+);
+void serializev_msg__rosgraph_msgs__Log(
+  UrosTcpRosGather *gp,
+  struct msg__rosgraph_msgs__Log *objp
+);
+uros_err_t deserialize_msg__rosgraph_msgs__Log(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__rosgraph_msgs__Log *objp
+);
 
 /*~~~ MESSAGE: sensor_msgs/Image ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -612,6 +738,20 @@ uros_err_t send_msg__sensor_msgs__Image(
   UrosTcpRosStatus *tcpstp,
   struct msg__sensor_msgs__Image *objp
 );
+uint8_t *serialize_msg__sensor_msgs__Image(
+  uint8_t *bufp,
+  struct msg__sensor_msgs__Image *objp
+);
+void serializev_msg__sensor_msgs__Image(
+  UrosTcpRosGather *gp,
+  struct msg__sensor_msgs__Image *objp
+);
+uros_err_t deserialize_msg__sensor_msgs__Image(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__sensor_msgs__Image *objp
+);
 
 /*~~~ MESSAGE: stereo_msgs/DisparityImage ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -632,6 +772,20 @@ uros_err_t send_msg__stereo_msgs__DisparityImage(
   UrosTcpRosStatus *tcpstp,
   struct msg__stereo_msgs__DisparityImage *objp
 );
+uint8_t *serialize_msg__stereo_msgs__DisparityImage(
+  uint8_t *bufp,
+  struct msg__stereo_msgs__DisparityImage *objp
+);
+void serializev_msg__stereo_msgs__DisparityImage(
+  UrosTcpRosGather *gp,
+  struct msg__stereo_msgs__DisparityImage *objp
+);
+uros_err_t deserialize_msg__stereo_msgs__DisparityImage(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__stereo_msgs__DisparityImage *objp
+);
 
 /*~~~ MESSAGE: bond/Constants ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -652,6 +806,20 @@ uros_err_t send_msg__bond__Constants(
   UrosTcpRosStatus *tcpstp,
   struct msg__bond__Constants *objp
 );
+uint8_t *serialize_msg__bond__Constants(
+  uint8_t *bufp,
+  struct msg__bond__Constants *objp
+);
+void serializev_msg__bond__Constants(
+  UrosTcpRosGather *gp,
+  struct msg__bond__Constants *objp
+);
+uros_err_t deserialize_msg__bond__Constants(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct msg__bond__Constants *objp
+);
 
 /*============================================================================*/
 /* SERVICE PROTOTYPES                                                         */
@@ -685,6 +853,34 @@ uros_err_t send_out_srv__dynamic_reconfigure__Reconfigure(
   UrosTcpRosStatus *tcpstp,
   struct out_srv__dynamic_reconfigure__Reconfigure *objp
 );
+uint8_t *serialize_in_srv__dynamic_reconfigure__Reconfigure(
+  uint8_t *bufp,
+  struct in_srv__dynamic_reconfigure__Reconfigure *objp
+);
+uint8_t *serialize_out_srv__dynamic_reconfigure__Reconfigure(
+  uint8_t *bufp,
+  struct out_srv__dynamic_reconfigure__Reconfigure *objp
+);
+void serializev_in_srv__dynamic_reconfigure__Reconfigure(
+  UrosTcpRosGather *gp,
+  struct in_srv__dynamic_reconfigure__Reconfigure *objp
+);
+void serializev_out_srv__dynamic_reconfigure__Reconfigure(
+  UrosTcpRosGather *gp,
+  struct out_srv__dynamic_reconfigure__Reconfigure *objp
+);
+uros_err_t deserialize_in_srv__dynamic_reconfigure__Reconfigure(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct in_srv__dynamic_reconfigure__Reconfigure *objp
+);
+uros_err_t deserialize_out_srv__dynamic_reconfigure__Reconfigure(
+  const uint8_t **bufpp,
+  size_t *buflenp,
+  UrosTcpRosArena *arenap,
+  struct out_srv__dynamic_reconfigure__Reconfigure *objp
+);
 
 /*============================================================================*/
 /* GLOBAL PROTOTYPES                                                          */
@@ -57,6 +57,21 @@ primitive_map = {
   'uint'        : 'uint32_t'
 }
 
+primitive_size = {
+  'int8_t'      : 1,
+  'uint8_t'     : 1,
+  'int16_t'     : 2,
+  'uint16_t'    : 2,
+  'int32_t'     : 4,
+  'uint32_t'    : 4,
+  'int64_t'     : 8,
+  'uint64_t'    : 8,
+  'float'       : 4,
+  'double'      : 8,
+  'UrosString'  : 4,
+  'uros_time_t' : 8
+}
+
 tab = '  '
 ROSMSG = 'rosmsg'
 ROSSRV = 'rossrv'
@@ -201,6 +216,21 @@ class MsgType:
                     deps.append(sd)
         return deps
     
+    def min_length(self):
+        # Smallest serialized length, with empty strings and arrays
+        length = 0
+        for f in self.fields:
+            if f.arraylen == '*':
+                size = 4
+            elif primitive_map.has_key(f.rostype):
+                size = primitive_size[f.ctype]
+            else:
+                size = self.cplxtypes[f.rostype].min_length()
+            if f.arraylen and f.arraylen != '*':
+                size *= int(f.arraylen)
+            length += size
+        return length
+    
     def _load(self):
         if not '/' in self.name:
             self.name = 'std_msgs/' + self.name
@@ -738,6 +768,264 @@ class MsgType:
             text += tab + 'return tcpstp->err = UROS_OK;\n'
         text += '}'
         return text
+    
+    def gen_serialize_sig(self):
+        text = 'uint8_t *serialize_%s(\n' % self.cname
+        text += tab + 'uint8_t *bufp,\n'
+        text += tab + '%s *objp\n' % self.ctype
+        text += ')'
+        return text
+    
+    def gen_serialize_body(self):
+        text = ""
+        for f in self.fields:
+            if f.arraylen:
+                if f.arraylen == '*':
+                    lenstr = 'objp->%s.length' % f.cname
+                    enpstr = 'objp->%s.entriesp' % f.cname
+                    text += tab + 'bufp = urosTcpRosPutRaw(bufp, %s);\n' % lenstr
+                else:
+                    lenstr = str(f.arraylen)
+                    enpstr = 'objp->' + f.name
+                
+                if f.rostype == 'string':
+                    text += tab + 'for (i = 0; i < %s; ++i) {\n' % lenstr
+                    text += tab*2 + 'bufp = urosTcpRosPutString(bufp, &%s[i]);\n' % enpstr
+                    text += tab + '}\n'
+                elif primitive_map.has_key(f.rostype):
+                    text += tab + 'bufp = urosTcpRosPut(bufp, %s,\n' % enpstr
+                    text += tab + '                    (size_t)%s * sizeof(%s));\n' % (lenstr, f.ctype)
+                else:
+                    cplxtype = self.cplxtypes[f.rostype]
+                    text += tab + 'for (i = 0; i < %s; ++i) {\n' % lenstr
+                    text += tab*2 + 'bufp = serialize_%s(bufp, &%s[i]);\n' % (cplxtype.cname, enpstr)
+                    text += tab + '}\n'
+                
+            elif f.rostype == 'string':
+                text += tab + 'bufp = urosTcpRosPutString(bufp, &objp->%s);\n' % f.cname
+            elif primitive_map.has_key(f.rostype):
+                text += tab + 'bufp = urosTcpRosPutRaw(bufp, objp->%s);\n' % f.cname
+            else:
+                cplxtype = self.cplxtypes[f.rostype]
+                text += tab + 'bufp = serialize_%s(bufp, &objp->%s);\n' % (cplxtype.cname, f.cname)
+        
+        return text
+    
+    def gen_serialize_func(self, sig, what):
+        text = '/**\n'
+        text += ' * @brief   Serializes a TCPROS <tt>%s</tt> %s.\n' % (self.name, what)
+        text += ' * @details The contents are written to a contiguous buffer, with the same\n'
+        text += ' *          layout they have on the TCPROS stream.\n'
+        text += ' *\n'
+        text += ' * @param[out] bufp\n'
+        text += ' *          Pointer to a buffer of at least <code>length_%s()</code> bytes.\n' % self.cname
+        text += ' * @param[in] objp\n'
+        text += ' *          Pointer to an initialized <code>%s</code> object.\n' % self.ctype
+        text += ' * @return\n'
+        text += ' *          Pointer to the first byte after the serialized contents.\n'
+        text += ' */\n'
+        text += sig + ' {\n'
+        if self.uses_arrays:
+            text += tab + 'uint32_t i;\n\n'
+        text += tab + 'urosAssert(bufp != NULL);\n'
+        text += tab + 'urosAssert(objp != NULL);\n\n'
+        body = self.gen_serialize_body()
+        if len(body) > 0:
+            text += body + '\n'
+        else:
+            text += tab + '/* Nothing to serialize.*/\n'
+            text += tab + '(void)objp;\n'
+        text += tab + 'return bufp;\n'
+        text += '}'
+        return text
+    
+    def gen_serialize(self):
+        return self.gen_serialize_func(self.gen_serialize_sig(), 'message')
+    
+    def gen_serializev_sig(self):
+        text = 'void serializev_%s(\n' % self.cname
+        text += tab + 'UrosTcpRosGather *gp,\n'
+        text += tab + '%s *objp\n' % self.ctype
+        text += ')'
+        return text
+    
+    def gen_serializev_body(self):
+        text = ""
+        for f in self.fields:
+            if f.arraylen:
+                if f.arraylen == '*':
+                    lenstr = 'objp->%s.length' % f.cname
+                    enpstr = 'objp->%s.entriesp' % f.cname
+                    text += tab + 'gp->bufp = urosTcpRosPutRaw(gp->bufp, %s);\n' % lenstr
+                else:
+                    lenstr = str(f.arraylen)
+                    enpstr = 'objp->' + f.name
+                
+                if f.rostype == 'string':
+                    text += tab + 'for (i = 0; i < %s; ++i) {\n' % lenstr
+                    text += tab*2 + 'urosTcpRosGatherString(gp, &%s[i]);\n' % enpstr
+                    text += tab + '}\n'
+                elif primitive_map.has_key(f.rostype):
+                    text += tab + 'urosTcpRosGather(gp, %s,\n' % enpstr
+                    text += tab + '                 (size_t)%s * sizeof(%s));\n' % (lenstr, f.ctype)
+                else:
+                    cplxtype = self.cplxtypes[f.rostype]
+                    text += tab + 'for (i = 0; i < %s; ++i) {\n' % lenstr
+                    text += tab*2 + 'serializev_%s(gp, &%s[i]);\n' % (cplxtype.cname, enpstr)
+                    text += tab + '}\n'
+                
+            elif f.rostype == 'string':
+                text += tab + 'urosTcpRosGatherString(gp, &objp->%s);\n' % f.cname
+            elif primitive_map.has_key(f.rostype):
+                text += tab + 'gp->bufp = urosTcpRosPutRaw(gp->bufp, objp->%s);\n' % f.cname
+            else:
+                cplxtype = self.cplxtypes[f.rostype]
+                text += tab + 'serializev_%s(gp, &objp->%s);\n' % (cplxtype.cname, f.cname)
+        
+        return text
+    
+    def gen_serializev_func(self, sig, what):
+        text = '/**\n'
+        text += ' * @brief   Serializes a TCPROS <tt>%s</tt> %s into a gathered frame.\n' % (self.name, what)
+        text += ' * @details Large variable-length fields are referenced, not copied.\n'
+        text += ' *\n'
+        text += ' * @param[in,out] gp\n'
+        text += ' *          Pointer to a gathered frame with room for <code>length_%s()</code> bytes.\n' % self.cname
+        text += ' * @param[in] objp\n'
+        text += ' *          Pointer to an initialized <code>%s</code> object.\n' % self.ctype
+        text += ' */\n'
+        text += sig + ' {\n'
+        if self.uses_arrays:
+            text += tab + 'uint32_t i;\n\n'
+        text += tab + 'urosAssert(gp != NULL);\n'
+        text += tab + 'urosAssert(objp != NULL);\n\n'
+        body = self.gen_serializev_body()
+        if len(body) > 0:
+            text += body
+        else:
+            text += tab + '/* Nothing to serialize.*/\n'
+            text += tab + '(void)gp;\n'
+            text += tab + '(void)objp;\n'
+        text += '}'
+        return text
+    
+    def gen_serializev(self):
+        return self.gen_serializev_func(self.gen_serializev_sig(), 'message')
+    
+    def gen_deserialize_sig(self):
+        text = 'uros_err_t deserialize_%s(\n' % self.cname
+        text += tab + 'const uint8_t **bufpp,\n'
+        text += tab + 'size_t *buflenp,\n'
+        text += tab + 'UrosTcpRosArena *arenap,\n'
+        text += tab + '%s *objp\n' % self.ctype
+        text += ')'
+        return text
+    
+    def gen_deserialize_body(self):
+        text = ""
+        for f in self.fields:
+            if f.arraylen:
+                if f.arraylen == '*':
+                    lenstr = 'objp->%s.length' % f.cname
+                    enpstr = 'objp->%s.entriesp' % f.cname
+                    text += tab + 'urosTcpRosArrayObjectInit((UrosTcpRosArray *)&objp->%s);\n' % f.cname
+                    text += tab + 'err = urosTcpRosGetRaw(bufpp, buflenp, %s); _CHKOK\n' % lenstr
+                    if f.rostype == 'string':
+                        minsize = 'sizeof(uint32_t)'
+                    elif primitive_map.has_key(f.rostype):
+                        minsize = 'sizeof(%s)' % f.ctype
+                    else:
+                        minsize = self.cplxtypes[f.rostype].min_length()
+                        minsize = '%dU' % minsize if minsize > 0 else None
+                    if minsize:
+                        text += tab + 'if (%s > *buflenp / %s) {\n' % (lenstr, minsize)
+                        text += tab*2 + '%s = 0; err = UROS_ERR_PARSE; goto _error;\n' % lenstr
+                        text += tab + '}\n'
+                    line = tab + '%s = urosTcpRosArenaArrayNew(' % enpstr
+                    text += line + 'arenap, %s,\n' % lenstr
+                    text += ' ' * len(line) + '%s);\n' % f.ctype
+                    text += tab + 'if (%s == NULL) {\n' % enpstr
+                    text += tab*2 + '%s = 0; err = UROS_ERR_NOMEM; goto _error;\n' % lenstr
+                    text += tab + '}\n'
+                    if f.rostype == 'string' or not primitive_map.has_key(f.rostype):
+                        text += tab + 'memset(%s, 0, (size_t)%s * sizeof(%s));\n' % (enpstr, lenstr, f.ctype)
+                else:
+                    lenstr = str(f.arraylen)
+                    enpstr = 'objp->' + f.name
+                
+                if f.rostype == 'string':
+                    text += tab + 'for (i = 0; i < %s; ++i) {\n' % lenstr
+                    text += tab*2 + 'err = urosTcpRosGetString(bufpp, buflenp, arenap, &%s[i]); _CHKOK\n' % enpstr
+                    text += tab + '}\n'
+                elif primitive_map.has_key(f.rostype):
+                    text += tab + 'err = urosTcpRosGet(bufpp, buflenp, %s,\n' % enpstr
+                    text += tab + '                    (size_t)%s * sizeof(%s)); _CHKOK\n' % (lenstr, f.ctype)
+                else:
+                    cplxtype = self.cplxtypes[f.rostype]
+                    text += tab + 'for (i = 0; i < %s; ++i) {\n' % lenstr
+                    text += tab*2 + 'err = deserialize_%s(bufpp, buflenp, arenap, &%s[i]); _CHKOK\n' % (cplxtype.cname, enpstr)
+                    text += tab + '}\n'
+                
+            elif f.rostype == 'string':
+                text += tab + 'err = urosTcpRosGetString(bufpp, buflenp, arenap, &objp->%s); _CHKOK\n' % f.cname
+            elif primitive_map.has_key(f.rostype):
+                text += tab + 'err = urosTcpRosGetRaw(bufpp, buflenp, objp->%s); _CHKOK\n' % f.cname
+            else:
+                cplxtype = self.cplxtypes[f.rostype]
+                text += tab + 'err = deserialize_%s(bufpp, buflenp, arenap, &objp->%s); _CHKOK\n' % (cplxtype.cname, f.cname)
+        
+        return text
+    
+    def gen_deserialize_func(self, sig, what):
+        text = '/**\n'
+        text += ' * @brief   Deserializes a TCPROS <tt>%s</tt> %s.\n' % (self.name, what)
+        text += ' * @details The contents are decoded from a contiguous buffer, with the same\n'
+        text += ' *          layout they have on the TCPROS stream. Decoding never reads\n'
+        text += ' *          beyond the remaining buffer length.\n'
+        text += ' *\n'
+        text += ' * @param[in,out] bufpp\n'
+        text += ' *          Pointer to the buffer pointer, advanced past the decoded contents.\n'
+        text += ' * @param[in,out] buflenp\n'
+        text += ' *          Pointer to the remaining buffer length, in bytes.\n'
+        text += ' * @param[in,out] arenap\n'
+        text += ' *          Pointer to the message arena of the contents, or @p NULL to\n'
+        text += ' *          allocate them with @p urosAlloc().\n'
+        text += ' * @param[out] objp\n'
+        text += ' *          Pointer to an initialized <code>%s</code> object.\n' % self.ctype
+        text += ' * @return\n'
+        text += ' *          Error code.\n'
+        text += ' */\n'
+        text += sig + ' {\n'
+        body = self.gen_deserialize_body()
+        if len(body) > 0:
+            text += tab + 'uros_err_t err;\n'
+            if self.uses_arrays:
+                text += tab + 'uint32_t i;\n'
+            text += '\n'
+        text += tab + 'urosAssert(bufpp != NULL);\n'
+        text += tab + 'urosAssert(buflenp != NULL);\n'
+        text += tab + 'urosAssert(objp != NULL);\n'
+        if len(body) > 0:
+            text += '#define _CHKOK { if (err != UROS_OK) { goto _error; } }\n\n'
+            text += body + '\n'
+            text += tab + 'return UROS_OK;\n'
+            text += '_error:\n'
+            text += tab + 'if (arenap == NULL) { clean_%s(objp); }\n' % self.cname
+            text += tab + 'return err;\n'
+            text += '#undef _CHKOK\n'
+        else:
+            text += '\n'
+            text += tab + '/* Nothing to deserialize.*/\n'
+            text += tab + '(void)bufpp;\n'
+            text += tab + '(void)buflenp;\n'
+            text += tab + '(void)arenap;\n'
+            text += tab + '(void)objp;\n'
+            text += tab + 'return UROS_OK;\n'
+        text += '}'
+        return text
+    
+    def gen_deserialize(self):
+        return self.gen_deserialize_func(self.gen_deserialize_sig(), 'message')
 
 #~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~#
         
@@ -1141,6 +1429,42 @@ class SrvType:
             text += tab + 'return tcpstp->err = UROS_OK;\n'
         text += '}'
         return text
+    
+    def gen_serialize_sig_in(self):
+        return self.intype.gen_serialize_sig()
+    
+    def gen_serialize_in(self):
+        return self.intype.gen_serialize_func(self.gen_serialize_sig_in(), 'service request')
+    
+    def gen_serialize_sig_out(self):
+        return self.outtype.gen_serialize_sig()
+    
+    def gen_serialize_out(self):
+        return self.outtype.gen_serialize_func(self.gen_serialize_sig_out(), 'service response')
+    
+    def gen_serializev_sig_in(self):
+        return self.intype.gen_serializev_sig()
+    
+    def gen_serializev_in(self):
+        return self.intype.gen_serializev_func(self.gen_serializev_sig_in(), 'service request')
+    
+    def gen_serializev_sig_out(self):
+        return self.outtype.gen_serializev_sig()
+    
+    def gen_serializev_out(self):
+        return self.outtype.gen_serializev_func(self.gen_serializev_sig_out(), 'service response')
+    
+    def gen_deserialize_sig_in(self):
+        return self.intype.gen_deserialize_sig()
+    
+    def gen_deserialize_in(self):
+        return self.intype.gen_deserialize_func(self.gen_deserialize_sig_in(), 'service request')
+    
+    def gen_deserialize_sig_out(self):
+        return self.outtype.gen_deserialize_sig()
+    
+    def gen_deserialize_out(self):
+        return self.outtype.gen_deserialize_func(self.gen_deserialize_sig_out(), 'service response')
 
 #~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~#
 
@@ -1166,6 +1490,7 @@ class CodeGen:
             'msgOnStack'                : 'false',
             'inOnStack'                 : 'false',
             'outOnStack'                : 'false',
+            'subFrameHandlers'          : 'false',
             'msgVarBaseName'            : 'msg',
             'inVarBaseName'             : 'inmsg',
             'outVarBaseName'            : 'outmsg',
@@ -1462,7 +1787,10 @@ class CodeGen:
             text += msgtype.gen_init_sig() + ';\n'
             text += msgtype.gen_clean_sig() + ';\n'
             text += msgtype.gen_recv_sig() + ';\n'
-            text += msgtype.gen_send_sig() + ';\n\n'
+            text += msgtype.gen_send_sig() + ';\n'
+            text += msgtype.gen_serialize_sig() + ';\n'
+            text += msgtype.gen_serializev_sig() + ';\n'
+            text += msgtype.gen_deserialize_sig() + ';\n\n'
         if len(self.sortedMsgTypeNames) == 0:
             text += '/* There are no message types.*/\n\n'
         
@@ -1477,7 +1805,13 @@ class CodeGen:
             text += srvtype.gen_clean_sig_in() + ';\n'
             text += srvtype.gen_clean_sig_out() + ';\n'
             text += srvtype.gen_recv_sig() + ';\n'
-            text += srvtype.gen_send_sig() + ';\n\n'
+            text += srvtype.gen_send_sig() + ';\n'
+            text += srvtype.gen_serialize_sig_in() + ';\n'
+            text += srvtype.gen_serialize_sig_out() + ';\n'
+            text += srvtype.gen_serializev_sig_in() + ';\n'
+            text += srvtype.gen_serializev_sig_out() + ';\n'
+            text += srvtype.gen_deserialize_sig_in() + ';\n'
+            text += srvtype.gen_deserialize_sig_out() + ';\n\n'
         if len(self.srvTypes) == 0:
             text += '/* There are no service types.*/\n\n'
         
@@ -1557,6 +1891,9 @@ class CodeGen:
             text += msgtype.gen_clean() + '\n\n'
             text += msgtype.gen_recv() + '\n\n'
             text += msgtype.gen_send() + '\n\n'
+            text += msgtype.gen_serialize() + '\n\n'
+            text += msgtype.gen_serializev() + '\n\n'
+            text += msgtype.gen_deserialize() + '\n\n'
             text += '/** @} */\n\n'
         if len(self.sortedMsgTypeNames) == 0:
             text += '/* There are no message types.*/\n\n'
@@ -1577,6 +1914,12 @@ class CodeGen:
             text += srvtype.gen_clean_out() + '\n\n'
             text += srvtype.gen_recv() + '\n\n'
             text += srvtype.gen_send() + '\n\n'
+            text += srvtype.gen_serialize_in() + '\n\n'
+            text += srvtype.gen_serialize_out() + '\n\n'
+            text += srvtype.gen_serializev_in() + '\n\n'
+            text += srvtype.gen_serializev_out() + '\n\n'
+            text += srvtype.gen_deserialize_in() + '\n\n'
+            text += srvtype.gen_deserialize_out() + '\n\n'
             text += '/** @} */\n\n'
         if len(self.srvTypes) == 0:
             text += '/* There are no service types.*/\n\n'
@@ -1625,8 +1968,8 @@ class CodeGen:
         text += tab*2 + '/* TODO: Generate the contents of the message.*/\n'
         text += tab*2 + 'urosThreadSleepSec(1); continue; /* TODO: Remove this dummy line.*/\n\n'
         text += tab*2 + '/* Send the message.*/\n'
-        text += tab*2 + 'UROS_MSG_SEND_LENGTH(%s, %s);\n' % (msgref, msgtype.cname)
-        text += tab*2 + 'UROS_MSG_SEND_BODY(%s, %s);\n\n' % (msgref, msgtype.cname)
+        text += tab*2 + 'UROS_MSG_FRAME_LENGTH(%s, %s);\n' % (msgref, msgtype.cname)
+        text += tab*2 + 'UROS_MSG_SEND_FRAME(%s, %s);\n\n' % (msgref, msgtype.cname)
         text += tab*2 + '/* Dispose the contents of the message.*/\n'
         text += tab*2 + 'clean_%s(%s);\n' % (msgtype.cname, msgref)
         text += tab + '}\n'
@@ -1639,9 +1982,49 @@ class CodeGen:
         return text
     
     def gen_subtopic_sig(self, name):
+        if str2bool(self.opts['subFrameHandlers']):
+            return self.gen_subframe_sig(name)
         return 'uros_err_t sub_tpc%s(UrosTcpRosStatus *tcpstp)' % mangled_name(name)
     
+    def gen_subframe_sig(self, name):
+        text =  'uros_err_t sub_frm%s(UrosTcpRosStatus *tcpstp,\n' % mangled_name(name)
+        text += ' ' * len('uros_err_t sub_frm%s(' % mangled_name(name))
+        text += 'const uint8_t *framep, size_t framelen)'
+        return text
+    
+    def gen_subframe_handler(self, name):
+        msgtype = self.msgTypes[self.subTopics[name]]
+        msgref = '&' + self.opts['msgVarBaseName']
+        
+        text = '/**\n'
+        text += ' * @brief   TCPROS <tt>%s</tt> subscribed topic frame handler.\n' % name
+        text += ' *\n'
+        text += ' * @param[in,out] tcpstp\n'
+        text += ' *          Pointer to a working @p UrosTcpRosStatus object.\n'
+        text += ' * @param[in] framep\n'
+        text += ' *          Pointer to the message frame body.\n'
+        text += ' * @param[in] framelen\n'
+        text += ' *          Length of the message frame body, in bytes.\n'
+        text += ' * @return\n'
+        text += ' *          Error code.\n'
+        text += ' */\n'
+        text += self.gen_subframe_sig(name) + ' {\n\n'
+        text += tab + '/* Message initialization.*/\n'
+        text += tab + 'UROS_FRM_INIT_S(%s);\n\n' % msgtype.cname
+        text += tab + '/* Decode the received frame.*/\n'
+        text += tab + 'UROS_MSG_DECODE_FRAME(%s, %s);\n\n' % (msgref, msgtype.cname)
+        text += tab + '/* TODO: Process the received message, without blocking.*/\n\n'
+        text += tab + 'tcpstp->err = UROS_OK;\n\n'
+        text += '_finally:\n'
+        text += tab + '/* Message deinitialization.*/\n'
+        text += tab + 'UROS_TPC_UNINIT_ARENA_S();\n'
+        text += tab + 'return tcpstp->err;\n'
+        text += '}'
+        return text
+    
     def gen_subtopic_handler(self, name):
+        if str2bool(self.opts['subFrameHandlers']):
+            return self.gen_subframe_handler(name)
         msgtype = self.msgTypes[self.subTopics[name]]
         onstack = str2bool(self.opts['msgOnStack'])
         if onstack:
@@ -1725,8 +2108,8 @@ class CodeGen:
         text += tab*2 + '/* TODO: Generate the contents of the response message.*/\n\n'
         text += tab*2 + '/* Send the response message.*/\n'
         text += tab*2 + 'UROS_SRV_SEND_OKBYTE_ERRSTR();\n'
-        text += tab*2 + 'UROS_MSG_SEND_LENGTH(%s, %s);\n' % (outref, srvtype.outtype.cname)
-        text += tab*2 + 'UROS_MSG_SEND_BODY(%s, %s);\n\n' % (outref, srvtype.outtype.cname)
+        text += tab*2 + 'UROS_MSG_FRAME_LENGTH(%s, %s);\n' % (outref, srvtype.outtype.cname)
+        text += tab*2 + 'UROS_MSG_SEND_FRAME(%s, %s);\n\n' % (outref, srvtype.outtype.cname)
         text += tab*2 + '/* Dispose the contents of the response message.*/\n'
         text += tab*2 + 'clean_%s(%s);\n' % (srvtype.outtype.cname, outref)
         text += tab + '} while (tcpstp->topicp->flags.persistent &&\n'
@@ -1773,8 +2156,8 @@ class CodeGen:
         text += tab + 'UROS_SRVCALL_INIT(%s,\n' % srvtype.intype.cname
         text += tab + '                  %s);\n\n' % srvtype.outtype.cname
         text += tab + '/* Send the request message.*/\n'
-        text += tab + 'UROS_MSG_SEND_LENGTH(%s, %s);\n' % (inref, srvtype.intype.cname)
-        text += tab + 'UROS_MSG_SEND_BODY(%s, %s);\n\n' % (inref, srvtype.intype.cname)
+        text += tab + 'UROS_MSG_FRAME_LENGTH(%s, %s);\n' % (inref, srvtype.intype.cname)
+        text += tab + 'UROS_MSG_SEND_FRAME(%s, %s);\n\n' % (inref, srvtype.intype.cname)
         text += tab + '/* TODO: Dispose the contents of the request message.*/\n\n'
         text += tab + '/* Receive the response message.*/\n'
         text += tab + 'UROS_SRV_RECV_OKBYTE();\n'
@@ -1850,10 +2233,16 @@ class CodeGen:
             for name in sorted(self.subTopics):
                 rostype = self.subTopics[name];
                 text += tab + '/* %s */\n' % name
-                text += tab + 'urosNodeSubscribeTopicSZ(\n'
+                if str2bool(self.opts['subFrameHandlers']):
+                    text += tab + 'urosNodeSubscribeTopicFramesSZ(\n'
+                else:
+                    text += tab + 'urosNodeSubscribeTopicSZ(\n'
                 text += tab*2 + '"%s",\n' % name
                 text += tab*2 + '"%s",\n' % rostype
-                text += tab*2 + '(uros_proc_f)sub_tpc%s,\n' % mangled_name(name)
+                if str2bool(self.opts['subFrameHandlers']):
+                    text += tab*2 + 'sub_frm%s,\n' % mangled_name(name)
+                else:
+                    text += tab*2 + '(uros_proc_f)sub_tpc%s,\n' % mangled_name(name)
                 text += tab*2 + 'uros_nulltopicflags\n'
                 text += tab + ');\n\n'
             text = text[:-1]